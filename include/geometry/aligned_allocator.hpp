@@ -0,0 +1,139 @@
+/**
+ * @file geometry/aligned_allocator.hpp
+ * @author Jeong Seong In (0806jsi@gmail.com)
+ * @brief Allocator for over-aligned buffers used by batch containers
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2023 Jeong0806, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#ifndef Jeong0806_GEOMETRY_ALIGNED_ALLOCATOR_HPP_
+#define Jeong0806_GEOMETRY_ALIGNED_ALLOCATOR_HPP_
+
+#include <cstddef>
+#include <limits>
+#include <memory_resource>
+#include <new>
+
+namespace Jeong0806::geometry {
+/**
+ * @brief Default alignment of batch buffers, wide enough for a 512-bit lane
+ */
+constexpr std::size_t kSimdAlignment{64U};
+
+/**
+ * @brief Allocator returning memory aligned to Alignment bytes
+ * @details Memory comes from a std::pmr::memory_resource, the default resource
+ * when none is given. Like std::pmr::polymorphic_allocator, a copied container
+ * goes back to the default resource and assignment keeps the resource.
+ * @tparam T The value type
+ * @tparam Alignment The alignment in bytes, a power of two
+ */
+template <typename T, std::size_t Alignment = kSimdAlignment>
+class AlignedAllocator {
+ public:
+  static_assert((Alignment & (Alignment - 1U)) == 0U,
+                "Alignment must be a power of two");
+  static_assert(Alignment >= alignof(T),
+                "Alignment must not be weaker than the type alignment");
+
+  using value_type = T;
+
+  /**
+   * @brief Rebind the allocator to another value type
+   * @tparam U The other value type
+   */
+  template <typename U>
+  struct rebind {
+    using other = AlignedAllocator<U, Alignment>;
+  };
+
+  /**
+   * @brief Construct a new AlignedAllocator object on the default resource
+   */
+  AlignedAllocator() noexcept
+      : resource_(std::pmr::get_default_resource()) {}
+  /**
+   * @brief Construct a new AlignedAllocator object on a memory resource
+   * @param resource The memory resource, which must outlive the allocations
+   */
+  AlignedAllocator(std::pmr::memory_resource* resource) noexcept
+      : resource_(resource) {}
+  /**
+   * @brief Construct a new AlignedAllocator object from other value type
+   * @param other AlignedAllocator object of other value type
+   */
+  template <typename U>
+  AlignedAllocator(const AlignedAllocator<U, Alignment>& other) noexcept
+      : resource_(other.resource()) {}
+
+  /**
+   * @brief Allocate aligned memory for count objects
+   * @param count The number of objects
+   * @return T* Pointer to the allocated memory
+   * @throws bad_array_new_length If the byte size overflows
+   */
+  [[nodiscard]] auto allocate(std::size_t count) -> T* {
+    if (count > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+      throw std::bad_array_new_length();
+    }
+    return static_cast<T*>(resource_->allocate(count * sizeof(T), Alignment));
+  }
+  /**
+   * @brief Release memory returned by allocate
+   * @param pointer Pointer returned by allocate
+   * @param count The number of objects passed to allocate
+   */
+  auto deallocate(T* pointer, std::size_t count) noexcept -> void {
+    resource_->deallocate(pointer, count * sizeof(T), Alignment);
+  }
+
+  /**
+   * @brief Get the memory resource
+   * @return std::pmr::memory_resource* The memory resource
+   */
+  [[nodiscard]] auto resource() const noexcept -> std::pmr::memory_resource* {
+    return resource_;
+  }
+  /**
+   * @brief Get the allocator of a copied container
+   * @return AlignedAllocator Allocator on the default resource
+   */
+  [[nodiscard]] auto select_on_container_copy_construction() const noexcept
+      -> AlignedAllocator {
+    return AlignedAllocator();
+  }
+
+  /**
+   * @brief Compare with other allocator for equality
+   * @param other The other allocator
+   * @return true If memory of one can be released by the other
+   * @return false If not
+   */
+  template <typename U>
+  auto operator==(const AlignedAllocator<U, Alignment>& other) const noexcept
+      -> bool {
+    return *resource_ == *other.resource();
+  }
+  /**
+   * @brief Compare with other allocator for inequality
+   * @param other The other allocator
+   * @return true If memory of one cannot be released by the other
+   * @return false If it can
+   */
+  template <typename U>
+  auto operator!=(const AlignedAllocator<U, Alignment>& other) const noexcept
+      -> bool {
+    return !(*this == other);
+  }
+
+ protected:
+ private:
+  std::pmr::memory_resource* resource_;  ///< Source of the memory
+};
+}  // namespace Jeong0806::geometry
+
+#endif  // Jeong0806_GEOMETRY_ALIGNED_ALLOCATOR_HPP_
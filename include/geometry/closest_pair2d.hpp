@@ -0,0 +1,103 @@
+/**
+ * @file geometry/closest_pair2d.hpp
+ * @author Jeong Seong In (0806jsi@gmail.com)
+ * @brief Closest pair query class declaration over 2-dimension points
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2023 Jeong0806, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#ifndef Jeong0806_GEOMETRY_CLOSEST_PAIR_2D_HPP_
+#define Jeong0806_GEOMETRY_CLOSEST_PAIR_2D_HPP_
+
+#include <cstddef>
+#include <vector>
+
+#include "geometry/neighbor.hpp"
+#include "geometry/parallel.hpp"
+#include "geometry/point2d.hpp"
+
+namespace Jeong0806::geometry {
+/**
+ * @brief Closest pair within one point set and between two point sets
+ * @details Find sorts by x in parallel, solves contiguous x blocks by divide
+ * and conquer on separate threads, then checks the strips around the block
+ * boundaries. FindBetween builds a KdTree2D over the rhs points and queries
+ * it with the lhs points across threads. Both take O(n log n) time, and ties
+ * resolve to the lowest first, then second, index.
+ */
+class ClosestPair2D {
+ public:
+  /**
+   * @brief Minimum number of points handled by one thread
+   */
+  static constexpr std::size_t kMinBlockSize{1U << 12U};
+
+  /**
+   * @brief Find the closest pair of contiguous points
+   * @param points Pointer to the first point
+   * @param count The number of points
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param executor The executor running the threads
+   * @return NeighborPair The pair, first is the lower index
+   * @throws invalid_argument If count is less than two
+   * @throws length_error If count does not fit in 32 bits
+   */
+  [[nodiscard]] static auto Find(const Point2D* points, std::size_t count,
+                                 std::size_t thread_count = 0,
+                                 Executor* executor = GetDefaultExecutor())
+      -> NeighborPair;
+  /**
+   * @brief Find the closest pair of points
+   * @param points The points
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param executor The executor running the threads
+   * @return NeighborPair The pair, first is the lower index
+   * @throws invalid_argument If there are less than two points
+   * @throws length_error If there are more points than fit in 32 bits
+   */
+  [[nodiscard]] static auto Find(const std::vector<Point2D>& points,
+                                 std::size_t thread_count = 0,
+                                 Executor* executor = GetDefaultExecutor())
+      -> NeighborPair;
+
+  /**
+   * @brief Find the closest pair of an lhs and an rhs point
+   * @param lhs Pointer to the first lhs point
+   * @param lhs_count The number of lhs points
+   * @param rhs Pointer to the first rhs point
+   * @param rhs_count The number of rhs points
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param executor The executor running the threads
+   * @return NeighborPair The pair, first indexes lhs and second indexes rhs
+   * @throws invalid_argument If lhs or rhs is empty
+   * @throws length_error If rhs_count does not fit in 32 bits
+   */
+  [[nodiscard]] static auto FindBetween(
+      const Point2D* lhs, std::size_t lhs_count, const Point2D* rhs,
+      std::size_t rhs_count, std::size_t thread_count = 0,
+      Executor* executor = GetDefaultExecutor()) -> NeighborPair;
+  /**
+   * @brief Find the closest pair of an lhs and an rhs point
+   * @param lhs The lhs points
+   * @param rhs The rhs points
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param executor The executor running the threads
+   * @return NeighborPair The pair, first indexes lhs and second indexes rhs
+   * @throws invalid_argument If lhs or rhs is empty
+   * @throws length_error If there are more rhs points than fit in 32 bits
+   */
+  [[nodiscard]] static auto FindBetween(
+      const std::vector<Point2D>& lhs, const std::vector<Point2D>& rhs,
+      std::size_t thread_count = 0, Executor* executor = GetDefaultExecutor())
+      -> NeighborPair;
+
+ protected:
+ private:
+};
+}  // namespace Jeong0806::geometry
+
+#endif  // Jeong0806_GEOMETRY_CLOSEST_PAIR_2D_HPP_
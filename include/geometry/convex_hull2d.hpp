@@ -0,0 +1,119 @@
+/**
+ * @file geometry/convex_hull2d.hpp
+ * @author Jeong Seong In (0806jsi@gmail.com)
+ * @brief Parallel convex hull class declaration over 2-dimension points
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2023 Jeong0806, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#ifndef Jeong0806_GEOMETRY_CONVEX_HULL_2D_HPP_
+#define Jeong0806_GEOMETRY_CONVEX_HULL_2D_HPP_
+
+#include <cstddef>
+#include <vector>
+
+#include "geometry/parallel.hpp"
+#include "geometry/point2d.hpp"
+#include "geometry/point_cloud2d.hpp"
+
+namespace Jeong0806::geometry {
+/**
+ * @brief Convex hull of Point2D arrays or point clouds
+ * @details Points strictly inside the octagon of the eight axis and diagonal
+ * extremes are dropped first (Akl-Toussaint), the survivors are sorted in
+ * parallel, and the monotone chain hulls of contiguous sorted blocks are
+ * merged by one more monotone chain over their vertices. The hull is listed
+ * counter-clockwise from the lowest x, then lowest y, point without collinear
+ * or duplicate vertices; duplicates resolve to the lowest index. Coordinates
+ * must be finite.
+ */
+class ConvexHull2D {
+ public:
+  /**
+   * @brief Minimum number of points handled by one thread
+   */
+  static constexpr std::size_t kMinBlockSize{1U << 12U};
+
+  /**
+   * @brief Compute hull vertex indices of contiguous points
+   * @param points Pointer to the first point
+   * @param count The number of points
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param executor The executor running the threads
+   * @return std::vector<std::size_t> Input indices of the hull vertices
+   * @throws length_error If count does not fit in 32 bits
+   */
+  [[nodiscard]] static auto ComputeIndices(
+      const Point2D* points, std::size_t count, std::size_t thread_count = 0,
+      Executor* executor = GetDefaultExecutor()) -> std::vector<std::size_t>;
+  /**
+   * @brief Compute hull vertex indices of points
+   * @param points The points
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param executor The executor running the threads
+   * @return std::vector<std::size_t> Input indices of the hull vertices
+   * @throws length_error If there are more points than fit in 32 bits
+   */
+  [[nodiscard]] static auto ComputeIndices(
+      const std::vector<Point2D>& points, std::size_t thread_count = 0,
+      Executor* executor = GetDefaultExecutor()) -> std::vector<std::size_t>;
+  /**
+   * @brief Compute hull vertex indices of a point cloud
+   * @param points The point cloud
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param executor The executor running the threads
+   * @return std::vector<std::size_t> Input indices of the hull vertices
+   * @throws length_error If there are more points than fit in 32 bits
+   */
+  [[nodiscard]] static auto ComputeIndices(
+      const PointCloud2D& points, std::size_t thread_count = 0,
+      Executor* executor = GetDefaultExecutor()) -> std::vector<std::size_t>;
+
+  /**
+   * @brief Compute hull vertices of contiguous points
+   * @param points Pointer to the first point
+   * @param count The number of points
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param executor The executor running the threads
+   * @return std::vector<Point2D> The hull vertices
+   * @throws length_error If count does not fit in 32 bits
+   */
+  [[nodiscard]] static auto Compute(const Point2D* points, std::size_t count,
+                                    std::size_t thread_count = 0,
+                                    Executor* executor = GetDefaultExecutor())
+      -> std::vector<Point2D>;
+  /**
+   * @brief Compute hull vertices of points
+   * @param points The points
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param executor The executor running the threads
+   * @return std::vector<Point2D> The hull vertices
+   * @throws length_error If there are more points than fit in 32 bits
+   */
+  [[nodiscard]] static auto Compute(const std::vector<Point2D>& points,
+                                    std::size_t thread_count = 0,
+                                    Executor* executor = GetDefaultExecutor())
+      -> std::vector<Point2D>;
+  /**
+   * @brief Compute hull vertices of a point cloud
+   * @param points The point cloud
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param executor The executor running the threads
+   * @return PointCloud2D The hull vertices
+   * @throws length_error If there are more points than fit in 32 bits
+   */
+  [[nodiscard]] static auto Compute(const PointCloud2D& points,
+                                    std::size_t thread_count = 0,
+                                    Executor* executor = GetDefaultExecutor())
+      -> PointCloud2D;
+
+ protected:
+ private:
+};
+}  // namespace Jeong0806::geometry
+
+#endif  // Jeong0806_GEOMETRY_CONVEX_HULL_2D_HPP_
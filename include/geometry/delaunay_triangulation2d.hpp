@@ -0,0 +1,319 @@
+/**
+ * @file geometry/delaunay_triangulation2d.hpp
+ * @author Jeong Seong In (0806jsi@gmail.com)
+ * @brief Delaunay triangulation and Voronoi cell class declaration
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2023 Jeong0806, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#ifndef Jeong0806_GEOMETRY_DELAUNAY_TRIANGULATION_2D_HPP_
+#define Jeong0806_GEOMETRY_DELAUNAY_TRIANGULATION_2D_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory_resource>
+#include <vector>
+
+#include "geometry/morton2d.hpp"
+#include "geometry/neighbor.hpp"
+#include "geometry/parallel.hpp"
+#include "geometry/point2d.hpp"
+#include "geometry/point_cloud2d.hpp"
+
+namespace Jeong0806::geometry {
+/**
+ * @brief Delaunay triangulation of point sites with Voronoi cells and
+ * nearest-site queries
+ * @details Sites are inserted one by one in Hilbert curve order, so each
+ * point location walks only a few triangles from the previous insertion,
+ * and the Delaunay property is restored by edge flips. The hull is closed
+ * by ghost triangles sharing a vertex at infinity while building, so sites
+ * outside the current hull need no special case. Every decision goes
+ * through Predicates2D, which keeps the result consistent for degenerate
+ * input such as grids and collinear or cocircular sites.
+ *
+ * The result is a half-edge structure in flat arrays. Half-edge e starts at
+ * site GetTriangles()[e], belongs to triangle e / 3 and is followed by
+ * e / 3 * 3 + (e + 1) % 3 counter-clockwise, and GetHalfedges()[e] is the
+ * opposite half-edge or kInvalid on the hull. The Delaunay neighbors of
+ * every site are kept in one more flat array for walking queries.
+ *
+ * Sites are stored in curve order, so a walk touches nearby memory, and
+ * nearest-site queries walk the neighbor graph from a nearby site, found
+ * by binary search among every kSeedStride-th site along the curve.
+ *
+ * Coincident sites are triangulated once, the first of them in input order
+ * becoming the vertex. When all sites are collinear there is no triangle,
+ * and consecutive sites along the line are neighbors. The arrays and the
+ * build buffers are allocated from a memory resource, the default resource
+ * unless one is given.
+ */
+class DelaunayTriangulation2D {
+ public:
+  /**
+   * @brief Marks a hull half-edge without opposite half-edge
+   */
+  static constexpr uint32_t kInvalid{std::numeric_limits<uint32_t>::max()};
+  /**
+   * @brief Number of sites along the Hilbert curve per walk seed
+   */
+  static constexpr uint32_t kSeedStride{16U};
+
+  /**
+   * @brief Construct a new empty DelaunayTriangulation2D object
+   */
+  DelaunayTriangulation2D() = default;
+  /**
+   * @brief Construct a new DelaunayTriangulation2D object from contiguous
+   * points
+   * @param points Pointer to the first site
+   * @param count The number of sites
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param resource The memory resource of the arrays
+   * @param executor The executor running the threads
+   * @throws invalid_argument If a coordinate is not finite
+   * @throws length_error If the half-edges of count sites do not fit in 32
+   * bits
+   */
+  DelaunayTriangulation2D(
+      const Point2D* points, std::size_t count, std::size_t thread_count = 0,
+      std::pmr::memory_resource* resource = std::pmr::get_default_resource(),
+      Executor* executor = GetDefaultExecutor());
+  /**
+   * @brief Construct a new DelaunayTriangulation2D object from points
+   * @param points Point2D objects, sites index into this vector
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param resource The memory resource of the arrays
+   * @param executor The executor running the threads
+   * @throws invalid_argument If a coordinate is not finite
+   * @throws length_error If the half-edges of the sites do not fit in 32 bits
+   */
+  explicit DelaunayTriangulation2D(
+      const std::vector<Point2D>& points, std::size_t thread_count = 0,
+      std::pmr::memory_resource* resource = std::pmr::get_default_resource(),
+      Executor* executor = GetDefaultExecutor());
+  /**
+   * @brief Construct a new DelaunayTriangulation2D object from a point cloud
+   * @param points The sites
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param resource The memory resource of the arrays
+   * @param executor The executor running the threads
+   * @throws invalid_argument If a coordinate is not finite
+   * @throws length_error If the half-edges of the sites do not fit in 32 bits
+   */
+  explicit DelaunayTriangulation2D(
+      const PointCloud2D& points, std::size_t thread_count = 0,
+      std::pmr::memory_resource* resource = std::pmr::get_default_resource(),
+      Executor* executor = GetDefaultExecutor());
+
+  /**
+   * @brief Get the number of sites
+   * @return std::size_t The number of sites, coincident ones included
+   */
+  [[nodiscard]] auto Size() const -> std::size_t;
+  /**
+   * @brief Check if there is no site
+   * @return true If empty
+   * @return false If not empty
+   */
+  [[nodiscard]] auto Empty() const -> bool;
+  /**
+   * @brief Get the memory resource of the arrays
+   * @return std::pmr::memory_resource* The memory resource
+   */
+  [[nodiscard]] auto GetResource() const -> std::pmr::memory_resource*;
+  /**
+   * @brief Get a site
+   * @param site The site index
+   * @return const Point2D& The site
+   * @throws out_of_range If site is not below Size()
+   */
+  [[nodiscard]] auto GetSite(std::size_t site) const -> const Point2D&;
+  /**
+   * @brief Get the site triangulated in place of a site
+   * @param site The site index
+   * @return std::size_t The first site in input order at the same position
+   * @throws out_of_range If site is not below Size()
+   */
+  [[nodiscard]] auto GetVertex(std::size_t site) const -> std::size_t;
+
+  /**
+   * @brief Get the number of triangles
+   * @return std::size_t The number of triangles
+   */
+  [[nodiscard]] auto GetTriangleCount() const -> std::size_t;
+  /**
+   * @brief Get the start site of every half-edge
+   * @return const std::pmr::vector<uint32_t>& Three sites per triangle in
+   * counter-clockwise order
+   */
+  [[nodiscard]] auto GetTriangles() const
+      -> const std::pmr::vector<uint32_t>&;
+  /**
+   * @brief Get the opposite of every half-edge
+   * @return const std::pmr::vector<uint32_t>& The opposite half-edge,
+   * kInvalid on the hull
+   */
+  [[nodiscard]] auto GetHalfedges() const
+      -> const std::pmr::vector<uint32_t>&;
+  /**
+   * @brief Get the convex hull
+   * @return const std::pmr::vector<uint32_t>& Hull sites in counter-clockwise
+   * order, including sites on hull edges, empty without triangles
+   */
+  [[nodiscard]] auto GetHull() const -> const std::pmr::vector<uint32_t>&;
+
+  /**
+   * @brief Get the number of Delaunay neighbors of a site
+   * @param site The site index
+   * @return std::size_t The number of neighbors, zero for sites coincident
+   * with an earlier one
+   * @throws out_of_range If site is not below Size()
+   */
+  [[nodiscard]] auto GetNeighborCount(std::size_t site) const -> std::size_t;
+  /**
+   * @brief Get the Delaunay neighbors of a site
+   * @param site The site index
+   * @return std::vector<uint32_t> The neighbor site indices
+   * @throws out_of_range If site is not below Size()
+   */
+  [[nodiscard]] auto GetNeighbors(std::size_t site) const
+      -> std::vector<uint32_t>;
+
+  /**
+   * @brief Find the nearest site by walking from the seed of the query
+   * @param query The query point
+   * @return Neighbor The nearest site, the lowest index on ties
+   * @throws out_of_range If the triangulation is empty
+   */
+  [[nodiscard]] auto Nearest(const Point2D& query) const -> Neighbor;
+  /**
+   * @brief Find the nearest site by walking from a given site
+   * @details The walk moves to a closer neighbor until there is none, which
+   * ends at the nearest site on a Delaunay triangulation, so it takes about
+   * as many steps as sites lie between start and query.
+   * @param query The query point
+   * @param start The site the walk starts from, ideally near the query
+   * @return Neighbor The nearest site, the lowest index on ties
+   * @throws out_of_range If the triangulation is empty or start is not below
+   * Size()
+   */
+  [[nodiscard]] auto Nearest(const Point2D& query, std::size_t start) const
+      -> Neighbor;
+  /**
+   * @brief Find the nearest site of every query across threads
+   * @details Each query walks from its seed or from the result of the
+   * previous query of its thread, whichever is closer, so spatially sorted
+   * queries take the fewest steps.
+   * @param queries The query points
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param executor The executor running the threads
+   * @return std::vector<Neighbor> The nearest site of each query
+   * @throws out_of_range If the triangulation is empty and queries is not
+   */
+  [[nodiscard]] auto Nearest(const std::vector<Point2D>& queries,
+                             std::size_t thread_count = 0,
+                             Executor* executor = GetDefaultExecutor()) const
+      -> std::vector<Neighbor>;
+
+  /**
+   * @brief Get the Voronoi cell of a site within a box
+   * @details The cell is the box cut by the bisector of the site and each of
+   * its Delaunay neighbors, so cells of hull sites are bounded too.
+   * @param site The site index
+   * @param min The lower corner of the box
+   * @param max The upper corner of the box
+   * @return std::vector<Point2D> Cell corners in counter-clockwise order,
+   * empty if the cell misses the box or site coincides with an earlier site
+   * @throws out_of_range If site is not below Size()
+   * @throws invalid_argument If a corner is not finite or max is below min
+   */
+  [[nodiscard]] auto ComputeVoronoiCell(std::size_t site, const Point2D& min,
+                                        const Point2D& max) const
+      -> std::vector<Point2D>;
+  /**
+   * @brief Get the Voronoi cells of all sites within a box across threads
+   * @param min The lower corner of the box
+   * @param max The upper corner of the box
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param executor The executor running the threads
+   * @return std::vector<std::vector<Point2D>> The cell of each site in index
+   * order as of ComputeVoronoiCell
+   * @throws invalid_argument If a corner is not finite or max is below min
+   */
+  [[nodiscard]] auto ComputeVoronoiCells(
+      const Point2D& min, const Point2D& max, std::size_t thread_count = 0,
+      Executor* executor = GetDefaultExecutor()) const
+      -> std::vector<std::vector<Point2D>>;
+
+ protected:
+ private:
+  /**
+   * @brief Throw if site is not a valid site
+   * @param site The site index
+   * @throws out_of_range If site is not below Size()
+   */
+  auto CheckSite(std::size_t site) const -> void;
+  /**
+   * @brief Sort and triangulate the sites
+   * @param points Pointer to the first site
+   * @param count The number of sites
+   * @param thread_count The number of threads sorting the sites
+   * @param executor The executor running the threads
+   * @throws invalid_argument If a coordinate is not finite
+   * @throws length_error If the half-edges of count sites do not fit in 32
+   * bits
+   */
+  auto Build(const Point2D* points, std::size_t count,
+             std::size_t thread_count, Executor* executor) -> void;
+  /**
+   * @brief Link consecutive sites along the line when all are collinear
+   */
+  auto BuildChain() -> void;
+  /**
+   * @brief Fill the neighbor arrays from the triangles
+   */
+  auto BuildNeighbors() -> void;
+  /**
+   * @brief Get the seed site of a query
+   * @param query The query point
+   * @return uint32_t The position of a triangulated site near the query
+   */
+  auto FindSeed(const Point2D& query) const -> uint32_t;
+  /**
+   * @brief Find the nearest site by walking the neighbor graph
+   * @param query The query point
+   * @param start The position of the triangulated site to start from
+   * @return Neighbor The nearest site, the lowest index on ties
+   */
+  auto Walk(const Point2D& query, uint32_t start) const -> Neighbor;
+  /**
+   * @brief Get the cell of a site within a box that is already checked
+   * @param position The position of the site along the curve
+   * @param min The lower corner of the box
+   * @param max The upper corner of the box
+   * @return std::vector<Point2D> Cell corners in counter-clockwise order
+   */
+  auto ClipCell(std::size_t position, const Point2D& min,
+                const Point2D& max) const -> std::vector<Point2D>;
+
+  std::pmr::vector<Point2D> sites_;        ///< Sites in curve order
+  std::pmr::vector<uint32_t> order_;       ///< Site index at each position
+  std::pmr::vector<uint32_t> ranks_;       ///< Position of each site index
+  std::pmr::vector<uint32_t> vertices_;    ///< Triangulated position of each
+  std::pmr::vector<uint32_t> triangles_;   ///< Start site of each half-edge
+  std::pmr::vector<uint32_t> halfedges_;   ///< Opposite of each half-edge
+  std::pmr::vector<uint32_t> hull_;        ///< Hull sites counter-clockwise
+  std::pmr::vector<uint32_t> offsets_;     ///< First neighbor of each position
+  std::pmr::vector<uint32_t> neighbors_;   ///< Neighbor positions of all sites
+  MortonGrid2D grid_;                      ///< Grid of the Hilbert codes
+  std::pmr::vector<uint64_t> seed_codes_;  ///< Code of every walk seed, sorted
+};
+}  // namespace Jeong0806::geometry
+
+#endif  // Jeong0806_GEOMETRY_DELAUNAY_TRIANGULATION_2D_HPP_
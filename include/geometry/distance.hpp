@@ -14,9 +14,17 @@
 #define Jeong0806_GEOMETRY_DISTANCE_HPP_
 
 #include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+#include "geometry/instrumentation.hpp"
+
 namespace Jeong0806::geometry {
 /**
  * @brief Distance class for abstract distance
+ * @details Distance is a trivially copyable, standard-layout value type holding
+ * a single nanometer count, and every conversion is constexpr.
  */
 class Distance {
  public:
@@ -31,6 +39,14 @@ class Distance {
     kMicrometer = 4,
     kNanometer = 5
   };
+  /**
+   * @brief The enum class for handling integer overflow in arithmetic
+   */
+  enum class OverflowPolicy {
+    kChecked = 0,     ///< Throw overflow_error
+    kSaturating = 1,  ///< Clamp to the nearest representable distance
+    kWrapping = 2     ///< Wrap around in two's complement
+  };
 
   /**
    * @brief Construct a new Distance object
@@ -41,7 +57,8 @@ class Distance {
    * @param value
    * @param type
    */
-  Distance(double value, DistanceType type = DistanceType::kMeter);
+  constexpr Distance(double value,
+                     DistanceType type = DistanceType::kMeter);
   /**
    * @brief Copy construct a new Distance object with other Distance object
    * @param other Distance object
@@ -55,7 +72,7 @@ class Distance {
   /**
    * @brief Destroy the Distance object
    */
-  virtual ~Distance() = default;
+  ~Distance() = default;
 
   /**
    * @brief Copy assignment operator
@@ -75,13 +92,134 @@ class Distance {
    * @param type The distance type
    * @return double The distance value
    */
-  [[nodiscard]] auto GetValue(const DistanceType& type) const -> double;
+  [[nodiscard]] constexpr auto GetValue(const DistanceType& type) const -> double;
   /**
    * @brief Set the distance value for distance type
    * @param value The distance value
    * @param type The distance type
    */
-  auto SetValue(double value, const DistanceType& type) -> void;
+  constexpr auto SetValue(double value, const DistanceType& type) -> void;
+  /**
+   * @brief Get the distance value for a distance type fixed at compile time
+   * @tparam kType The distance type
+   * @return double The distance value
+   */
+  template <DistanceType kType>
+  [[nodiscard]] constexpr auto GetValue() const -> double;
+  /**
+   * @brief Create a Distance object from a value of a distance type fixed at
+   * compile time
+   * @tparam kType The distance type
+   * @param value The distance value
+   * @return Distance The Distance object
+   */
+  template <DistanceType kType>
+  [[nodiscard]] static constexpr auto FromValue(double value) -> Distance;
+  /**
+   * @brief Get the number of nanometers in one unit of distance type
+   * @param type The distance type
+   * @return int64_t The nanometer count
+   */
+  [[nodiscard]] static constexpr auto GetNanometerScale(DistanceType type)
+      -> int64_t;
+  /**
+   * @brief Get the factor scaling a nanometer value to distance type
+   * @param type The distance type
+   * @return double The scale factor, so GetValue(type) is the nanometer value
+   * times this factor
+   */
+  [[nodiscard]] static constexpr auto GetUnitScale(DistanceType type)
+      -> double;
+  /**
+   * @brief Get the exact nanometer count
+   * @return int64_t The nanometer count
+   */
+  [[nodiscard]] constexpr auto GetNanometer() const -> int64_t;
+  /**
+   * @brief Create a Distance object from an exact nanometer count
+   * @param nanometer The nanometer count
+   * @return Distance The Distance object
+   */
+  [[nodiscard]] static constexpr auto FromNanometer(int64_t nanometer)
+      -> Distance;
+
+  /**
+   * @brief Add other distance object in the integer domain
+   * @tparam kPolicy The overflow policy
+   * @param other The other distance object
+   * @return Distance The result of addition
+   * @throws overflow_error If kPolicy is kChecked and the result overflows
+   */
+  template <OverflowPolicy kPolicy>
+  [[nodiscard]] constexpr auto Add(const Distance& other) const -> Distance;
+  /**
+   * @brief Subtract other distance object in the integer domain
+   * @tparam kPolicy The overflow policy
+   * @param other The other distance object
+   * @return Distance The result of subtraction
+   * @throws overflow_error If kPolicy is kChecked and the result overflows
+   */
+  template <OverflowPolicy kPolicy>
+  [[nodiscard]] constexpr auto Subtract(const Distance& other) const
+      -> Distance;
+  /**
+   * @brief Multiply by an integer scale in the integer domain
+   * @tparam kPolicy The overflow policy
+   * @param scale The value for multiplication
+   * @return Distance The result of multiplication
+   * @throws overflow_error If kPolicy is kChecked and the result overflows
+   */
+  template <OverflowPolicy kPolicy>
+  [[nodiscard]] constexpr auto Multiply(int64_t scale) const -> Distance;
+  /**
+   * @brief Divide by an integer divisor, truncating toward zero
+   * @tparam kPolicy The overflow policy
+   * @param divisor The value for division
+   * @return Distance The result of division
+   * @throws invalid_argument If divisor is zero
+   * @throws overflow_error If kPolicy is kChecked and the result overflows
+   */
+  template <OverflowPolicy kPolicy>
+  [[nodiscard]] constexpr auto Divide(int64_t divisor) const -> Distance;
+  /**
+   * @brief Add other distance object in the integer domain
+   * @param other The other distance object
+   * @param policy The overflow policy
+   * @return Distance The result of addition
+   * @throws overflow_error If policy is kChecked and the result overflows
+   */
+  [[nodiscard]] constexpr auto Add(const Distance& other,
+                                   OverflowPolicy policy) const -> Distance;
+  /**
+   * @brief Subtract other distance object in the integer domain
+   * @param other The other distance object
+   * @param policy The overflow policy
+   * @return Distance The result of subtraction
+   * @throws overflow_error If policy is kChecked and the result overflows
+   */
+  [[nodiscard]] constexpr auto Subtract(const Distance& other,
+                                        OverflowPolicy policy) const
+      -> Distance;
+  /**
+   * @brief Multiply by an integer scale in the integer domain
+   * @param scale The value for multiplication
+   * @param policy The overflow policy
+   * @return Distance The result of multiplication
+   * @throws overflow_error If policy is kChecked and the result overflows
+   */
+  [[nodiscard]] constexpr auto Multiply(int64_t scale,
+                                        OverflowPolicy policy) const
+      -> Distance;
+  /**
+   * @brief Divide by an integer divisor, truncating toward zero
+   * @param divisor The value for division
+   * @param policy The overflow policy
+   * @return Distance The result of division
+   * @throws invalid_argument If divisor is zero
+   * @throws overflow_error If policy is kChecked and the result overflows
+   */
+  [[nodiscard]] constexpr auto Divide(int64_t divisor,
+                                      OverflowPolicy policy) const -> Distance;
 
   /**
    * @brief Compare with other distance object for equality
@@ -89,93 +227,444 @@ class Distance {
    * @return true If equal
    * @return false If not equal
    */
-  auto operator==(const Distance& other) const -> bool;
+  constexpr auto operator==(const Distance& other) const -> bool;
   /**
    * @brief Compare with other distance object for equality
    * @param other The other distance object
    * @return true If not equal
    * @return false If equal
    */
-  auto operator!=(const Distance& other) const -> bool;
+  constexpr auto operator!=(const Distance& other) const -> bool;
   /**
    * @brief Compare with other distance object for less
    * @param other The other distance object
    * @return true true If less
    * @return false false If bigger or equal
    */
-  auto operator<(const Distance& other) const -> bool;
+  constexpr auto operator<(const Distance& other) const -> bool;
   /**
    * @brief Compare with other distance object for less or equal
    * @param other The other distance object
    * @return true true true If less of eqaul
    * @return false false If bigger
    */
-  auto operator<=(const Distance& other) const -> bool;
+  constexpr auto operator<=(const Distance& other) const -> bool;
   /**
    * @brief Compare with other distance object for bigger
    * @param other The other distance object
    * @return true true If bigger
    * @return false false If less or equal
    */
-  auto operator>(const Distance& other) const -> bool;
+  constexpr auto operator>(const Distance& other) const -> bool;
   /**
    * @brief Compare with other distance object for bigger or equal
    * @param other The other distance object
    * @return true true If bigger or equal
    * @return false false If less
    */
-  auto operator>=(const Distance& other) const -> bool;
+  constexpr auto operator>=(const Distance& other) const -> bool;
 
   /**
-   * @brief Add other distance object
+   * @brief Add other distance object exactly
    * @param other The other distance object
    * @return Distance The result of addition
+   * @throws overflow_error If the result overflows
    */
-  auto operator+(const Distance& other) const -> Distance;
+  constexpr auto operator+(const Distance& other) const -> Distance;
   /**
-   * @brief Subtract other distance object
+   * @brief Subtract other distance object exactly
    * @param other The other distance object
    * @return Distance The result of subtraction
+   * @throws overflow_error If the result overflows
    */
-  auto operator-(const Distance& other) const -> Distance;
+  constexpr auto operator-(const Distance& other) const -> Distance;
   /**
-   * @brief Multiply by scale
+   * @brief Multiply by scale, truncating toward zero
    * @param scale The value for multiplication
    * @return Distance The result of multiplication
+   * @throws overflow_error If the result is not finite or overflows
    */
-  auto operator*(double scale) const -> Distance;
+  constexpr auto operator*(double scale) const -> Distance;
   /**
-   * @brief Divide by scale
+   * @brief Divide by scale, truncating toward zero
    * @param scale The value for division
    * @return Distance The result of division
+   * @throws invalid_argument If scale is zero
+   * @throws overflow_error If the result is not finite or overflows
    */
-  auto operator/(double scale) const -> Distance;
+  constexpr auto operator/(double scale) const -> Distance;
 
   /**
-   * @brief Add other distance object
+   * @brief Add other distance object exactly
    * @param other The other distance object
+   * @throws overflow_error If the result overflows
    */
-  auto operator+=(const Distance& other) -> void;
+  constexpr auto operator+=(const Distance& other) -> void;
   /**
-   * @brief Subtract other distance object
+   * @brief Subtract other distance object exactly
    * @param other The other distance object
+   * @throws overflow_error If the result overflows
    */
-  auto operator-=(const Distance& other) -> void;
+  constexpr auto operator-=(const Distance& other) -> void;
   /**
-   * @brief Multiply by scale
+   * @brief Multiply by scale, truncating toward zero
    * @param scale The value for multiplication
+   * @throws overflow_error If the result is not finite or overflows
    */
-  auto operator*=(double scale) -> void;
+  constexpr auto operator*=(double scale) -> void;
   /**
-   * @brief Divide by scale
+   * @brief Divide by scale, truncating toward zero
    * @param scale The value for division
+   * @throws invalid_argument If scale is zero
+   * @throws overflow_error If the result is not finite or overflows
    */
-  auto operator/=(double scale) -> void;
+  constexpr auto operator/=(double scale) -> void;
 
  protected:
  private:
+  /**
+   * @brief Scale the value of distance type to nanometer
+   * @param value The distance value
+   * @param type The distance type
+   * @return int64_t The nanometer value
+   */
+  static constexpr auto ScaleToNanometer(double value, DistanceType type)
+      -> int64_t;
+  /**
+   * @brief Apply the overflow policy to an integer result
+   * @tparam kPolicy The overflow policy
+   * @param overflow If the exact result does not fit in int64_t
+   * @param wrapped The two's complement wrapped result
+   * @param negative If the exact result is negative
+   * @return Distance The result under kPolicy
+   */
+  template <OverflowPolicy kPolicy>
+  static constexpr auto ApplyPolicy(bool overflow, int64_t wrapped,
+                                    bool negative) -> Distance;
+  /**
+   * @brief Truncate a scaled nanometer value under the checked policy
+   * @param nanometer The scaled nanometer value
+   * @return Distance The truncated distance
+   * @throws overflow_error If nanometer is not finite or overflows
+   */
+  static constexpr auto FromScaledNanometer(double nanometer) -> Distance;
+
+  static constexpr int64_t kKilometerToNanometer{
+      static_cast<int64_t>(1.0e+12)};
+  static constexpr int64_t kMeterToNanometer{static_cast<int64_t>(1.0e+9)};
+  static constexpr int64_t kCentimeterToNanometer{
+      static_cast<int64_t>(1.0e+7)};
+  static constexpr int64_t kMillimeterToNanometer{
+      static_cast<int64_t>(1.0e+6)};
+  static constexpr int64_t kMicrometerToNanometer{
+      static_cast<int64_t>(1.0e+3)};
+
+  static constexpr double kNonometerToKillometer{1.0e-12};
+  static constexpr double kNonometerToMeter{1.0e-9};
+  static constexpr double kNonometerToCentimeter{1.0e-7};
+  static constexpr double kNonometerToMillimeter{1.0e-6};
+  static constexpr double kNonometerToMicrometer{1.0e-3};
+
   int64_t nanometer_{0};
 };
+
+static_assert(std::is_trivially_copyable_v<Distance>,
+              "Distance must be trivially copyable");
+static_assert(std::is_standard_layout_v<Distance>,
+              "Distance must be standard layout");
+static_assert(sizeof(Distance) == sizeof(int64_t),
+              "Distance must not carry any member but its nanometer value");
+
+constexpr Distance::Distance(double value, DistanceType type)
+    : nanometer_(ScaleToNanometer(value, type)) {}
+
+constexpr auto Distance::GetNanometerScale(DistanceType type) -> int64_t {
+  int64_t result{0};
+  switch (type) {
+    case DistanceType::kKilometer:
+      result = kKilometerToNanometer;
+      break;
+    case DistanceType::kMeter:
+      result = kMeterToNanometer;
+      break;
+    case DistanceType::kCentimeter:
+      result = kCentimeterToNanometer;
+      break;
+    case DistanceType::kMillimeter:
+      result = kMillimeterToNanometer;
+      break;
+    case DistanceType::kMicrometer:
+      result = kMicrometerToNanometer;
+      break;
+    case DistanceType::kNanometer:
+      result = 1;
+      break;
+    default:
+      result = kMeterToNanometer;
+      break;
+  }
+  return result;
+}
+
+constexpr auto Distance::GetUnitScale(DistanceType type) -> double {
+  double result{1.0};
+  switch (type) {
+    case DistanceType::kKilometer:
+      result = kNonometerToKillometer;
+      break;
+    case DistanceType::kMeter:
+      result = kNonometerToMeter;
+      break;
+    case DistanceType::kCentimeter:
+      result = kNonometerToCentimeter;
+      break;
+    case DistanceType::kMillimeter:
+      result = kNonometerToMillimeter;
+      break;
+    case DistanceType::kMicrometer:
+      result = kNonometerToMicrometer;
+      break;
+    case DistanceType::kNanometer:
+      break;
+    default:
+      result = kNonometerToMeter;
+      break;
+  }
+  return result;
+}
+
+constexpr auto Distance::ScaleToNanometer(double value, DistanceType type)
+    -> int64_t {
+  Instrumentation::Add(Instrumentation::Counter::kDistanceConversions);
+  return static_cast<int64_t>(value * GetNanometerScale(type));
+}
+
+constexpr auto Distance::GetValue(const DistanceType& type) const -> double {
+  Instrumentation::Add(Instrumentation::Counter::kDistanceConversions);
+  return static_cast<double>(nanometer_) * GetUnitScale(type);
+}
+
+template <Distance::DistanceType kType>
+constexpr auto Distance::GetValue() const -> double {
+  Instrumentation::Add(Instrumentation::Counter::kDistanceConversions);
+  if constexpr (kType == DistanceType::kNanometer) {
+    return static_cast<double>(nanometer_);
+  } else {
+    constexpr double kScale{GetUnitScale(kType)};
+    return static_cast<double>(nanometer_) * kScale;
+  }
+}
+
+template <Distance::DistanceType kType>
+constexpr auto Distance::FromValue(double value) -> Distance {
+  Instrumentation::Add(Instrumentation::Counter::kDistanceConversions);
+  Distance distance;
+  if constexpr (kType == DistanceType::kNanometer) {
+    distance.nanometer_ = static_cast<int64_t>(value);
+  } else {
+    constexpr int64_t kScale{GetNanometerScale(kType)};
+    distance.nanometer_ = static_cast<int64_t>(value * kScale);
+  }
+  return distance;
+}
+
+constexpr auto Distance::SetValue(double value, const DistanceType& type)
+    -> void {
+  nanometer_ = ScaleToNanometer(value, type);
+}
+
+constexpr auto Distance::operator==(const Distance& other) const -> bool {
+  return (nanometer_ == other.nanometer_);
+}
+
+constexpr auto Distance::operator!=(const Distance& other) const -> bool {
+  return (nanometer_ != other.nanometer_);
+}
+
+constexpr auto Distance::operator<(const Distance& other) const -> bool {
+  return (nanometer_ < other.nanometer_);
+}
+
+constexpr auto Distance::operator<=(const Distance& other) const -> bool {
+  return (nanometer_ <= other.nanometer_);
+}
+
+constexpr auto Distance::operator>(const Distance& other) const -> bool {
+  return (nanometer_ > other.nanometer_);
+}
+
+constexpr auto Distance::operator>=(const Distance& other) const -> bool {
+  return (nanometer_ >= other.nanometer_);
+}
+
+constexpr auto Distance::operator+(const Distance& other) const -> Distance {
+  return Add<OverflowPolicy::kChecked>(other);
+}
+
+constexpr auto Distance::operator-(const Distance& other) const -> Distance {
+  return Subtract<OverflowPolicy::kChecked>(other);
+}
+
+constexpr auto Distance::operator*(double scale) const -> Distance {
+  return FromScaledNanometer(static_cast<double>(nanometer_) * scale);
+}
+
+constexpr auto Distance::operator/(double scale) const -> Distance {
+  if (scale == 0.0) {
+    throw std::invalid_argument("Distance divisor must not be zero");
+  }
+  return FromScaledNanometer(static_cast<double>(nanometer_) / scale);
+}
+
+constexpr auto Distance::operator+=(const Distance& other) -> void {
+  *this = Add<OverflowPolicy::kChecked>(other);
+}
+
+constexpr auto Distance::operator-=(const Distance& other) -> void {
+  *this = Subtract<OverflowPolicy::kChecked>(other);
+}
+
+constexpr auto Distance::operator*=(double scale) -> void {
+  *this = *this * scale;
+}
+
+constexpr auto Distance::operator/=(double scale) -> void {
+  *this = *this / scale;
+}
+
+constexpr auto Distance::GetNanometer() const -> int64_t { return nanometer_; }
+
+constexpr auto Distance::FromNanometer(int64_t nanometer) -> Distance {
+  Distance distance;
+  distance.nanometer_ = nanometer;
+  return distance;
+}
+
+template <Distance::OverflowPolicy kPolicy>
+constexpr auto Distance::ApplyPolicy(bool overflow, int64_t wrapped,
+                                     bool negative) -> Distance {
+  if constexpr (kPolicy == OverflowPolicy::kChecked) {
+    if (overflow) {
+      throw std::overflow_error("Distance arithmetic overflowed");
+    }
+  } else if constexpr (kPolicy == OverflowPolicy::kSaturating) {
+    if (overflow) {
+      return FromNanometer(negative ? std::numeric_limits<int64_t>::min()
+                                    : std::numeric_limits<int64_t>::max());
+    }
+  }
+  return FromNanometer(wrapped);
+}
+
+constexpr auto Distance::FromScaledNanometer(double nanometer) -> Distance {
+  // int64_t holds [-2^63, 2^63), and NaN fails both comparisons
+  constexpr double kBound{
+      -static_cast<double>(std::numeric_limits<int64_t>::min())};
+  if (!((nanometer >= -kBound) && (nanometer < kBound))) {
+    throw std::overflow_error("Distance arithmetic overflowed");
+  }
+  return FromNanometer(static_cast<int64_t>(nanometer));
+}
+
+template <Distance::OverflowPolicy kPolicy>
+constexpr auto Distance::Add(const Distance& other) const -> Distance {
+  const auto kWrapped =
+      static_cast<int64_t>(static_cast<uint64_t>(nanometer_) +
+                           static_cast<uint64_t>(other.nanometer_));
+  const auto kNegative = (nanometer_ < 0);
+  const auto kOverflow =
+      (kNegative == (other.nanometer_ < 0)) && (kNegative != (kWrapped < 0));
+  return ApplyPolicy<kPolicy>(kOverflow, kWrapped, kNegative);
+}
+
+template <Distance::OverflowPolicy kPolicy>
+constexpr auto Distance::Subtract(const Distance& other) const -> Distance {
+  const auto kWrapped =
+      static_cast<int64_t>(static_cast<uint64_t>(nanometer_) -
+                           static_cast<uint64_t>(other.nanometer_));
+  const auto kNegative = (nanometer_ < 0);
+  const auto kOverflow =
+      (kNegative != (other.nanometer_ < 0)) && (kNegative != (kWrapped < 0));
+  return ApplyPolicy<kPolicy>(kOverflow, kWrapped, kNegative);
+}
+
+template <Distance::OverflowPolicy kPolicy>
+constexpr auto Distance::Multiply(int64_t scale) const -> Distance {
+  const auto kWrapped = static_cast<int64_t>(static_cast<uint64_t>(nanometer_) *
+                                             static_cast<uint64_t>(scale));
+  const auto kNegative = (nanometer_ < 0) != (scale < 0);
+  // Compare magnitudes against the limit of the result sign, 2^63 if negative
+  const auto kLhs = (nanometer_ < 0) ? (0U - static_cast<uint64_t>(nanometer_))
+                                     : static_cast<uint64_t>(nanometer_);
+  const auto kRhs = (scale < 0) ? (0U - static_cast<uint64_t>(scale))
+                                : static_cast<uint64_t>(scale);
+  const auto kLimit =
+      static_cast<uint64_t>(std::numeric_limits<int64_t>::max()) +
+      (kNegative ? 1U : 0U);
+  const auto kOverflow = (kRhs != 0U) && (kLhs > kLimit / kRhs);
+  return ApplyPolicy<kPolicy>(kOverflow, kWrapped, kNegative);
+}
+
+template <Distance::OverflowPolicy kPolicy>
+constexpr auto Distance::Divide(int64_t divisor) const -> Distance {
+  if (divisor == 0) {
+    throw std::invalid_argument("Distance divisor must not be zero");
+  }
+  // The only overflow is the most negative value divided by -1
+  const auto kOverflow =
+      (nanometer_ == std::numeric_limits<int64_t>::min()) && (divisor == -1);
+  return ApplyPolicy<kPolicy>(kOverflow,
+                              kOverflow ? nanometer_ : (nanometer_ / divisor),
+                              false);
+}
+
+constexpr auto Distance::Add(const Distance& other,
+                             OverflowPolicy policy) const -> Distance {
+  switch (policy) {
+    case OverflowPolicy::kSaturating:
+      return Add<OverflowPolicy::kSaturating>(other);
+    case OverflowPolicy::kWrapping:
+      return Add<OverflowPolicy::kWrapping>(other);
+    default:
+      return Add<OverflowPolicy::kChecked>(other);
+  }
+}
+
+constexpr auto Distance::Subtract(const Distance& other,
+                                  OverflowPolicy policy) const -> Distance {
+  switch (policy) {
+    case OverflowPolicy::kSaturating:
+      return Subtract<OverflowPolicy::kSaturating>(other);
+    case OverflowPolicy::kWrapping:
+      return Subtract<OverflowPolicy::kWrapping>(other);
+    default:
+      return Subtract<OverflowPolicy::kChecked>(other);
+  }
+}
+
+constexpr auto Distance::Multiply(int64_t scale, OverflowPolicy policy) const
+    -> Distance {
+  switch (policy) {
+    case OverflowPolicy::kSaturating:
+      return Multiply<OverflowPolicy::kSaturating>(scale);
+    case OverflowPolicy::kWrapping:
+      return Multiply<OverflowPolicy::kWrapping>(scale);
+    default:
+      return Multiply<OverflowPolicy::kChecked>(scale);
+  }
+}
+
+constexpr auto Distance::Divide(int64_t divisor, OverflowPolicy policy) const
+    -> Distance {
+  switch (policy) {
+    case OverflowPolicy::kSaturating:
+      return Divide<OverflowPolicy::kSaturating>(divisor);
+    case OverflowPolicy::kWrapping:
+      return Divide<OverflowPolicy::kWrapping>(divisor);
+    default:
+      return Divide<OverflowPolicy::kChecked>(divisor);
+  }
+}
 }  // namespace Jeong0806::geometry
 
 #endif  // Jeong0806_GEOMETRY_DISTANCE_HPP_
@@ -0,0 +1,214 @@
+/**
+ * @file geometry/distance_accumulator.hpp
+ * @author Jeong Seong In (0806jsi@gmail.com)
+ * @brief Exact 128-bit distance accumulator class declaration
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2023 Jeong0806, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#ifndef Jeong0806_GEOMETRY_DISTANCE_ACCUMULATOR_HPP_
+#define Jeong0806_GEOMETRY_DISTANCE_ACCUMULATOR_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "geometry/distance.hpp"
+
+namespace Jeong0806::geometry {
+/**
+ * @brief Exact running sum of Distance objects
+ * @details The sum is a two's complement 128-bit nanometer count kept in two
+ * 64-bit words, so no realistic number of additions can overflow it, and it
+ * converts back to a Distance object under an overflow policy.
+ */
+class DistanceAccumulator {
+ public:
+  /**
+   * @brief Construct a new zero DistanceAccumulator object
+   */
+  DistanceAccumulator() = default;
+
+  /**
+   * @brief Add one Distance object
+   * @param distance The Distance object
+   */
+  constexpr auto Add(const Distance& distance) -> void;
+  /**
+   * @brief Add contiguous Distance objects
+   * @param distances Pointer to the first Distance object
+   * @param count The number of Distance objects
+   */
+  auto Add(const Distance* distances, std::size_t count) -> void;
+  /**
+   * @brief Add Distance objects
+   * @param distances The Distance objects
+   */
+  auto Add(const std::vector<Distance>& distances) -> void;
+  /**
+   * @brief Reset the sum to zero
+   */
+  constexpr auto Reset() -> void;
+
+  /**
+   * @brief Add one Distance object
+   * @param distance The Distance object
+   * @return DistanceAccumulator& Reference of this object
+   */
+  constexpr auto operator+=(const Distance& distance) -> DistanceAccumulator&;
+  /**
+   * @brief Merge the sum of other accumulator, such as a per-thread sum
+   * @param other The other accumulator
+   * @return DistanceAccumulator& Reference of this object
+   */
+  constexpr auto operator+=(const DistanceAccumulator& other)
+      -> DistanceAccumulator&;
+  /**
+   * @brief Compare with other accumulator for equality
+   * @param other The other accumulator
+   * @return true If the sums are equal
+   * @return false If the sums are not equal
+   */
+  constexpr auto operator==(const DistanceAccumulator& other) const -> bool;
+  /**
+   * @brief Compare with other accumulator for equality
+   * @param other The other accumulator
+   * @return true If the sums are not equal
+   * @return false If the sums are equal
+   */
+  constexpr auto operator!=(const DistanceAccumulator& other) const -> bool;
+
+  /**
+   * @brief Check if the sum fits in a Distance object
+   * @return true If representable
+   * @return false If not representable
+   */
+  [[nodiscard]] constexpr auto IsRepresentable() const -> bool;
+  /**
+   * @brief Convert the sum to a Distance object
+   * @param policy The overflow policy
+   * @return Distance The sum
+   * @throws overflow_error If policy is kChecked and the sum is not
+   * representable
+   */
+  [[nodiscard]] constexpr auto ToDistance(
+      Distance::OverflowPolicy policy = Distance::OverflowPolicy::kChecked)
+      const -> Distance;
+  /**
+   * @brief Get the sum for distance type
+   * @param type The distance type
+   * @return double The sum, equal to ToDistance().GetValue(type) if
+   * representable
+   */
+  [[nodiscard]] constexpr auto GetValue(Distance::DistanceType type) const
+      -> double;
+  /**
+   * @brief Get the high 64 bits of the 128-bit nanometer sum
+   * @return int64_t The signed high word
+   */
+  [[nodiscard]] constexpr auto GetHigh() const -> int64_t;
+  /**
+   * @brief Get the low 64 bits of the 128-bit nanometer sum
+   * @return uint64_t The unsigned low word
+   */
+  [[nodiscard]] constexpr auto GetLow() const -> uint64_t;
+
+ protected:
+ private:
+  /**
+   * @brief Add a 128-bit value given as two words
+   * @param high The signed high word
+   * @param low The unsigned low word
+   */
+  constexpr auto AddWide(int64_t high, uint64_t low) -> void;
+
+  uint64_t low_{0U};  ///< Low word of the nanometer sum
+  int64_t high_{0};   ///< High word of the nanometer sum
+};
+
+constexpr auto DistanceAccumulator::AddWide(int64_t high, uint64_t low)
+    -> void {
+  const auto kLow = low_ + low;
+  const auto kCarry = (kLow < low_) ? 1U : 0U;
+  low_ = kLow;
+  high_ = static_cast<int64_t>(static_cast<uint64_t>(high_) +
+                               static_cast<uint64_t>(high) + kCarry);
+}
+
+constexpr auto DistanceAccumulator::Add(const Distance& distance) -> void {
+  const auto kNanometer = distance.GetNanometer();
+  AddWide((kNanometer < 0) ? -1 : 0, static_cast<uint64_t>(kNanometer));
+}
+
+constexpr auto DistanceAccumulator::Reset() -> void {
+  low_ = 0U;
+  high_ = 0;
+}
+
+constexpr auto DistanceAccumulator::operator+=(const Distance& distance)
+    -> DistanceAccumulator& {
+  Add(distance);
+  return *this;
+}
+
+constexpr auto DistanceAccumulator::operator+=(const DistanceAccumulator& other)
+    -> DistanceAccumulator& {
+  AddWide(other.high_, other.low_);
+  return *this;
+}
+
+constexpr auto DistanceAccumulator::operator==(
+    const DistanceAccumulator& other) const -> bool {
+  return (low_ == other.low_) && (high_ == other.high_);
+}
+
+constexpr auto DistanceAccumulator::operator!=(
+    const DistanceAccumulator& other) const -> bool {
+  return !(*this == other);
+}
+
+constexpr auto DistanceAccumulator::IsRepresentable() const -> bool {
+  // Representable if the high word is the sign extension of the low word
+  return high_ == ((static_cast<int64_t>(low_) < 0) ? -1 : 0);
+}
+
+constexpr auto DistanceAccumulator::ToDistance(
+    Distance::OverflowPolicy policy) const -> Distance {
+  if (!IsRepresentable()) {
+    if (policy == Distance::OverflowPolicy::kChecked) {
+      throw std::overflow_error("Distance sum is not representable");
+    }
+    if (policy == Distance::OverflowPolicy::kSaturating) {
+      return Distance::FromNanometer((high_ < 0)
+                                         ? std::numeric_limits<int64_t>::min()
+                                         : std::numeric_limits<int64_t>::max());
+    }
+  }
+  return Distance::FromNanometer(static_cast<int64_t>(low_));
+}
+
+constexpr auto DistanceAccumulator::GetValue(Distance::DistanceType type) const
+    -> double {
+  if (IsRepresentable()) {
+    return ToDistance().GetValue(type);
+  }
+  constexpr double kTwoPow64{18446744073709551616.0};
+  return ((static_cast<double>(high_) * kTwoPow64) +
+          static_cast<double>(low_)) *
+         Distance::GetUnitScale(type);
+}
+
+constexpr auto DistanceAccumulator::GetHigh() const -> int64_t {
+  return high_;
+}
+
+constexpr auto DistanceAccumulator::GetLow() const -> uint64_t { return low_; }
+}  // namespace Jeong0806::geometry
+
+#endif  // Jeong0806_GEOMETRY_DISTANCE_ACCUMULATOR_HPP_
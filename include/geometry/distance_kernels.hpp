@@ -0,0 +1,278 @@
+/**
+ * @file geometry/distance_kernels.hpp
+ * @author Jeong Seong In (0806jsi@gmail.com)
+ * @brief Batch distance kernels over structure-of-arrays coordinates
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2023 Jeong0806, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#ifndef Jeong0806_GEOMETRY_DISTANCE_KERNELS_HPP_
+#define Jeong0806_GEOMETRY_DISTANCE_KERNELS_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "geometry/distance.hpp"
+#include "geometry/point2i.hpp"
+
+namespace Jeong0806::geometry::kernel {
+/**
+ * @brief Calculate distance from one origin to many points
+ * @param xs x coordinate values of the points
+ * @param ys y coordinate values of the points
+ * @param count The number of points
+ * @param origin_x x coordinate value of the origin
+ * @param origin_y y coordinate value of the origin
+ * @param output count Euclidean distances
+ */
+auto CalculateDistances(const double* xs, const double* ys, std::size_t count,
+                        double origin_x, double origin_y, double* output)
+    -> void;
+/**
+ * @brief Calculate squared distance from one origin to many points
+ * @param xs x coordinate values of the points
+ * @param ys y coordinate values of the points
+ * @param count The number of points
+ * @param origin_x x coordinate value of the origin
+ * @param origin_y y coordinate value of the origin
+ * @param output count squared Euclidean distances
+ */
+auto CalculateSquaredDistances(const double* xs, const double* ys,
+                               std::size_t count, double origin_x,
+                               double origin_y, double* output) -> void;
+/**
+ * @brief Calculate distance between lhs and rhs points of the same index
+ * @param lhs_xs x coordinate values of the lhs points
+ * @param lhs_ys y coordinate values of the lhs points
+ * @param rhs_xs x coordinate values of the rhs points
+ * @param rhs_ys y coordinate values of the rhs points
+ * @param count The number of point pairs
+ * @param output count Euclidean distances
+ */
+auto CalculatePairwiseDistances(const double* lhs_xs, const double* lhs_ys,
+                                const double* rhs_xs, const double* rhs_ys,
+                                std::size_t count, double* output) -> void;
+/**
+ * @brief Calculate squared distance between lhs and rhs points of the same
+ * index
+ * @param lhs_xs x coordinate values of the lhs points
+ * @param lhs_ys y coordinate values of the lhs points
+ * @param rhs_xs x coordinate values of the rhs points
+ * @param rhs_ys y coordinate values of the rhs points
+ * @param count The number of point pairs
+ * @param output count squared Euclidean distances
+ */
+auto CalculatePairwiseSquaredDistances(const double* lhs_xs,
+                                       const double* lhs_ys,
+                                       const double* rhs_xs,
+                                       const double* rhs_ys, std::size_t count,
+                                       double* output) -> void;
+/**
+ * @brief Check which points are within radius of one origin without sqrt
+ * @param xs x coordinate values of the points
+ * @param ys y coordinate values of the points
+ * @param count The number of points
+ * @param origin_x x coordinate value of the origin
+ * @param origin_y y coordinate value of the origin
+ * @param radius Inclusive radius, nothing is within a negative radius
+ * @param output count flags, 1 if within and 0 if not
+ * @return std::size_t The number of points within radius
+ */
+auto IsWithin(const double* xs, const double* ys, std::size_t count,
+              double origin_x, double origin_y, double radius,
+              uint8_t* output) -> std::size_t;
+/**
+ * @brief Compare distances of lhs and rhs points of the same index from one
+ * origin without sqrt
+ * @param lhs_xs x coordinate values of the lhs points
+ * @param lhs_ys y coordinate values of the lhs points
+ * @param rhs_xs x coordinate values of the rhs points
+ * @param rhs_ys y coordinate values of the rhs points
+ * @param count The number of point pairs
+ * @param origin_x x coordinate value of the origin
+ * @param origin_y y coordinate value of the origin
+ * @param output count results, -1 if lhs is closer, 1 if rhs is closer and 0
+ * if equally far
+ */
+auto CompareDistances(const double* lhs_xs, const double* lhs_ys,
+                      const double* rhs_xs, const double* rhs_ys,
+                      std::size_t count, double origin_x, double origin_y,
+                      int8_t* output) -> void;
+/**
+ * @brief Calculate distance from one origin to many float points
+ * @details The float kernels process twice as many points per vector as the
+ * double ones and read half the bytes. They round every step to float, so
+ * each result is within a few float ulps of the distance of the float
+ * coordinates, about 1e-7 relative.
+ * @param xs x coordinate values of the points
+ * @param ys y coordinate values of the points
+ * @param count The number of points
+ * @param origin_x x coordinate value of the origin
+ * @param origin_y y coordinate value of the origin
+ * @param output count Euclidean distances
+ */
+auto CalculateDistances(const float* xs, const float* ys, std::size_t count,
+                        float origin_x, float origin_y, float* output) -> void;
+/**
+ * @brief Calculate squared distance from one origin to many float points
+ * @param xs x coordinate values of the points
+ * @param ys y coordinate values of the points
+ * @param count The number of points
+ * @param origin_x x coordinate value of the origin
+ * @param origin_y y coordinate value of the origin
+ * @param output count squared Euclidean distances
+ */
+auto CalculateSquaredDistances(const float* xs, const float* ys,
+                               std::size_t count, float origin_x,
+                               float origin_y, float* output) -> void;
+/**
+ * @brief Calculate distance between lhs and rhs float points of the same
+ * index
+ * @param lhs_xs x coordinate values of the lhs points
+ * @param lhs_ys y coordinate values of the lhs points
+ * @param rhs_xs x coordinate values of the rhs points
+ * @param rhs_ys y coordinate values of the rhs points
+ * @param count The number of point pairs
+ * @param output count Euclidean distances
+ */
+auto CalculatePairwiseDistances(const float* lhs_xs, const float* lhs_ys,
+                                const float* rhs_xs, const float* rhs_ys,
+                                std::size_t count, float* output) -> void;
+/**
+ * @brief Calculate squared distance between lhs and rhs float points of the
+ * same index
+ * @param lhs_xs x coordinate values of the lhs points
+ * @param lhs_ys y coordinate values of the lhs points
+ * @param rhs_xs x coordinate values of the rhs points
+ * @param rhs_ys y coordinate values of the rhs points
+ * @param count The number of point pairs
+ * @param output count squared Euclidean distances
+ */
+auto CalculatePairwiseSquaredDistances(const float* lhs_xs,
+                                       const float* lhs_ys,
+                                       const float* rhs_xs,
+                                       const float* rhs_ys, std::size_t count,
+                                       float* output) -> void;
+/**
+ * @brief Check which float points are within radius of one origin without
+ * sqrt
+ * @param xs x coordinate values of the points
+ * @param ys y coordinate values of the points
+ * @param count The number of points
+ * @param origin_x x coordinate value of the origin
+ * @param origin_y y coordinate value of the origin
+ * @param radius Inclusive radius, nothing is within a negative radius
+ * @param output count flags, 1 if within and 0 if not
+ * @return std::size_t The number of points within radius
+ */
+auto IsWithin(const float* xs, const float* ys, std::size_t count,
+              float origin_x, float origin_y, float radius, uint8_t* output)
+    -> std::size_t;
+/**
+ * @brief Compare distances of lhs and rhs float points of the same index from
+ * one origin without sqrt
+ * @param lhs_xs x coordinate values of the lhs points
+ * @param lhs_ys y coordinate values of the lhs points
+ * @param rhs_xs x coordinate values of the rhs points
+ * @param rhs_ys y coordinate values of the rhs points
+ * @param count The number of point pairs
+ * @param origin_x x coordinate value of the origin
+ * @param origin_y y coordinate value of the origin
+ * @param output count results, -1 if lhs is closer, 1 if rhs is closer and 0
+ * if equally far
+ */
+auto CompareDistances(const float* lhs_xs, const float* lhs_ys,
+                      const float* rhs_xs, const float* rhs_ys,
+                      std::size_t count, float origin_x, float origin_y,
+                      int8_t* output) -> void;
+/**
+ * @brief Calculate exact squared distance from one origin to many int32
+ * points
+ * @details Every coordinate must be within 2^30 - 1 in magnitude, the kLimit
+ * of int32 BasicPoint2I, so differences fit int32 and the SIMD levels can
+ * multiply them with one widening instruction.
+ * @param xs x coordinate values of the points in ticks
+ * @param ys y coordinate values of the points in ticks
+ * @param count The number of points
+ * @param origin_x x coordinate value of the origin in ticks
+ * @param origin_y y coordinate value of the origin in ticks
+ * @param output count squared Euclidean distances in square ticks
+ */
+auto CalculateSquaredDistances(const int32_t* xs, const int32_t* ys,
+                               std::size_t count, int32_t origin_x,
+                               int32_t origin_y, uint64_t* output) -> void;
+/**
+ * @brief Check exactly which int32 points are within radius of one origin
+ * @details Coordinates are limited as in CalculateSquaredDistances.
+ * @param xs x coordinate values of the points in ticks
+ * @param ys y coordinate values of the points in ticks
+ * @param count The number of points
+ * @param origin_x x coordinate value of the origin in ticks
+ * @param origin_y y coordinate value of the origin in ticks
+ * @param radius Inclusive radius in ticks, nothing is within a negative
+ * radius
+ * @param output count flags, 1 if within and 0 if not
+ * @return std::size_t The number of points within radius
+ */
+auto IsWithin(const int32_t* xs, const int32_t* ys, std::size_t count,
+              int32_t origin_x, int32_t origin_y, int64_t radius,
+              uint8_t* output) -> std::size_t;
+/**
+ * @brief Calculate exact squared distance from one origin to many int64
+ * points
+ * @details Every coordinate must be within 2^62 - 1 in magnitude, the kLimit
+ * of int64 BasicPoint2I. There is no 64 by 64 bit SIMD multiply with a 128-bit
+ * product, so every level runs the scalar code.
+ * @param xs x coordinate values of the points in ticks
+ * @param ys y coordinate values of the points in ticks
+ * @param count The number of points
+ * @param origin_x x coordinate value of the origin in ticks
+ * @param origin_y y coordinate value of the origin in ticks
+ * @param output count squared Euclidean distances in square ticks
+ * @throws out_of_range If a coordinate exceeds 2^62 - 1 in magnitude
+ */
+auto CalculateSquaredDistances(const int64_t* xs, const int64_t* ys,
+                               std::size_t count, int64_t origin_x,
+                               int64_t origin_y, UInt128* output) -> void;
+/**
+ * @brief Check exactly which int64 points are within radius of one origin
+ * @details Coordinates are limited as in CalculateSquaredDistances.
+ * @param xs x coordinate values of the points in ticks
+ * @param ys y coordinate values of the points in ticks
+ * @param count The number of points
+ * @param origin_x x coordinate value of the origin in ticks
+ * @param origin_y y coordinate value of the origin in ticks
+ * @param radius Inclusive radius in ticks, nothing is within a negative
+ * radius
+ * @param output count flags, 1 if within and 0 if not
+ * @return std::size_t The number of points within radius
+ * @throws out_of_range If a coordinate exceeds 2^62 - 1 in magnitude
+ */
+auto IsWithin(const int64_t* xs, const int64_t* ys, std::size_t count,
+              int64_t origin_x, int64_t origin_y, int64_t radius,
+              uint8_t* output) -> std::size_t;
+/**
+ * @brief Get the values of many Distance objects in one distance type
+ * @param distances The Distance objects
+ * @param count The number of Distance objects
+ * @param type The distance type of the output
+ * @param output count values, each equal to GetValue(type)
+ */
+auto ConvertDistances(const Distance* distances, std::size_t count,
+                      Distance::DistanceType type, double* output) -> void;
+/**
+ * @brief Create many Distance objects from values of one distance type
+ * @param values The distance values
+ * @param count The number of values
+ * @param type The distance type of the values
+ * @param output count Distance objects, each equal to Distance(value, type)
+ */
+auto FromValues(const double* values, std::size_t count,
+                Distance::DistanceType type, Distance* output) -> void;
+}  // namespace Jeong0806::geometry::kernel
+
+#endif  // Jeong0806_GEOMETRY_DISTANCE_KERNELS_HPP_
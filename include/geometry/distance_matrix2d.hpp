@@ -0,0 +1,196 @@
+/**
+ * @file geometry/distance_matrix2d.hpp
+ * @author Jeong Seong In (0806jsi@gmail.com)
+ * @brief All-pairs distance matrix class declaration
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2023 Jeong0806, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#ifndef Jeong0806_GEOMETRY_DISTANCE_MATRIX_2D_HPP_
+#define Jeong0806_GEOMETRY_DISTANCE_MATRIX_2D_HPP_
+
+#include <cstddef>
+#include <functional>
+#include <memory_resource>
+#include <vector>
+
+#include "geometry/distance.hpp"
+#include "geometry/parallel.hpp"
+#include "geometry/point2d.hpp"
+#include "geometry/point_cloud2d.hpp"
+
+namespace Jeong0806::geometry {
+/**
+ * @brief Dense row-major distance matrix between a row and a column point set
+ * @details The matrix is computed in tiles of kRowTile rows by kColumnTile
+ * columns, so a column tile stays in L1 while every row of the tile reuses it.
+ * Tiles run across threads and each row of a tile is one batch kernel call.
+ */
+class DistanceMatrix2D {
+ public:
+  /**
+   * @brief Number of rows in a tile
+   */
+  static constexpr std::size_t kRowTile{32U};
+  /**
+   * @brief Number of columns in a tile, whose coordinates take 16 KiB
+   */
+  static constexpr std::size_t kColumnTile{1024U};
+
+  /**
+   * @brief Callback receiving a block of consecutive matrix rows
+   * @tparam T The element type
+   * @details Called with the first row, the number of rows and row-major
+   * values of row_count * Columns() elements, which are only valid during the
+   * call.
+   */
+  template <typename T>
+  using RowBlockCallback =
+      std::function<void(std::size_t first_row, std::size_t row_count,
+                         const T* values)>;
+
+  /**
+   * @brief Construct a new empty DistanceMatrix2D object
+   */
+  DistanceMatrix2D() = default;
+  /**
+   * @brief Construct a new DistanceMatrix2D object
+   * @param rows The row points
+   * @param columns The column points
+   * @param unit The unit of the point coordinates, used for Distance output
+   */
+  DistanceMatrix2D(
+      PointCloud2D rows, PointCloud2D columns,
+      Distance::DistanceType unit = Distance::DistanceType::kMeter);
+  /**
+   * @brief Construct a new DistanceMatrix2D object
+   * @param rows The row points
+   * @param columns The column points
+   * @param unit The unit of the point coordinates, used for Distance output
+   * @param resource The memory resource of the row and column points
+   */
+  DistanceMatrix2D(
+      const std::vector<Point2D>& rows, const std::vector<Point2D>& columns,
+      Distance::DistanceType unit = Distance::DistanceType::kMeter,
+      std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+  /**
+   * @brief Get the number of rows
+   * @return std::size_t The number of row points
+   */
+  [[nodiscard]] auto Rows() const -> std::size_t;
+  /**
+   * @brief Get the number of columns
+   * @return std::size_t The number of column points
+   */
+  [[nodiscard]] auto Columns() const -> std::size_t;
+
+  /**
+   * @brief Calculate the whole matrix
+   * @param output Pointer to at least Rows() * Columns() row-major values
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param executor The executor running the threads
+   */
+  auto Calculate(double* output, std::size_t thread_count = 0,
+                 Executor* executor = GetDefaultExecutor()) const -> void;
+  /**
+   * @brief Calculate the whole matrix in single precision
+   * @param output Pointer to at least Rows() * Columns() row-major values
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param executor The executor running the threads
+   */
+  auto Calculate(float* output, std::size_t thread_count = 0,
+                 Executor* executor = GetDefaultExecutor()) const -> void;
+  /**
+   * @brief Calculate the whole matrix as nanometer Distance objects
+   * @param output Pointer to at least Rows() * Columns() row-major values
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param executor The executor running the threads
+   */
+  auto Calculate(Distance* output, std::size_t thread_count = 0,
+                 Executor* executor = GetDefaultExecutor()) const -> void;
+  /**
+   * @brief Calculate the whole matrix
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param executor The executor running the threads
+   * @return std::vector<double> Rows() * Columns() row-major values
+   */
+  [[nodiscard]] auto ToVector(std::size_t thread_count = 0,
+                              Executor* executor = GetDefaultExecutor()) const
+      -> std::vector<double>;
+
+  /**
+   * @brief Calculate the matrix block by block without holding all of it
+   * @param block_rows The number of rows in a block
+   * @param callback Called in row order with each block
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param executor The executor running the threads
+   * @throws invalid_argument If block_rows is zero
+   */
+  auto StreamRowBlocks(std::size_t block_rows,
+                       const RowBlockCallback<double>& callback,
+                       std::size_t thread_count = 0,
+                       Executor* executor = GetDefaultExecutor()) const -> void;
+  /**
+   * @brief Calculate the matrix block by block in single precision
+   * @param block_rows The number of rows in a block
+   * @param callback Called in row order with each block
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param executor The executor running the threads
+   * @throws invalid_argument If block_rows is zero
+   */
+  auto StreamRowBlocks(std::size_t block_rows,
+                       const RowBlockCallback<float>& callback,
+                       std::size_t thread_count = 0,
+                       Executor* executor = GetDefaultExecutor()) const -> void;
+  /**
+   * @brief Calculate the matrix block by block as nanometer Distance objects
+   * @param block_rows The number of rows in a block
+   * @param callback Called in row order with each block
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param executor The executor running the threads
+   * @throws invalid_argument If block_rows is zero
+   */
+  auto StreamRowBlocks(std::size_t block_rows,
+                       const RowBlockCallback<Distance>& callback,
+                       std::size_t thread_count = 0,
+                       Executor* executor = GetDefaultExecutor()) const -> void;
+
+ protected:
+ private:
+  /**
+   * @brief Calculate consecutive rows tile by tile across threads
+   * @tparam T The element type
+   * @param first_row The first row
+   * @param row_count The number of rows
+   * @param output Pointer to row_count * Columns() row-major values
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param executor The executor running the threads
+   */
+  template <typename T>
+  auto CalculateRows(std::size_t first_row, std::size_t row_count, T* output,
+                     std::size_t thread_count, Executor* executor) const
+      -> void;
+  /**
+   * @brief Stream consecutive row blocks through a reused buffer
+   * @tparam T The element type
+   * @param block_rows The number of rows in a block
+   * @param callback Called in row order with each block
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param executor The executor running the threads
+   */
+  template <typename T>
+  auto StreamRows(std::size_t block_rows, const RowBlockCallback<T>& callback,
+                  std::size_t thread_count, Executor* executor) const -> void;
+
+  PointCloud2D rows_;     ///< Row points
+  PointCloud2D columns_;  ///< Column points
+  Distance::DistanceType unit_{Distance::DistanceType::kMeter};  ///< Unit
+};
+}  // namespace Jeong0806::geometry
+
+#endif  // Jeong0806_GEOMETRY_DISTANCE_MATRIX_2D_HPP_
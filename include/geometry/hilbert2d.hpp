@@ -0,0 +1,234 @@
+/**
+ * @file geometry/hilbert2d.hpp
+ * @author Jeong Seong In (0806jsi@gmail.com)
+ * @brief Hilbert code and spatial partition class declarations
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2023 Jeong0806, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#ifndef Jeong0806_GEOMETRY_HILBERT_2D_HPP_
+#define Jeong0806_GEOMETRY_HILBERT_2D_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <utility>
+#include <vector>
+
+#include "geometry/morton2d.hpp"
+#include "geometry/parallel.hpp"
+#include "geometry/point2d.hpp"
+#include "geometry/point_cloud2d.hpp"
+
+namespace Jeong0806::geometry {
+/**
+ * @brief Hilbert codes of 32-bit grid cells
+ * @details Unlike the Z-order, consecutive codes are always edge-adjacent
+ * cells, so any range of codes covers a connected and compact region. Points
+ * are quantized by a MortonGrid2D, which is a plain square grid. Batch
+ * encoding walks the curve four bits per axis at a time through a table.
+ */
+class Hilbert2D {
+ public:
+  /**
+   * @brief Encode a cell into its Hilbert code
+   * @param x x index of the cell
+   * @param y y index of the cell
+   * @return uint64_t The distance of the cell along the curve
+   */
+  [[nodiscard]] static constexpr auto Encode(uint32_t x, uint32_t y)
+      -> uint64_t {
+    uint64_t code = 0;
+    for (uint32_t bit = 32U; bit-- > 0U;) {
+      const auto kRx = (x >> bit) & 1U;
+      const auto kRy = (y >> bit) & 1U;
+      code |= static_cast<uint64_t>((3U * kRx) ^ kRy) << (2U * bit);
+      // Rotate the quadrant so the lower bits follow the base curve, with
+      // masks since the branches would be unpredictable
+      const auto kFlip = 0U - (kRx & ~kRy & 1U);
+      x ^= kFlip;
+      y ^= kFlip;
+      const auto kSwap = (x ^ y) & (0U - (kRy ^ 1U));
+      x ^= kSwap;
+      y ^= kSwap;
+    }
+    return code;
+  }
+  /**
+   * @brief Decode a Hilbert code into its cell
+   * @param code The distance of the cell along the curve
+   * @return std::pair<uint32_t, uint32_t> x and y index of the cell
+   */
+  [[nodiscard]] static constexpr auto Decode(uint64_t code)
+      -> std::pair<uint32_t, uint32_t> {
+    uint32_t x = 0;
+    uint32_t y = 0;
+    for (uint32_t bit = 0; bit < 32U; ++bit) {
+      const auto kRx = static_cast<uint32_t>(code >> (2U * bit + 1U)) & 1U;
+      const auto kRy =
+          (static_cast<uint32_t>(code >> (2U * bit)) ^ kRx) & 1U;
+      if (kRy == 0U) {
+        if (kRx == 1U) {
+          const auto kMask = (bit == 0U) ? 0U : (~0U >> (32U - bit));
+          x = kMask - x;
+          y = kMask - y;
+        }
+        const auto kSwap = x;
+        x = y;
+        y = kSwap;
+      }
+      x |= kRx << bit;
+      y |= kRy << bit;
+    }
+    return {x, y};
+  }
+
+  /**
+   * @brief Get the Hilbert code of a point
+   * @param grid The grid quantizing the point
+   * @param point The point
+   * @return uint64_t The Hilbert code of its cell
+   */
+  [[nodiscard]] static auto GetCode(const MortonGrid2D& grid,
+                                    const Point2D& point) -> uint64_t;
+  /**
+   * @brief Get the Hilbert codes of contiguous points across threads
+   * @param grid The grid quantizing the points
+   * @param points Pointer to the first point
+   * @param count The number of points
+   * @param codes Pointer to count output codes
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param executor The executor running the threads
+   */
+  static auto ComputeCodes(const MortonGrid2D& grid, const Point2D* points,
+                           std::size_t count, uint64_t* codes,
+                           std::size_t thread_count = 0,
+                           Executor* executor = GetDefaultExecutor()) -> void;
+  /**
+   * @brief Get the Hilbert codes of points across threads
+   * @param grid The grid quantizing the points
+   * @param points The points
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param executor The executor running the threads
+   * @return std::vector<uint64_t> The code of each point in index order
+   */
+  [[nodiscard]] static auto ComputeCodes(
+      const MortonGrid2D& grid, const PointCloud2D& points,
+      std::size_t thread_count = 0, Executor* executor = GetDefaultExecutor())
+      -> std::vector<uint64_t>;
+
+ protected:
+ private:
+};
+
+/**
+ * @brief Points cut into spatially compact shards of equal weight
+ * @details Points are ordered along the Hilbert curve of 2^16 by 2^16 cells
+ * over their bounding box, ties keeping their input order, and the curve is
+ * cut into consecutive runs, so each shard is a compact region and shards
+ * may be processed by separate threads with good locality. Without weights
+ * every shard gets the same number of points, give or take one. With
+ * weights each cut is placed where the running weight first reaches its
+ * share of the total.
+ */
+class HilbertPartition2D {
+ public:
+  /**
+   * @brief Construct a new empty HilbertPartition2D object
+   */
+  HilbertPartition2D() = default;
+  /**
+   * @brief Construct a new HilbertPartition2D object of equal point counts
+   * @param points The points
+   * @param shard_count The number of shards
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param executor The executor running the threads
+   * @throws invalid_argument If shard_count is zero or a coordinate is not
+   * finite
+   * @throws length_error If there are more points than fit in 32 bits
+   */
+  HilbertPartition2D(const PointCloud2D& points, std::size_t shard_count,
+                     std::size_t thread_count = 0,
+                     Executor* executor = GetDefaultExecutor());
+  /**
+   * @brief Construct a new HilbertPartition2D object of equal weights
+   * @param points The points
+   * @param weights The weight of each point
+   * @param shard_count The number of shards
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param executor The executor running the threads
+   * @throws invalid_argument If shard_count is zero, a coordinate is not
+   * finite, the sizes differ or a weight is negative or not finite
+   * @throws length_error If there are more points than fit in 32 bits
+   */
+  HilbertPartition2D(const PointCloud2D& points,
+                     const std::vector<double>& weights,
+                     std::size_t shard_count, std::size_t thread_count = 0,
+                     Executor* executor = GetDefaultExecutor());
+
+  /**
+   * @brief Get the number of shards
+   * @return std::size_t The number of shards, some may be empty
+   */
+  [[nodiscard]] auto GetShardCount() const -> std::size_t;
+  /**
+   * @brief Get the point indices of all shards in curve order
+   * @return const std::vector<uint32_t>& Input index of each curve position
+   */
+  [[nodiscard]] auto GetOrder() const -> const std::vector<uint32_t>&;
+  /**
+   * @brief Get the number of points in a shard
+   * @param shard The shard
+   * @return std::size_t The number of points
+   * @throws out_of_range If shard is not below GetShardCount()
+   */
+  [[nodiscard]] auto GetShardSize(std::size_t shard) const -> std::size_t;
+  /**
+   * @brief Get the point indices of a shard
+   * @param shard The shard
+   * @return const uint32_t* Pointer to GetShardSize(shard) input indices in
+   * curve order
+   * @throws out_of_range If shard is not below GetShardCount()
+   */
+  [[nodiscard]] auto GetShardIndices(std::size_t shard) const
+      -> const uint32_t*;
+  /**
+   * @brief Get the total weight of a shard
+   * @param shard The shard
+   * @return double The sum of the weights, the point count without weights
+   * @throws out_of_range If shard is not below GetShardCount()
+   */
+  [[nodiscard]] auto GetShardWeight(std::size_t shard) const -> double;
+  /**
+   * @brief Copy the points of a shard into a contiguous cloud
+   * @param points The points the partition was built from
+   * @param shard The shard
+   * @param resource The memory resource of the returned cloud
+   * @return PointCloud2D The points of the shard in curve order
+   * @throws out_of_range If shard is not below GetShardCount()
+   */
+  [[nodiscard]] auto Gather(
+      const PointCloud2D& points, std::size_t shard,
+      std::pmr::memory_resource* resource =
+          std::pmr::get_default_resource()) const -> PointCloud2D;
+
+ protected:
+ private:
+  /**
+   * @brief Throw if shard is not a valid shard
+   * @param shard The shard
+   * @throws out_of_range If shard is not below GetShardCount()
+   */
+  auto CheckShard(std::size_t shard) const -> void;
+
+  std::vector<uint32_t> order_;       ///< Input index of each curve position
+  std::vector<std::size_t> offsets_;  ///< First position of each shard
+  std::vector<double> weights_;       ///< Total weight of each shard
+};
+}  // namespace Jeong0806::geometry
+
+#endif  // Jeong0806_GEOMETRY_HILBERT_2D_HPP_
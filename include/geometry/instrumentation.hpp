@@ -0,0 +1,254 @@
+/**
+ * @file geometry/instrumentation.hpp
+ * @author Jeong Seong In (0806jsi@gmail.com)
+ * @brief Hot path counter and timer declarations
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2023 Jeong0806, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#ifndef Jeong0806_GEOMETRY_INSTRUMENTATION_HPP_
+#define Jeong0806_GEOMETRY_INSTRUMENTATION_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#if defined(Jeong0806_GEOMETRY_INSTRUMENTATION)
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define Jeong0806_GEOMETRY_INSTRUMENTATION_TSC
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define Jeong0806_GEOMETRY_INSTRUMENTATION_TSC
+#else
+#include <chrono>
+#endif
+#endif
+
+namespace Jeong0806::geometry {
+/**
+ * @brief Per-thread counters and timers of the library hot paths
+ * @details Compiled in only when Jeong0806_GEOMETRY_INSTRUMENTATION is
+ * defined, which the geometry_INSTRUMENTATION CMake option does for the
+ * library and its users. Otherwise Add() and ScopedTimer are empty and
+ * snapshots stay zero. Each thread writes its own cache line without atomic
+ * read-modify-writes, and TakeSnapshot() sums the lines of all threads,
+ * including exited ones, without taking a lock.
+ */
+class Instrumentation {
+ public:
+  /**
+   * @brief The enum class for counted events
+   */
+  enum class Counter : std::size_t {
+    kDistanceCalculations = 0,  ///< Point distances, squared or not
+    kDistanceConversions = 1,   ///< Distance values converted between units
+    kIndexNodeVisits = 2,       ///< k-d tree nodes and hash grid buckets
+    kIndexPointTests = 3,       ///< Points tested by index queries
+    kPredicateTests = 4,        ///< Orientation and in-circle predicates
+    kPredicateFallbacks = 5,    ///< Predicates refined past the filter
+    kCount = 6
+  };
+  /**
+   * @brief The enum class for timed operations
+   */
+  enum class Timer : std::size_t {
+    kKdTreeBuild = 0,           ///< KdTree2D construction
+    kKdTreeQuery = 1,           ///< KdTree2D batch queries
+    kSpatialHashGridBuild = 2,  ///< SpatialHashGrid2D construction
+    kSpatialHashGridQuery = 3,  ///< SpatialHashGrid2D pair queries
+    kDistanceMatrix = 4,        ///< DistanceMatrix2D row blocks
+    kConvexHull = 5,            ///< ConvexHull2D hulls
+    kClosestPair = 6,           ///< ClosestPair2D searches
+    kPolylineSimplify = 7,      ///< PolylineSimplifier2D simplifications
+    kSpatialSort = 8,           ///< Morton2D sort orders
+    kHilbertPartition = 9,      ///< HilbertPartition2D construction
+    kPointParse = 10,           ///< CSV and WKT parsing
+    kDelaunayBuild = 11,        ///< DelaunayTriangulation2D construction
+    kDelaunayQuery = 12,        ///< DelaunayTriangulation2D batch queries
+    kPolygonIndexBuild = 13,    ///< PolygonIndex2D construction
+    kPolygonClassify = 14,      ///< PolygonIndex2D batch classifications
+    kCount = 15
+  };
+
+  /**
+   * @brief Whether the instrumentation is compiled in
+   */
+#if defined(Jeong0806_GEOMETRY_INSTRUMENTATION)
+  static constexpr bool kEnabled{true};
+#else
+  static constexpr bool kEnabled{false};
+#endif
+  /**
+   * @brief Unit of timer ticks
+   */
+#if defined(Jeong0806_GEOMETRY_INSTRUMENTATION_TSC)
+  static constexpr std::string_view kTickUnit{"cycles"};
+#else
+  static constexpr std::string_view kTickUnit{"nanoseconds"};
+#endif
+  static constexpr std::size_t kCounterCount{
+      static_cast<std::size_t>(Counter::kCount)};
+  static constexpr std::size_t kTimerCount{
+      static_cast<std::size_t>(Timer::kCount)};
+
+  /**
+   * @brief Totals of one timer
+   */
+  struct TimerValue {
+    uint64_t calls{0};  ///< Finished timed operations
+    uint64_t ticks{0};  ///< Ticks spent in them, see kTickUnit
+  };
+
+  /**
+   * @brief Totals of all threads at one point in time
+   */
+  struct Snapshot {
+    std::array<uint64_t, kCounterCount> counters{};  ///< By Counter
+    std::array<TimerValue, kTimerCount> timers{};    ///< By Timer
+
+    /**
+     * @brief Get a counter total
+     * @param counter The counter
+     * @return uint64_t The total
+     */
+    [[nodiscard]] auto Get(Counter counter) const -> uint64_t;
+    /**
+     * @brief Get a timer total
+     * @param timer The timer
+     * @return TimerValue The total
+     */
+    [[nodiscard]] auto Get(Timer timer) const -> TimerValue;
+    /**
+     * @brief Get the totals since an earlier snapshot
+     * @param earlier The earlier snapshot
+     * @return Snapshot The difference of every total
+     */
+    auto operator-(const Snapshot& earlier) const -> Snapshot;
+    /**
+     * @brief Format as one "name value" line per counter and one
+     * "name calls=... ticks=..." line per timer
+     * @return std::string The text
+     */
+    [[nodiscard]] auto ToText() const -> std::string;
+    /**
+     * @brief Format as a JSON object of the tick unit, counters and timers
+     * @return std::string The JSON text
+     */
+    [[nodiscard]] auto ToJson() const -> std::string;
+  };
+
+  /**
+   * @brief Count events on the calling thread
+   * @param counter The counter
+   * @param count The number of events
+   */
+  static constexpr auto Add(Counter counter, uint64_t count = 1U) -> void {
+#if defined(Jeong0806_GEOMETRY_INSTRUMENTATION)
+    // Conversions of Distance may run at compile time
+    if (!__builtin_is_constant_evaluated()) {
+      Record(counter, count);
+    }
+#else
+    static_cast<void>(counter);
+    static_cast<void>(count);
+#endif
+  }
+  /**
+   * @brief Read the tick clock of the timers
+   * @return uint64_t The current tick, zero when disabled
+   */
+  static auto ReadTicks() -> uint64_t {
+#if defined(Jeong0806_GEOMETRY_INSTRUMENTATION_TSC)
+    return __rdtsc();
+#elif defined(Jeong0806_GEOMETRY_INSTRUMENTATION)
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+#else
+    return 0U;
+#endif
+  }
+  /**
+   * @brief Sum the counters and timers of all threads
+   * @details Totals of threads still running may miss their latest events.
+   * @return Snapshot The totals since the process started
+   */
+  [[nodiscard]] static auto TakeSnapshot() -> Snapshot;
+  /**
+   * @brief Get the snake_case name of a counter
+   * @param counter The counter
+   * @return std::string_view The name
+   */
+  [[nodiscard]] static auto GetName(Counter counter) -> std::string_view;
+  /**
+   * @brief Get the snake_case name of a timer
+   * @param timer The timer
+   * @return std::string_view The name
+   */
+  [[nodiscard]] static auto GetName(Timer timer) -> std::string_view;
+
+  /**
+   * @brief Time the enclosing scope on the calling thread
+   */
+  class ScopedTimer {
+   public:
+    /**
+     * @brief Construct a new ScopedTimer object and start timing
+     * @param timer The timer
+     */
+    explicit ScopedTimer(Timer timer) {
+#if defined(Jeong0806_GEOMETRY_INSTRUMENTATION)
+      timer_ = timer;
+      start_ = ReadTicks();
+#else
+      static_cast<void>(timer);
+#endif
+    }
+    ScopedTimer(const ScopedTimer& other) = delete;
+    ScopedTimer(ScopedTimer&& other) = delete;
+    /**
+     * @brief Destroy the ScopedTimer object and record the elapsed ticks
+     */
+    ~ScopedTimer() {
+#if defined(Jeong0806_GEOMETRY_INSTRUMENTATION)
+      Record(timer_, ReadTicks() - start_);
+#endif
+    }
+
+    auto operator=(const ScopedTimer& other) -> ScopedTimer& = delete;
+    auto operator=(ScopedTimer&& other) -> ScopedTimer& = delete;
+
+   protected:
+   private:
+#if defined(Jeong0806_GEOMETRY_INSTRUMENTATION)
+    Timer timer_{Timer::kCount};  ///< The timer
+    uint64_t start_{0};           ///< Tick at construction
+#endif
+  };
+
+ protected:
+ private:
+  /**
+   * @brief Add to a counter of the calling thread
+   * @param counter The counter
+   * @param count The number of events
+   */
+  static auto Record(Counter counter, uint64_t count) -> void;
+  /**
+   * @brief Add one call to a timer of the calling thread
+   * @param timer The timer
+   * @param ticks The ticks of the call
+   */
+  static auto Record(Timer timer, uint64_t ticks) -> void;
+};
+}  // namespace Jeong0806::geometry
+
+#endif  // Jeong0806_GEOMETRY_INSTRUMENTATION_HPP_
@@ -0,0 +1,181 @@
+/**
+ * @file geometry/kd_tree2d.hpp
+ * @author Jeong Seong In (0806jsi@gmail.com)
+ * @brief Static k-d tree class declaration over 2-dimension points
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2023 Jeong0806, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#ifndef Jeong0806_GEOMETRY_KD_TREE_2D_HPP_
+#define Jeong0806_GEOMETRY_KD_TREE_2D_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+#include "geometry/neighbor.hpp"
+#include "geometry/parallel.hpp"
+#include "geometry/point2d.hpp"
+
+namespace Jeong0806::geometry {
+/**
+ * @brief Static, bulk-built k-d tree for nearest-neighbor queries
+ * @details Nodes live in one array in pre-order, so the left child of a node
+ * is the next node. Points are copied into tree order as separate x and y
+ * arrays, so each leaf is a contiguous run scanned linearly. Nodes and
+ * arrays are allocated from a memory resource, the default resource unless
+ * one is given.
+ */
+class KdTree2D {
+ public:
+  /**
+   * @brief Maximum number of points in a leaf
+   */
+  static constexpr std::size_t kLeafSize{8U};
+
+  /**
+   * @brief Construct a new empty KdTree2D object
+   */
+  KdTree2D() = default;
+  /**
+   * @brief Construct a new KdTree2D object from contiguous points
+   * @param points Pointer to the first point
+   * @param count The number of points
+   * @param resource The memory resource of the nodes and arrays
+   * @throws length_error If count does not fit in 32 bits
+   */
+  KdTree2D(
+      const Point2D* points, std::size_t count,
+      std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+  /**
+   * @brief Construct a new KdTree2D object from points
+   * @param points Point2D objects, query results index into this vector
+   * @param resource The memory resource of the nodes and arrays
+   * @throws length_error If there are more points than fit in 32 bits
+   */
+  explicit KdTree2D(
+      const std::vector<Point2D>& points,
+      std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+  /**
+   * @brief Get the number of indexed points
+   * @return std::size_t The number of points
+   */
+  [[nodiscard]] auto Size() const -> std::size_t;
+  /**
+   * @brief Check if no point is indexed
+   * @return true If empty
+   * @return false If not empty
+   */
+  [[nodiscard]] auto Empty() const -> bool;
+  /**
+   * @brief Get the memory resource of the nodes and arrays
+   * @return std::pmr::memory_resource* The memory resource
+   */
+  [[nodiscard]] auto GetResource() const -> std::pmr::memory_resource*;
+
+  /**
+   * @brief Find the nearest point
+   * @param query The query point
+   * @return Neighbor The nearest point, the lowest index on ties
+   * @throws out_of_range If the tree is empty
+   */
+  [[nodiscard]] auto Nearest(const Point2D& query) const -> Neighbor;
+  /**
+   * @brief Find the k nearest points
+   * @param query The query point
+   * @param k The number of points
+   * @return std::vector<Neighbor> Up to k points ordered by distance
+   */
+  [[nodiscard]] auto KNearest(const Point2D& query, std::size_t k) const
+      -> std::vector<Neighbor>;
+  /**
+   * @brief Find every point within radius
+   * @param query The query point
+   * @param radius The inclusive radius in coordinate units
+   * @return std::vector<Neighbor> The points ordered by distance
+   */
+  [[nodiscard]] auto Radius(const Point2D& query, double radius) const
+      -> std::vector<Neighbor>;
+
+  /**
+   * @brief Find the nearest point of every query across threads
+   * @param queries The query points
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param executor The executor running the threads
+   * @return std::vector<Neighbor> The nearest point of each query
+   * @throws out_of_range If the tree is empty and queries is not
+   */
+  [[nodiscard]] auto Nearest(const std::vector<Point2D>& queries,
+                             std::size_t thread_count = 0,
+                             Executor* executor = GetDefaultExecutor()) const
+      -> std::vector<Neighbor>;
+  /**
+   * @brief Find the k nearest points of every query across threads
+   * @param queries The query points
+   * @param k The number of points per query
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param executor The executor running the threads
+   * @return std::vector<std::vector<Neighbor>> The result of each query
+   */
+  [[nodiscard]] auto KNearest(const std::vector<Point2D>& queries,
+                              std::size_t k,
+                              std::size_t thread_count = 0,
+                              Executor* executor = GetDefaultExecutor()) const
+      -> std::vector<std::vector<Neighbor>>;
+  /**
+   * @brief Find every point within radius of every query across threads
+   * @param queries The query points
+   * @param radius The inclusive radius in coordinate units
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param executor The executor running the threads
+   * @return std::vector<std::vector<Neighbor>> The result of each query
+   */
+  [[nodiscard]] auto Radius(const std::vector<Point2D>& queries, double radius,
+                            std::size_t thread_count = 0,
+                            Executor* executor = GetDefaultExecutor()) const
+      -> std::vector<std::vector<Neighbor>>;
+
+ protected:
+ private:
+  /**
+   * @brief Flat tree node, the left child is the next node
+   */
+  struct Node {
+    double split{0.0};  ///< Split coordinate of inner node
+    uint32_t begin{0};  ///< First point of the subtree
+    uint32_t end{0};    ///< One past the last point of the subtree
+    uint32_t right{0};  ///< Right child, zero for leaf
+    uint32_t axis{0};   ///< 0 to split on x, 1 to split on y
+  };
+
+  /**
+   * @brief Build the subtree over tree positions [begin, end)
+   * @param points The input points
+   * @param begin First tree position
+   * @param end One past the last tree position
+   */
+  auto Build(const Point2D* points, uint32_t begin, uint32_t end) -> void;
+  /**
+   * @brief Visit every point whose subtree may lie within the bound
+   * @param query The query point
+   * @param bound_squared Squared pruning bound, the visitor may shrink it
+   * @param visit Callable receiving the input index and squared distance
+   */
+  template <typename Visitor>
+  auto Search(const Point2D& query, double& bound_squared,
+              Visitor&& visit) const -> void;
+
+  std::pmr::vector<Node> nodes_;        ///< Nodes in pre-order
+  std::pmr::vector<double> xs_;         ///< x coordinates in tree order
+  std::pmr::vector<double> ys_;         ///< y coordinates in tree order
+  std::pmr::vector<uint32_t> indices_;  ///< Input index of each tree position
+};
+}  // namespace Jeong0806::geometry
+
+#endif  // Jeong0806_GEOMETRY_KD_TREE_2D_HPP_
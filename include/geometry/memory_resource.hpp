@@ -0,0 +1,138 @@
+/**
+ * @file geometry/memory_resource.hpp
+ * @author Jeong Seong In (0806jsi@gmail.com)
+ * @brief Arena and allocation counting memory resource declarations
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2023 Jeong0806, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#ifndef Jeong0806_GEOMETRY_MEMORY_RESOURCE_HPP_
+#define Jeong0806_GEOMETRY_MEMORY_RESOURCE_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <memory_resource>
+
+namespace Jeong0806::geometry {
+/**
+ * @brief Memory resource counting the allocations passed to its upstream
+ * @details Counters are atomic, so it may sit under containers used from
+ * several threads as long as the upstream is thread safe.
+ */
+class CountingMemoryResource : public std::pmr::memory_resource {
+ public:
+  /**
+   * @brief Construct a new CountingMemoryResource object
+   * @param upstream The resource allocations are forwarded to
+   */
+  explicit CountingMemoryResource(
+      std::pmr::memory_resource* upstream = std::pmr::get_default_resource());
+  CountingMemoryResource(const CountingMemoryResource& other) = delete;
+  CountingMemoryResource(CountingMemoryResource&& other) = delete;
+  ~CountingMemoryResource() override = default;
+
+  auto operator=(const CountingMemoryResource& other)
+      -> CountingMemoryResource& = delete;
+  auto operator=(CountingMemoryResource&& other)
+      -> CountingMemoryResource& = delete;
+
+  /**
+   * @brief Get the upstream resource
+   * @return std::pmr::memory_resource* The upstream resource
+   */
+  [[nodiscard]] auto GetUpstream() const -> std::pmr::memory_resource*;
+  /**
+   * @brief Get the number of allocations
+   * @return std::size_t The number of allocate calls
+   */
+  [[nodiscard]] auto GetAllocationCount() const -> std::size_t;
+  /**
+   * @brief Get the number of deallocations
+   * @return std::size_t The number of deallocate calls
+   */
+  [[nodiscard]] auto GetDeallocationCount() const -> std::size_t;
+  /**
+   * @brief Get the bytes allocated and not yet deallocated
+   * @return std::size_t The bytes in use
+   */
+  [[nodiscard]] auto GetBytesInUse() const -> std::size_t;
+  /**
+   * @brief Get the largest bytes in use since construction or ResetCounts()
+   * @return std::size_t The peak bytes in use
+   */
+  [[nodiscard]] auto GetPeakBytes() const -> std::size_t;
+  /**
+   * @brief Zero the allocation and deallocation counts and the peak bytes
+   */
+  auto ResetCounts() -> void;
+
+ protected:
+  auto do_allocate(std::size_t bytes, std::size_t alignment) -> void* override;
+  auto do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment)
+      -> void override;
+  [[nodiscard]] auto do_is_equal(const std::pmr::memory_resource& other)
+      const noexcept -> bool override;
+
+ private:
+  std::pmr::memory_resource* upstream_;        ///< Source of the memory
+  std::atomic<std::size_t> allocations_{0U};   ///< allocate calls
+  std::atomic<std::size_t> deallocations_{0U};  ///< deallocate calls
+  std::atomic<std::size_t> bytes_in_use_{0U};  ///< Outstanding bytes
+  std::atomic<std::size_t> peak_bytes_{0U};    ///< Largest bytes_in_use_
+};
+
+/**
+ * @brief Per-request arena freeing every allocation at once
+ * @details Allocations are served from pools of fixed-size blocks carved out
+ * of a monotonic buffer, so memory released by a container is reused by the
+ * next one of a similar size, and the upstream is only asked for large
+ * chunks. Release() and destruction return everything in one step, without
+ * visiting single allocations. Not thread safe, so containers using an arena
+ * must be built and resized from one thread at a time.
+ */
+class Arena : public std::pmr::memory_resource {
+ public:
+  /**
+   * @brief Default size of the first chunk taken from the upstream
+   */
+  static constexpr std::size_t kDefaultInitialSize{1U << 16U};
+
+  /**
+   * @brief Construct a new Arena object
+   * @param initial_size Size of the first chunk taken from the upstream
+   * @param upstream The resource chunks are taken from
+   */
+  explicit Arena(
+      std::size_t initial_size = kDefaultInitialSize,
+      std::pmr::memory_resource* upstream = std::pmr::get_default_resource());
+  Arena(const Arena& other) = delete;
+  Arena(Arena&& other) = delete;
+  ~Arena() override = default;
+
+  auto operator=(const Arena& other) -> Arena& = delete;
+  auto operator=(Arena&& other) -> Arena& = delete;
+
+  /**
+   * @brief Return all memory to the upstream
+   * @details Containers still using the arena must not be touched afterwards.
+   */
+  auto Release() -> void;
+
+ protected:
+  auto do_allocate(std::size_t bytes, std::size_t alignment) -> void* override;
+  auto do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment)
+      -> void override;
+  [[nodiscard]] auto do_is_equal(const std::pmr::memory_resource& other)
+      const noexcept -> bool override;
+
+ private:
+  std::pmr::monotonic_buffer_resource buffer_;  ///< Chunks from upstream
+  std::pmr::unsynchronized_pool_resource pools_;  ///< Blocks from buffer_
+};
+}  // namespace Jeong0806::geometry
+
+#endif  // Jeong0806_GEOMETRY_MEMORY_RESOURCE_HPP_
@@ -0,0 +1,290 @@
+/**
+ * @file geometry/morton2d.hpp
+ * @author Jeong Seong In (0806jsi@gmail.com)
+ * @brief Morton code, grid quantization and spatial sort class declarations
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2023 Jeong0806, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#ifndef Jeong0806_GEOMETRY_MORTON_2D_HPP_
+#define Jeong0806_GEOMETRY_MORTON_2D_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "geometry/parallel.hpp"
+#include "geometry/point2d.hpp"
+#include "geometry/point_cloud2d.hpp"
+
+namespace Jeong0806::geometry {
+/**
+ * @brief Morton (Z-order) codes of 32-bit grid cells and the spatial sort
+ * @details A code interleaves the bits of the cell x in its even bits and of
+ * the cell y in its odd bits. Batch encoding and decoding use BMI2 pdep and
+ * pext while GetSimdLevel() is AVX2 or wider and the CPU has BMI2, and bit
+ * tricks otherwise. Sorting is a parallel stable LSD radix sort on the codes,
+ * which skips byte passes whose digit is the same for every code.
+ */
+class Morton2D {
+ public:
+  /**
+   * @brief Up to this many codes are sorted by comparison instead of radix
+   */
+  static constexpr std::size_t kMinRadixSortSize{1U << 8U};
+
+  /**
+   * @brief Encode a cell into its Morton code
+   * @param x x index of the cell
+   * @param y y index of the cell
+   * @return uint64_t The Morton code
+   */
+  [[nodiscard]] static constexpr auto Encode(uint32_t x, uint32_t y)
+      -> uint64_t {
+    return Spread(x) | (Spread(y) << 1U);
+  }
+  /**
+   * @brief Decode a Morton code into its cell
+   * @param code The Morton code
+   * @return std::pair<uint32_t, uint32_t> x and y index of the cell
+   */
+  [[nodiscard]] static constexpr auto Decode(uint64_t code)
+      -> std::pair<uint32_t, uint32_t> {
+    return {Compact(code), Compact(code >> 1U)};
+  }
+  /**
+   * @brief Encode cells into Morton codes
+   * @param xs Pointer to count x indices
+   * @param ys Pointer to count y indices
+   * @param count The number of cells
+   * @param codes Pointer to count output codes
+   */
+  static auto Encode(const uint32_t* xs, const uint32_t* ys, std::size_t count,
+                     uint64_t* codes) -> void;
+  /**
+   * @brief Decode Morton codes into cells
+   * @param codes Pointer to count codes
+   * @param count The number of codes
+   * @param xs Pointer to count output x indices
+   * @param ys Pointer to count output y indices
+   */
+  static auto Decode(const uint64_t* codes, std::size_t count, uint32_t* xs,
+                     uint32_t* ys) -> void;
+
+  /**
+   * @brief Sort codes and return the order
+   * @param codes Pointer to count codes
+   * @param count The number of codes
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param executor The executor running the threads
+   * @return std::vector<uint32_t> Input index of each sorted position, equal
+   * codes keep their input order
+   * @throws length_error If count does not fit in 32 bits
+   */
+  [[nodiscard]] static auto SortOrder(const uint64_t* codes, std::size_t count,
+                                      std::size_t thread_count = 0,
+                                      Executor* executor = GetDefaultExecutor())
+      -> std::vector<uint32_t>;
+  /**
+   * @brief Reorder points along the Z-order curve over their bounding box
+   * @param points The points, reordered in place
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param executor The executor running the threads
+   * @return std::vector<uint32_t> Input index of each sorted position
+   * @throws length_error If there are more points than fit in 32 bits
+   */
+  static auto Sort(PointCloud2D& points, std::size_t thread_count = 0,
+                   Executor* executor = GetDefaultExecutor())
+      -> std::vector<uint32_t>;
+  /**
+   * @brief Reorder points along the Z-order curve over their bounding box
+   * @param points The points, reordered in place
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param executor The executor running the threads
+   * @return std::vector<uint32_t> Input index of each sorted position
+   * @throws length_error If there are more points than fit in 32 bits
+   */
+  static auto Sort(std::vector<Point2D>& points, std::size_t thread_count = 0,
+                   Executor* executor = GetDefaultExecutor())
+      -> std::vector<uint32_t>;
+
+  /**
+   * @brief Gather values into sorted order
+   * @tparam T The value type
+   * @param order Input index of each sorted position
+   * @param input Pointer to the values in input order
+   * @param output Pointer to order.size() values, must not overlap input
+   */
+  template <typename T>
+  static auto Permute(const std::vector<uint32_t>& order, const T* input,
+                      T* output) -> void {
+    for (std::size_t i = 0; i < order.size(); ++i) {
+      output[i] = input[order[i]];
+    }
+  }
+  /**
+   * @brief Reorder a payload column the same way as the sorted points
+   * @tparam T The value type
+   * @param order Input index of each sorted position
+   * @param values The values in input order, reordered in place
+   * @throws invalid_argument If the sizes differ
+   */
+  template <typename T>
+  static auto Permute(const std::vector<uint32_t>& order,
+                      std::vector<T>& values) -> void {
+    if (order.size() != values.size()) {
+      throw std::invalid_argument("Order and values have different sizes");
+    }
+    std::vector<T> sorted(values.size());
+    Permute(order, values.data(), sorted.data());
+    values.swap(sorted);
+  }
+
+ protected:
+ private:
+  /**
+   * @brief Move bit i of value to bit 2i
+   * @param value The value
+   * @return uint64_t The spread bits
+   */
+  static constexpr auto Spread(uint32_t value) -> uint64_t {
+    uint64_t bits = value;
+    bits = (bits | (bits << 16U)) & 0x0000FFFF0000FFFFULL;
+    bits = (bits | (bits << 8U)) & 0x00FF00FF00FF00FFULL;
+    bits = (bits | (bits << 4U)) & 0x0F0F0F0F0F0F0F0FULL;
+    bits = (bits | (bits << 2U)) & 0x3333333333333333ULL;
+    bits = (bits | (bits << 1U)) & 0x5555555555555555ULL;
+    return bits;
+  }
+  /**
+   * @brief Move bit 2i of value to bit i
+   * @param value The value
+   * @return uint32_t The compacted bits
+   */
+  static constexpr auto Compact(uint64_t value) -> uint32_t {
+    auto bits = value & 0x5555555555555555ULL;
+    bits = (bits | (bits >> 1U)) & 0x3333333333333333ULL;
+    bits = (bits | (bits >> 2U)) & 0x0F0F0F0F0F0F0F0FULL;
+    bits = (bits | (bits >> 4U)) & 0x00FF00FF00FF00FFULL;
+    bits = (bits | (bits >> 8U)) & 0x0000FFFF0000FFFFULL;
+    bits = (bits | (bits >> 16U)) & 0x00000000FFFFFFFFULL;
+    return static_cast<uint32_t>(bits);
+  }
+};
+
+/**
+ * @brief Square grid of 2^32 by 2^32 cells over a bounding box
+ * @details Both axes share one cell size, the larger extent divided by
+ * 2^32 - 1, so cells stay square and the Z-order keeps neighbors close in
+ * both directions. Coordinates outside the box clamp to the border cells.
+ */
+class MortonGrid2D {
+ public:
+  /**
+   * @brief Construct a new MortonGrid2D object over the unit square
+   */
+  MortonGrid2D() = default;
+  /**
+   * @brief Construct a new MortonGrid2D object over a box
+   * @param min The lower left corner
+   * @param max The upper right corner
+   * @throws invalid_argument If a corner is not finite or max is below min
+   */
+  MortonGrid2D(const Point2D& min, const Point2D& max);
+  /**
+   * @brief Construct a new MortonGrid2D object over the bounding box of
+   * contiguous points
+   * @param points Pointer to the first point
+   * @param count The number of points
+   * @throws invalid_argument If a coordinate is not finite
+   */
+  MortonGrid2D(const Point2D* points, std::size_t count);
+  /**
+   * @brief Construct a new MortonGrid2D object over the bounding box of points
+   * @param points The points
+   * @throws invalid_argument If a coordinate is not finite
+   */
+  explicit MortonGrid2D(const PointCloud2D& points);
+
+  /**
+   * @brief Get the lower left corner
+   * @return Point2D The corner
+   */
+  [[nodiscard]] auto GetMin() const -> Point2D;
+  /**
+   * @brief Get the edge length of a cell
+   * @return double The cell size in coordinate units, zero for a point box
+   */
+  [[nodiscard]] auto GetCellSize() const -> double;
+
+  /**
+   * @brief Get the cell of a point
+   * @param point The point
+   * @return std::pair<uint32_t, uint32_t> x and y index of the cell
+   */
+  [[nodiscard]] auto Quantize(const Point2D& point) const
+      -> std::pair<uint32_t, uint32_t>;
+  /**
+   * @brief Get the Morton code of a point
+   * @param point The point
+   * @return uint64_t The Morton code of its cell
+   */
+  [[nodiscard]] auto GetCode(const Point2D& point) const -> uint64_t;
+  /**
+   * @brief Get the lower left corner of the cell of a Morton code
+   * @param code The Morton code
+   * @return Point2D The corner
+   */
+  [[nodiscard]] auto GetCellMin(uint64_t code) const -> Point2D;
+
+  /**
+   * @brief Get the Morton codes of coordinate arrays across threads
+   * @param xs Pointer to count x coordinates
+   * @param ys Pointer to count y coordinates
+   * @param count The number of points
+   * @param codes Pointer to count output codes
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param executor The executor running the threads
+   */
+  auto ComputeCodes(const double* xs, const double* ys, std::size_t count,
+                    uint64_t* codes, std::size_t thread_count = 0,
+                    Executor* executor = GetDefaultExecutor()) const
+      -> void;
+  /**
+   * @brief Get the Morton codes of contiguous points across threads
+   * @param points Pointer to the first point
+   * @param count The number of points
+   * @param codes Pointer to count output codes
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param executor The executor running the threads
+   */
+  auto ComputeCodes(const Point2D* points, std::size_t count, uint64_t* codes,
+                    std::size_t thread_count = 0,
+                    Executor* executor = GetDefaultExecutor()) const -> void;
+  /**
+   * @brief Get the Morton codes of points across threads
+   * @param points The points
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param executor The executor running the threads
+   * @return std::vector<uint64_t> The code of each point in index order
+   */
+  [[nodiscard]] auto ComputeCodes(
+      const PointCloud2D& points, std::size_t thread_count = 0,
+      Executor* executor = GetDefaultExecutor()) const
+      -> std::vector<uint64_t>;
+
+ protected:
+ private:
+  double min_x_{0.0};  ///< x coordinate of the lower left corner
+  double min_y_{0.0};  ///< y coordinate of the lower left corner
+  double scale_{4294967295.0};  ///< Cells per coordinate unit
+};
+}  // namespace Jeong0806::geometry
+
+#endif  // Jeong0806_GEOMETRY_MORTON_2D_HPP_
@@ -0,0 +1,120 @@
+/**
+ * @file geometry/neighbor.hpp
+ * @author Jeong Seong In (0806jsi@gmail.com)
+ * @brief Neighbor declaration for results of spatial index queries
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2023 Jeong0806, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#ifndef Jeong0806_GEOMETRY_NEIGHBOR_HPP_
+#define Jeong0806_GEOMETRY_NEIGHBOR_HPP_
+
+#include <cstddef>
+
+#include "geometry/distance.hpp"
+
+namespace Jeong0806::geometry {
+/**
+ * @brief A point found by a spatial index query
+ */
+struct Neighbor {
+  std::size_t index{0};  ///< Index of the point in the indexed input
+  double distance{0.0};  ///< Euclidean distance in coordinate units
+
+  /**
+   * @brief Get the distance as Distance object
+   * @param unit The unit of the indexed coordinates
+   * @return Distance The distance to the query point
+   */
+  [[nodiscard]] constexpr auto GetDistance(
+      Distance::DistanceType unit = Distance::DistanceType::kMeter) const
+      -> Distance {
+    return Distance(distance, unit);
+  }
+
+  /**
+   * @brief Order by distance, then by index for ties
+   * @param other The other neighbor
+   * @return true If this is closer
+   * @return false If this is not closer
+   */
+  constexpr auto operator<(const Neighbor& other) const -> bool {
+    return (distance < other.distance) ||
+           ((distance == other.distance) && (index < other.index));
+  }
+  /**
+   * @brief Compare with other neighbor for equality
+   * @param other The other neighbor
+   * @return true If index and distance are equal
+   * @return false If not equal
+   */
+  constexpr auto operator==(const Neighbor& other) const -> bool {
+    return (index == other.index) && (distance == other.distance);
+  }
+  /**
+   * @brief Compare with other neighbor for inequality
+   * @param other The other neighbor
+   * @return true If index or distance differ
+   * @return false If equal
+   */
+  constexpr auto operator!=(const Neighbor& other) const -> bool {
+    return !(*this == other);
+  }
+};
+
+/**
+ * @brief A pair of points found by a spatial index query
+ */
+struct NeighborPair {
+  std::size_t first{0};   ///< Lower input index of the pair
+  std::size_t second{0};  ///< Higher input index of the pair
+  double distance{0.0};   ///< Euclidean distance in coordinate units
+
+  /**
+   * @brief Get the distance as Distance object
+   * @param unit The unit of the indexed coordinates
+   * @return Distance The distance between the pair
+   */
+  [[nodiscard]] constexpr auto GetDistance(
+      Distance::DistanceType unit = Distance::DistanceType::kMeter) const
+      -> Distance {
+    return Distance(distance, unit);
+  }
+
+  /**
+   * @brief Order by first, then by second index
+   * @param other The other pair
+   * @return true If this comes first
+   * @return false If this does not come first
+   */
+  constexpr auto operator<(const NeighborPair& other) const -> bool {
+    return (first < other.first) ||
+           ((first == other.first) && (second < other.second));
+  }
+  /**
+   * @brief Compare with other pair for equality
+   * @param other The other pair
+   * @return true If indices and distance are equal
+   * @return false If not equal
+   */
+  constexpr auto operator==(const NeighborPair& other) const -> bool {
+    return (first == other.first) && (second == other.second) &&
+           (distance == other.distance);
+  }
+  /**
+   * @brief Compare with other pair for inequality
+   * @param other The other pair
+   * @return true If indices or distance differ
+   * @return false If equal
+   */
+  constexpr auto operator!=(const NeighborPair& other) const -> bool {
+    return !(*this == other);
+  }
+};
+}  // namespace Jeong0806::geometry
+
+#endif  // Jeong0806_GEOMETRY_NEIGHBOR_HPP_
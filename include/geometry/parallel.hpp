@@ -0,0 +1,287 @@
+/**
+ * @file geometry/parallel.hpp
+ * @author Jeong Seong In (0806jsi@gmail.com)
+ * @brief Executor, thread pool and parallel loop declarations for batch
+ * geometry operations
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2023 Jeong0806, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#ifndef Jeong0806_GEOMETRY_PARALLEL_HPP_
+#define Jeong0806_GEOMETRY_PARALLEL_HPP_
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Jeong0806::geometry {
+/**
+ * @brief Get the number of hardware threads
+ * @return std::size_t The number of hardware threads, at least one
+ */
+[[nodiscard]] auto GetDefaultThreadCount() -> std::size_t;
+
+/**
+ * @brief Interface running batches of tasks on a set of threads
+ * @details Batch operations hand their work to an executor instead of
+ * starting threads, so components running at once share its threads rather
+ * than oversubscribing the cores. Callers may pass their own implementation.
+ */
+class Executor {
+ public:
+  Executor() = default;
+  Executor(const Executor& other) = delete;
+  Executor(Executor&& other) = delete;
+  virtual ~Executor() = default;
+
+  auto operator=(const Executor& other) -> Executor& = delete;
+  auto operator=(Executor&& other) -> Executor& = delete;
+
+  /**
+   * @brief Get the number of tasks that may run at the same time
+   * @return std::size_t The number of threads, at least one
+   */
+  [[nodiscard]] virtual auto GetThreadCount() const -> std::size_t = 0;
+  /**
+   * @brief Run tasks and wait for all of them
+   * @details Tasks may run concurrently and in any order, and may
+   * themselves call Run().
+   * @param task_count The number of tasks
+   * @param task Callable receiving the task index in [0, task_count)
+   * @throws Rethrows the first exception thrown by task after every task
+   * finished
+   */
+  virtual auto Run(std::size_t task_count,
+                   const std::function<void(std::size_t)>& task) -> void = 0;
+
+ protected:
+ private:
+};
+
+/**
+ * @brief Work-stealing thread pool
+ * @details Each worker owns a deque of tasks, taking the newest of its own
+ * and stealing the oldest of the others when it runs dry. A thread calling
+ * Run() runs queued tasks too while it waits, so nested calls never block
+ * the pool and a pool of n threads starts n - 1 workers.
+ */
+class ThreadPool : public Executor {
+ public:
+  /**
+   * @brief Construct a new ThreadPool object
+   * @param thread_count The number of threads, zero for
+   * GetDefaultThreadCount()
+   * @param cpus CPUs the workers are pinned to in turn, empty to leave them
+   * to the scheduler, ignored outside Linux
+   * @throws invalid_argument If a CPU is not available to the process
+   */
+  explicit ThreadPool(std::size_t thread_count = 0,
+                      const std::vector<std::size_t>& cpus = {});
+  ~ThreadPool() override;
+
+  [[nodiscard]] auto GetThreadCount() const -> std::size_t override;
+  auto Run(std::size_t task_count,
+           const std::function<void(std::size_t)>& task) -> void override;
+
+ protected:
+ private:
+  struct Batch;
+
+  /**
+   * @brief A queued task of a batch
+   */
+  struct Task {
+    Batch* batch{nullptr};  ///< Batch the task belongs to
+    std::size_t index{0};   ///< Index passed to the task
+  };
+
+  /**
+   * @brief Task deque owned by a worker
+   */
+  struct Queue {
+    std::mutex mutex;        ///< Guards tasks
+    std::deque<Task> tasks;  ///< Newest task at the back
+  };
+
+  /**
+   * @brief Take a task, the newest of queue first, then the oldest of the
+   * others
+   * @param queue The queue of the calling worker, or the first queue to look
+   * at for other threads
+   * @param own Whether the queue belongs to the calling worker
+   * @param task The task taken
+   * @return bool Whether a task was taken
+   */
+  auto TakeTask(std::size_t queue, bool own, Task& task) -> bool;
+  /**
+   * @brief Run a task and count it as finished
+   * @param task The task
+   */
+  auto Execute(const Task& task) -> void;
+  /**
+   * @brief Run tasks until the pool stops
+   * @param queue The queue of the worker
+   */
+  auto Work(std::size_t queue) -> void;
+  /**
+   * @brief Wake the workers to exit and join them
+   */
+  auto Stop() -> void;
+
+  std::size_t thread_count_;                    ///< Workers and the caller
+  std::vector<std::unique_ptr<Queue>> queues_;  ///< One per worker
+  std::vector<std::thread> workers_;            ///< Threads draining queues_
+  std::mutex mutex_;                            ///< Guards the members below
+  std::condition_variable wake_;                ///< Signals tasks or finish
+  std::size_t pending_{0};                      ///< Queued tasks
+  std::size_t next_queue_{0};                   ///< Queue of the next batch
+  bool stop_{false};                            ///< Whether workers exit
+};
+
+/**
+ * @brief Get the executor batch operations run on by default
+ * @return Executor* The executor set by SetDefaultExecutor(), or a
+ * library-owned ThreadPool of GetDefaultThreadCount() threads
+ */
+[[nodiscard]] auto GetDefaultExecutor() -> Executor*;
+/**
+ * @brief Set the executor batch operations run on by default
+ * @param executor The executor, which must outlive its use, or nullptr for
+ * the library-owned ThreadPool
+ * @return Executor* The previous default executor
+ */
+auto SetDefaultExecutor(Executor* executor) -> Executor*;
+
+/**
+ * @brief Get the number of ranges a batch operation splits into
+ * @param thread_count The requested number of threads, zero for the thread
+ * count of the executor
+ * @param executor The executor, nullptr for GetDefaultExecutor()
+ * @return std::size_t The number of threads, at least one
+ */
+[[nodiscard]] auto ResolveThreadCount(std::size_t thread_count,
+                                      Executor* executor) -> std::size_t;
+
+/**
+ * @brief Run body over [0, count) split into contiguous ranges across threads
+ * @param count The number of items
+ * @param body Callable receiving a [begin, end) range of items
+ * @param thread_count The number of ranges, zero for the thread count of the
+ * executor
+ * @param executor The executor running the ranges, nullptr for
+ * GetDefaultExecutor()
+ * @throws Rethrows the first exception thrown by body
+ */
+auto ParallelFor(std::size_t count,
+                 const std::function<void(std::size_t, std::size_t)>& body,
+                 std::size_t thread_count = 0,
+                 Executor* executor = GetDefaultExecutor()) -> void;
+
+/**
+ * @brief Map contiguous ranges of [0, count) across threads and reduce the
+ * results in range order
+ * @tparam T The result type
+ * @tparam Map Callable receiving a [begin, end) range and returning T
+ * @tparam Reduce Callable combining two T into one
+ * @param count The number of items
+ * @param identity The result of no items
+ * @param map The range mapping
+ * @param reduce The associative reduction
+ * @param thread_count The number of ranges, zero for the thread count of the
+ * executor
+ * @param executor The executor running the ranges, nullptr for
+ * GetDefaultExecutor()
+ * @return T The reduction of the range results, the same for the same
+ * number of ranges
+ * @throws Rethrows the first exception thrown by map
+ */
+template <typename T, typename Map, typename Reduce>
+auto ParallelReduce(std::size_t count, T identity, Map map, Reduce reduce,
+                    std::size_t thread_count = 0,
+                    Executor* executor = GetDefaultExecutor()) -> T {
+  const auto kRanges =
+      std::min(ResolveThreadCount(thread_count, executor), count);
+  std::vector<T> results(kRanges, identity);
+  ParallelFor(
+      kRanges,
+      [&](std::size_t begin, std::size_t end) {
+        for (auto range = begin; range < end; ++range) {
+          results[range] = map((count * range) / kRanges,
+                               (count * (range + 1U)) / kRanges);
+        }
+      },
+      kRanges, executor);
+  for (auto& result : results) {
+    identity = reduce(std::move(identity), std::move(result));
+  }
+  return identity;
+}
+
+/**
+ * @brief Minimum number of items sorted by one thread in ParallelSort
+ */
+constexpr std::size_t kMinParallelSortSize{1U << 12U};
+
+/**
+ * @brief Sort contiguous blocks across threads, then merge pairs of runs
+ * level by level
+ * @tparam Iterator Random access iterator
+ * @tparam Compare Strict weak ordering of the elements
+ * @param first The first element
+ * @param last One past the last element
+ * @param less The ordering, equal elements may be reordered
+ * @param thread_count The number of threads, zero for the thread count of the
+ * executor
+ * @param executor The executor running the blocks, nullptr for
+ * GetDefaultExecutor()
+ */
+template <typename Iterator, typename Compare>
+auto ParallelSort(Iterator first, Iterator last, Compare less,
+                  std::size_t thread_count = 0,
+                  Executor* executor = GetDefaultExecutor()) -> void {
+  const auto kCount = static_cast<std::size_t>(last - first);
+  thread_count = ResolveThreadCount(thread_count, executor);
+  const auto kBlocks = std::max<std::size_t>(
+      std::min(thread_count, kCount / kMinParallelSortSize), 1U);
+  const auto kBound = [&](std::size_t block) {
+    return first + static_cast<std::ptrdiff_t>((kCount * block) / kBlocks);
+  };
+
+  ParallelFor(
+      kBlocks,
+      [&](std::size_t begin, std::size_t end) {
+        for (auto block = begin; block < end; ++block) {
+          std::sort(kBound(block), kBound(block + 1U), less);
+        }
+      },
+      thread_count, executor);
+  for (std::size_t width = 1; width < kBlocks; width *= 2U) {
+    const auto kPairs = (kBlocks + (2U * width) - 1U) / (2U * width);
+    ParallelFor(
+        kPairs,
+        [&](std::size_t begin, std::size_t end) {
+          for (auto pair = begin; pair < end; ++pair) {
+            const auto kFirst = 2U * width * pair;
+            std::inplace_merge(kBound(kFirst),
+                               kBound(std::min(kFirst + width, kBlocks)),
+                               kBound(std::min(kFirst + (2U * width), kBlocks)),
+                               less);
+          }
+        },
+        thread_count, executor);
+  }
+}
+}  // namespace Jeong0806::geometry
+
+#endif  // Jeong0806_GEOMETRY_PARALLEL_HPP_
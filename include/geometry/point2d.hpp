@@ -13,140 +13,361 @@
 #ifndef Jeong0806_GEOMETRY_POINT_2D_HPP_
 #define Jeong0806_GEOMETRY_POINT_2D_HPP_
 
+#include <cstdint>
+#include <type_traits>
+
 namespace Jeong0806::geometry {
 /**
  * @brief Point class with 2-demension
+ * @details BasicPoint2 is a trivially copyable, standard-layout value type of
+ * two coordinates, so arrays of points are dense and can be copied in bulk.
+ * Point2D holds doubles and Point2F holds floats, which halves the memory and
+ * bandwidth of large point sets. A float has a 24-bit significand, so a
+ * coordinate of magnitude 1e6 rounds to a multiple of 0.0625 and distances
+ * keep about 7 significant digits; keep float coordinates in a local frame
+ * near the origin when the absolute precision matters. Widening conversions
+ * are implicit and narrowing ones are explicit.
+ * @tparam T The coordinate type, float or double
  */
-class Point2D {
+template <typename T>
+class BasicPoint2 {
  public:
+  static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>,
+                "BasicPoint2 coordinates must be float or double");
+
+  /**
+   * @brief The coordinate type
+   */
+  using ValueType = T;
+
   /**
-   * @brief Construct a new Point2D object
+   * @brief Construct a new BasicPoint2 object
    */
-  Point2D() = default;
+  BasicPoint2() = default;
   /**
-   * @brief Construct a new Point2D object with x, y coordinate values
-   * @param x Double type x coordinate value
-   * @param y Double type y coordinate value
+   * @brief Construct a new BasicPoint2 object with x, y coordinate values
+   * @param x x coordinate value
+   * @param y y coordinate value
    */
-  Point2D(double x, double y);
+  constexpr BasicPoint2(T x, T y);
   /**
-   * @brief Copy construct a new Point2D object with other Point2D object
-   * @param other Point2D object
+   * @brief Convert a point of a narrower coordinate type, which is exact
+   * @tparam U The coordinate type of other
+   * @param other The point to convert
    */
-  Point2D(const Point2D& other) = default;
+  template <typename U, std::enable_if_t<(sizeof(U) < sizeof(T)), int> = 0>
+  constexpr BasicPoint2(const BasicPoint2<U>& other);
   /**
-   * @brief Move construct a new Point2D object with other Point2D object
-   * @param other Point2D object
+   * @brief Convert a point of a wider coordinate type, rounding each
+   * coordinate to nearest
+   * @tparam U The coordinate type of other
+   * @param other The point to convert
    */
-  Point2D(Point2D&& other) noexcept = default;
+  template <typename U, std::enable_if_t<(sizeof(U) > sizeof(T)), int> = 0>
+  constexpr explicit BasicPoint2(const BasicPoint2<U>& other);
   /**
-   * @brief Destroy the Point2D object
+   * @brief Copy construct a new BasicPoint2 object with other BasicPoint2
+   * object
+   * @param other BasicPoint2 object
    */
-  virtual ~Point2D() = default;
+  BasicPoint2(const BasicPoint2& other) = default;
+  /**
+   * @brief Move construct a new BasicPoint2 object with other BasicPoint2
+   * object
+   * @param other BasicPoint2 object
+   */
+  BasicPoint2(BasicPoint2&& other) noexcept = default;
+  /**
+   * @brief Destroy the BasicPoint2 object
+   */
+  ~BasicPoint2() = default;
 
   /**
    * @brief Copy assignment operator
-   * @param other Point2D object
-   * @return Point2D& Reference of Point2D object
+   * @param other BasicPoint2 object
+   * @return BasicPoint2& Reference of BasicPoint2 object
    */
-  auto operator=(const Point2D& other) -> Point2D& = default;
+  auto operator=(const BasicPoint2& other) -> BasicPoint2& = default;
   /**
    * @brief Move assignment operator
-   * @param other Point2D object
-   * @return Point2D& Reference of Point2D object
+   * @param other BasicPoint2 object
+   * @return BasicPoint2& Reference of BasicPoint2 object
    */
-  auto operator=(Point2D&& other) -> Point2D& = default;
+  auto operator=(BasicPoint2&& other) -> BasicPoint2& = default;
 
   /**
    * @brief Clculate distance between this point and target point
-   * @param target Other Point2D object to calculate distance
-   * @return double Euclidean distance betwwen this point and target point
+   * @param target Other BasicPoint2 object to calculate distance
+   * @return T Euclidean distance betwwen this point and target point
    */
-  auto CalculateDistance(const Point2D& target) const -> double;
+  auto CalculateDistance(const BasicPoint2& target) const -> T;
   /**
    * @brief Clculate distance between lhs point and rhs point
-   * @param lhs Left hand side Point2D object
-   * @param rhs Right hand side Point2D object
-   * @return double double Euclidean distance betwwen lhs point and rhs point
+   * @param lhs Left hand side BasicPoint2 object
+   * @param rhs Right hand side BasicPoint2 object
+   * @return T Euclidean distance betwwen lhs point and rhs point
+   */
+  [[nodiscard]] static auto CalculateDistance(const BasicPoint2& lhs,
+                                              const BasicPoint2& rhs) -> T;
+  /**
+   * @brief Calculate squared distance between this point and target point
+   * @param target Other BasicPoint2 object to calculate squared distance
+   * @return T Squared Euclidean distance between this point and target point
    */
-  [[nodiscard]] static auto CalculateDistance(const Point2D& lhs,
-                                              const Point2D& rhs) -> double;
+  [[nodiscard]] constexpr auto CalculateSquaredDistance(
+      const BasicPoint2& target) const -> T;
+  /**
+   * @brief Calculate squared distance between lhs point and rhs point
+   * @details Ordering by squared distance gives the same order as
+   * CalculateDistance without calling sqrt.
+   * @param lhs Left hand side BasicPoint2 object
+   * @param rhs Right hand side BasicPoint2 object
+   * @return T Squared Euclidean distance between lhs point and rhs point
+   */
+  [[nodiscard]] static constexpr auto CalculateSquaredDistance(
+      const BasicPoint2& lhs, const BasicPoint2& rhs) -> T;
+  /**
+   * @brief Check if target point is within radius of this point
+   * @details Compares squared values, so the result can differ from
+   * CalculateDistance(target) <= radius only by the rounding of radius^2.
+   * @param target Other BasicPoint2 object
+   * @param radius Inclusive radius in coordinate units
+   * @return true If the distance is not greater than radius
+   * @return false If the distance is greater than radius or radius is negative
+   */
+  [[nodiscard]] constexpr auto IsWithin(const BasicPoint2& target,
+                                        T radius) const -> bool;
+  /**
+   * @brief Compare distances of lhs and rhs points from origin point
+   * @param lhs Left hand side BasicPoint2 object
+   * @param rhs Right hand side BasicPoint2 object
+   * @param origin The origin point
+   * @return int32_t Negative if lhs is closer, positive if rhs is closer, zero
+   * if equally far
+   */
+  [[nodiscard]] static constexpr auto CompareDistance(
+      const BasicPoint2& lhs, const BasicPoint2& rhs,
+      const BasicPoint2& origin) -> int32_t;
 
   /**
    * @brief Set x coordinate value
-   * @param x Double type input x coordinate value
+   * @param x Input x coordinate value
    */
-  auto SetX(double x) -> void;
+  constexpr auto SetX(T x) -> void;
   /**
    * @brief Set y coordinate value
-   * @param y Double type input y coordinate value
+   * @param y Input y coordinate value
    */
-  auto SetY(double y) -> void;
+  constexpr auto SetY(T y) -> void;
   /**
    * @brief Get x coordinate value of this point
-   * @return double x coordinate value of this point
+   * @return T x coordinate value of this point
    */
-  [[nodiscard]] auto GetX() const -> double;
+  [[nodiscard]] constexpr auto GetX() const -> T;
   /**
    * @brief Get y coordinate value of this point
-   * @return double y coordinate value of this point
+   * @return T y coordinate value of this point
    */
-  [[nodiscard]] auto GetY() const -> double;
+  [[nodiscard]] constexpr auto GetY() const -> T;
   /**
    * @brief Add the x and y coordinates of this and target object respectively
-   * @param other Point2D object
-   * @return Point2D Point2D& Reference of Point2D object
+   * @param other BasicPoint2 object
+   * @return BasicPoint2 The sum
    */
-  auto operator+(const Point2D& other) const -> Point2D;
+  constexpr auto operator+(const BasicPoint2& other) const -> BasicPoint2;
   /**
-   * @brief Subtract the x and y coordinates of this and target object respectively
-   * @param other Point2D object
-   * @return Point2D Point2D& Reference of Point2D object
+   * @brief Subtract the x and y coordinates of this and target object
+   * respectively
+   * @param other BasicPoint2 object
+   * @return BasicPoint2 The difference
    */
-  auto operator-(const Point2D& other) const -> Point2D;
+  constexpr auto operator-(const BasicPoint2& other) const -> BasicPoint2;
   /**
    * @brief Add target object's x, y coordinates in this object's
-   * @param other Point2D object
+   * @param other BasicPoint2 object
    */
-  auto operator+=(const Point2D& other) -> void;
+  constexpr auto operator+=(const BasicPoint2& other) -> void;
   /**
    * @brief Subtract target object's x, y coordinates in this object's
-   * @param other Point2D object
+   * @param other BasicPoint2 object
    */
-  auto operator-=(const Point2D& other) -> void;
+  constexpr auto operator-=(const BasicPoint2& other) -> void;
   /**
    * @brief Multiply scalar by the coordinates x and y of this
-   * @param scalar Double type operand
-   * @return Point2D Point2D& Reference of Point2D object
+   * @param scalar Operand
+   * @return BasicPoint2 The product
    */
-  auto operator*(double scalar) const -> Point2D;
+  constexpr auto operator*(T scalar) const -> BasicPoint2;
   /**
    * @brief Divide scalar by the coordinates x and y of this
-   * @param scalar Double type operand
-   * @return Point2D Point2D& Reference of Point2D object
-   * @throws invalid_argument If operand is zero, nan, or inf
+   * @param scalar Operand
+   * @return BasicPoint2 The quotient
    */
-  auto operator/(double scalar) const -> Point2D;
+  constexpr auto operator/(T scalar) const -> BasicPoint2;
   /**
-   * @brief Check if the coordinates x and y of this and target object have the same values
-   * @param other Point2D object
+   * @brief Check if the coordinates x and y of this and target object have
+   * the same values
+   * @param other BasicPoint2 object
    * @return true If this and target object's x, y coordinates is equal
    * @return false If this and target object's x, y coordinates is not equal
    */
-  auto operator==(const Point2D& other) const -> bool;
+  constexpr auto operator==(const BasicPoint2& other) const -> bool;
   /**
-   * @brief Check if the coordinates x and y of this and target object have the different values
-   * @param other Point2D object
+   * @brief Check if the coordinates x and y of this and target object have
+   * the different values
+   * @param other BasicPoint2 object
    * @return true If this and target object's x, y coordinates is not equal
    * @return false If this and target object's x, y coordinates is equal
    */
-  auto operator!=(const Point2D& other) const -> bool;
+  constexpr auto operator!=(const BasicPoint2& other) const -> bool;
 
  protected:
  private:
-  double x_{0.0};  ///< x coordinate
-  double y_{0.0};  ///< y coordinate
+  T x_{0};  ///< x coordinate
+  T y_{0};  ///< y coordinate
 };
+
+/**
+ * @brief Point with double coordinates
+ */
+using Point2D = BasicPoint2<double>;
+/**
+ * @brief Point with float coordinates
+ */
+using Point2F = BasicPoint2<float>;
+
+// CalculateDistance is instantiated in point2d.cpp
+extern template class BasicPoint2<float>;
+extern template class BasicPoint2<double>;
+
+static_assert(std::is_trivially_copyable_v<Point2D>,
+              "Point2D must be trivially copyable");
+static_assert(std::is_standard_layout_v<Point2D>,
+              "Point2D must be standard layout");
+static_assert(sizeof(Point2D) == 2U * sizeof(double),
+              "Point2D must not carry any member but its coordinates");
+static_assert(std::is_trivially_copyable_v<Point2F>,
+              "Point2F must be trivially copyable");
+static_assert(std::is_standard_layout_v<Point2F>,
+              "Point2F must be standard layout");
+static_assert(sizeof(Point2F) == 2U * sizeof(float),
+              "Point2F must not carry any member but its coordinates");
+static_assert(std::is_convertible_v<Point2F, Point2D>,
+              "Widening Point2F to Point2D must be implicit");
+static_assert(!std::is_convertible_v<Point2D, Point2F> &&
+                  std::is_constructible_v<Point2F, Point2D>,
+              "Narrowing Point2D to Point2F must be explicit");
+
+template <typename T>
+constexpr BasicPoint2<T>::BasicPoint2(T x, T y) : x_(x), y_(y) {}
+
+template <typename T>
+template <typename U, std::enable_if_t<(sizeof(U) < sizeof(T)), int>>
+constexpr BasicPoint2<T>::BasicPoint2(const BasicPoint2<U>& other)
+    : x_(other.GetX()), y_(other.GetY()) {}
+
+template <typename T>
+template <typename U, std::enable_if_t<(sizeof(U) > sizeof(T)), int>>
+constexpr BasicPoint2<T>::BasicPoint2(const BasicPoint2<U>& other)
+    : x_(static_cast<T>(other.GetX())), y_(static_cast<T>(other.GetY())) {}
+
+template <typename T>
+constexpr auto BasicPoint2<T>::CalculateSquaredDistance(
+    const BasicPoint2& target) const -> T {
+  return BasicPoint2::CalculateSquaredDistance(*this, target);
+}
+
+template <typename T>
+constexpr auto BasicPoint2<T>::CalculateSquaredDistance(const BasicPoint2& lhs,
+                                                        const BasicPoint2& rhs)
+    -> T {
+  const auto kDx = lhs.x_ - rhs.x_;
+  const auto kDy = lhs.y_ - rhs.y_;
+  return (kDx * kDx) + (kDy * kDy);
+}
+
+template <typename T>
+constexpr auto BasicPoint2<T>::IsWithin(const BasicPoint2& target,
+                                        T radius) const -> bool {
+  return (radius >= T{0}) &&
+         (CalculateSquaredDistance(target) <= (radius * radius));
+}
+
+template <typename T>
+constexpr auto BasicPoint2<T>::CompareDistance(const BasicPoint2& lhs,
+                                               const BasicPoint2& rhs,
+                                               const BasicPoint2& origin)
+    -> int32_t {
+  const auto kLhs = CalculateSquaredDistance(lhs, origin);
+  const auto kRhs = CalculateSquaredDistance(rhs, origin);
+  return static_cast<int32_t>(kLhs > kRhs) - static_cast<int32_t>(kLhs < kRhs);
+}
+
+template <typename T>
+constexpr auto BasicPoint2<T>::GetX() const -> T {
+  return x_;
+}
+
+template <typename T>
+constexpr auto BasicPoint2<T>::GetY() const -> T {
+  return y_;
+}
+
+template <typename T>
+constexpr auto BasicPoint2<T>::SetX(T x) -> void {
+  x_ = x;
+}
+
+template <typename T>
+constexpr auto BasicPoint2<T>::SetY(T y) -> void {
+  y_ = y;
+}
+
+template <typename T>
+constexpr auto BasicPoint2<T>::operator+(const BasicPoint2& other) const
+    -> BasicPoint2 {
+  return BasicPoint2(x_ + other.x_, y_ + other.y_);
+}
+
+template <typename T>
+constexpr auto BasicPoint2<T>::operator-(const BasicPoint2& other) const
+    -> BasicPoint2 {
+  return BasicPoint2(x_ - other.x_, y_ - other.y_);
+}
+
+template <typename T>
+constexpr auto BasicPoint2<T>::operator+=(const BasicPoint2& other) -> void {
+  x_ += other.x_;
+  y_ += other.y_;
+}
+
+template <typename T>
+constexpr auto BasicPoint2<T>::operator-=(const BasicPoint2& other) -> void {
+  x_ -= other.x_;
+  y_ -= other.y_;
+}
+
+template <typename T>
+constexpr auto BasicPoint2<T>::operator*(T scalar) const -> BasicPoint2 {
+  return BasicPoint2(x_ * scalar, y_ * scalar);
+}
+
+template <typename T>
+constexpr auto BasicPoint2<T>::operator/(T scalar) const -> BasicPoint2 {
+  return BasicPoint2(x_ / scalar, y_ / scalar);
+}
+
+template <typename T>
+constexpr auto BasicPoint2<T>::operator==(const BasicPoint2& other) const
+    -> bool {
+  return (x_ == other.x_) && (y_ == other.y_);
+}
+
+template <typename T>
+constexpr auto BasicPoint2<T>::operator!=(const BasicPoint2& other) const
+    -> bool {
+  return (x_ != other.x_) || (y_ != other.y_);
+}
 }  // namespace Jeong0806::geometry
 
 #endif  // Jeong0806_GEOMETRY_POINT_2D_HPP_
@@ -0,0 +1,488 @@
+/**
+ * @file geometry/point2i.hpp
+ * @author Jeong Seong In (0806jsi@gmail.com)
+ * @brief Fixed-point integer point class declaration with 2-dimension
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2023 Jeong0806, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#ifndef Jeong0806_GEOMETRY_POINT_2I_HPP_
+#define Jeong0806_GEOMETRY_POINT_2I_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+#include "geometry/distance.hpp"
+#include "geometry/point2d.hpp"
+
+namespace Jeong0806::geometry {
+/**
+ * @brief Unsigned 128-bit integer holding exact squared integer distances
+ */
+struct UInt128 {
+  uint64_t high{0};  ///< Upper 64 bits
+  uint64_t low{0};   ///< Lower 64 bits
+
+  /**
+   * @brief Multiply two 64-bit values without losing a bit
+   * @param lhs Left hand side operand
+   * @param rhs Right hand side operand
+   * @return UInt128 The exact product
+   */
+  [[nodiscard]] static constexpr auto Multiply(uint64_t lhs, uint64_t rhs)
+      -> UInt128;
+  /**
+   * @brief Add other value, wrapping around past 2^128
+   * @param other The other value
+   * @return UInt128 The sum
+   */
+  constexpr auto operator+(const UInt128& other) const -> UInt128;
+  /**
+   * @brief Convert to the nearest double
+   * @return double The value
+   */
+  [[nodiscard]] constexpr auto ToDouble() const -> double;
+
+  constexpr auto operator==(const UInt128& other) const -> bool;
+  constexpr auto operator!=(const UInt128& other) const -> bool;
+  constexpr auto operator<(const UInt128& other) const -> bool;
+  constexpr auto operator<=(const UInt128& other) const -> bool;
+  constexpr auto operator>(const UInt128& other) const -> bool;
+  constexpr auto operator>=(const UInt128& other) const -> bool;
+};
+
+/**
+ * @brief Point class with 2-dimension integer coordinates in fixed ticks
+ * @details A tick is kResolution nanometers, so coordinates convert to and
+ * from Distance without rounding, compare and hash exactly, and squared
+ * distances are exact integers. Coordinates are limited to kLimit ticks,
+ * which keeps differences of int32 points within int32 for the SIMD kernels,
+ * every squared distance below 2^127 and every coordinate a valid Distance.
+ * @tparam T The coordinate type, int32_t or int64_t
+ * @tparam kResolution Nanometers in one tick
+ */
+template <typename T, int64_t kResolution = 1>
+class BasicPoint2I {
+ public:
+  static_assert(std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t>,
+                "BasicPoint2I coordinates must be int32_t or int64_t");
+  static_assert(kResolution > 0, "Resolution must be positive");
+
+  /**
+   * @brief The coordinate type
+   */
+  using ValueType = T;
+
+  /**
+   * @brief Nanometers in one tick
+   */
+  static constexpr int64_t kTickNanometers{kResolution};
+  /**
+   * @brief Largest coordinate magnitude in ticks
+   */
+  static constexpr T kLimit{static_cast<T>(std::min<int64_t>(
+      std::is_same_v<T, int32_t> ? (int64_t{1} << 30) - 1
+                                 : (int64_t{1} << 62) - 1,
+      std::numeric_limits<int64_t>::max() / kResolution))};
+
+  /**
+   * @brief Construct a new BasicPoint2I object at origin
+   */
+  BasicPoint2I() = default;
+  /**
+   * @brief Construct a new BasicPoint2I object with coordinates in ticks
+   * @param x x coordinate in ticks, not greater than kLimit in magnitude
+   * @param y y coordinate in ticks, not greater than kLimit in magnitude
+   * @throws out_of_range If a coordinate exceeds kLimit ticks
+   */
+  constexpr BasicPoint2I(T x, T y);
+
+  /**
+   * @brief Snap distances from origin to the nearest tick, halves away from
+   * zero
+   * @param x x coordinate distance
+   * @param y y coordinate distance
+   * @return BasicPoint2I The snapped point
+   * @throws out_of_range If a coordinate exceeds kLimit ticks
+   */
+  [[nodiscard]] static constexpr auto FromDistances(const Distance& x,
+                                                    const Distance& y)
+      -> BasicPoint2I;
+  /**
+   * @brief Snap a floating point to the nearest tick, halves away from zero
+   * @param point The point with coordinates in unit
+   * @param unit The distance type of the coordinates
+   * @return BasicPoint2I The snapped point
+   * @throws out_of_range If a coordinate is not finite or exceeds kLimit
+   * ticks
+   */
+  [[nodiscard]] static auto FromPoint(const Point2D& point,
+                                      Distance::DistanceType unit)
+      -> BasicPoint2I;
+  /**
+   * @brief Convert to a floating point
+   * @param unit The distance type of the output coordinates
+   * @return Point2D The point, rounded to nearest double
+   */
+  [[nodiscard]] constexpr auto ToPoint(Distance::DistanceType unit) const
+      -> Point2D;
+
+  /**
+   * @brief Get x coordinate value in ticks
+   * @return T x coordinate value
+   */
+  [[nodiscard]] constexpr auto GetX() const -> T;
+  /**
+   * @brief Get y coordinate value in ticks
+   * @return T y coordinate value
+   */
+  [[nodiscard]] constexpr auto GetY() const -> T;
+  /**
+   * @brief Set x coordinate value in ticks
+   * @param x x coordinate value
+   * @throws out_of_range If x exceeds kLimit ticks
+   */
+  constexpr auto SetX(T x) -> void;
+  /**
+   * @brief Set y coordinate value in ticks
+   * @param y y coordinate value
+   * @throws out_of_range If y exceeds kLimit ticks
+   */
+  constexpr auto SetY(T y) -> void;
+  /**
+   * @brief Get the exact x coordinate distance from origin
+   * @return Distance x coordinate distance
+   */
+  [[nodiscard]] constexpr auto GetXDistance() const -> Distance;
+  /**
+   * @brief Get the exact y coordinate distance from origin
+   * @return Distance y coordinate distance
+   */
+  [[nodiscard]] constexpr auto GetYDistance() const -> Distance;
+
+  /**
+   * @brief Calculate exact squared distance between lhs and rhs points
+   * @param lhs Left hand side BasicPoint2I object
+   * @param rhs Right hand side BasicPoint2I object
+   * @return UInt128 Squared Euclidean distance in square ticks
+   */
+  [[nodiscard]] static constexpr auto CalculateSquaredDistance(
+      const BasicPoint2I& lhs, const BasicPoint2I& rhs) -> UInt128;
+  /**
+   * @brief Calculate exact squared distance between this point and target
+   * point
+   * @param target Other BasicPoint2I object
+   * @return UInt128 Squared Euclidean distance in square ticks
+   */
+  [[nodiscard]] constexpr auto CalculateSquaredDistance(
+      const BasicPoint2I& target) const -> UInt128;
+  /**
+   * @brief Check exactly if target point is within radius of this point
+   * @param target Other BasicPoint2I object
+   * @param radius Inclusive radius in ticks
+   * @return true If the distance is not greater than radius
+   * @return false If the distance is greater than radius or radius is negative
+   */
+  [[nodiscard]] constexpr auto IsWithin(const BasicPoint2I& target,
+                                        int64_t radius) const -> bool;
+  /**
+   * @brief Compare distances of lhs and rhs points from origin point exactly
+   * @param lhs Left hand side BasicPoint2I object
+   * @param rhs Right hand side BasicPoint2I object
+   * @param origin The origin point
+   * @return int32_t Negative if lhs is closer, positive if rhs is closer, zero
+   * if equally far
+   */
+  [[nodiscard]] static constexpr auto CompareDistance(
+      const BasicPoint2I& lhs, const BasicPoint2I& rhs,
+      const BasicPoint2I& origin) -> int32_t;
+
+  /**
+   * @brief Check if the coordinates of this and other object are equal
+   * @param other BasicPoint2I object
+   * @return true If equal
+   * @return false If not equal
+   */
+  constexpr auto operator==(const BasicPoint2I& other) const -> bool;
+  /**
+   * @brief Check if the coordinates of this and other object are different
+   * @param other BasicPoint2I object
+   * @return true If not equal
+   * @return false If equal
+   */
+  constexpr auto operator!=(const BasicPoint2I& other) const -> bool;
+  /**
+   * @brief Order by x coordinate, then by y coordinate
+   * @param other BasicPoint2I object
+   * @return true If this point comes first
+   * @return false If not
+   */
+  constexpr auto operator<(const BasicPoint2I& other) const -> bool;
+
+ protected:
+ private:
+  /**
+   * @brief Check a coordinate against kLimit
+   * @param ticks The coordinate in ticks
+   * @return T The coordinate
+   * @throws out_of_range If ticks exceeds kLimit in magnitude
+   */
+  static constexpr auto CheckLimit(int64_t ticks) -> T;
+  /**
+   * @brief Round nanometers to the nearest tick, halves away from zero
+   * @param nanometer The nanometer count
+   * @return T The coordinate in ticks
+   * @throws out_of_range If the result exceeds kLimit in magnitude
+   */
+  static constexpr auto SnapNanometer(int64_t nanometer) -> T;
+  /**
+   * @brief Round a fractional tick count to nearest, halves away from zero
+   * @param ticks The fractional tick count
+   * @return T The coordinate in ticks
+   * @throws out_of_range If ticks is not finite or exceeds kLimit
+   */
+  static auto SnapTicks(double ticks) -> T;
+
+  T x_{0};  ///< x coordinate in ticks
+  T y_{0};  ///< y coordinate in ticks
+};
+
+/**
+ * @brief Point with int64 nanometer coordinates, up to 4.6e+9 meters
+ */
+using Point2I = BasicPoint2I<int64_t>;
+/**
+ * @brief Point with int32 millimeter coordinates, up to 1073 kilometers
+ */
+using Point2I32 = BasicPoint2I<int32_t, 1000000>;
+
+static_assert(std::is_trivially_copyable_v<Point2I>,
+              "Point2I must be trivially copyable");
+static_assert(sizeof(Point2I) == 2U * sizeof(int64_t),
+              "Point2I must not carry any member but its coordinates");
+static_assert(sizeof(Point2I32) == 2U * sizeof(int32_t),
+              "Point2I32 must not carry any member but its coordinates");
+
+constexpr auto UInt128::Multiply(uint64_t lhs, uint64_t rhs) -> UInt128 {
+  constexpr uint64_t kLowMask{0xFFFFFFFFU};
+  const auto kLhsLow = lhs & kLowMask;
+  const auto kLhsHigh = lhs >> 32U;
+  const auto kRhsLow = rhs & kLowMask;
+  const auto kRhsHigh = rhs >> 32U;
+  const auto kLowLow = kLhsLow * kRhsLow;
+  const auto kLowHigh = kLhsLow * kRhsHigh;
+  const auto kHighLow = kLhsHigh * kRhsLow;
+  const auto kMiddle =
+      (kLowLow >> 32U) + (kLowHigh & kLowMask) + (kHighLow & kLowMask);
+  return UInt128{(kLhsHigh * kRhsHigh) + (kLowHigh >> 32U) +
+                     (kHighLow >> 32U) + (kMiddle >> 32U),
+                 (kMiddle << 32U) | (kLowLow & kLowMask)};
+}
+
+constexpr auto UInt128::operator+(const UInt128& other) const -> UInt128 {
+  const auto kLow = low + other.low;
+  return UInt128{high + other.high + ((kLow < low) ? 1U : 0U), kLow};
+}
+
+constexpr auto UInt128::ToDouble() const -> double {
+  constexpr double kHighScale{18446744073709551616.0};  // 2^64
+  return (static_cast<double>(high) * kHighScale) + static_cast<double>(low);
+}
+
+constexpr auto UInt128::operator==(const UInt128& other) const -> bool {
+  return (high == other.high) && (low == other.low);
+}
+
+constexpr auto UInt128::operator!=(const UInt128& other) const -> bool {
+  return !(*this == other);
+}
+
+constexpr auto UInt128::operator<(const UInt128& other) const -> bool {
+  return (high < other.high) || ((high == other.high) && (low < other.low));
+}
+
+constexpr auto UInt128::operator<=(const UInt128& other) const -> bool {
+  return !(other < *this);
+}
+
+constexpr auto UInt128::operator>(const UInt128& other) const -> bool {
+  return other < *this;
+}
+
+constexpr auto UInt128::operator>=(const UInt128& other) const -> bool {
+  return !(*this < other);
+}
+
+template <typename T, int64_t kResolution>
+constexpr BasicPoint2I<T, kResolution>::BasicPoint2I(T x, T y)
+    : x_(CheckLimit(x)), y_(CheckLimit(y)) {}
+
+template <typename T, int64_t kResolution>
+constexpr auto BasicPoint2I<T, kResolution>::FromDistances(const Distance& x,
+                                                           const Distance& y)
+    -> BasicPoint2I {
+  return BasicPoint2I(SnapNanometer(x.GetNanometer()),
+                      SnapNanometer(y.GetNanometer()));
+}
+
+template <typename T, int64_t kResolution>
+auto BasicPoint2I<T, kResolution>::FromPoint(const Point2D& point,
+                                             Distance::DistanceType unit)
+    -> BasicPoint2I {
+  const auto kScale =
+      static_cast<double>(Distance::GetNanometerScale(unit)) /
+      static_cast<double>(kResolution);
+  return BasicPoint2I(SnapTicks(point.GetX() * kScale),
+                      SnapTicks(point.GetY() * kScale));
+}
+
+template <typename T, int64_t kResolution>
+constexpr auto BasicPoint2I<T, kResolution>::ToPoint(
+    Distance::DistanceType unit) const -> Point2D {
+  return Point2D(GetXDistance().GetValue(unit), GetYDistance().GetValue(unit));
+}
+
+template <typename T, int64_t kResolution>
+constexpr auto BasicPoint2I<T, kResolution>::GetX() const -> T {
+  return x_;
+}
+
+template <typename T, int64_t kResolution>
+constexpr auto BasicPoint2I<T, kResolution>::GetY() const -> T {
+  return y_;
+}
+
+template <typename T, int64_t kResolution>
+constexpr auto BasicPoint2I<T, kResolution>::SetX(T x) -> void {
+  x_ = CheckLimit(x);
+}
+
+template <typename T, int64_t kResolution>
+constexpr auto BasicPoint2I<T, kResolution>::SetY(T y) -> void {
+  y_ = CheckLimit(y);
+}
+
+template <typename T, int64_t kResolution>
+constexpr auto BasicPoint2I<T, kResolution>::GetXDistance() const
+    -> Distance {
+  return Distance::FromNanometer(static_cast<int64_t>(x_) * kResolution);
+}
+
+template <typename T, int64_t kResolution>
+constexpr auto BasicPoint2I<T, kResolution>::GetYDistance() const
+    -> Distance {
+  return Distance::FromNanometer(static_cast<int64_t>(y_) * kResolution);
+}
+
+template <typename T, int64_t kResolution>
+constexpr auto BasicPoint2I<T, kResolution>::CalculateSquaredDistance(
+    const BasicPoint2I& lhs, const BasicPoint2I& rhs) -> UInt128 {
+  // Below 2^63 in magnitude since coordinates are within kLimit
+  const auto kDx = static_cast<int64_t>(lhs.x_) - rhs.x_;
+  const auto kDy = static_cast<int64_t>(lhs.y_) - rhs.y_;
+  const auto kAbsDx = static_cast<uint64_t>(kDx < 0 ? -kDx : kDx);
+  const auto kAbsDy = static_cast<uint64_t>(kDy < 0 ? -kDy : kDy);
+  return UInt128::Multiply(kAbsDx, kAbsDx) + UInt128::Multiply(kAbsDy, kAbsDy);
+}
+
+template <typename T, int64_t kResolution>
+constexpr auto BasicPoint2I<T, kResolution>::CalculateSquaredDistance(
+    const BasicPoint2I& target) const -> UInt128 {
+  return CalculateSquaredDistance(*this, target);
+}
+
+template <typename T, int64_t kResolution>
+constexpr auto BasicPoint2I<T, kResolution>::IsWithin(
+    const BasicPoint2I& target, int64_t radius) const -> bool {
+  const auto kRadius = static_cast<uint64_t>(radius);
+  return (radius >= 0) && (CalculateSquaredDistance(target) <=
+                           UInt128::Multiply(kRadius, kRadius));
+}
+
+template <typename T, int64_t kResolution>
+constexpr auto BasicPoint2I<T, kResolution>::CompareDistance(
+    const BasicPoint2I& lhs, const BasicPoint2I& rhs,
+    const BasicPoint2I& origin) -> int32_t {
+  const auto kLhs = CalculateSquaredDistance(lhs, origin);
+  const auto kRhs = CalculateSquaredDistance(rhs, origin);
+  return static_cast<int32_t>(kLhs > kRhs) - static_cast<int32_t>(kLhs < kRhs);
+}
+
+template <typename T, int64_t kResolution>
+constexpr auto BasicPoint2I<T, kResolution>::operator==(
+    const BasicPoint2I& other) const -> bool {
+  return (x_ == other.x_) && (y_ == other.y_);
+}
+
+template <typename T, int64_t kResolution>
+constexpr auto BasicPoint2I<T, kResolution>::operator!=(
+    const BasicPoint2I& other) const -> bool {
+  return (x_ != other.x_) || (y_ != other.y_);
+}
+
+template <typename T, int64_t kResolution>
+constexpr auto BasicPoint2I<T, kResolution>::operator<(
+    const BasicPoint2I& other) const -> bool {
+  return (x_ < other.x_) || ((x_ == other.x_) && (y_ < other.y_));
+}
+
+template <typename T, int64_t kResolution>
+constexpr auto BasicPoint2I<T, kResolution>::CheckLimit(int64_t ticks) -> T {
+  if ((ticks > kLimit) || (ticks < -static_cast<int64_t>(kLimit))) {
+    throw std::out_of_range("Coordinate exceeds the fixed-point range");
+  }
+  return static_cast<T>(ticks);
+}
+
+template <typename T, int64_t kResolution>
+constexpr auto BasicPoint2I<T, kResolution>::SnapNanometer(int64_t nanometer)
+    -> T {
+  auto ticks = nanometer / kResolution;
+  const auto kRemainder = nanometer % kResolution;
+  // Compared as kResolution - |remainder| <= |remainder| to avoid overflow
+  if (kRemainder > 0 && kResolution - kRemainder <= kRemainder) {
+    ++ticks;
+  } else if (kRemainder < 0 && kResolution + kRemainder <= -kRemainder) {
+    --ticks;
+  }
+  return CheckLimit(ticks);
+}
+
+template <typename T, int64_t kResolution>
+auto BasicPoint2I<T, kResolution>::SnapTicks(double ticks) -> T {
+  if (!(std::abs(ticks) <= static_cast<double>(kLimit))) {
+    throw std::out_of_range("Coordinate exceeds the fixed-point range");
+  }
+  return CheckLimit(static_cast<int64_t>(std::llround(ticks)));
+}
+}  // namespace Jeong0806::geometry
+
+/**
+ * @brief Hash of BasicPoint2I for unordered containers
+ * @tparam T The coordinate type
+ * @tparam kResolution Nanometers in one tick
+ */
+template <typename T, int64_t kResolution>
+struct std::hash<Jeong0806::geometry::BasicPoint2I<T, kResolution>> {
+  auto operator()(const Jeong0806::geometry::BasicPoint2I<T, kResolution>&
+                      point) const noexcept -> std::size_t {
+    // Mix both coordinates through the splitmix64 finalizer
+    auto hash = (static_cast<uint64_t>(point.GetX()) * 0x9E3779B97F4A7C15U) ^
+                static_cast<uint64_t>(point.GetY());
+    hash = (hash ^ (hash >> 30U)) * 0xBF58476D1CE4E5B9U;
+    hash = (hash ^ (hash >> 27U)) * 0x94D049BB133111EBU;
+    return static_cast<std::size_t>(hash ^ (hash >> 31U));
+  }
+};
+
+#endif  // Jeong0806_GEOMETRY_POINT_2I_HPP_
@@ -0,0 +1,321 @@
+/**
+ * @file geometry/point_cloud2d.hpp
+ * @author Jeong Seong In (0806jsi@gmail.com)
+ * @brief Point cloud class declaration with structure-of-arrays layout
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2023 Jeong0806, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#ifndef Jeong0806_GEOMETRY_POINT_CLOUD_2D_HPP_
+#define Jeong0806_GEOMETRY_POINT_CLOUD_2D_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <type_traits>
+#include <vector>
+
+#include "geometry/aligned_allocator.hpp"
+#include "geometry/point2d.hpp"
+
+namespace Jeong0806::geometry {
+/**
+ * @brief Point cloud class storing x and y coordinates in separate aligned
+ * arrays for batch kernels
+ * @details The arrays are allocated from a memory resource, the default
+ * resource unless one is given. A copy uses the default resource.
+ * PointCloud2D stores doubles and PointCloud2F floats, whose kernels stream
+ * half the bytes and fill twice the SIMD lanes at the precision described in
+ * BasicPoint2.
+ * @tparam T The coordinate type, float or double
+ */
+template <typename T>
+class BasicPointCloud2 {
+ public:
+  /**
+   * @brief Aligned coordinate array type
+   */
+  using CoordinateArray = std::vector<T, AlignedAllocator<T>>;
+
+  /**
+   * @brief Construct a new empty BasicPointCloud2 object
+   */
+  BasicPointCloud2() = default;
+  /**
+   * @brief Construct a new BasicPointCloud2 object with size points at origin
+   * @param size The number of points
+   * @param resource The memory resource of the coordinates
+   */
+  explicit BasicPointCloud2(
+      std::size_t size,
+      std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+  /**
+   * @brief Construct a new BasicPointCloud2 object from contiguous points
+   * @param points Pointer to the first point
+   * @param count The number of points
+   * @param resource The memory resource of the coordinates
+   */
+  BasicPointCloud2(
+      const BasicPoint2<T>* points, std::size_t count,
+      std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+  /**
+   * @brief Construct a new BasicPointCloud2 object from points
+   * @param points BasicPoint2 objects
+   * @param resource The memory resource of the coordinates
+   */
+  explicit BasicPointCloud2(
+      const std::vector<BasicPoint2<T>>& points,
+      std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+  /**
+   * @brief Convert a BasicPointCloud2 object of another coordinate type
+   * @details Explicit in both directions since it copies every coordinate,
+   * narrowing ones round to nearest.
+   * @tparam U The coordinate type of other
+   * @param other The point cloud to convert
+   * @param resource The memory resource of the coordinates
+   */
+  template <typename U, std::enable_if_t<!std::is_same_v<U, T>, int> = 0>
+  explicit BasicPointCloud2(
+      const BasicPointCloud2<U>& other,
+      std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+  /**
+   * @brief Get the number of points
+   * @return std::size_t The number of points
+   */
+  [[nodiscard]] auto Size() const -> std::size_t;
+  /**
+   * @brief Check if the cloud has no point
+   * @return true If empty
+   * @return false If not empty
+   */
+  [[nodiscard]] auto Empty() const -> bool;
+  /**
+   * @brief Get the memory resource of the coordinates
+   * @return std::pmr::memory_resource* The memory resource
+   */
+  [[nodiscard]] auto GetResource() const -> std::pmr::memory_resource*;
+  /**
+   * @brief Reserve memory for capacity points
+   * @param capacity The number of points
+   */
+  auto Reserve(std::size_t capacity) -> void;
+  /**
+   * @brief Resize the cloud, new points are at origin
+   * @param size The number of points
+   */
+  auto Resize(std::size_t size) -> void;
+  /**
+   * @brief Remove all points
+   */
+  auto Clear() -> void;
+  /**
+   * @brief Append a point
+   * @param point BasicPoint2 object
+   */
+  auto PushBack(const BasicPoint2<T>& point) -> void;
+  /**
+   * @brief Append contiguous points
+   * @param points Pointer to the first point
+   * @param count The number of points
+   */
+  auto Append(const BasicPoint2<T>* points, std::size_t count) -> void;
+
+  /**
+   * @brief Get the point at index
+   * @param index The index of point
+   * @return BasicPoint2<T> The point at index
+   * @throws out_of_range If index is not less than size
+   */
+  [[nodiscard]] auto GetPoint(std::size_t index) const -> BasicPoint2<T>;
+  /**
+   * @brief Set the point at index
+   * @param index The index of point
+   * @param point BasicPoint2 object
+   * @throws out_of_range If index is not less than size
+   */
+  auto SetPoint(std::size_t index, const BasicPoint2<T>& point) -> void;
+  /**
+   * @brief Get the x coordinate array
+   * @return const T* Pointer to Size() x coordinate values
+   */
+  [[nodiscard]] auto GetXData() const -> const T*;
+  /**
+   * @brief Get the y coordinate array
+   * @return const T* Pointer to Size() y coordinate values
+   */
+  [[nodiscard]] auto GetYData() const -> const T*;
+  /**
+   * @brief Get the mutable x coordinate array
+   * @return T* Pointer to Size() x coordinate values
+   */
+  [[nodiscard]] auto GetXData() -> T*;
+  /**
+   * @brief Get the mutable y coordinate array
+   * @return T* Pointer to Size() y coordinate values
+   */
+  [[nodiscard]] auto GetYData() -> T*;
+
+  /**
+   * @brief Copy all points to contiguous BasicPoint2 objects
+   * @param output Pointer to at least Size() points
+   */
+  auto CopyTo(BasicPoint2<T>* output) const -> void;
+  /**
+   * @brief Convert to BasicPoint2 objects
+   * @return std::vector<BasicPoint2<T>> The points in index order
+   */
+  [[nodiscard]] auto ToPoints() const -> std::vector<BasicPoint2<T>>;
+
+  /**
+   * @brief Calculate distance between origin and every point
+   * @param origin The origin point
+   * @param output Pointer to at least Size() values
+   */
+  auto CalculateDistances(const BasicPoint2<T>& origin, T* output) const
+      -> void;
+  /**
+   * @brief Calculate distance between origin and every point
+   * @param origin The origin point
+   * @return std::vector<T> Euclidean distances in index order
+   */
+  [[nodiscard]] auto CalculateDistances(const BasicPoint2<T>& origin) const
+      -> std::vector<T>;
+  /**
+   * @brief Calculate squared distance between origin and every point
+   * @param origin The origin point
+   * @param output Pointer to at least Size() values
+   */
+  auto CalculateSquaredDistances(const BasicPoint2<T>& origin,
+                                 T* output) const -> void;
+  /**
+   * @brief Calculate squared distance between origin and every point
+   * @param origin The origin point
+   * @return std::vector<T> Squared Euclidean distances in index order
+   */
+  [[nodiscard]] auto CalculateSquaredDistances(
+      const BasicPoint2<T>& origin) const -> std::vector<T>;
+  /**
+   * @brief Calculate distance between lhs and rhs points of the same index
+   * @param lhs Left hand side BasicPointCloud2 object
+   * @param rhs Right hand side BasicPointCloud2 object
+   * @param output Pointer to at least lhs.Size() values
+   * @throws invalid_argument If lhs and rhs have different sizes
+   */
+  static auto CalculatePairwiseDistances(const BasicPointCloud2& lhs,
+                                         const BasicPointCloud2& rhs,
+                                         T* output) -> void;
+  /**
+   * @brief Calculate distance between lhs and rhs points of the same index
+   * @param lhs Left hand side BasicPointCloud2 object
+   * @param rhs Right hand side BasicPointCloud2 object
+   * @return std::vector<T> Euclidean distances in index order
+   * @throws invalid_argument If lhs and rhs have different sizes
+   */
+  [[nodiscard]] static auto CalculatePairwiseDistances(
+      const BasicPointCloud2& lhs, const BasicPointCloud2& rhs)
+      -> std::vector<T>;
+  /**
+   * @brief Calculate squared distance between lhs and rhs points of the same
+   * index
+   * @param lhs Left hand side BasicPointCloud2 object
+   * @param rhs Right hand side BasicPointCloud2 object
+   * @param output Pointer to at least lhs.Size() values
+   * @throws invalid_argument If lhs and rhs have different sizes
+   */
+  static auto CalculatePairwiseSquaredDistances(const BasicPointCloud2& lhs,
+                                                const BasicPointCloud2& rhs,
+                                                T* output) -> void;
+  /**
+   * @brief Calculate squared distance between lhs and rhs points of the same
+   * index
+   * @param lhs Left hand side BasicPointCloud2 object
+   * @param rhs Right hand side BasicPointCloud2 object
+   * @return std::vector<T> Squared Euclidean distances in index order
+   * @throws invalid_argument If lhs and rhs have different sizes
+   */
+  [[nodiscard]] static auto CalculatePairwiseSquaredDistances(
+      const BasicPointCloud2& lhs, const BasicPointCloud2& rhs)
+      -> std::vector<T>;
+  /**
+   * @brief Check which points are within radius of origin without sqrt
+   * @param origin The origin point
+   * @param radius Inclusive radius
+   * @param output Pointer to at least Size() flags, 1 if within and 0 if not
+   * @return std::size_t The number of points within radius
+   */
+  auto IsWithin(const BasicPoint2<T>& origin, T radius, uint8_t* output) const
+      -> std::size_t;
+  /**
+   * @brief Check which points are within radius of origin without sqrt
+   * @param origin The origin point
+   * @param radius Inclusive radius
+   * @return std::vector<uint8_t> Flags in index order, 1 if within and 0 if
+   * not
+   */
+  [[nodiscard]] auto IsWithin(const BasicPoint2<T>& origin, T radius) const
+      -> std::vector<uint8_t>;
+  /**
+   * @brief Compare distances of lhs and rhs points of the same index from
+   * origin without sqrt
+   * @param lhs Left hand side BasicPointCloud2 object
+   * @param rhs Right hand side BasicPointCloud2 object
+   * @param origin The origin point
+   * @param output Pointer to at least lhs.Size() results, -1 if lhs is closer,
+   * 1 if rhs is closer and 0 if equally far
+   * @throws invalid_argument If lhs and rhs have different sizes
+   */
+  static auto CompareDistances(const BasicPointCloud2& lhs,
+                               const BasicPointCloud2& rhs,
+                               const BasicPoint2<T>& origin, int8_t* output)
+      -> void;
+  /**
+   * @brief Compare distances of lhs and rhs points of the same index from
+   * origin without sqrt
+   * @param lhs Left hand side BasicPointCloud2 object
+   * @param rhs Right hand side BasicPointCloud2 object
+   * @param origin The origin point
+   * @return std::vector<int8_t> Results in index order
+   * @throws invalid_argument If lhs and rhs have different sizes
+   */
+  [[nodiscard]] static auto CompareDistances(const BasicPointCloud2& lhs,
+                                             const BasicPointCloud2& rhs,
+                                             const BasicPoint2<T>& origin)
+      -> std::vector<int8_t>;
+
+ protected:
+ private:
+  CoordinateArray xs_;  ///< x coordinates
+  CoordinateArray ys_;  ///< y coordinates
+};
+
+/**
+ * @brief Point cloud with double coordinates
+ */
+using PointCloud2D = BasicPointCloud2<double>;
+/**
+ * @brief Point cloud with float coordinates
+ */
+using PointCloud2F = BasicPointCloud2<float>;
+
+// Instantiated in point_cloud2d.cpp
+extern template class BasicPointCloud2<float>;
+extern template class BasicPointCloud2<double>;
+
+template <typename T>
+template <typename U, std::enable_if_t<!std::is_same_v<U, T>, int>>
+BasicPointCloud2<T>::BasicPointCloud2(const BasicPointCloud2<U>& other,
+                                      std::pmr::memory_resource* resource)
+    : xs_(other.Size(), resource), ys_(other.Size(), resource) {
+  for (std::size_t i = 0; i < other.Size(); ++i) {
+    xs_[i] = static_cast<T>(other.GetXData()[i]);
+    ys_[i] = static_cast<T>(other.GetYData()[i]);
+  }
+}
+}  // namespace Jeong0806::geometry
+
+#endif  // Jeong0806_GEOMETRY_POINT_CLOUD_2D_HPP_
@@ -0,0 +1,268 @@
+/**
+ * @file geometry/point_file.hpp
+ * @author Jeong Seong In (0806jsi@gmail.com)
+ * @brief Binary point file format, streaming writer and mapped reader
+ * declaration
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2023 Jeong0806, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#ifndef Jeong0806_GEOMETRY_POINT_FILE_HPP_
+#define Jeong0806_GEOMETRY_POINT_FILE_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory_resource>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "geometry/distance.hpp"
+#include "geometry/point2d.hpp"
+#include "geometry/point_cloud2d.hpp"
+
+namespace Jeong0806::geometry {
+/**
+ * @brief Header at the start of a point file
+ * @details All fields are little-endian. The x and y columns hold count
+ * doubles each, and the optional nanometer columns hold count int64 values
+ * equal to Distance(value, unit).GetNanometer(). Every column starts on a
+ * kPointFileAlignment boundary. The checksum covers the column bytes, and the
+ * magic is only written once every column is complete.
+ */
+struct PointFileHeader {
+  std::array<char, 8> magic{};  ///< kPointFileMagic once complete
+  uint32_t version{0U};         ///< Format version, kPointFileVersion
+  uint32_t byte_order{0U};      ///< kPointFileByteOrder as written
+  uint64_t count{0U};           ///< The number of points
+  uint32_t unit{0U};            ///< Distance::DistanceType of coordinates
+  uint32_t flags{0U};           ///< kPointFileHasNanometers if present
+  uint64_t x_offset{0U};        ///< Byte offset of the x column
+  uint64_t y_offset{0U};        ///< Byte offset of the y column
+  uint64_t x_nanometer_offset{0U};  ///< Offset of the x nanometers, or 0
+  uint64_t y_nanometer_offset{0U};  ///< Offset of the y nanometers, or 0
+  uint64_t checksum{0U};            ///< Hash of the columns
+  std::array<uint64_t, 7> reserved{};  ///< Zero, pads the header to 128 bytes
+};
+
+static_assert(std::is_trivially_copyable_v<PointFileHeader>,
+              "Point file header must be trivially copyable");
+static_assert(sizeof(PointFileHeader) == 128U,
+              "Point file header must keep its on-disk size");
+
+/// Magic at the start of a complete point file
+constexpr std::array<char, 8> kPointFileMagic{'J', 'G', 'E', 'O', 'P',
+                                              'T', 'S', '\0'};
+/// Current format version
+constexpr uint32_t kPointFileVersion{1U};
+/// Byte order marker, reads differently on a big-endian machine
+constexpr uint32_t kPointFileByteOrder{0x01020304U};
+/// Flag of the optional nanometer columns
+constexpr uint32_t kPointFileHasNanometers{1U};
+/// Column alignment in bytes, a cache line and an AVX-512 vector
+constexpr std::size_t kPointFileAlignment{64U};
+
+/**
+ * @brief Writer streaming points into a point file
+ * @details The number of points is declared up front, so every column has a
+ * fixed offset and points are written in chunks of kChunkSize without
+ * holding the whole set. The file is only valid after Close().
+ */
+class PointFileWriter {
+ public:
+  /**
+   * @brief Number of points buffered before a chunk is written
+   */
+  static constexpr std::size_t kChunkSize{1U << 12U};
+
+  /**
+   * @brief Create a point file
+   * @param path The file path
+   * @param count The number of points that will be pushed
+   * @param unit The unit of the point coordinates
+   * @param with_nanometers Whether to write the nanometer columns
+   * @throws runtime_error If the file cannot be created
+   */
+  PointFileWriter(const std::string& path, std::size_t count,
+                  Distance::DistanceType unit = Distance::DistanceType::kMeter,
+                  bool with_nanometers = false);
+  PointFileWriter(const PointFileWriter& other) = delete;
+  PointFileWriter(PointFileWriter&& other) = delete;
+  /**
+   * @brief Close the file if not closed, ignoring errors
+   */
+  ~PointFileWriter();
+
+  auto operator=(const PointFileWriter& other) -> PointFileWriter& = delete;
+  auto operator=(PointFileWriter&& other) -> PointFileWriter& = delete;
+
+  /**
+   * @brief Write the next point
+   * @param point The point
+   * @throws length_error If more points than declared are pushed
+   * @throws runtime_error If writing fails
+   */
+  auto Push(const Point2D& point) -> void;
+  /**
+   * @brief Write the next contiguous points
+   * @param points Pointer to the first point
+   * @param count The number of points
+   * @throws length_error If more points than declared are pushed
+   * @throws runtime_error If writing fails
+   */
+  auto Push(const Point2D* points, std::size_t count) -> void;
+  /**
+   * @brief Write the last chunk and the completed header
+   * @throws runtime_error If fewer points than declared were pushed or
+   * writing fails
+   */
+  auto Close() -> void;
+
+  /**
+   * @brief Write a point cloud to a point file at once
+   * @param path The file path
+   * @param points The point cloud
+   * @param unit The unit of the point coordinates
+   * @param with_nanometers Whether to write the nanometer columns
+   * @throws runtime_error If writing fails
+   */
+  static auto Write(
+      const std::string& path, const PointCloud2D& points,
+      Distance::DistanceType unit = Distance::DistanceType::kMeter,
+      bool with_nanometers = false) -> void;
+
+ protected:
+ private:
+  /**
+   * @brief Write the buffered chunk at its offset in every column
+   */
+  auto Flush() -> void;
+
+  std::ofstream file_;                   ///< The output file
+  PointFileHeader header_;               ///< Header written by Close()
+  std::size_t written_{0U};              ///< Points already flushed
+  std::vector<double> xs_;               ///< Buffered x coordinates
+  std::vector<double> ys_;               ///< Buffered y coordinates
+  std::vector<int64_t> x_nanometers_;    ///< Buffered x nanometers
+  std::vector<int64_t> y_nanometers_;    ///< Buffered y nanometers
+  std::array<uint64_t, 4> checksums_{};  ///< Running hash of each column
+  bool closed_{false};                   ///< Whether Close() finished
+};
+
+/**
+ * @brief Read-only memory-mapped view of a point file
+ * @details Opening maps the file and checks the header only, so it costs the
+ * same for any size; pages are read on first access. The column pointers
+ * point into the mapping and go straight to the batch kernels. Platforms
+ * without mmap read the file into memory instead.
+ */
+class PointFileReader {
+ public:
+  /**
+   * @brief Map a point file
+   * @param path The file path
+   * @param verify Whether to check the checksum, which reads every page
+   * @throws runtime_error If the file cannot be mapped, is incomplete or
+   * invalid, or verify is set and the checksum does not match
+   */
+  explicit PointFileReader(const std::string& path, bool verify = false);
+  PointFileReader(const PointFileReader& other) = delete;
+  /**
+   * @brief Take over the mapping of other
+   * @param other The reader to move from, left empty
+   */
+  PointFileReader(PointFileReader&& other) noexcept;
+  /**
+   * @brief Unmap the file
+   */
+  ~PointFileReader();
+
+  auto operator=(const PointFileReader& other) -> PointFileReader& = delete;
+  /**
+   * @brief Take over the mapping of other
+   * @param other The reader to move from, left empty
+   * @return PointFileReader& Reference of this object
+   */
+  auto operator=(PointFileReader&& other) noexcept -> PointFileReader&;
+
+  /**
+   * @brief Get the number of points
+   * @return std::size_t The number of points
+   */
+  [[nodiscard]] auto Size() const -> std::size_t;
+  /**
+   * @brief Get the unit of the point coordinates
+   * @return Distance::DistanceType The unit
+   */
+  [[nodiscard]] auto GetUnit() const -> Distance::DistanceType;
+  /**
+   * @brief Check if the file has the nanometer columns
+   * @return true If present
+   * @return false If absent
+   */
+  [[nodiscard]] auto HasNanometers() const -> bool;
+  /**
+   * @brief Check the checksum against the columns
+   * @return true If it matches
+   * @return false If it does not match
+   */
+  [[nodiscard]] auto Verify() const -> bool;
+
+  /**
+   * @brief Get x coordinate values
+   * @return const double* Pointer to Size() aligned values
+   */
+  [[nodiscard]] auto GetXData() const -> const double*;
+  /**
+   * @brief Get y coordinate values
+   * @return const double* Pointer to Size() aligned values
+   */
+  [[nodiscard]] auto GetYData() const -> const double*;
+  /**
+   * @brief Get x coordinate nanometers
+   * @return const int64_t* Pointer to Size() values, nullptr if absent
+   */
+  [[nodiscard]] auto GetXNanometerData() const -> const int64_t*;
+  /**
+   * @brief Get y coordinate nanometers
+   * @return const int64_t* Pointer to Size() values, nullptr if absent
+   */
+  [[nodiscard]] auto GetYNanometerData() const -> const int64_t*;
+
+  /**
+   * @brief Get a point
+   * @param index The index of the point
+   * @return Point2D The point
+   * @throws out_of_range If index is not less than Size()
+   */
+  [[nodiscard]] auto GetPoint(std::size_t index) const -> Point2D;
+  /**
+   * @brief Copy the points into a point cloud
+   * @param resource The memory resource of the point cloud
+   * @return PointCloud2D The points
+   */
+  [[nodiscard]] auto ToPointCloud(
+      std::pmr::memory_resource* resource =
+          std::pmr::get_default_resource()) const -> PointCloud2D;
+
+ protected:
+ private:
+  /**
+   * @brief Release the mapping
+   */
+  auto Release() -> void;
+
+  const unsigned char* data_{nullptr};  ///< Start of the mapped file
+  std::size_t size_{0U};                ///< Size of the mapped file
+  std::vector<uint64_t> buffer_;        ///< File contents without mmap
+  PointFileHeader header_;              ///< Copy of the header
+};
+}  // namespace Jeong0806::geometry
+
+#endif  // Jeong0806_GEOMETRY_POINT_FILE_HPP_
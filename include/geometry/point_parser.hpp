@@ -0,0 +1,160 @@
+/**
+ * @file geometry/point_parser.hpp
+ * @author Jeong Seong In (0806jsi@gmail.com)
+ * @brief CSV and WKT point text parser class declaration
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2023 Jeong0806, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#ifndef Jeong0806_GEOMETRY_POINT_PARSER_HPP_
+#define Jeong0806_GEOMETRY_POINT_PARSER_HPP_
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "geometry/distance.hpp"
+#include "geometry/parallel.hpp"
+#include "geometry/point_cloud2d.hpp"
+
+namespace Jeong0806::geometry {
+/**
+ * @brief Layout of a CSV point file
+ */
+struct CsvFormat {
+  char delimiter{','};      ///< Field separator
+  std::size_t x_column{0};  ///< Zero-based column of x coordinates
+  std::size_t y_column{1};  ///< Zero-based column of y coordinates
+  bool has_header{false};   ///< Whether the first line is skipped
+};
+
+/**
+ * @brief The enum class of WKT geometry types
+ */
+enum class WktType {
+  kPoint = 0,       ///< POINT
+  kLineString = 1,  ///< LINESTRING
+  kMultiPoint = 2   ///< MULTIPOINT
+};
+
+/**
+ * @brief Geometries parsed from WKT, one per line
+ * @details The points of geometry i are [offsets[i], offsets[i + 1]) in
+ * points, so offsets holds one more entry than types.
+ */
+struct WktGeometries {
+  PointCloud2D points;               ///< Points of every geometry in order
+  std::vector<std::size_t> offsets;  ///< First point of each geometry
+  std::vector<WktType> types;        ///< Type of each geometry
+};
+
+/**
+ * @brief Parser of coordinate text into point clouds
+ * @details Numbers are parsed by std::from_chars, so parsing is exact and
+ * locale independent. Any number may carry a unit suffix directly after it,
+ * one of km, m, cm, mm, um, µm and nm, and is converted into the requested
+ * unit; numbers without a suffix are already in it. Input is split into
+ * chunks on line boundaries, and the chunks are parsed on separate threads.
+ * Errors name the first invalid line.
+ */
+class PointParser {
+ public:
+  /**
+   * @brief Minimum number of bytes parsed by one thread
+   */
+  static constexpr std::size_t kMinChunkSize{1U << 16U};
+
+  /**
+   * @brief Parse a distance such as "12.5km" or "300m"
+   * @param text The number and an optional unit suffix
+   * @param unit The unit of a number without suffix
+   * @return Distance The distance
+   * @throws invalid_argument If text is not a finite number with a known
+   * suffix
+   * @throws out_of_range If the distance does not fit in Distance
+   */
+  [[nodiscard]] static auto ParseDistance(
+      std::string_view text,
+      Distance::DistanceType unit = Distance::DistanceType::kMeter)
+      -> Distance;
+
+  /**
+   * @brief Parse CSV text into points
+   * @details Blank lines are skipped, fields may be surrounded by spaces or
+   * double quotes and lines may end with CRLF.
+   * @param text The CSV text
+   * @param format The layout of the columns
+   * @param unit The unit of the point coordinates
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param executor The executor running the threads
+   * @return PointCloud2D The points in line order
+   * @throws invalid_argument If a line misses a column or holds an invalid
+   * coordinate
+   */
+  [[nodiscard]] static auto ParseCsv(
+      std::string_view text, const CsvFormat& format = CsvFormat(),
+      Distance::DistanceType unit = Distance::DistanceType::kMeter,
+      std::size_t thread_count = 0,
+      Executor* executor = GetDefaultExecutor()) -> PointCloud2D;
+  /**
+   * @brief Parse a CSV file into points
+   * @param path The file path
+   * @param format The layout of the columns
+   * @param unit The unit of the point coordinates
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param executor The executor running the threads
+   * @return PointCloud2D The points in line order
+   * @throws runtime_error If the file cannot be read
+   * @throws invalid_argument If a line misses a column or holds an invalid
+   * coordinate
+   */
+  [[nodiscard]] static auto ParseCsvFile(
+      const std::string& path, const CsvFormat& format = CsvFormat(),
+      Distance::DistanceType unit = Distance::DistanceType::kMeter,
+      std::size_t thread_count = 0,
+      Executor* executor = GetDefaultExecutor()) -> PointCloud2D;
+
+  /**
+   * @brief Parse WKT text with one geometry per line
+   * @details POINT, LINESTRING and MULTIPOINT are accepted in any case, with
+   * EMPTY, and MULTIPOINT members with or without parentheses. Blank lines
+   * are skipped.
+   * @param text The WKT text
+   * @param unit The unit of the point coordinates
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param executor The executor running the threads
+   * @return WktGeometries The geometries in line order
+   * @throws invalid_argument If a line is not a supported geometry
+   */
+  [[nodiscard]] static auto ParseWkt(
+      std::string_view text,
+      Distance::DistanceType unit = Distance::DistanceType::kMeter,
+      std::size_t thread_count = 0,
+      Executor* executor = GetDefaultExecutor()) -> WktGeometries;
+  /**
+   * @brief Parse a WKT file with one geometry per line
+   * @param path The file path
+   * @param unit The unit of the point coordinates
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param executor The executor running the threads
+   * @return WktGeometries The geometries in line order
+   * @throws runtime_error If the file cannot be read
+   * @throws invalid_argument If a line is not a supported geometry
+   */
+  [[nodiscard]] static auto ParseWktFile(
+      const std::string& path,
+      Distance::DistanceType unit = Distance::DistanceType::kMeter,
+      std::size_t thread_count = 0,
+      Executor* executor = GetDefaultExecutor()) -> WktGeometries;
+
+ protected:
+ private:
+};
+}  // namespace Jeong0806::geometry
+
+#endif  // Jeong0806_GEOMETRY_POINT_PARSER_HPP_
@@ -0,0 +1,150 @@
+/**
+ * @file geometry/polygon2d.hpp
+ * @author Jeong Seong In (0806jsi@gmail.com)
+ * @brief Polygon class declaration over 2-dimension point rings
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2023 Jeong0806, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#ifndef Jeong0806_GEOMETRY_POLYGON_2D_HPP_
+#define Jeong0806_GEOMETRY_POLYGON_2D_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+#include "geometry/point2d.hpp"
+
+namespace Jeong0806::geometry {
+/**
+ * @brief Polygon of one or more closed Point2D rings
+ * @details Rings are stored back to back, and ring r spans the points from
+ * GetRingOffsets()[r] up to GetRingOffsets()[r + 1]. Each ring closes by an
+ * edge from its last point back to its first, so a repeated first point at
+ * the end is dropped. Containment follows the even-odd rule, which makes
+ * every ring after an outer one a hole regardless of orientation. Points on
+ * an edge may be classified either way.
+ *
+ * The points and offsets are allocated from a memory resource, the default
+ * resource unless one is given. Polygons copied into a container of
+ * std::pmr::polymorphic_allocator take its resource.
+ */
+class Polygon2D {
+ public:
+  /**
+   * @brief Allocator of the points and offsets
+   */
+  using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+  /**
+   * @brief Construct a new empty Polygon2D object
+   */
+  Polygon2D() = default;
+  /**
+   * @brief Construct a new Polygon2D object of one ring
+   * @param ring The ring points in order
+   * @param resource The memory resource of the points and offsets
+   * @throws invalid_argument If a coordinate is not finite or the ring has
+   * fewer than three points
+   * @throws length_error If the points do not fit in 32 bits
+   */
+  explicit Polygon2D(
+      const std::vector<Point2D>& ring,
+      std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+  /**
+   * @brief Construct a new Polygon2D object of several rings
+   * @param rings The outer ring and then the holes, each in order
+   * @param resource The memory resource of the points and offsets
+   * @throws invalid_argument If a coordinate is not finite or a ring has
+   * fewer than three points
+   * @throws length_error If the points do not fit in 32 bits
+   */
+  explicit Polygon2D(
+      const std::vector<std::vector<Point2D>>& rings,
+      std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+  /**
+   * @brief Construct a copy of a Polygon2D object on another memory resource
+   * @param other The copied polygon
+   * @param allocator The allocator of the points and offsets
+   */
+  Polygon2D(const Polygon2D& other, const allocator_type& allocator);
+
+  /**
+   * @brief Check if there is no ring
+   * @return true If empty
+   * @return false If not empty
+   */
+  [[nodiscard]] auto Empty() const -> bool;
+  /**
+   * @brief Get the number of rings
+   * @return std::size_t The number of rings
+   */
+  [[nodiscard]] auto GetRingCount() const -> std::size_t;
+  /**
+   * @brief Get the number of edges, which is the number of points
+   * @return std::size_t The number of edges of all rings
+   */
+  [[nodiscard]] auto GetEdgeCount() const -> std::size_t;
+  /**
+   * @brief Get the memory resource of the points and offsets
+   * @return std::pmr::memory_resource* The memory resource
+   */
+  [[nodiscard]] auto GetResource() const -> std::pmr::memory_resource*;
+  /**
+   * @brief Get the points of all rings
+   * @return const std::pmr::vector<Point2D>& The points, ring after ring
+   */
+  [[nodiscard]] auto GetPoints() const -> const std::pmr::vector<Point2D>&;
+  /**
+   * @brief Get the first point of every ring
+   * @return const std::pmr::vector<uint32_t>& GetRingCount() + 1 offsets
+   * into GetPoints(), the last one being the number of points
+   */
+  [[nodiscard]] auto GetRingOffsets() const
+      -> const std::pmr::vector<uint32_t>&;
+  /**
+   * @brief Get the lower corner of the bounding box
+   * @return const Point2D& The lowest x and y of all points
+   */
+  [[nodiscard]] auto GetMin() const -> const Point2D&;
+  /**
+   * @brief Get the upper corner of the bounding box
+   * @return const Point2D& The highest x and y of all points
+   */
+  [[nodiscard]] auto GetMax() const -> const Point2D&;
+
+  /**
+   * @brief Check if a point lies inside by counting ring crossings
+   * @details Takes one exact orientation test per edge crossing the
+   * horizontal line of the point. PolygonIndex2D classifies many points
+   * against many polygons in about constant time per point.
+   * @param point The tested point
+   * @return true If inside under the even-odd rule
+   * @return false If outside
+   */
+  [[nodiscard]] auto Contains(const Point2D& point) const -> bool;
+
+ protected:
+ private:
+  /**
+   * @brief Append a ring and grow the bounding box
+   * @param ring The ring points in order
+   * @throws invalid_argument If a coordinate is not finite or the ring has
+   * fewer than three points
+   * @throws length_error If the points do not fit in 32 bits
+   */
+  auto AddRing(const std::vector<Point2D>& ring) -> void;
+
+  std::pmr::vector<Point2D> points_;            ///< Points of all rings
+  std::pmr::vector<uint32_t> ring_offsets_{0};  ///< First point of each ring
+  Point2D min_;                                 ///< Lower bounding box corner
+  Point2D max_;                                 ///< Upper bounding box corner
+};
+}  // namespace Jeong0806::geometry
+
+#endif  // Jeong0806_GEOMETRY_POLYGON_2D_HPP_
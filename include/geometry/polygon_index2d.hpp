@@ -0,0 +1,229 @@
+/**
+ * @file geometry/polygon_index2d.hpp
+ * @author Jeong Seong In (0806jsi@gmail.com)
+ * @brief Prepared polygon index class declaration for point classification
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2023 Jeong0806, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#ifndef Jeong0806_GEOMETRY_POLYGON_INDEX_2D_HPP_
+#define Jeong0806_GEOMETRY_POLYGON_INDEX_2D_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory_resource>
+#include <vector>
+
+#include "geometry/parallel.hpp"
+#include "geometry/point2d.hpp"
+#include "geometry/point_cloud2d.hpp"
+#include "geometry/polygon2d.hpp"
+
+namespace Jeong0806::geometry {
+/**
+ * @brief Index of zone polygons answering which zone contains a point
+ * @details A uniform grid over the bounding box of all zones has about
+ * kCellsPerEdge cells per polygon edge, and every cell lists the edges that
+ * pass through it, grouped by zone. Each cell also has a reference point off
+ * every edge whose containing zones are found once while building, by
+ * walking the cells of a row from outside the box.
+ *
+ * A point in a cell without edges is in the zones of the reference point,
+ * which is one table lookup. Otherwise a zone contains the point when it
+ * contains the reference point and the segment between them crosses an even
+ * number of its edges, so only the edges of that cell are tested. The tests
+ * go through Predicates2D, which keeps them exact.
+ *
+ * Zones may overlap, and a point gets the lowest index of the zones holding
+ * it. Like Polygon2D::Contains, points on an edge may be classified either
+ * way.
+ *
+ * The zones, cells and edges are allocated from a memory resource, the
+ * default resource unless one is given.
+ */
+class PolygonIndex2D {
+ public:
+  /**
+   * @brief Zone of points inside no zone
+   */
+  static constexpr uint32_t kNoZone{std::numeric_limits<uint32_t>::max()};
+  /**
+   * @brief Grid cells per polygon edge
+   */
+  static constexpr std::size_t kCellsPerEdge{4U};
+  /**
+   * @brief Upper bound of the grid cells
+   */
+  static constexpr std::size_t kMaxCellCount{std::size_t{1} << 22U};
+
+  /**
+   * @brief Construct a new empty PolygonIndex2D object
+   */
+  PolygonIndex2D() = default;
+  /**
+   * @brief Construct a new PolygonIndex2D object
+   * @param zones The zone polygons, zone ids index into this vector
+   * @param resource The memory resource of the zones, cells and edges
+   * @throws length_error If the zones or the edges listed by the cells do
+   * not fit in 32 bits
+   */
+  explicit PolygonIndex2D(
+      const std::vector<Polygon2D>& zones,
+      std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+  /**
+   * @brief Get the number of zones
+   * @return std::size_t The number of zones
+   */
+  [[nodiscard]] auto Size() const -> std::size_t;
+  /**
+   * @brief Check if there is no zone
+   * @return true If empty
+   * @return false If not empty
+   */
+  [[nodiscard]] auto Empty() const -> bool;
+  /**
+   * @brief Get the memory resource of the zones, cells and edges
+   * @return std::pmr::memory_resource* The memory resource
+   */
+  [[nodiscard]] auto GetResource() const -> std::pmr::memory_resource*;
+  /**
+   * @brief Get a zone polygon
+   * @param zone The zone id
+   * @return const Polygon2D& The polygon
+   * @throws out_of_range If zone is not below Size()
+   */
+  [[nodiscard]] auto GetZone(std::size_t zone) const -> const Polygon2D&;
+  /**
+   * @brief Get the number of grid cells
+   * @return std::size_t The number of cells, zero without edges
+   */
+  [[nodiscard]] auto GetCellCount() const -> std::size_t;
+
+  /**
+   * @brief Get the zone containing a point
+   * @param point The point
+   * @return uint32_t The lowest id of the zones containing point, kNoZone if
+   * none does
+   */
+  [[nodiscard]] auto Classify(const Point2D& point) const -> uint32_t;
+  /**
+   * @brief Get the zone of contiguous points across threads
+   * @param points Pointer to the first point
+   * @param count The number of points
+   * @param output count zone ids as of Classify(point)
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param executor The executor running the threads
+   */
+  auto Classify(const Point2D* points, std::size_t count, uint32_t* output,
+                std::size_t thread_count = 0,
+                Executor* executor = GetDefaultExecutor()) const -> void;
+  /**
+   * @brief Get the zone of points across threads
+   * @param points The points
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param executor The executor running the threads
+   * @return std::vector<uint32_t> The zone id of each point
+   */
+  [[nodiscard]] auto Classify(const std::vector<Point2D>& points,
+                              std::size_t thread_count = 0,
+                              Executor* executor = GetDefaultExecutor()) const
+      -> std::vector<uint32_t>;
+  /**
+   * @brief Get the zone of a point cloud across threads
+   * @param points The point cloud
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param executor The executor running the threads
+   * @return std::vector<uint32_t> The zone id of each point
+   */
+  [[nodiscard]] auto Classify(const PointCloud2D& points,
+                              std::size_t thread_count = 0,
+                              Executor* executor = GetDefaultExecutor()) const
+      -> std::vector<uint32_t>;
+
+ protected:
+ private:
+  /**
+   * @brief Grid cell, whose groups run up to the first group of the next
+   */
+  struct Cell {
+    Point2D reference;        ///< Point off every edge within the cell
+    uint32_t zone{kNoZone};   ///< Lowest zone holding the whole cell
+    uint32_t first_group{0};  ///< First zone group with edges in the cell
+  };
+  /**
+   * @brief Edges of one zone within a cell, which run up to the first edge
+   * of the next group
+   */
+  struct Group {
+    uint32_t zone{kNoZone};  ///< Zone of the edges
+    uint32_t inside{0};      ///< 1 if the zone holds the cell reference
+    uint32_t first_edge{0};  ///< First edge in edges_
+  };
+
+  /**
+   * @brief Size the grid and fill the cells from the zones
+   */
+  auto Build() -> void;
+  /**
+   * @brief Get the grid column of an x coordinate, clamped to the grid
+   * @param x The x coordinate
+   * @return uint32_t The column
+   */
+  [[nodiscard]] auto GetColumn(double x) const -> uint32_t;
+  /**
+   * @brief Get the grid row of a y coordinate, clamped to the grid
+   * @param y The y coordinate
+   * @return uint32_t The row
+   */
+  [[nodiscard]] auto GetRow(double y) const -> uint32_t;
+  /**
+   * @brief Get the grid cell of a point
+   * @param x The x coordinate
+   * @param y The y coordinate
+   * @return uint32_t The cell, or GetCellCount() outside the grid
+   */
+  [[nodiscard]] auto GetCell(double x, double y) const -> uint32_t;
+  /**
+   * @brief Get the zone containing a point within its cell
+   * @param point The point
+   * @param cell The cell of point
+   * @return uint32_t The zone id as of Classify(point)
+   */
+  [[nodiscard]] auto ClassifyInCell(const Point2D& point, uint32_t cell) const
+      -> uint32_t;
+  /**
+   * @brief Classify a range of points in blocks, finding the cells of a
+   * whole block in one branchless pass and answering points in cells
+   * without edges in another before testing the edges of the rest
+   * @tparam PointAt Callable returning the Point2D of an index
+   * @param point_at Gets the point of an index
+   * @param begin The first index
+   * @param end One past the last index
+   * @param output Zone ids by index
+   */
+  template <typename PointAt>
+  auto ClassifyRange(PointAt point_at, std::size_t begin, std::size_t end,
+                     uint32_t* output) const -> void;
+
+  std::pmr::vector<Polygon2D> zones_;   ///< Zone polygons
+  uint32_t columns_{0};                 ///< Cells along x
+  uint32_t rows_{0};                    ///< Cells along y
+  double min_x_{0.0};                   ///< Lowest x of the grid
+  double min_y_{0.0};                   ///< Lowest y of the grid
+  double max_x_{-1.0};                  ///< Highest x of the grid
+  double max_y_{-1.0};                  ///< Highest y of the grid
+  double scale_x_{0.0};                 ///< Columns per unit x
+  double scale_y_{0.0};                 ///< Rows per unit y
+  std::pmr::vector<Cell> cells_{2U};    ///< Cells, the outside one and an end
+  std::pmr::vector<Group> groups_{1U};  ///< Groups by cell and an end
+  std::pmr::vector<Point2D> edges_;     ///< Edge end points in pairs by group
+};
+}  // namespace Jeong0806::geometry
+
+#endif  // Jeong0806_GEOMETRY_POLYGON_INDEX_2D_HPP_
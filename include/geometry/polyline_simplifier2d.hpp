@@ -0,0 +1,184 @@
+/**
+ * @file geometry/polyline_simplifier2d.hpp
+ * @author Jeong Seong In (0806jsi@gmail.com)
+ * @brief Polyline simplification class declarations with Distance tolerance
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2023 Jeong0806, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#ifndef Jeong0806_GEOMETRY_POLYLINE_SIMPLIFIER_2D_HPP_
+#define Jeong0806_GEOMETRY_POLYLINE_SIMPLIFIER_2D_HPP_
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+#include "geometry/distance.hpp"
+#include "geometry/point2d.hpp"
+
+namespace Jeong0806::geometry {
+/**
+ * @brief Batch simplification of a whole polyline
+ * @details Both methods keep the first and the last point and return the
+ * retained points in input order. They run iteratively on flat arrays sized
+ * once per call, so nothing recurses and nothing is allocated per point.
+ */
+class PolylineSimplifier2D {
+ public:
+  /**
+   * @brief The enum class of simplification methods
+   */
+  enum class Method {
+    kDouglasPeucker = 0,  ///< Keep points farther than tolerance from the
+                          ///< segment between retained points
+    kVisvalingam = 1      ///< Drop points whose effective triangle area is
+                          ///< below tolerance squared, smallest first
+  };
+
+  /**
+   * @brief Simplify contiguous points into retained indices
+   * @param points Pointer to the first point
+   * @param count The number of points
+   * @param tolerance The tolerance
+   * @param method The simplification method
+   * @param unit The unit of the point coordinates
+   * @return std::vector<std::size_t> Ascending indices of the retained points
+   * @throws invalid_argument If tolerance is negative
+   */
+  [[nodiscard]] static auto SimplifyIndices(
+      const Point2D* points, std::size_t count, const Distance& tolerance,
+      Method method = Method::kDouglasPeucker,
+      Distance::DistanceType unit = Distance::DistanceType::kMeter)
+      -> std::vector<std::size_t>;
+  /**
+   * @brief Simplify points into retained indices
+   * @param points The points
+   * @param tolerance The tolerance
+   * @param method The simplification method
+   * @param unit The unit of the point coordinates
+   * @return std::vector<std::size_t> Ascending indices of the retained points
+   * @throws invalid_argument If tolerance is negative
+   */
+  [[nodiscard]] static auto SimplifyIndices(
+      const std::vector<Point2D>& points, const Distance& tolerance,
+      Method method = Method::kDouglasPeucker,
+      Distance::DistanceType unit = Distance::DistanceType::kMeter)
+      -> std::vector<std::size_t>;
+  /**
+   * @brief Simplify contiguous points
+   * @param points Pointer to the first point
+   * @param count The number of points
+   * @param tolerance The tolerance
+   * @param method The simplification method
+   * @param unit The unit of the point coordinates
+   * @return std::vector<Point2D> The retained points
+   * @throws invalid_argument If tolerance is negative
+   */
+  [[nodiscard]] static auto Simplify(
+      const Point2D* points, std::size_t count, const Distance& tolerance,
+      Method method = Method::kDouglasPeucker,
+      Distance::DistanceType unit = Distance::DistanceType::kMeter)
+      -> std::vector<Point2D>;
+  /**
+   * @brief Simplify points
+   * @param points The points
+   * @param tolerance The tolerance
+   * @param method The simplification method
+   * @param unit The unit of the point coordinates
+   * @return std::vector<Point2D> The retained points
+   * @throws invalid_argument If tolerance is negative
+   */
+  [[nodiscard]] static auto Simplify(
+      const std::vector<Point2D>& points, const Distance& tolerance,
+      Method method = Method::kDouglasPeucker,
+      Distance::DistanceType unit = Distance::DistanceType::kMeter)
+      -> std::vector<Point2D>;
+
+ protected:
+ private:
+};
+
+/**
+ * @brief Online simplification emitting retained points as input arrives
+ * @details An opening window: points after the last retained point are
+ * buffered while every buffered point stays within tolerance of the segment
+ * from the last retained point to the newest point. When one does not, the
+ * point before the newest is retained. The buffer never holds more than the
+ * window size, at which point its newest point is retained regardless, so
+ * memory stays bounded for unbounded input.
+ */
+class StreamingPolylineSimplifier2D {
+ public:
+  /**
+   * @brief Callback receiving the input index and the retained point
+   */
+  using Callback = std::function<void(std::size_t index, const Point2D& point)>;
+
+  /**
+   * @brief Default number of points buffered after the last retained point
+   */
+  static constexpr std::size_t kDefaultWindowSize{1024U};
+
+  /**
+   * @brief Construct a new StreamingPolylineSimplifier2D object
+   * @param tolerance The tolerance
+   * @param callback Called in input order with each retained point
+   * @param unit The unit of the point coordinates
+   * @param window_size The maximum number of buffered points
+   * @throws invalid_argument If tolerance is negative or window_size is zero
+   */
+  StreamingPolylineSimplifier2D(
+      const Distance& tolerance, Callback callback,
+      Distance::DistanceType unit = Distance::DistanceType::kMeter,
+      std::size_t window_size = kDefaultWindowSize);
+
+  /**
+   * @brief Add the next point of the polyline
+   * @param point The point
+   */
+  auto Push(const Point2D& point) -> void;
+  /**
+   * @brief Retain the last point and start a new polyline
+   */
+  auto Finish() -> void;
+  /**
+   * @brief Get the number of points pushed since the polyline started
+   * @return std::size_t The number of points
+   */
+  [[nodiscard]] auto GetInputCount() const -> std::size_t;
+  /**
+   * @brief Get the number of points buffered after the last retained point
+   * @return std::size_t The number of points
+   */
+  [[nodiscard]] auto GetBufferedCount() const -> std::size_t;
+
+ protected:
+ private:
+  /**
+   * @brief A buffered input point
+   */
+  struct Entry {
+    std::size_t index{0};  ///< Input index
+    Point2D point;         ///< The point
+  };
+
+  /**
+   * @brief Retain a point and make it the start of the window
+   * @param entry The retained point
+   */
+  auto Retain(const Entry& entry) -> void;
+
+  double tolerance_squared_{0.0};  ///< Squared tolerance in coordinate units
+  Callback callback_;              ///< Receiver of retained points
+  std::size_t window_size_{kDefaultWindowSize};  ///< Maximum buffered points
+  std::size_t input_count_{0};                   ///< Points pushed so far
+  Entry anchor_;               ///< Last retained point
+  std::vector<Entry> window_;  ///< Points after anchor_ in input order
+};
+}  // namespace Jeong0806::geometry
+
+#endif  // Jeong0806_GEOMETRY_POLYLINE_SIMPLIFIER_2D_HPP_
@@ -0,0 +1,127 @@
+/**
+ * @file geometry/predicates2d.hpp
+ * @author Jeong Seong In (0806jsi@gmail.com)
+ * @brief Robust orientation and in-circle predicate class declaration
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2023 Jeong0806, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#ifndef Jeong0806_GEOMETRY_PREDICATES_2D_HPP_
+#define Jeong0806_GEOMETRY_PREDICATES_2D_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "geometry/parallel.hpp"
+#include "geometry/point2d.hpp"
+#include "geometry/point_cloud2d.hpp"
+
+namespace Jeong0806::geometry {
+/**
+ * @brief Orientation and in-circle predicates with exact signs
+ * @details Each predicate first evaluates its determinant in plain double
+ * arithmetic and returns it when a forward error bound proves the sign, which
+ * holds for all but near-degenerate inputs. Otherwise it refines the value
+ * with adaptive expansion arithmetic after Shewchuk, so only the slow cases
+ * pay for exactness, and the Instrumentation counter kPredicateFallbacks
+ * counts them. Results are exact for any finite coordinates whose products
+ * neither overflow nor underflow.
+ */
+class Predicates2D {
+ public:
+  /**
+   * @brief Get the orientation of point c relative to the line through a and b
+   * @param a The first point of the line
+   * @param b The second point of the line
+   * @param c The tested point
+   * @return double Positive if a, b and c are counter-clockwise, negative if
+   * clockwise and zero if collinear, approximately twice the signed area
+   */
+  [[nodiscard]] static auto Orient2D(const Point2D& a, const Point2D& b,
+                                     const Point2D& c) -> double;
+  /**
+   * @brief Get if point d lies inside the circle through a, b and c
+   * @param a The first point on the circle
+   * @param b The second point on the circle
+   * @param c The third point on the circle
+   * @param d The tested point
+   * @return double Positive if d is inside the circle of counter-clockwise a,
+   * b and c, negative if outside and zero if cocircular. The sign flips when
+   * a, b and c are clockwise.
+   */
+  [[nodiscard]] static auto InCircle(const Point2D& a, const Point2D& b,
+                                     const Point2D& c, const Point2D& d)
+      -> double;
+
+  /**
+   * @brief Get the orientation of many points relative to one line across
+   * threads
+   * @param a The first point of the line
+   * @param b The second point of the line
+   * @param points Pointer to the first tested point
+   * @param count The number of tested points
+   * @param output count signs, 1 if counter-clockwise, -1 if clockwise and 0
+   * if collinear
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param executor The executor running the threads
+   */
+  static auto Orient2D(const Point2D& a, const Point2D& b,
+                       const Point2D* points, std::size_t count,
+                       int8_t* output, std::size_t thread_count = 0,
+                       Executor* executor = GetDefaultExecutor()) -> void;
+  /**
+   * @brief Get the orientation of many points relative to one line across
+   * threads
+   * @param a The first point of the line
+   * @param b The second point of the line
+   * @param points The tested points
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param executor The executor running the threads
+   * @return std::vector<int8_t> The sign of each point in index order
+   */
+  [[nodiscard]] static auto Orient2D(
+      const Point2D& a, const Point2D& b, const PointCloud2D& points,
+      std::size_t thread_count = 0, Executor* executor = GetDefaultExecutor())
+      -> std::vector<int8_t>;
+  /**
+   * @brief Get if many points lie inside one circle across threads
+   * @param a The first point on the circle
+   * @param b The second point on the circle
+   * @param c The third point on the circle
+   * @param points Pointer to the first tested point
+   * @param count The number of tested points
+   * @param output count signs as of InCircle, 1 if inside, -1 if outside and
+   * 0 if cocircular for counter-clockwise a, b and c
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param executor The executor running the threads
+   */
+  static auto InCircle(const Point2D& a, const Point2D& b, const Point2D& c,
+                       const Point2D* points, std::size_t count,
+                       int8_t* output, std::size_t thread_count = 0,
+                       Executor* executor = GetDefaultExecutor()) -> void;
+  /**
+   * @brief Get if many points lie inside one circle across threads
+   * @param a The first point on the circle
+   * @param b The second point on the circle
+   * @param c The third point on the circle
+   * @param points The tested points
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param executor The executor running the threads
+   * @return std::vector<int8_t> The sign of each point in index order
+   */
+  [[nodiscard]] static auto InCircle(
+      const Point2D& a, const Point2D& b, const Point2D& c,
+      const PointCloud2D& points, std::size_t thread_count = 0,
+      Executor* executor = GetDefaultExecutor()) -> std::vector<int8_t>;
+
+ protected:
+ private:
+};
+}  // namespace Jeong0806::geometry
+
+#endif  // Jeong0806_GEOMETRY_PREDICATES_2D_HPP_
@@ -0,0 +1,380 @@
+/**
+ * @file geometry/quantity.hpp
+ * @author Jeong Seong In (0806jsi@gmail.com)
+ * @brief Compile-time unit-typed distance quantity declaration
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2023 Jeong0806, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#ifndef Jeong0806_GEOMETRY_QUANTITY_HPP_
+#define Jeong0806_GEOMETRY_QUANTITY_HPP_
+
+#include <type_traits>
+
+#include "geometry/distance.hpp"
+
+namespace Jeong0806::geometry {
+/**
+ * @brief Distance value whose unit is part of its type
+ * @details Every conversion factor is a compile-time constant, so converting
+ * between units is one multiply and a same-unit operation is plain double
+ * arithmetic. Quantities of different units only mix through an explicit
+ * conversion.
+ * @tparam kUnit The distance type of the value
+ */
+template <Distance::DistanceType kUnit>
+class Quantity {
+ public:
+  /**
+   * @brief The distance type of the value
+   */
+  static constexpr Distance::DistanceType kType{kUnit};
+
+  /**
+   * @brief Construct a new zero Quantity object
+   */
+  Quantity() = default;
+  /**
+   * @brief Construct a new Quantity object
+   * @param value The value in kUnit
+   */
+  constexpr explicit Quantity(double value);
+  /**
+   * @brief Convert a Quantity object of another unit
+   * @tparam kOther The distance type of other
+   * @param other The Quantity object to convert
+   */
+  template <Distance::DistanceType kOther>
+  constexpr explicit Quantity(const Quantity<kOther>& other);
+  /**
+   * @brief Convert a Distance object
+   * @param distance The Distance object to convert
+   */
+  constexpr explicit Quantity(const Distance& distance);
+
+  /**
+   * @brief Get the value
+   * @return double The value in kUnit
+   */
+  [[nodiscard]] constexpr auto GetValue() const -> double;
+  /**
+   * @brief Convert to a Distance object
+   * @return Distance The Distance object
+   */
+  [[nodiscard]] constexpr auto ToDistance() const -> Distance;
+
+  /**
+   * @brief Compare with other quantity object for equality
+   * @param other The other quantity object
+   * @return true If equal
+   * @return false If not equal
+   */
+  constexpr auto operator==(const Quantity& other) const -> bool;
+  /**
+   * @brief Compare with other quantity object for equality
+   * @param other The other quantity object
+   * @return true If not equal
+   * @return false If equal
+   */
+  constexpr auto operator!=(const Quantity& other) const -> bool;
+  /**
+   * @brief Compare with other quantity object for less
+   * @param other The other quantity object
+   * @return true If less
+   * @return false If bigger or equal
+   */
+  constexpr auto operator<(const Quantity& other) const -> bool;
+  /**
+   * @brief Compare with other quantity object for less or equal
+   * @param other The other quantity object
+   * @return true If less or equal
+   * @return false If bigger
+   */
+  constexpr auto operator<=(const Quantity& other) const -> bool;
+  /**
+   * @brief Compare with other quantity object for bigger
+   * @param other The other quantity object
+   * @return true If bigger
+   * @return false If less or equal
+   */
+  constexpr auto operator>(const Quantity& other) const -> bool;
+  /**
+   * @brief Compare with other quantity object for bigger or equal
+   * @param other The other quantity object
+   * @return true If bigger or equal
+   * @return false If less
+   */
+  constexpr auto operator>=(const Quantity& other) const -> bool;
+
+  /**
+   * @brief Negate the quantity
+   * @return Quantity The negated quantity
+   */
+  constexpr auto operator-() const -> Quantity;
+  /**
+   * @brief Add other quantity object
+   * @param other The other quantity object
+   * @return Quantity The result of addition
+   */
+  constexpr auto operator+(const Quantity& other) const -> Quantity;
+  /**
+   * @brief Subtract other quantity object
+   * @param other The other quantity object
+   * @return Quantity The result of subtraction
+   */
+  constexpr auto operator-(const Quantity& other) const -> Quantity;
+  /**
+   * @brief Multiply by scale
+   * @param scale The value for multiplication
+   * @return Quantity The result of multiplication
+   */
+  constexpr auto operator*(double scale) const -> Quantity;
+  /**
+   * @brief Divide by scale
+   * @param scale The value for division
+   * @return Quantity The result of division
+   */
+  constexpr auto operator/(double scale) const -> Quantity;
+  /**
+   * @brief Divide by other quantity object
+   * @param other The other quantity object
+   * @return double The ratio of the two quantities
+   */
+  constexpr auto operator/(const Quantity& other) const -> double;
+
+  /**
+   * @brief Add other quantity object
+   * @param other The other quantity object
+   * @return Quantity& Reference of this object
+   */
+  constexpr auto operator+=(const Quantity& other) -> Quantity&;
+  /**
+   * @brief Subtract other quantity object
+   * @param other The other quantity object
+   * @return Quantity& Reference of this object
+   */
+  constexpr auto operator-=(const Quantity& other) -> Quantity&;
+  /**
+   * @brief Multiply by scale
+   * @param scale The value for multiplication
+   * @return Quantity& Reference of this object
+   */
+  constexpr auto operator*=(double scale) -> Quantity&;
+  /**
+   * @brief Divide by scale
+   * @param scale The value for division
+   * @return Quantity& Reference of this object
+   */
+  constexpr auto operator/=(double scale) -> Quantity&;
+
+ protected:
+ private:
+  double value_{0.0};  ///< The value in kUnit
+};
+
+using Kilometers = Quantity<Distance::DistanceType::kKilometer>;
+using Meters = Quantity<Distance::DistanceType::kMeter>;
+using Centimeters = Quantity<Distance::DistanceType::kCentimeter>;
+using Millimeters = Quantity<Distance::DistanceType::kMillimeter>;
+using Micrometers = Quantity<Distance::DistanceType::kMicrometer>;
+using Nanometers = Quantity<Distance::DistanceType::kNanometer>;
+
+static_assert(std::is_trivially_copyable_v<Meters>,
+              "Quantity must be trivially copyable");
+static_assert(sizeof(Meters) == sizeof(double),
+              "Quantity must not carry any member but its value");
+
+/**
+ * @brief Multiply a quantity by scale
+ * @tparam kUnit The distance type of the quantity
+ * @param scale The value for multiplication
+ * @param quantity The quantity object
+ * @return Quantity<kUnit> The result of multiplication
+ */
+template <Distance::DistanceType kUnit>
+constexpr auto operator*(double scale, const Quantity<kUnit>& quantity)
+    -> Quantity<kUnit> {
+  return quantity * scale;
+}
+
+template <Distance::DistanceType kUnit>
+constexpr Quantity<kUnit>::Quantity(double value) : value_(value) {}
+
+template <Distance::DistanceType kUnit>
+template <Distance::DistanceType kOther>
+constexpr Quantity<kUnit>::Quantity(const Quantity<kOther>& other)
+    : value_(other.GetValue()) {
+  if constexpr (kOther != kUnit) {
+    constexpr double kScale{
+        static_cast<double>(Distance::GetNanometerScale(kOther)) /
+        static_cast<double>(Distance::GetNanometerScale(kUnit))};
+    value_ *= kScale;
+  }
+}
+
+template <Distance::DistanceType kUnit>
+constexpr Quantity<kUnit>::Quantity(const Distance& distance)
+    : value_(distance.GetValue<kUnit>()) {}
+
+template <Distance::DistanceType kUnit>
+constexpr auto Quantity<kUnit>::GetValue() const -> double {
+  return value_;
+}
+
+template <Distance::DistanceType kUnit>
+constexpr auto Quantity<kUnit>::ToDistance() const -> Distance {
+  return Distance::FromValue<kUnit>(value_);
+}
+
+template <Distance::DistanceType kUnit>
+constexpr auto Quantity<kUnit>::operator==(const Quantity& other) const
+    -> bool {
+  return (value_ == other.value_);
+}
+
+template <Distance::DistanceType kUnit>
+constexpr auto Quantity<kUnit>::operator!=(const Quantity& other) const
+    -> bool {
+  return (value_ != other.value_);
+}
+
+template <Distance::DistanceType kUnit>
+constexpr auto Quantity<kUnit>::operator<(const Quantity& other) const
+    -> bool {
+  return (value_ < other.value_);
+}
+
+template <Distance::DistanceType kUnit>
+constexpr auto Quantity<kUnit>::operator<=(const Quantity& other) const
+    -> bool {
+  return (value_ <= other.value_);
+}
+
+template <Distance::DistanceType kUnit>
+constexpr auto Quantity<kUnit>::operator>(const Quantity& other) const
+    -> bool {
+  return (value_ > other.value_);
+}
+
+template <Distance::DistanceType kUnit>
+constexpr auto Quantity<kUnit>::operator>=(const Quantity& other) const
+    -> bool {
+  return (value_ >= other.value_);
+}
+
+template <Distance::DistanceType kUnit>
+constexpr auto Quantity<kUnit>::operator-() const -> Quantity {
+  return Quantity(-value_);
+}
+
+template <Distance::DistanceType kUnit>
+constexpr auto Quantity<kUnit>::operator+(const Quantity& other) const
+    -> Quantity {
+  return Quantity(value_ + other.value_);
+}
+
+template <Distance::DistanceType kUnit>
+constexpr auto Quantity<kUnit>::operator-(const Quantity& other) const
+    -> Quantity {
+  return Quantity(value_ - other.value_);
+}
+
+template <Distance::DistanceType kUnit>
+constexpr auto Quantity<kUnit>::operator*(double scale) const -> Quantity {
+  return Quantity(value_ * scale);
+}
+
+template <Distance::DistanceType kUnit>
+constexpr auto Quantity<kUnit>::operator/(double scale) const -> Quantity {
+  return Quantity(value_ / scale);
+}
+
+template <Distance::DistanceType kUnit>
+constexpr auto Quantity<kUnit>::operator/(const Quantity& other) const
+    -> double {
+  return (value_ / other.value_);
+}
+
+template <Distance::DistanceType kUnit>
+constexpr auto Quantity<kUnit>::operator+=(const Quantity& other)
+    -> Quantity& {
+  value_ += other.value_;
+  return *this;
+}
+
+template <Distance::DistanceType kUnit>
+constexpr auto Quantity<kUnit>::operator-=(const Quantity& other)
+    -> Quantity& {
+  value_ -= other.value_;
+  return *this;
+}
+
+template <Distance::DistanceType kUnit>
+constexpr auto Quantity<kUnit>::operator*=(double scale) -> Quantity& {
+  value_ *= scale;
+  return *this;
+}
+
+template <Distance::DistanceType kUnit>
+constexpr auto Quantity<kUnit>::operator/=(double scale) -> Quantity& {
+  value_ /= scale;
+  return *this;
+}
+
+namespace literals {
+/**
+ * @brief Kilometer literal
+ * @param value The value in kilometers
+ * @return Kilometers The quantity
+ */
+constexpr auto operator""_km(long double value) -> Kilometers {
+  return Kilometers(static_cast<double>(value));
+}
+/**
+ * @brief Meter literal
+ * @param value The value in meters
+ * @return Meters The quantity
+ */
+constexpr auto operator""_m(long double value) -> Meters {
+  return Meters(static_cast<double>(value));
+}
+/**
+ * @brief Centimeter literal
+ * @param value The value in centimeters
+ * @return Centimeters The quantity
+ */
+constexpr auto operator""_cm(long double value) -> Centimeters {
+  return Centimeters(static_cast<double>(value));
+}
+/**
+ * @brief Millimeter literal
+ * @param value The value in millimeters
+ * @return Millimeters The quantity
+ */
+constexpr auto operator""_mm(long double value) -> Millimeters {
+  return Millimeters(static_cast<double>(value));
+}
+/**
+ * @brief Micrometer literal
+ * @param value The value in micrometers
+ * @return Micrometers The quantity
+ */
+constexpr auto operator""_um(long double value) -> Micrometers {
+  return Micrometers(static_cast<double>(value));
+}
+/**
+ * @brief Nanometer literal
+ * @param value The value in nanometers
+ * @return Nanometers The quantity
+ */
+constexpr auto operator""_nm(long double value) -> Nanometers {
+  return Nanometers(static_cast<double>(value));
+}
+}  // namespace literals
+}  // namespace Jeong0806::geometry
+
+#endif  // Jeong0806_GEOMETRY_QUANTITY_HPP_
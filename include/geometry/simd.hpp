@@ -0,0 +1,64 @@
+/**
+ * @file geometry/simd.hpp
+ * @author Jeong Seong In (0806jsi@gmail.com)
+ * @brief Runtime selection of the SIMD instruction set for batch kernels
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2023 Jeong0806, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#ifndef Jeong0806_GEOMETRY_SIMD_HPP_
+#define Jeong0806_GEOMETRY_SIMD_HPP_
+
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__GNUC__) || defined(__clang__))
+/// Compile x86 kernels with per-function target attributes
+#define Jeong0806_GEOMETRY_SIMD_X86 1
+#endif
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+/// Compile NEON kernels, always available on AArch64
+#define Jeong0806_GEOMETRY_SIMD_NEON 1
+#endif
+
+namespace Jeong0806::geometry {
+/**
+ * @brief The enum class for instruction set used by batch kernels
+ */
+enum class SimdLevel {
+  kScalar = 0,
+  kNeon = 1,
+  kAvx2 = 2,
+  kAvx512 = 3  ///< AVX-512 F and DQ
+};
+
+/**
+ * @brief Detect the widest instruction set supported by this CPU and OS
+ * @return SimdLevel The detected instruction set
+ */
+[[nodiscard]] auto DetectSimdLevel() -> SimdLevel;
+/**
+ * @brief Get the instruction set currently used by batch kernels
+ * @return SimdLevel The active instruction set, detected on first use
+ */
+[[nodiscard]] auto GetSimdLevel() -> SimdLevel;
+/**
+ * @brief Set the instruction set used by batch kernels
+ * @param level The requested instruction set
+ * @return SimdLevel The applied instruction set
+ * @throws invalid_argument If level is not supported by this CPU
+ */
+auto SetSimdLevel(SimdLevel level) -> SimdLevel;
+/**
+ * @brief Check if the instruction set can run on this CPU
+ * @param level The instruction set
+ * @return true If supported
+ * @return false If not supported
+ */
+[[nodiscard]] auto IsSimdLevelSupported(SimdLevel level) -> bool;
+}  // namespace Jeong0806::geometry
+
+#endif  // Jeong0806_GEOMETRY_SIMD_HPP_
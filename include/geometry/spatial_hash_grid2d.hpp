@@ -0,0 +1,183 @@
+/**
+ * @file geometry/spatial_hash_grid2d.hpp
+ * @author Jeong Seong In (0806jsi@gmail.com)
+ * @brief Uniform grid class declaration for fixed-radius neighbor queries
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2023 Jeong0806, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#ifndef Jeong0806_GEOMETRY_SPATIAL_HASH_GRID_2D_HPP_
+#define Jeong0806_GEOMETRY_SPATIAL_HASH_GRID_2D_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+#include "geometry/distance.hpp"
+#include "geometry/neighbor.hpp"
+#include "geometry/parallel.hpp"
+#include "geometry/point2d.hpp"
+
+namespace Jeong0806::geometry {
+/**
+ * @brief Uniform grid bucketing points by square cells
+ * @details Points are counting-sorted by bucket into flat arrays, so a bucket
+ * is a contiguous run and no bucket owns an allocation. Cells map to buckets
+ * directly while the bounding box has few cells, and through a hash otherwise.
+ * The arrays and the build buffers are allocated from a memory resource, the
+ * default resource unless one is given.
+ */
+class SpatialHashGrid2D {
+ public:
+  /**
+   * @brief Construct a new empty SpatialHashGrid2D object
+   */
+  SpatialHashGrid2D() = default;
+  /**
+   * @brief Construct a new SpatialHashGrid2D object from contiguous points
+   * @param points Pointer to the first point
+   * @param count The number of points
+   * @param cell_size The edge length of a cell
+   * @param unit The unit of the point coordinates
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param resource The memory resource of the arrays
+   * @param executor The executor running the threads
+   * @throws invalid_argument If cell_size is not positive
+   * @throws length_error If count does not fit in 32 bits
+   */
+  SpatialHashGrid2D(
+      const Point2D* points, std::size_t count, const Distance& cell_size,
+      Distance::DistanceType unit = Distance::DistanceType::kMeter,
+      std::size_t thread_count = 0,
+      std::pmr::memory_resource* resource = std::pmr::get_default_resource(),
+      Executor* executor = GetDefaultExecutor());
+  /**
+   * @brief Construct a new SpatialHashGrid2D object from points
+   * @param points Point2D objects, query results index into this vector
+   * @param cell_size The edge length of a cell
+   * @param unit The unit of the point coordinates
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param resource The memory resource of the arrays
+   * @param executor The executor running the threads
+   * @throws invalid_argument If cell_size is not positive
+   * @throws length_error If there are more points than fit in 32 bits
+   */
+  SpatialHashGrid2D(
+      const std::vector<Point2D>& points, const Distance& cell_size,
+      Distance::DistanceType unit = Distance::DistanceType::kMeter,
+      std::size_t thread_count = 0,
+      std::pmr::memory_resource* resource = std::pmr::get_default_resource(),
+      Executor* executor = GetDefaultExecutor());
+
+  /**
+   * @brief Get the number of indexed points
+   * @return std::size_t The number of points
+   */
+  [[nodiscard]] auto Size() const -> std::size_t;
+  /**
+   * @brief Check if no point is indexed
+   * @return true If empty
+   * @return false If not empty
+   */
+  [[nodiscard]] auto Empty() const -> bool;
+  /**
+   * @brief Get the memory resource of the arrays
+   * @return std::pmr::memory_resource* The memory resource
+   */
+  [[nodiscard]] auto GetResource() const -> std::pmr::memory_resource*;
+  /**
+   * @brief Get the edge length of a cell
+   * @return Distance The cell size
+   */
+  [[nodiscard]] auto GetCellSize() const -> Distance;
+  /**
+   * @brief Get the number of buckets
+   * @return std::size_t The number of buckets
+   */
+  [[nodiscard]] auto GetBucketCount() const -> std::size_t;
+
+  /**
+   * @brief Find every point within radius
+   * @param query The query point
+   * @param radius The inclusive radius in coordinate units
+   * @return std::vector<Neighbor> The points ordered by distance
+   */
+  [[nodiscard]] auto Radius(const Point2D& query, double radius) const
+      -> std::vector<Neighbor>;
+  /**
+   * @brief Find every point within radius
+   * @param query The query point
+   * @param radius The inclusive radius
+   * @return std::vector<Neighbor> The points ordered by distance
+   */
+  [[nodiscard]] auto Radius(const Point2D& query, const Distance& radius) const
+      -> std::vector<Neighbor>;
+  /**
+   * @brief Enumerate every pair of points within radius across threads
+   * @param radius The inclusive radius in coordinate units
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param executor The executor running the threads
+   * @return std::vector<NeighborPair> The pairs ordered by index
+   */
+  [[nodiscard]] auto PairsWithin(
+      double radius, std::size_t thread_count = 0,
+      Executor* executor = GetDefaultExecutor()) const
+      -> std::vector<NeighborPair>;
+  /**
+   * @brief Enumerate every pair of points within radius across threads
+   * @param radius The inclusive radius
+   * @param thread_count The number of threads, zero for all executor threads
+   * @param executor The executor running the threads
+   * @return std::vector<NeighborPair> The pairs ordered by index
+   */
+  [[nodiscard]] auto PairsWithin(
+      const Distance& radius, std::size_t thread_count = 0,
+      Executor* executor = GetDefaultExecutor()) const
+      -> std::vector<NeighborPair>;
+
+ protected:
+ private:
+  /**
+   * @brief Get the bucket of a cell
+   * @param cell_x x index of the cell
+   * @param cell_y y index of the cell
+   * @return std::size_t The bucket index
+   */
+  [[nodiscard]] auto GetBucket(int64_t cell_x, int64_t cell_y) const
+      -> std::size_t;
+  /**
+   * @brief Get the cell index of a coordinate
+   * @param value The coordinate value
+   * @param origin The coordinate of the grid origin
+   * @return int64_t The cell index
+   */
+  [[nodiscard]] auto GetCell(double value, double origin) const -> int64_t;
+  /**
+   * @brief Visit every point in the buckets of the cells overlapping a square
+   * @param query The center of the square
+   * @param radius The half edge length of the square
+   * @param visit Callable receiving the sorted position of each point
+   */
+  template <typename Visitor>
+  auto VisitBuckets(const Point2D& query, double radius, Visitor&& visit) const
+      -> void;
+
+  Distance::DistanceType unit_{Distance::DistanceType::kMeter};  ///< Unit
+  double cell_size_{1.0};                ///< Cell size in coordinate units
+  double origin_x_{0.0};                 ///< x coordinate of the grid origin
+  double origin_y_{0.0};                 ///< y coordinate of the grid origin
+  int64_t cells_x_{0};                   ///< Cells along x, zero if hashed
+  int64_t cells_y_{0};                   ///< Cells along y, zero if hashed
+  std::pmr::vector<uint32_t> bucket_starts_;  ///< First position per bucket
+  std::pmr::vector<double> xs_;               ///< x coordinates, bucket order
+  std::pmr::vector<double> ys_;               ///< y coordinates, bucket order
+  std::pmr::vector<uint32_t> indices_;        ///< Input index, bucket order
+};
+}  // namespace Jeong0806::geometry
+
+#endif  // Jeong0806_GEOMETRY_SPATIAL_HASH_GRID_2D_HPP_
@@ -0,0 +1,270 @@
+/**
+ * @file geometry/src/closest_pair2d.cpp
+ * @author Jeong Seong In (0806jsi@gmail.com)
+ * @brief Closest pair query class developments over 2-dimension points
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2023 Jeong0806, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/closest_pair2d.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <numeric>
+#include <stdexcept>
+
+#include "geometry/kd_tree2d.hpp"
+#include "geometry/instrumentation.hpp"
+#include "geometry/parallel.hpp"
+
+namespace {
+using Jeong0806::geometry::ClosestPair2D;
+using Jeong0806::geometry::Executor;
+using Jeong0806::geometry::NeighborPair;
+using Jeong0806::geometry::Point2D;
+
+// Up to this many points are compared pairwise instead of split
+constexpr std::size_t kBruteForceSize{3U};
+
+struct Candidate {
+  double squared{std::numeric_limits<double>::infinity()};
+  uint32_t first{0U};
+  uint32_t second{0U};
+};
+
+auto IsBetter(const Candidate& lhs, const Candidate& rhs) -> bool {
+  if (lhs.squared != rhs.squared) {
+    return lhs.squared < rhs.squared;
+  }
+  return (lhs.first < rhs.first) ||
+         ((lhs.first == rhs.first) && (lhs.second < rhs.second));
+}
+
+auto Update(const Point2D* points, uint32_t lhs, uint32_t rhs, Candidate& best)
+    -> void {
+  const Candidate kCandidate{
+      Point2D::CalculateSquaredDistance(points[lhs], points[rhs]),
+      std::min(lhs, rhs), std::max(lhs, rhs)};
+  if (IsBetter(kCandidate, best)) {
+    best = kCandidate;
+  }
+}
+
+auto IsLessX(const Point2D* points, uint32_t lhs, uint32_t rhs) -> bool {
+  if (points[lhs].GetX() != points[rhs].GetX()) {
+    return points[lhs].GetX() < points[rhs].GetX();
+  }
+  if (points[lhs].GetY() != points[rhs].GetY()) {
+    return points[lhs].GetY() < points[rhs].GetY();
+  }
+  return lhs < rhs;
+}
+
+auto IsLessY(const Point2D* points, uint32_t lhs, uint32_t rhs) -> bool {
+  if (points[lhs].GetY() != points[rhs].GetY()) {
+    return points[lhs].GetY() < points[rhs].GetY();
+  }
+  if (points[lhs].GetX() != points[rhs].GetX()) {
+    return points[lhs].GetX() < points[rhs].GetX();
+  }
+  return lhs < rhs;
+}
+
+// Checks pairs of a y-sorted strip within the best distance in y; windows
+// compare squares since a rounded squared distance is never below dx^2 or
+// dy^2, so no pair at the best distance is skipped
+auto SearchStrip(const Point2D* points, const uint32_t* strip,
+                 std::size_t count, Candidate& best) -> void {
+  for (std::size_t i = 0; i < count; ++i) {
+    for (auto j = i + 1U; j < count; ++j) {
+      const auto kDy = points[strip[j]].GetY() - points[strip[i]].GetY();
+      if (kDy * kDy > best.squared) {
+        break;
+      }
+      Update(points, strip[i], strip[j], best);
+    }
+  }
+}
+
+// Divide and conquer over x-sorted indices, which end up sorted by y
+auto Solve(const Point2D* points, uint32_t* indices, std::size_t count,
+           uint32_t* scratch, Candidate& best) -> void {
+  const auto kLessY = [points](uint32_t lhs, uint32_t rhs) {
+    return IsLessY(points, lhs, rhs);
+  };
+  if (count <= kBruteForceSize) {
+    for (std::size_t i = 0; i < count; ++i) {
+      for (auto j = i + 1U; j < count; ++j) {
+        Update(points, indices[i], indices[j], best);
+      }
+    }
+    std::sort(indices, indices + count, kLessY);
+    return;
+  }
+
+  const auto kMiddle = count / 2U;
+  const auto kMiddleX = points[indices[kMiddle]].GetX();
+  Solve(points, indices, kMiddle, scratch, best);
+  Solve(points, indices + kMiddle, count - kMiddle, scratch, best);
+  std::merge(indices, indices + kMiddle, indices + kMiddle, indices + count,
+             scratch, kLessY);
+  std::copy(scratch, scratch + count, indices);
+
+  std::size_t strip_count = 0;
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto kDx = points[indices[i]].GetX() - kMiddleX;
+    if (kDx * kDx <= best.squared) {
+      scratch[strip_count++] = indices[i];
+    }
+  }
+  SearchStrip(points, scratch, strip_count, best);
+}
+
+auto GetBlockCount(std::size_t count, std::size_t thread_count,
+                   Executor* executor) -> std::size_t {
+  thread_count =
+      Jeong0806::geometry::ResolveThreadCount(thread_count, executor);
+  return std::max<std::size_t>(
+      std::min(thread_count, count / ClosestPair2D::kMinBlockSize), 1U);
+}
+
+auto ToNeighborPair(const Candidate& candidate) -> NeighborPair {
+  return NeighborPair{candidate.first, candidate.second,
+                      std::sqrt(candidate.squared)};
+}
+}  // namespace
+
+namespace Jeong0806::geometry {
+auto ClosestPair2D::Find(const Point2D* points, std::size_t count,
+                         std::size_t thread_count, Executor* executor)
+    -> NeighborPair {
+  const Instrumentation::ScopedTimer kTimer(
+      Instrumentation::Timer::kClosestPair);
+  if (count < 2U) {
+    throw std::invalid_argument("Closest pair needs at least two points");
+  }
+  if (count > std::numeric_limits<uint32_t>::max()) {
+    throw std::length_error("ClosestPair2D supports up to 2^32 - 1 points");
+  }
+
+  std::vector<uint32_t> sorted(count);
+  std::iota(sorted.begin(), sorted.end(), 0U);
+  ParallelSort(
+      sorted.begin(), sorted.end(),
+      [points](uint32_t lhs, uint32_t rhs) {
+        return IsLessX(points, lhs, rhs);
+      },
+      thread_count, executor);
+
+  const auto kBlocks = GetBlockCount(count, thread_count, executor);
+  const auto kBound = [count, kBlocks](std::size_t block) {
+    return (count * block) / kBlocks;
+  };
+  std::vector<Candidate> candidates(kBlocks);
+  ParallelFor(
+      kBlocks,
+      [&](std::size_t begin, std::size_t end) {
+        for (auto block = begin; block < end; ++block) {
+          std::vector<uint32_t> indices(sorted.begin() + kBound(block),
+                                        sorted.begin() + kBound(block + 1U));
+          std::vector<uint32_t> scratch(indices.size());
+          Solve(points, indices.data(), indices.size(), scratch.data(),
+                candidates[block]);
+        }
+      },
+      thread_count, executor);
+  auto best =
+      *std::min_element(candidates.begin(), candidates.end(), IsBetter);
+
+  // Pairs across a block boundary lie in the strip around its first point
+  const auto kBest = best;
+  ParallelFor(
+      kBlocks - 1U,
+      [&](std::size_t begin, std::size_t end) {
+        for (auto block = begin + 1U; block <= end; ++block) {
+          const auto kStart = kBound(block);
+          const auto kBoundaryX = points[sorted[kStart]].GetX();
+          const auto kIsInStrip = [&](std::size_t position) {
+            const auto kDx = points[sorted[position]].GetX() - kBoundaryX;
+            return kDx * kDx <= kBest.squared;
+          };
+          auto first = kStart;
+          while ((first > 0U) && kIsInStrip(first - 1U)) {
+            --first;
+          }
+          auto last = kStart;
+          while ((last < count) && kIsInStrip(last)) {
+            ++last;
+          }
+          std::vector<uint32_t> strip(sorted.begin() + first,
+                                      sorted.begin() + last);
+          std::sort(strip.begin(), strip.end(),
+                    [points](uint32_t lhs, uint32_t rhs) {
+                      return IsLessY(points, lhs, rhs);
+                    });
+          SearchStrip(points, strip.data(), strip.size(), candidates[block]);
+        }
+      },
+      thread_count, executor);
+  for (const auto& candidate : candidates) {
+    if (IsBetter(candidate, best)) {
+      best = candidate;
+    }
+  }
+  return ToNeighborPair(best);
+}
+
+auto ClosestPair2D::Find(const std::vector<Point2D>& points,
+                         std::size_t thread_count, Executor* executor)
+    -> NeighborPair {
+  return Find(points.data(), points.size(), thread_count, executor);
+}
+
+auto ClosestPair2D::FindBetween(const Point2D* lhs, std::size_t lhs_count,
+                                const Point2D* rhs, std::size_t rhs_count,
+                                std::size_t thread_count, Executor* executor)
+    -> NeighborPair {
+  const Instrumentation::ScopedTimer kTimer(
+      Instrumentation::Timer::kClosestPair);
+  if ((lhs_count == 0U) || (rhs_count == 0U)) {
+    throw std::invalid_argument("Closest pair needs points in both sets");
+  }
+
+  const KdTree2D kTree(rhs, rhs_count);
+  NeighborPair best{0U, 0U, std::numeric_limits<double>::infinity()};
+  std::mutex best_mutex;
+  ParallelFor(
+      lhs_count,
+      [&](std::size_t begin, std::size_t end) {
+        NeighborPair local{0U, 0U, std::numeric_limits<double>::infinity()};
+        for (auto i = begin; i < end; ++i) {
+          const auto kNearest = kTree.Nearest(lhs[i]);
+          if (kNearest.distance < local.distance) {
+            local = NeighborPair{i, kNearest.index, kNearest.distance};
+          }
+        }
+        const std::lock_guard<std::mutex> kLock(best_mutex);
+        if ((local.distance < best.distance) ||
+            ((local.distance == best.distance) && (local < best))) {
+          best = local;
+        }
+      },
+      thread_count, executor);
+  return best;
+}
+
+auto ClosestPair2D::FindBetween(const std::vector<Point2D>& lhs,
+                                const std::vector<Point2D>& rhs,
+                                std::size_t thread_count, Executor* executor)
+    -> NeighborPair {
+  return FindBetween(lhs.data(), lhs.size(), rhs.data(), rhs.size(),
+                     thread_count, executor);
+}
+}  // namespace Jeong0806::geometry
@@ -0,0 +1,363 @@
+/**
+ * @file geometry/src/convex_hull2d.cpp
+ * @author Jeong Seong In (0806jsi@gmail.com)
+ * @brief Parallel convex hull class developments over 2-dimension points
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2023 Jeong0806, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/convex_hull2d.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+#include "geometry/instrumentation.hpp"
+#include "geometry/parallel.hpp"
+#include "geometry/predicates2d.hpp"
+
+namespace {
+using Jeong0806::geometry::ConvexHull2D;
+using Jeong0806::geometry::Executor;
+using Jeong0806::geometry::Instrumentation;
+using Jeong0806::geometry::Point2D;
+using Jeong0806::geometry::Predicates2D;
+
+// Number of axis and diagonal directions of the Akl-Toussaint octagon
+constexpr std::size_t kDirectionCount{8U};
+
+struct PointAccessor {
+  const Point2D* points;
+
+  [[nodiscard]] auto X(uint32_t index) const -> double {
+    return points[index].GetX();
+  }
+  [[nodiscard]] auto Y(uint32_t index) const -> double {
+    return points[index].GetY();
+  }
+};
+
+struct CloudAccessor {
+  const double* xs;
+  const double* ys;
+
+  [[nodiscard]] auto X(uint32_t index) const -> double { return xs[index]; }
+  [[nodiscard]] auto Y(uint32_t index) const -> double { return ys[index]; }
+};
+
+// Twice the signed area of (o, a, b), positive if counter-clockwise, with
+// the exact sign so near-collinear points can not fold the hull
+template <typename Accessor>
+auto Cross(const Accessor& points, uint32_t o, uint32_t a, uint32_t b)
+    -> double {
+  return Predicates2D::Orient2D(Point2D(points.X(o), points.Y(o)),
+                                Point2D(points.X(a), points.Y(a)),
+                                Point2D(points.X(b), points.Y(b)));
+}
+
+// Lexicographic order by x then y, index order for duplicates
+template <typename Accessor>
+auto IsLess(const Accessor& points, uint32_t lhs, uint32_t rhs) -> bool {
+  if (points.X(lhs) != points.X(rhs)) {
+    return points.X(lhs) < points.X(rhs);
+  }
+  if (points.Y(lhs) != points.Y(rhs)) {
+    return points.Y(lhs) < points.Y(rhs);
+  }
+  return lhs < rhs;
+}
+
+template <typename Accessor>
+auto IsSamePoint(const Accessor& points, uint32_t lhs, uint32_t rhs) -> bool {
+  return (points.X(lhs) == points.X(rhs)) && (points.Y(lhs) == points.Y(rhs));
+}
+
+// Key minimized by the extreme of each direction, in counter-clockwise order
+// from the leftmost point
+auto DirectionKey(std::size_t direction, double x, double y) -> double {
+  switch (direction) {
+    case 0U:
+      return x;
+    case 1U:
+      return x + y;
+    case 2U:
+      return y;
+    case 3U:
+      return y - x;
+    case 4U:
+      return -x;
+    case 5U:
+      return -(x + y);
+    case 6U:
+      return -y;
+    default:
+      return x - y;
+  }
+}
+
+auto GetBlockCount(std::size_t count, std::size_t thread_count,
+                   Executor* executor) -> std::size_t {
+  thread_count =
+      Jeong0806::geometry::ResolveThreadCount(thread_count, executor);
+  return std::max<std::size_t>(
+      std::min(thread_count, count / ConvexHull2D::kMinBlockSize), 1U);
+}
+
+auto GetBlockBegin(std::size_t count, std::size_t block_count,
+                   std::size_t block) -> std::size_t {
+  return (count * block) / block_count;
+}
+
+// Runs body(block, begin, end) for each of block_count contiguous blocks
+template <typename Body>
+auto ForEachBlock(std::size_t count, std::size_t block_count, Body&& body,
+                  std::size_t thread_count, Executor* executor) -> void {
+  Jeong0806::geometry::ParallelFor(
+      block_count,
+      [&](std::size_t begin, std::size_t end) {
+        for (auto block = begin; block < end; ++block) {
+          body(block, GetBlockBegin(count, block_count, block),
+               GetBlockBegin(count, block_count, block + 1U));
+        }
+      },
+      thread_count, executor);
+}
+
+template <typename Accessor>
+auto FindExtremes(const Accessor& points, std::size_t count,
+                  std::size_t block_count, std::size_t thread_count,
+                  Executor* executor)
+    -> std::array<uint32_t, kDirectionCount> {
+  std::vector<std::array<uint32_t, kDirectionCount>> extremes(block_count);
+  ForEachBlock(
+      count, block_count,
+      [&](std::size_t block, std::size_t begin, std::size_t end) {
+        std::array<uint32_t, kDirectionCount> best{};
+        std::array<double, kDirectionCount> best_key{};
+        best.fill(static_cast<uint32_t>(begin));
+        best_key.fill(std::numeric_limits<double>::infinity());
+        for (auto i = begin; i < end; ++i) {
+          const auto kIndex = static_cast<uint32_t>(i);
+          for (std::size_t d = 0; d < kDirectionCount; ++d) {
+            const auto kKey =
+                DirectionKey(d, points.X(kIndex), points.Y(kIndex));
+            if (kKey < best_key[d]) {
+              best_key[d] = kKey;
+              best[d] = kIndex;
+            }
+          }
+        }
+        extremes[block] = best;
+      },
+      thread_count, executor);
+
+  auto result = extremes.front();
+  for (std::size_t block = 1; block < block_count; ++block) {
+    for (std::size_t d = 0; d < kDirectionCount; ++d) {
+      const auto kCandidate = extremes[block][d];
+      if (DirectionKey(d, points.X(kCandidate), points.Y(kCandidate)) <
+          DirectionKey(d, points.X(result[d]), points.Y(result[d]))) {
+        result[d] = kCandidate;
+      }
+    }
+  }
+  return result;
+}
+
+// Indices of the points not strictly inside the extreme octagon, ascending
+template <typename Accessor>
+auto FilterCandidates(const Accessor& points, std::size_t count,
+                      std::size_t block_count, std::size_t thread_count,
+                      Executor* executor)
+    -> std::vector<uint32_t> {
+  const auto kExtremes =
+      FindExtremes(points, count, block_count, thread_count, executor);
+  std::vector<uint32_t> octagon;
+  for (const auto kIndex : kExtremes) {
+    if (octagon.empty() || !IsSamePoint(points, octagon.back(), kIndex)) {
+      octagon.push_back(kIndex);
+    }
+  }
+  while ((octagon.size() > 1U) &&
+         IsSamePoint(points, octagon.front(), octagon.back())) {
+    octagon.pop_back();
+  }
+
+  std::vector<std::vector<uint32_t>> survivors(block_count);
+  ForEachBlock(
+      count, block_count,
+      [&](std::size_t block, std::size_t begin, std::size_t end) {
+        auto& kept = survivors[block];
+        for (auto i = begin; i < end; ++i) {
+          const auto kIndex = static_cast<uint32_t>(i);
+          auto inside = (octagon.size() >= 3U);
+          for (std::size_t edge = 0; inside && (edge < octagon.size());
+               ++edge) {
+            const auto kNext = (edge + 1U) % octagon.size();
+            inside = Cross(points, octagon[edge], octagon[kNext], kIndex) > 0.0;
+          }
+          if (!inside) {
+            kept.push_back(kIndex);
+          }
+        }
+      },
+      thread_count, executor);
+
+  std::size_t total = 0;
+  for (const auto& kept : survivors) {
+    total += kept.size();
+  }
+  std::vector<uint32_t> candidates;
+  candidates.reserve(total);
+  for (const auto& kept : survivors) {
+    candidates.insert(candidates.end(), kept.begin(), kept.end());
+  }
+  return candidates;
+}
+
+// Andrew's monotone chain over distinct points sorted by IsLess
+template <typename Accessor>
+auto MonotoneChain(const Accessor& points, const uint32_t* sorted,
+                   std::size_t count) -> std::vector<uint32_t> {
+  if (count < 3U) {
+    return std::vector<uint32_t>(sorted, sorted + count);
+  }
+  std::vector<uint32_t> hull(2U * count);
+  std::size_t size = 0;
+  for (std::size_t i = 0; i < count; ++i) {
+    while ((size >= 2U) &&
+           (Cross(points, hull[size - 2U], hull[size - 1U], sorted[i]) <=
+            0.0)) {
+      --size;
+    }
+    hull[size++] = sorted[i];
+  }
+  const auto kLowerSize = size + 1U;
+  for (auto i = count - 1U; i > 0U; --i) {
+    while ((size >= kLowerSize) &&
+           (Cross(points, hull[size - 2U], hull[size - 1U], sorted[i - 1U]) <=
+            0.0)) {
+      --size;
+    }
+    hull[size++] = sorted[i - 1U];
+  }
+  hull.resize(size - 1U);
+  return hull;
+}
+
+template <typename Accessor>
+auto ComputeHull(const Accessor& points, std::size_t count,
+                 std::size_t thread_count, Executor* executor)
+    -> std::vector<std::size_t> {
+  const Instrumentation::ScopedTimer kTimer(
+      Instrumentation::Timer::kConvexHull);
+  if (count > std::numeric_limits<uint32_t>::max()) {
+    throw std::length_error("ConvexHull2D supports up to 2^32 - 1 points");
+  }
+  if (count == 0U) {
+    return {};
+  }
+
+  auto candidates =
+      FilterCandidates(points, count,
+                       GetBlockCount(count, thread_count, executor),
+                       thread_count, executor);
+  Jeong0806::geometry::ParallelSort(
+      candidates.begin(), candidates.end(),
+      [&points](uint32_t lhs, uint32_t rhs) {
+        return IsLess(points, lhs, rhs);
+      },
+      thread_count, executor);
+  candidates.erase(std::unique(candidates.begin(), candidates.end(),
+                               [&points](uint32_t lhs, uint32_t rhs) {
+                                 return IsSamePoint(points, lhs, rhs);
+                               }),
+                   candidates.end());
+
+  // The hull of the union is the hull of the block hull vertices, which stay
+  // sorted when each block's vertices are sorted since blocks are contiguous
+  const auto kCount = candidates.size();
+  const auto kBlocks = GetBlockCount(kCount, thread_count, executor);
+  std::vector<uint32_t> hull;
+  if (kBlocks == 1U) {
+    hull = MonotoneChain(points, candidates.data(), kCount);
+  } else {
+    std::vector<std::vector<uint32_t>> block_hulls(kBlocks);
+    ForEachBlock(
+        kCount, kBlocks,
+        [&](std::size_t block, std::size_t begin, std::size_t end) {
+          auto& block_hull = block_hulls[block];
+          block_hull =
+              MonotoneChain(points, candidates.data() + begin, end - begin);
+          std::sort(block_hull.begin(), block_hull.end(),
+                    [&points](uint32_t lhs, uint32_t rhs) {
+                      return IsLess(points, lhs, rhs);
+                    });
+        },
+        thread_count, executor);
+    std::vector<uint32_t> merged;
+    for (const auto& block_hull : block_hulls) {
+      merged.insert(merged.end(), block_hull.begin(), block_hull.end());
+    }
+    hull = MonotoneChain(points, merged.data(), merged.size());
+  }
+  return std::vector<std::size_t>(hull.begin(), hull.end());
+}
+}  // namespace
+
+namespace Jeong0806::geometry {
+auto ConvexHull2D::ComputeIndices(const Point2D* points, std::size_t count,
+                                  std::size_t thread_count, Executor* executor)
+    -> std::vector<std::size_t> {
+  return ComputeHull(PointAccessor{points}, count, thread_count, executor);
+}
+
+auto ConvexHull2D::ComputeIndices(const std::vector<Point2D>& points,
+                                  std::size_t thread_count, Executor* executor)
+    -> std::vector<std::size_t> {
+  return ComputeIndices(points.data(), points.size(), thread_count, executor);
+}
+
+auto ConvexHull2D::ComputeIndices(const PointCloud2D& points,
+                                  std::size_t thread_count, Executor* executor)
+    -> std::vector<std::size_t> {
+  return ComputeHull(CloudAccessor{points.GetXData(), points.GetYData()},
+                     points.Size(), thread_count, executor);
+}
+
+auto ConvexHull2D::Compute(const Point2D* points, std::size_t count,
+                           std::size_t thread_count, Executor* executor)
+    -> std::vector<Point2D> {
+  const auto kIndices = ComputeIndices(points, count, thread_count, executor);
+  std::vector<Point2D> hull;
+  hull.reserve(kIndices.size());
+  for (const auto kIndex : kIndices) {
+    hull.push_back(points[kIndex]);
+  }
+  return hull;
+}
+
+auto ConvexHull2D::Compute(const std::vector<Point2D>& points,
+                           std::size_t thread_count, Executor* executor)
+    -> std::vector<Point2D> {
+  return Compute(points.data(), points.size(), thread_count, executor);
+}
+
+auto ConvexHull2D::Compute(const PointCloud2D& points,
+                           std::size_t thread_count, Executor* executor)
+    -> PointCloud2D {
+  const auto kIndices = ComputeIndices(points, thread_count, executor);
+  PointCloud2D hull;
+  hull.Reserve(kIndices.size());
+  for (const auto kIndex : kIndices) {
+    hull.PushBack(points.GetPoint(kIndex));
+  }
+  return hull;
+}
+}  // namespace Jeong0806::geometry
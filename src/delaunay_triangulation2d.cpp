@@ -0,0 +1,757 @@
+/**
+ * @file geometry/src/delaunay_triangulation2d.cpp
+ * @author Jeong Seong In (0806jsi@gmail.com)
+ * @brief Delaunay triangulation and Voronoi cell class developments
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2023 Jeong0806, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/delaunay_triangulation2d.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+
+#include "geometry/hilbert2d.hpp"
+#include "geometry/instrumentation.hpp"
+#include "geometry/morton2d.hpp"
+#include "geometry/parallel.hpp"
+#include "geometry/predicates2d.hpp"
+
+namespace {
+using Jeong0806::geometry::DelaunayTriangulation2D;
+using Jeong0806::geometry::Point2D;
+using Jeong0806::geometry::Predicates2D;
+
+// The vertex at infinity shared by the ghost triangles
+constexpr uint32_t kGhost{DelaunayTriangulation2D::kInvalid};
+// A triangulation of n sites has fewer than 2n triangles with ghosts
+constexpr std::size_t kMaxSites{std::numeric_limits<uint32_t>::max() / 6U};
+
+auto Next(uint32_t edge) -> uint32_t {
+  return (edge % 3U == 2U) ? edge - 2U : edge + 1U;
+}
+
+auto Previous(uint32_t edge) -> uint32_t {
+  return (edge % 3U == 0U) ? edge + 2U : edge - 1U;
+}
+
+auto SquaredDistance(const Point2D& lhs, const Point2D& rhs) -> double {
+  const auto kDx = lhs.GetX() - rhs.GetX();
+  const auto kDy = lhs.GetY() - rhs.GetY();
+  return (kDx * kDx) + (kDy * kDy);
+}
+
+auto IsCloser(double lhs_squared, uint32_t lhs_index, double rhs_squared,
+              uint32_t rhs_index) -> bool {
+  return (lhs_squared < rhs_squared) ||
+         ((lhs_squared == rhs_squared) && (lhs_index < rhs_index));
+}
+
+auto CheckBox(const Point2D& min, const Point2D& max) -> void {
+  if (!std::isfinite(min.GetX()) || !std::isfinite(min.GetY()) ||
+      !std::isfinite(max.GetX()) || !std::isfinite(max.GetY())) {
+    throw std::invalid_argument("Box corners must be finite");
+  }
+  if ((max.GetX() < min.GetX()) || (max.GetY() < min.GetY())) {
+    throw std::invalid_argument("Box max must not be below min");
+  }
+}
+
+// The triangulation while sites are inserted. Half-edge e of triangle e / 3
+// starts at triangles[e], and a ghost triangle (u, v, kGhost) lies outside
+// the hull edge v to u, so every half-edge has an opposite.
+class Mesh {
+ public:
+  Mesh(const std::pmr::vector<Point2D>& sites,
+       std::pmr::memory_resource* resource)
+      : triangles(resource),
+        halfedges(resource),
+        sites_(sites),
+        pending_(resource) {
+    triangles.reserve(6U * sites.size());
+    halfedges.reserve(6U * sites.size());
+  }
+
+  // Start from the counter-clockwise triangle a, b, c and its ghosts
+  auto Initialize(uint32_t a, uint32_t b, uint32_t c) -> void {
+    const auto kFinite = AddTriangle(a, b, c);
+    const auto kGhostAb = AddTriangle(b, a, kGhost);
+    const auto kGhostBc = AddTriangle(c, b, kGhost);
+    const auto kGhostCa = AddTriangle(a, c, kGhost);
+    Link(kFinite, kGhostAb);
+    Link(kFinite + 1U, kGhostBc);
+    Link(kFinite + 2U, kGhostCa);
+    Link(kGhostAb + 1U, kGhostCa + 2U);
+    Link(kGhostBc + 1U, kGhostAb + 2U);
+    Link(kGhostCa + 1U, kGhostBc + 2U);
+    last_ = kFinite / 3U;
+  }
+
+  // Insert a site and get the vertex at its position, itself unless an
+  // earlier site is there
+  auto Insert(uint32_t site) -> uint32_t {
+    const auto& kPoint = sites_[site];
+    const auto kTriangle = Locate(kPoint);
+    const auto kFirst = 3U * kTriangle;
+    if (IsGhost(kTriangle)) {
+      SplitTriangle(kTriangle, site);
+    } else {
+      auto on_edge = kGhost;
+      for (auto edge = kFirst; edge < kFirst + 3U; ++edge) {
+        const auto kVertex = triangles[edge];
+        if ((sites_[kVertex].GetX() == kPoint.GetX()) &&
+            (sites_[kVertex].GetY() == kPoint.GetY())) {
+          return kVertex;
+        }
+        if (Orient(kVertex, triangles[Next(edge)], kPoint) == 0.0) {
+          on_edge = edge;
+        }
+      }
+      if (on_edge == kGhost) {
+        SplitTriangle(kTriangle, site);
+      } else {
+        SplitEdge(on_edge, site);
+      }
+    }
+    Legalize(site);
+    last_ = kTriangle;
+    return site;
+  }
+
+  auto IsGhost(uint32_t triangle) const -> bool {
+    const auto kFirst = 3U * triangle;
+    return (triangles[kFirst] == kGhost) ||
+           (triangles[kFirst + 1U] == kGhost) ||
+           (triangles[kFirst + 2U] == kGhost);
+  }
+
+  std::pmr::vector<uint32_t> triangles;  ///< Start vertex of each half-edge
+  std::pmr::vector<uint32_t> halfedges;  ///< Opposite of each half-edge
+
+ private:
+  auto Orient(uint32_t a, uint32_t b, const Point2D& point) const -> double {
+    return Predicates2D::Orient2D(sites_[a], sites_[b], point);
+  }
+
+  auto AddTriangle(uint32_t a, uint32_t b, uint32_t c) -> uint32_t {
+    const auto kFirst = static_cast<uint32_t>(triangles.size());
+    triangles.insert(triangles.end(), {a, b, c});
+    halfedges.insert(halfedges.end(), 3U, kGhost);
+    return kFirst;
+  }
+
+  auto SetTriangle(uint32_t first, uint32_t a, uint32_t b, uint32_t c)
+      -> void {
+    triangles[first] = a;
+    triangles[first + 1U] = b;
+    triangles[first + 2U] = c;
+  }
+
+  auto Link(uint32_t lhs, uint32_t rhs) -> void {
+    halfedges[lhs] = rhs;
+    halfedges[rhs] = lhs;
+  }
+
+  // Walk from the last insertion across edges the point lies beyond, which
+  // ends on a Delaunay triangulation. Stops in the finite triangle holding
+  // the point or in the ghost triangle of a hull edge the point lies beyond.
+  auto Locate(const Point2D& point) -> uint32_t {
+    auto triangle = last_;
+    if (IsGhost(triangle)) {
+      auto edge = 3U * triangle;
+      while ((triangles[edge] == kGhost) || (triangles[Next(edge)] == kGhost)) {
+        ++edge;
+      }
+      triangle = halfedges[edge] / 3U;
+    }
+    // The edge walked across needs no test
+    auto entry = kGhost;
+    for (;;) {
+      // Rotating the first tested edge keeps the walk from favoring a side
+      const auto kFirst = 3U * triangle;
+      const auto kOffset = ++step_;
+      auto next = kGhost;
+      for (uint32_t i = 0; i < 3U; ++i) {
+        const auto kEdge = kFirst + ((kOffset + i) % 3U);
+        if ((kEdge != entry) &&
+            (Orient(triangles[kEdge], triangles[Next(kEdge)], point) < 0.0)) {
+          next = kEdge;
+          break;
+        }
+      }
+      if (next == kGhost) {
+        return triangle;
+      }
+      entry = halfedges[next];
+      triangle = entry / 3U;
+      if (IsGhost(triangle)) {
+        return triangle;
+      }
+    }
+  }
+
+  // Replace triangle a, b, c by a, b, site and b, c, site and c, a, site
+  auto SplitTriangle(uint32_t triangle, uint32_t site) -> void {
+    const auto kFirst = 3U * triangle;
+    const auto kA = triangles[kFirst];
+    const auto kB = triangles[kFirst + 1U];
+    const auto kC = triangles[kFirst + 2U];
+    const auto kOppositeBc = halfedges[kFirst + 1U];
+    const auto kOppositeCa = halfedges[kFirst + 2U];
+    triangles[kFirst + 2U] = site;
+    const auto kBc = AddTriangle(kB, kC, site);
+    const auto kCa = AddTriangle(kC, kA, site);
+    Link(kBc, kOppositeBc);
+    Link(kCa, kOppositeCa);
+    Link(kFirst + 1U, kBc + 2U);
+    Link(kBc + 1U, kCa + 2U);
+    Link(kCa + 1U, kFirst + 2U);
+    pending_.insert(pending_.end(), {kFirst, kBc, kCa});
+  }
+
+  // Replace the triangles x, y, a and y, x, b on both sides of edge x to y
+  // by four triangles around the site on the edge
+  auto SplitEdge(uint32_t edge, uint32_t site) -> void {
+    const auto kOpposite = halfedges[edge];
+    const auto kX = triangles[edge];
+    const auto kY = triangles[Next(edge)];
+    const auto kA = triangles[Previous(edge)];
+    const auto kB = triangles[Previous(kOpposite)];
+    const auto kOppositeYa = halfedges[Next(edge)];
+    const auto kOppositeAx = halfedges[Previous(edge)];
+    const auto kOppositeXb = halfedges[Next(kOpposite)];
+    const auto kOppositeBy = halfedges[Previous(kOpposite)];
+    const auto kXa = 3U * (edge / 3U);
+    const auto kYb = 3U * (kOpposite / 3U);
+    SetTriangle(kXa, kX, site, kA);
+    SetTriangle(kYb, kY, site, kB);
+    const auto kYa = AddTriangle(site, kY, kA);
+    const auto kXb = AddTriangle(site, kX, kB);
+    Link(kXa + 2U, kOppositeAx);
+    Link(kYa + 1U, kOppositeYa);
+    Link(kYb + 2U, kOppositeBy);
+    Link(kXb + 1U, kOppositeXb);
+    Link(kXa, kXb);
+    Link(kXa + 1U, kYa + 2U);
+    Link(kYa, kYb);
+    Link(kYb + 1U, kXb + 2U);
+    pending_.insert(pending_.end(), {kXa + 2U, kYa + 1U, kYb + 2U, kXb + 1U});
+  }
+
+  // Check if the site opposite edge u to v lies in the circle of the
+  // triangle v, u, q across it. The circle of a ghost triangle is the open
+  // half-plane beyond its hull edge.
+  auto IsIllegal(uint32_t edge) const -> bool {
+    const auto kOpposite = halfedges[edge];
+    const auto& kPoint = sites_[triangles[Previous(edge)]];
+    const auto kU = triangles[edge];
+    const auto kV = triangles[Next(edge)];
+    const auto kQ = triangles[Previous(kOpposite)];
+    if (kV == kGhost) {
+      return Orient(kU, kQ, kPoint) > 0.0;
+    }
+    if (kU == kGhost) {
+      return Orient(kQ, kV, kPoint) > 0.0;
+    }
+    if (kQ == kGhost) {
+      // The site lies inside the hull edge
+      return false;
+    }
+    return Predicates2D::InCircle(sites_[kV], sites_[kU], sites_[kQ],
+                                  kPoint) > 0.0;
+  }
+
+  // Flip illegal edges opposite the site until the triangulation is
+  // Delaunay again
+  auto Legalize(uint32_t site) -> void {
+    while (!pending_.empty()) {
+      const auto kEdge = pending_.back();
+      pending_.pop_back();
+      if (!IsIllegal(kEdge)) {
+        continue;
+      }
+      // Triangles site, u, v and v, u, q become q, v, site and site, u, q
+      const auto kOpposite = halfedges[kEdge];
+      const auto kSiteU = Previous(kEdge);
+      const auto kQv = Previous(kOpposite);
+      const auto kUq = Next(kOpposite);
+      const auto kOppositeQv = halfedges[kQv];
+      const auto kOppositeSiteU = halfedges[kSiteU];
+      triangles[kEdge] = triangles[kQv];
+      triangles[kOpposite] = site;
+      Link(kEdge, kOppositeQv);
+      Link(kOpposite, kOppositeSiteU);
+      Link(kSiteU, kQv);
+      pending_.insert(pending_.end(), {kEdge, kUq});
+    }
+  }
+
+  const std::pmr::vector<Point2D>& sites_;
+  std::pmr::vector<uint32_t> pending_;
+  uint32_t last_{0};
+  uint32_t step_{0};
+};
+}  // namespace
+
+namespace Jeong0806::geometry {
+DelaunayTriangulation2D::DelaunayTriangulation2D(
+    const Point2D* points, std::size_t count, std::size_t thread_count,
+    std::pmr::memory_resource* resource, Executor* executor)
+    : sites_(resource),
+      order_(resource),
+      ranks_(resource),
+      vertices_(resource),
+      triangles_(resource),
+      halfedges_(resource),
+      hull_(resource),
+      offsets_(resource),
+      neighbors_(resource),
+      seed_codes_(resource) {
+  Build(points, count, thread_count, executor);
+}
+
+DelaunayTriangulation2D::DelaunayTriangulation2D(
+    const std::vector<Point2D>& points, std::size_t thread_count,
+    std::pmr::memory_resource* resource, Executor* executor)
+    : DelaunayTriangulation2D(points.data(), points.size(), thread_count,
+                              resource, executor) {}
+
+DelaunayTriangulation2D::DelaunayTriangulation2D(
+    const PointCloud2D& points, std::size_t thread_count,
+    std::pmr::memory_resource* resource, Executor* executor)
+    : DelaunayTriangulation2D(points.ToPoints(), thread_count, resource,
+                              executor) {}
+
+auto DelaunayTriangulation2D::Size() const -> std::size_t {
+  return sites_.size();
+}
+
+auto DelaunayTriangulation2D::Empty() const -> bool { return sites_.empty(); }
+
+auto DelaunayTriangulation2D::GetResource() const
+    -> std::pmr::memory_resource* {
+  return sites_.get_allocator().resource();
+}
+
+auto DelaunayTriangulation2D::GetSite(std::size_t site) const
+    -> const Point2D& {
+  CheckSite(site);
+  return sites_[ranks_[site]];
+}
+
+auto DelaunayTriangulation2D::GetVertex(std::size_t site) const
+    -> std::size_t {
+  CheckSite(site);
+  return order_[vertices_[ranks_[site]]];
+}
+
+auto DelaunayTriangulation2D::GetTriangleCount() const -> std::size_t {
+  return triangles_.size() / 3U;
+}
+
+auto DelaunayTriangulation2D::GetTriangles() const
+    -> const std::pmr::vector<uint32_t>& {
+  return triangles_;
+}
+
+auto DelaunayTriangulation2D::GetHalfedges() const
+    -> const std::pmr::vector<uint32_t>& {
+  return halfedges_;
+}
+
+auto DelaunayTriangulation2D::GetHull() const
+    -> const std::pmr::vector<uint32_t>& {
+  return hull_;
+}
+
+auto DelaunayTriangulation2D::GetNeighborCount(std::size_t site) const
+    -> std::size_t {
+  CheckSite(site);
+  return offsets_[ranks_[site] + 1U] - offsets_[ranks_[site]];
+}
+
+auto DelaunayTriangulation2D::GetNeighbors(std::size_t site) const
+    -> std::vector<uint32_t> {
+  CheckSite(site);
+  std::vector<uint32_t> neighbors;
+  for (auto i = offsets_[ranks_[site]]; i < offsets_[ranks_[site] + 1U]; ++i) {
+    neighbors.push_back(order_[neighbors_[i]]);
+  }
+  return neighbors;
+}
+
+auto DelaunayTriangulation2D::Nearest(const Point2D& query) const
+    -> Neighbor {
+  if (Empty()) {
+    throw std::out_of_range("DelaunayTriangulation2D is empty");
+  }
+  return Walk(query, FindSeed(query));
+}
+
+auto DelaunayTriangulation2D::Nearest(const Point2D& query,
+                                      std::size_t start) const -> Neighbor {
+  if (Empty()) {
+    throw std::out_of_range("DelaunayTriangulation2D is empty");
+  }
+  CheckSite(start);
+  return Walk(query, vertices_[ranks_[start]]);
+}
+
+auto DelaunayTriangulation2D::Nearest(const std::vector<Point2D>& queries,
+                                      std::size_t thread_count,
+                                      Executor* executor) const
+    -> std::vector<Neighbor> {
+  const Instrumentation::ScopedTimer kTimer(
+      Instrumentation::Timer::kDelaunayQuery);
+  if (Empty() && !queries.empty()) {
+    throw std::out_of_range("DelaunayTriangulation2D is empty");
+  }
+  std::vector<Neighbor> results(queries.size());
+  ParallelFor(
+      queries.size(),
+      [&](std::size_t begin, std::size_t end) {
+        auto previous = kInvalid;
+        for (auto i = begin; i < end; ++i) {
+          // Walk from the previous result when it is closer than the seed
+          auto start = FindSeed(queries[i]);
+          if ((previous != kInvalid) &&
+              (SquaredDistance(queries[i], sites_[previous]) <
+               SquaredDistance(queries[i], sites_[start]))) {
+            start = previous;
+          }
+          results[i] = Walk(queries[i], start);
+          previous = ranks_[results[i].index];
+        }
+      },
+      thread_count, executor);
+  return results;
+}
+
+auto DelaunayTriangulation2D::ComputeVoronoiCell(std::size_t site,
+                                                 const Point2D& min,
+                                                 const Point2D& max) const
+    -> std::vector<Point2D> {
+  CheckSite(site);
+  CheckBox(min, max);
+  return ClipCell(ranks_[site], min, max);
+}
+
+auto DelaunayTriangulation2D::ComputeVoronoiCells(const Point2D& min,
+                                                  const Point2D& max,
+                                                  std::size_t thread_count,
+                                                  Executor* executor) const
+    -> std::vector<std::vector<Point2D>> {
+  const Instrumentation::ScopedTimer kTimer(
+      Instrumentation::Timer::kDelaunayQuery);
+  CheckBox(min, max);
+  std::vector<std::vector<Point2D>> cells(sites_.size());
+  ParallelFor(
+      sites_.size(),
+      [&](std::size_t begin, std::size_t end) {
+        for (auto position = begin; position < end; ++position) {
+          cells[order_[position]] = ClipCell(position, min, max);
+        }
+      },
+      thread_count, executor);
+  return cells;
+}
+
+auto DelaunayTriangulation2D::CheckSite(std::size_t site) const -> void {
+  if (site >= sites_.size()) {
+    throw std::out_of_range("Site index is out of range");
+  }
+}
+
+auto DelaunayTriangulation2D::Build(const Point2D* points, std::size_t count,
+                                    std::size_t thread_count,
+                                    Executor* executor) -> void {
+  const Instrumentation::ScopedTimer kTimer(
+      Instrumentation::Timer::kDelaunayBuild);
+  if (count > kMaxSites) {
+    throw std::length_error(
+        "DelaunayTriangulation2D supports up to 2^32 / 6 points");
+  }
+  if (!std::all_of(points, points + count, [](const Point2D& point) {
+        return std::isfinite(point.GetX()) && std::isfinite(point.GetY());
+      })) {
+    throw std::invalid_argument("Site coordinates must be finite");
+  }
+  const auto kCount = static_cast<uint32_t>(count);
+  if (kCount == 0U) {
+    offsets_.assign(1U, 0U);
+    return;
+  }
+
+  // Consecutive sites along the Hilbert curve are close, so each location
+  // walk starts next to its target. Keeping the sites in curve order also
+  // keeps the sites a walk touches together in memory.
+  grid_ = MortonGrid2D(points, count);
+  std::pmr::vector<uint64_t> codes(kCount, GetResource());
+  Hilbert2D::ComputeCodes(grid_, points, count, codes.data(), thread_count,
+                          executor);
+  const auto kOrder =
+      Morton2D::SortOrder(codes.data(), count, thread_count, executor);
+  order_.assign(kOrder.begin(), kOrder.end());
+  sites_.resize(kCount);
+  ranks_.resize(kCount);
+  for (uint32_t i = 0; i < kCount; ++i) {
+    sites_[i] = points[order_[i]];
+    ranks_[order_[i]] = i;
+  }
+  for (uint32_t i = 0; i < kCount; i += kSeedStride) {
+    seed_codes_.push_back(codes[order_[i]]);
+  }
+  vertices_.resize(kCount);
+  std::iota(vertices_.begin(), vertices_.end(), 0U);
+
+  // The first triangle takes the first two distinct sites and the first
+  // site off their line, and the skipped ones are inserted later
+  const auto kIsDistinct = [&](const Point2D& site) {
+    return (site.GetX() != sites_[0].GetX()) ||
+           (site.GetY() != sites_[0].GetY());
+  };
+  const auto kB = static_cast<uint32_t>(
+      std::find_if(sites_.begin(), sites_.end(), kIsDistinct) -
+      sites_.begin());
+  if (kB == kCount) {
+    BuildChain();
+    return;
+  }
+  const auto kC = static_cast<uint32_t>(
+      std::find_if(sites_.begin() + kB + 1, sites_.end(),
+                   [&](const Point2D& site) {
+                     return Predicates2D::Orient2D(sites_[0], sites_[kB],
+                                                   site) != 0.0;
+                   }) -
+      sites_.begin());
+  if (kC == kCount) {
+    BuildChain();
+    return;
+  }
+
+  Mesh mesh(sites_, GetResource());
+  if (Predicates2D::Orient2D(sites_[0], sites_[kB], sites_[kC]) > 0.0) {
+    mesh.Initialize(0U, kB, kC);
+  } else {
+    mesh.Initialize(0U, kC, kB);
+  }
+  for (uint32_t i = 1; i < kCount; ++i) {
+    if ((i != kB) && (i != kC)) {
+      vertices_[i] = mesh.Insert(i);
+    }
+  }
+
+  // Drop the ghost triangles, their opposites becoming hull half-edges
+  const auto kTriangleCount = mesh.triangles.size() / 3U;
+  std::pmr::vector<uint32_t> renumbered(kTriangleCount, kInvalid,
+                                        GetResource());
+  uint32_t finite_count = 0;
+  for (uint32_t triangle = 0; triangle < kTriangleCount; ++triangle) {
+    if (!mesh.IsGhost(triangle)) {
+      renumbered[triangle] = finite_count++;
+    }
+  }
+  triangles_.resize(3U * finite_count);
+  halfedges_.resize(3U * finite_count);
+  auto hull_edge = kInvalid;
+  for (uint32_t edge = 0; edge < mesh.triangles.size(); ++edge) {
+    const auto kTriangle = renumbered[edge / 3U];
+    if (kTriangle == kInvalid) {
+      continue;
+    }
+    const auto kOpposite = mesh.halfedges[edge];
+    const auto kOppositeTriangle = renumbered[kOpposite / 3U];
+    triangles_[(3U * kTriangle) + (edge % 3U)] = mesh.triangles[edge];
+    halfedges_[(3U * kTriangle) + (edge % 3U)] =
+        (kOppositeTriangle == kInvalid)
+            ? kInvalid
+            : (3U * kOppositeTriangle) + (kOpposite % 3U);
+    if (kOppositeTriangle == kInvalid) {
+      hull_edge = kOpposite;
+    }
+  }
+
+  // Ghost triangles around the vertex at infinity follow the hull clockwise
+  auto edge = hull_edge;
+  do {
+    hull_.push_back(order_[mesh.triangles[edge]]);
+    edge = Next(mesh.halfedges[Next(edge)]);
+  } while (edge != hull_edge);
+  std::reverse(hull_.begin(), hull_.end());
+
+  BuildNeighbors();
+  for (auto& vertex : triangles_) {
+    vertex = order_[vertex];
+  }
+}
+
+auto DelaunayTriangulation2D::BuildChain() -> void {
+  // Collinear sites in lexicographic order are in order along their line
+  std::pmr::vector<uint32_t> sorted(sites_.size(), GetResource());
+  std::iota(sorted.begin(), sorted.end(), 0U);
+  std::sort(sorted.begin(), sorted.end(), [&](uint32_t lhs, uint32_t rhs) {
+    if (sites_[lhs].GetX() != sites_[rhs].GetX()) {
+      return sites_[lhs].GetX() < sites_[rhs].GetX();
+    }
+    if (sites_[lhs].GetY() != sites_[rhs].GetY()) {
+      return sites_[lhs].GetY() < sites_[rhs].GetY();
+    }
+    return order_[lhs] < order_[rhs];
+  });
+  std::pmr::vector<uint32_t> chain(GetResource());
+  for (const auto kPosition : sorted) {
+    if (!chain.empty() &&
+        (sites_[chain.back()].GetX() == sites_[kPosition].GetX()) &&
+        (sites_[chain.back()].GetY() == sites_[kPosition].GetY())) {
+      vertices_[kPosition] = chain.back();
+    } else {
+      chain.push_back(kPosition);
+    }
+  }
+
+  offsets_.assign(sites_.size() + 1U, 0U);
+  for (std::size_t i = 0; i < chain.size(); ++i) {
+    offsets_[chain[i] + 1U] = ((i > 0U) ? 1U : 0U) +
+                              ((i + 1U < chain.size()) ? 1U : 0U);
+  }
+  std::partial_sum(offsets_.begin(), offsets_.end(), offsets_.begin());
+  neighbors_.resize(offsets_.back());
+  for (std::size_t i = 0; i < chain.size(); ++i) {
+    auto position = offsets_[chain[i]];
+    if (i > 0U) {
+      neighbors_[position++] = chain[i - 1U];
+    }
+    if (i + 1U < chain.size()) {
+      neighbors_[position] = chain[i + 1U];
+    }
+  }
+}
+
+auto DelaunayTriangulation2D::BuildNeighbors() -> void {
+  // Every interior edge has a half-edge in each direction, and a hull edge
+  // stands for both
+  offsets_.assign(sites_.size() + 1U, 0U);
+  for (uint32_t edge = 0; edge < triangles_.size(); ++edge) {
+    ++offsets_[triangles_[edge] + 1U];
+    if (halfedges_[edge] == kInvalid) {
+      ++offsets_[triangles_[Next(edge)] + 1U];
+    }
+  }
+  std::partial_sum(offsets_.begin(), offsets_.end(), offsets_.begin());
+  neighbors_.resize(offsets_.back());
+  std::pmr::vector<uint32_t> positions(offsets_.begin(), offsets_.end() - 1,
+                                       GetResource());
+  for (uint32_t edge = 0; edge < triangles_.size(); ++edge) {
+    const auto kFrom = triangles_[edge];
+    const auto kTo = triangles_[Next(edge)];
+    neighbors_[positions[kFrom]++] = kTo;
+    if (halfedges_[edge] == kInvalid) {
+      neighbors_[positions[kTo]++] = kFrom;
+    }
+  }
+}
+
+auto DelaunayTriangulation2D::FindSeed(const Point2D& query) const
+    -> uint32_t {
+  // The sampled site before the query's position along the curve is close
+  const auto kSeed = std::upper_bound(seed_codes_.begin(), seed_codes_.end(),
+                                      Hilbert2D::GetCode(grid_, query)) -
+                     seed_codes_.begin();
+  return vertices_[(kSeed > 0) ? (kSeed - 1) * kSeedStride : 0U];
+}
+
+auto DelaunayTriangulation2D::Walk(const Point2D& query, uint32_t start) const
+    -> Neighbor {
+  auto best = start;
+  auto best_squared = SquaredDistance(query, sites_[best]);
+  auto tied = false;
+  uint64_t visited_sites = 0;
+  uint64_t tested_sites = 1;
+  for (auto current = kInvalid; current != best;) {
+    current = best;
+    tied = false;
+    ++visited_sites;
+    tested_sites += offsets_[current + 1U] - offsets_[current];
+    for (auto i = offsets_[current]; i < offsets_[current + 1U]; ++i) {
+      const auto kNeighbor = neighbors_[i];
+      const auto kSquared = SquaredDistance(query, sites_[kNeighbor]);
+      tied = tied || (kSquared == best_squared);
+      if (IsCloser(kSquared, order_[kNeighbor], best_squared, order_[best])) {
+        best_squared = kSquared;
+        best = kNeighbor;
+      }
+    }
+  }
+
+  // Sites tied with the end of the walk are cocircular around the query, so
+  // the Delaunay edges between them reach the one of lowest index
+  if (tied) {
+    std::vector<uint32_t> ties{best};
+    for (std::size_t i = 0; i < ties.size(); ++i) {
+      for (auto j = offsets_[ties[i]]; j < offsets_[ties[i] + 1U]; ++j) {
+        const auto kNeighbor = neighbors_[j];
+        if ((SquaredDistance(query, sites_[kNeighbor]) == best_squared) &&
+            (std::find(ties.begin(), ties.end(), kNeighbor) == ties.end())) {
+          ties.push_back(kNeighbor);
+          best = (order_[kNeighbor] < order_[best]) ? kNeighbor : best;
+        }
+      }
+    }
+  }
+  Instrumentation::Add(Instrumentation::Counter::kIndexNodeVisits,
+                       visited_sites);
+  Instrumentation::Add(Instrumentation::Counter::kIndexPointTests,
+                       tested_sites);
+  return Neighbor{order_[best], std::sqrt(best_squared)};
+}
+
+auto DelaunayTriangulation2D::ClipCell(std::size_t position,
+                                       const Point2D& min,
+                                       const Point2D& max) const
+    -> std::vector<Point2D> {
+  std::vector<Point2D> cell;
+  if (vertices_[position] != position) {
+    return cell;
+  }
+  cell = {min, Point2D(max.GetX(), min.GetY()), max,
+          Point2D(min.GetX(), max.GetY())};
+  std::vector<Point2D> clipped;
+  const auto& kSite = sites_[position];
+  for (auto i = offsets_[position];
+       (i < offsets_[position + 1U]) && !cell.empty(); ++i) {
+    // Keep the side of the bisector towards the site, Sutherland-Hodgman
+    const auto& kNeighbor = sites_[neighbors_[i]];
+    const auto kDx = kNeighbor.GetX() - kSite.GetX();
+    const auto kDy = kNeighbor.GetY() - kSite.GetY();
+    const auto kMidX = 0.5 * (kNeighbor.GetX() + kSite.GetX());
+    const auto kMidY = 0.5 * (kNeighbor.GetY() + kSite.GetY());
+    const auto kSide = [&](const Point2D& point) {
+      return ((point.GetX() - kMidX) * kDx) + ((point.GetY() - kMidY) * kDy);
+    };
+    clipped.clear();
+    for (std::size_t j = 0; j < cell.size(); ++j) {
+      const auto& kFrom = cell[j];
+      const auto& kTo = cell[(j + 1U) % cell.size()];
+      const auto kFromSide = kSide(kFrom);
+      const auto kToSide = kSide(kTo);
+      if (kFromSide <= 0.0) {
+        clipped.push_back(kFrom);
+      }
+      if (((kFromSide < 0.0) && (kToSide > 0.0)) ||
+          ((kFromSide > 0.0) && (kToSide < 0.0))) {
+        const auto kT = kFromSide / (kFromSide - kToSide);
+        clipped.emplace_back(kFrom.GetX() + (kT * (kTo.GetX() - kFrom.GetX())),
+                             kFrom.GetY() + (kT * (kTo.GetY() - kFrom.GetY())));
+      }
+    }
+    cell.swap(clipped);
+  }
+  return cell;
+}
+}  // namespace Jeong0806::geometry
@@ -0,0 +1,45 @@
+/**
+ * @file geometry/src/distance_accumulator.cpp
+ * @author Jeong Seong In (0806jsi@gmail.com)
+ * @brief Exact 128-bit distance accumulator class developments
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2023 Jeong0806, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/distance_accumulator.hpp"
+
+#include <algorithm>
+
+namespace {
+// Sums of 2^31 split values fit in 64 bits without overflow
+constexpr std::size_t kChunk{std::size_t{1U} << 31U};
+}  // namespace
+
+namespace Jeong0806::geometry {
+auto DistanceAccumulator::Add(const Distance* distances, std::size_t count)
+    -> void {
+  // Each value is split as high * 2^32 + low, so the loop is plain 64-bit
+  // adds without a carry chain and vectorizes
+  for (std::size_t begin = 0; begin < count; begin += kChunk) {
+    const auto kEnd = std::min(begin + kChunk, count);
+    uint64_t low_sum{0U};
+    int64_t high_sum{0};
+    for (auto i = begin; i < kEnd; ++i) {
+      const auto kNanometer = distances[i].GetNanometer();
+      low_sum += static_cast<uint64_t>(kNanometer) & 0xFFFFFFFFU;
+      high_sum += kNanometer >> 32;
+    }
+    // high_sum * 2^32 as a 128-bit value
+    AddWide(high_sum >> 32, static_cast<uint64_t>(high_sum) << 32U);
+    AddWide(0, low_sum);
+  }
+}
+
+auto DistanceAccumulator::Add(const std::vector<Distance>& distances) -> void {
+  Add(distances.data(), distances.size());
+}
+}  // namespace Jeong0806::geometry
@@ -0,0 +1,1326 @@
+/**
+ * @file geometry/src/distance_kernels.cpp
+ * @author Jeong Seong In (0806jsi@gmail.com)
+ * @brief Batch distance kernel developments with runtime SIMD dispatch
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2023 Jeong0806, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/distance_kernels.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+#include "geometry/instrumentation.hpp"
+#include "geometry/simd.hpp"
+
+#if defined(Jeong0806_GEOMETRY_SIMD_X86)
+#include <immintrin.h>
+#endif
+
+#if defined(Jeong0806_GEOMETRY_SIMD_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace {
+using Jeong0806::geometry::Distance;
+using Jeong0806::geometry::Instrumentation;
+
+template <bool kRoot, typename T>
+auto Finish(T squared) -> T {
+  if constexpr (kRoot) {
+    return std::sqrt(squared);
+  } else {
+    return squared;
+  }
+}
+
+template <bool kRoot, typename T>
+auto OneToManyScalar(const T* xs, const T* ys, std::size_t begin,
+                     std::size_t count, T origin_x, T origin_y, T* output)
+    -> void {
+  for (std::size_t i = begin; i < count; ++i) {
+    const auto kDx = xs[i] - origin_x;
+    const auto kDy = ys[i] - origin_y;
+    output[i] = Finish<kRoot>((kDx * kDx) + (kDy * kDy));
+  }
+}
+
+template <bool kRoot, typename T>
+auto PairwiseScalar(const T* lhs_xs, const T* lhs_ys, const T* rhs_xs,
+                    const T* rhs_ys, std::size_t begin, std::size_t count,
+                    T* output) -> void {
+  for (std::size_t i = begin; i < count; ++i) {
+    const auto kDx = lhs_xs[i] - rhs_xs[i];
+    const auto kDy = lhs_ys[i] - rhs_ys[i];
+    output[i] = Finish<kRoot>((kDx * kDx) + (kDy * kDy));
+  }
+}
+
+template <typename T>
+auto IsWithinScalar(const T* xs, const T* ys, std::size_t begin,
+                    std::size_t count, T origin_x, T origin_y,
+                    T radius_squared, uint8_t* output) -> std::size_t {
+  std::size_t within = 0;
+  for (std::size_t i = begin; i < count; ++i) {
+    const auto kDx = xs[i] - origin_x;
+    const auto kDy = ys[i] - origin_y;
+    output[i] = ((kDx * kDx) + (kDy * kDy) <= radius_squared) ? 1U : 0U;
+    within += output[i];
+  }
+  return within;
+}
+
+template <typename T>
+auto CompareScalar(const T* lhs_xs, const T* lhs_ys, const T* rhs_xs,
+                   const T* rhs_ys, std::size_t begin, std::size_t count,
+                   T origin_x, T origin_y, int8_t* output) -> void {
+  for (std::size_t i = begin; i < count; ++i) {
+    const auto kLhsDx = lhs_xs[i] - origin_x;
+    const auto kLhsDy = lhs_ys[i] - origin_y;
+    const auto kRhsDx = rhs_xs[i] - origin_x;
+    const auto kRhsDy = rhs_ys[i] - origin_y;
+    const auto kLhs = (kLhsDx * kLhsDx) + (kLhsDy * kLhsDy);
+    const auto kRhs = (kRhsDx * kRhsDx) + (kRhsDy * kRhsDy);
+    output[i] = static_cast<int8_t>(static_cast<int8_t>(kLhs > kRhs) -
+                                    static_cast<int8_t>(kLhs < kRhs));
+  }
+}
+
+auto ConvertScalar(const Distance* distances, std::size_t begin,
+                   std::size_t count, double scale, double* output) -> void {
+  for (std::size_t i = begin; i < count; ++i) {
+    output[i] = distances[i].GetValue<Distance::DistanceType::kNanometer>() *
+                scale;
+  }
+}
+
+auto FromScalar(const double* values, std::size_t begin, std::size_t count,
+                double scale, Distance* output) -> void {
+  for (std::size_t i = begin; i < count; ++i) {
+    output[i] =
+        Distance::FromValue<Distance::DistanceType::kNanometer>(values[i] *
+                                                                scale);
+  }
+}
+
+auto SquaredScalar(const int32_t* xs, const int32_t* ys, std::size_t begin,
+                   std::size_t count, int32_t origin_x, int32_t origin_y,
+                   uint64_t* output) -> void {
+  for (std::size_t i = begin; i < count; ++i) {
+    const auto kDx = static_cast<int64_t>(xs[i]) - origin_x;
+    const auto kDy = static_cast<int64_t>(ys[i]) - origin_y;
+    output[i] = static_cast<uint64_t>((kDx * kDx) + (kDy * kDy));
+  }
+}
+
+auto IsWithinScalar(const int32_t* xs, const int32_t* ys, std::size_t begin,
+                    std::size_t count, int32_t origin_x, int32_t origin_y,
+                    int64_t radius_squared, uint8_t* output) -> std::size_t {
+  std::size_t within = 0;
+  for (std::size_t i = begin; i < count; ++i) {
+    const auto kDx = static_cast<int64_t>(xs[i]) - origin_x;
+    const auto kDy = static_cast<int64_t>(ys[i]) - origin_y;
+    output[i] = ((kDx * kDx) + (kDy * kDy) <= radius_squared) ? 1U : 0U;
+    within += output[i];
+  }
+  return within;
+}
+
+#if defined(Jeong0806_GEOMETRY_SIMD_X86)
+constexpr std::size_t kAvx2Lanes{4U};
+constexpr std::size_t kAvx512Lanes{8U};
+
+template <bool kRoot>
+__attribute__((target("avx2"))) auto OneToManyAvx2(
+    const double* xs, const double* ys, std::size_t count, double origin_x,
+    double origin_y, double* output) -> void {
+  const auto kOriginX = _mm256_set1_pd(origin_x);
+  const auto kOriginY = _mm256_set1_pd(origin_y);
+  std::size_t i = 0;
+  for (; i + kAvx2Lanes <= count; i += kAvx2Lanes) {
+    const auto kDx = _mm256_sub_pd(_mm256_loadu_pd(xs + i), kOriginX);
+    const auto kDy = _mm256_sub_pd(_mm256_loadu_pd(ys + i), kOriginY);
+    auto squared =
+        _mm256_add_pd(_mm256_mul_pd(kDx, kDx), _mm256_mul_pd(kDy, kDy));
+    if constexpr (kRoot) {
+      squared = _mm256_sqrt_pd(squared);
+    }
+    _mm256_storeu_pd(output + i, squared);
+  }
+  OneToManyScalar<kRoot>(xs, ys, i, count, origin_x, origin_y, output);
+}
+
+template <bool kRoot>
+__attribute__((target("avx2"))) auto PairwiseAvx2(
+    const double* lhs_xs, const double* lhs_ys, const double* rhs_xs,
+    const double* rhs_ys, std::size_t count, double* output) -> void {
+  std::size_t i = 0;
+  for (; i + kAvx2Lanes <= count; i += kAvx2Lanes) {
+    const auto kDx = _mm256_sub_pd(_mm256_loadu_pd(lhs_xs + i),
+                                   _mm256_loadu_pd(rhs_xs + i));
+    const auto kDy = _mm256_sub_pd(_mm256_loadu_pd(lhs_ys + i),
+                                   _mm256_loadu_pd(rhs_ys + i));
+    auto squared =
+        _mm256_add_pd(_mm256_mul_pd(kDx, kDx), _mm256_mul_pd(kDy, kDy));
+    if constexpr (kRoot) {
+      squared = _mm256_sqrt_pd(squared);
+    }
+    _mm256_storeu_pd(output + i, squared);
+  }
+  PairwiseScalar<kRoot>(lhs_xs, lhs_ys, rhs_xs, rhs_ys, i, count, output);
+}
+
+template <bool kRoot>
+__attribute__((target("avx512f"))) auto OneToManyAvx512(
+    const double* xs, const double* ys, std::size_t count, double origin_x,
+    double origin_y, double* output) -> void {
+  const auto kOriginX = _mm512_set1_pd(origin_x);
+  const auto kOriginY = _mm512_set1_pd(origin_y);
+  for (std::size_t i = 0; i < count; i += kAvx512Lanes) {
+    const auto kRemain = count - i;
+    const auto kMask = static_cast<__mmask8>(
+        kRemain >= kAvx512Lanes ? 0xFFU : ((1U << kRemain) - 1U));
+    const auto kDx =
+        _mm512_sub_pd(_mm512_maskz_loadu_pd(kMask, xs + i), kOriginX);
+    const auto kDy =
+        _mm512_sub_pd(_mm512_maskz_loadu_pd(kMask, ys + i), kOriginY);
+    auto squared =
+        _mm512_add_pd(_mm512_mul_pd(kDx, kDx), _mm512_mul_pd(kDy, kDy));
+    if constexpr (kRoot) {
+      squared = _mm512_maskz_sqrt_pd(kMask, squared);
+    }
+    _mm512_mask_storeu_pd(output + i, kMask, squared);
+  }
+}
+
+template <bool kRoot>
+__attribute__((target("avx512f"))) auto PairwiseAvx512(
+    const double* lhs_xs, const double* lhs_ys, const double* rhs_xs,
+    const double* rhs_ys, std::size_t count, double* output) -> void {
+  for (std::size_t i = 0; i < count; i += kAvx512Lanes) {
+    const auto kRemain = count - i;
+    const auto kMask = static_cast<__mmask8>(
+        kRemain >= kAvx512Lanes ? 0xFFU : ((1U << kRemain) - 1U));
+    const auto kDx = _mm512_sub_pd(_mm512_maskz_loadu_pd(kMask, lhs_xs + i),
+                                   _mm512_maskz_loadu_pd(kMask, rhs_xs + i));
+    const auto kDy = _mm512_sub_pd(_mm512_maskz_loadu_pd(kMask, lhs_ys + i),
+                                   _mm512_maskz_loadu_pd(kMask, rhs_ys + i));
+    auto squared =
+        _mm512_add_pd(_mm512_mul_pd(kDx, kDx), _mm512_mul_pd(kDy, kDy));
+    if constexpr (kRoot) {
+      squared = _mm512_maskz_sqrt_pd(kMask, squared);
+    }
+    _mm512_mask_storeu_pd(output + i, kMask, squared);
+  }
+}
+
+__attribute__((target("avx2"))) auto IsWithinAvx2(
+    const double* xs, const double* ys, std::size_t count, double origin_x,
+    double origin_y, double radius_squared, uint8_t* output) -> std::size_t {
+  const auto kOriginX = _mm256_set1_pd(origin_x);
+  const auto kOriginY = _mm256_set1_pd(origin_y);
+  const auto kRadiusSquared = _mm256_set1_pd(radius_squared);
+  std::size_t within = 0;
+  std::size_t i = 0;
+  for (; i + kAvx2Lanes <= count; i += kAvx2Lanes) {
+    const auto kDx = _mm256_sub_pd(_mm256_loadu_pd(xs + i), kOriginX);
+    const auto kDy = _mm256_sub_pd(_mm256_loadu_pd(ys + i), kOriginY);
+    const auto kSquared =
+        _mm256_add_pd(_mm256_mul_pd(kDx, kDx), _mm256_mul_pd(kDy, kDy));
+    const auto kMask = static_cast<unsigned>(_mm256_movemask_pd(
+        _mm256_cmp_pd(kSquared, kRadiusSquared, _CMP_LE_OQ)));
+    for (std::size_t lane = 0; lane < kAvx2Lanes; ++lane) {
+      output[i + lane] = static_cast<uint8_t>((kMask >> lane) & 1U);
+    }
+    within += static_cast<std::size_t>(__builtin_popcount(kMask));
+  }
+  return within + IsWithinScalar(xs, ys, i, count, origin_x, origin_y,
+                                 radius_squared, output);
+}
+
+__attribute__((target("avx2"))) auto CompareAvx2(
+    const double* lhs_xs, const double* lhs_ys, const double* rhs_xs,
+    const double* rhs_ys, std::size_t count, double origin_x, double origin_y,
+    int8_t* output) -> void {
+  const auto kOriginX = _mm256_set1_pd(origin_x);
+  const auto kOriginY = _mm256_set1_pd(origin_y);
+  std::size_t i = 0;
+  for (; i + kAvx2Lanes <= count; i += kAvx2Lanes) {
+    const auto kLhsDx = _mm256_sub_pd(_mm256_loadu_pd(lhs_xs + i), kOriginX);
+    const auto kLhsDy = _mm256_sub_pd(_mm256_loadu_pd(lhs_ys + i), kOriginY);
+    const auto kRhsDx = _mm256_sub_pd(_mm256_loadu_pd(rhs_xs + i), kOriginX);
+    const auto kRhsDy = _mm256_sub_pd(_mm256_loadu_pd(rhs_ys + i), kOriginY);
+    const auto kLhs = _mm256_add_pd(_mm256_mul_pd(kLhsDx, kLhsDx),
+                                    _mm256_mul_pd(kLhsDy, kLhsDy));
+    const auto kRhs = _mm256_add_pd(_mm256_mul_pd(kRhsDx, kRhsDx),
+                                    _mm256_mul_pd(kRhsDy, kRhsDy));
+    const auto kGreater = static_cast<unsigned>(
+        _mm256_movemask_pd(_mm256_cmp_pd(kLhs, kRhs, _CMP_GT_OQ)));
+    const auto kLess = static_cast<unsigned>(
+        _mm256_movemask_pd(_mm256_cmp_pd(kLhs, kRhs, _CMP_LT_OQ)));
+    for (std::size_t lane = 0; lane < kAvx2Lanes; ++lane) {
+      output[i + lane] = static_cast<int8_t>(
+          static_cast<int8_t>((kGreater >> lane) & 1U) -
+          static_cast<int8_t>((kLess >> lane) & 1U));
+    }
+  }
+  CompareScalar(lhs_xs, lhs_ys, rhs_xs, rhs_ys, i, count, origin_x, origin_y,
+                output);
+}
+
+__attribute__((target("avx512f"))) auto IsWithinAvx512(
+    const double* xs, const double* ys, std::size_t count, double origin_x,
+    double origin_y, double radius_squared, uint8_t* output) -> std::size_t {
+  const auto kOriginX = _mm512_set1_pd(origin_x);
+  const auto kOriginY = _mm512_set1_pd(origin_y);
+  const auto kRadiusSquared = _mm512_set1_pd(radius_squared);
+  std::size_t within = 0;
+  for (std::size_t i = 0; i < count; i += kAvx512Lanes) {
+    const auto kRemain = std::min(count - i, kAvx512Lanes);
+    const auto kMask = static_cast<__mmask8>(
+        kRemain >= kAvx512Lanes ? 0xFFU : ((1U << kRemain) - 1U));
+    const auto kDx =
+        _mm512_sub_pd(_mm512_maskz_loadu_pd(kMask, xs + i), kOriginX);
+    const auto kDy =
+        _mm512_sub_pd(_mm512_maskz_loadu_pd(kMask, ys + i), kOriginY);
+    const auto kSquared =
+        _mm512_add_pd(_mm512_mul_pd(kDx, kDx), _mm512_mul_pd(kDy, kDy));
+    const auto kWithin = static_cast<unsigned>(
+        _mm512_mask_cmp_pd_mask(kMask, kSquared, kRadiusSquared, _CMP_LE_OQ));
+    for (std::size_t lane = 0; lane < kRemain; ++lane) {
+      output[i + lane] = static_cast<uint8_t>((kWithin >> lane) & 1U);
+    }
+    within += static_cast<std::size_t>(__builtin_popcount(kWithin));
+  }
+  return within;
+}
+
+__attribute__((target("avx512f"))) auto CompareAvx512(
+    const double* lhs_xs, const double* lhs_ys, const double* rhs_xs,
+    const double* rhs_ys, std::size_t count, double origin_x, double origin_y,
+    int8_t* output) -> void {
+  const auto kOriginX = _mm512_set1_pd(origin_x);
+  const auto kOriginY = _mm512_set1_pd(origin_y);
+  for (std::size_t i = 0; i < count; i += kAvx512Lanes) {
+    const auto kRemain = std::min(count - i, kAvx512Lanes);
+    const auto kMask = static_cast<__mmask8>(
+        kRemain >= kAvx512Lanes ? 0xFFU : ((1U << kRemain) - 1U));
+    const auto kLhsDx =
+        _mm512_sub_pd(_mm512_maskz_loadu_pd(kMask, lhs_xs + i), kOriginX);
+    const auto kLhsDy =
+        _mm512_sub_pd(_mm512_maskz_loadu_pd(kMask, lhs_ys + i), kOriginY);
+    const auto kRhsDx =
+        _mm512_sub_pd(_mm512_maskz_loadu_pd(kMask, rhs_xs + i), kOriginX);
+    const auto kRhsDy =
+        _mm512_sub_pd(_mm512_maskz_loadu_pd(kMask, rhs_ys + i), kOriginY);
+    const auto kLhs = _mm512_add_pd(_mm512_mul_pd(kLhsDx, kLhsDx),
+                                    _mm512_mul_pd(kLhsDy, kLhsDy));
+    const auto kRhs = _mm512_add_pd(_mm512_mul_pd(kRhsDx, kRhsDx),
+                                    _mm512_mul_pd(kRhsDy, kRhsDy));
+    const auto kGreater = static_cast<unsigned>(
+        _mm512_mask_cmp_pd_mask(kMask, kLhs, kRhs, _CMP_GT_OQ));
+    const auto kLess = static_cast<unsigned>(
+        _mm512_mask_cmp_pd_mask(kMask, kLhs, kRhs, _CMP_LT_OQ));
+    for (std::size_t lane = 0; lane < kRemain; ++lane) {
+      output[i + lane] = static_cast<int8_t>(
+          static_cast<int8_t>((kGreater >> lane) & 1U) -
+          static_cast<int8_t>((kLess >> lane) & 1U));
+    }
+  }
+}
+
+// Exact int64 to double for the full range: only the final add rounds
+__attribute__((target("avx2"))) auto Int64ToDoubleAvx2(__m256i values)
+    -> __m256d {
+  constexpr double kHighMagic{442721857769029238784.0};  // 3 * 2^67
+  constexpr double kLowMagic{4503599627370496.0};        // 2^52
+  constexpr double kMagic{kHighMagic + kLowMagic};
+  auto high = _mm256_srai_epi32(values, 16);
+  high = _mm256_blend_epi16(high, _mm256_setzero_si256(), 0x33);
+  high = _mm256_add_epi64(high,
+                          _mm256_castpd_si256(_mm256_set1_pd(kHighMagic)));
+  const auto kLow = _mm256_blend_epi16(
+      values, _mm256_castpd_si256(_mm256_set1_pd(kLowMagic)), 0x88);
+  const auto kHigh =
+      _mm256_sub_pd(_mm256_castsi256_pd(high), _mm256_set1_pd(kMagic));
+  return _mm256_add_pd(kHigh, _mm256_castsi256_pd(kLow));
+}
+
+__attribute__((target("avx2"))) auto ConvertAvx2(const Distance* distances,
+                                                 std::size_t count,
+                                                 double scale, double* output)
+    -> void {
+  const auto kScale = _mm256_set1_pd(scale);
+  std::size_t i = 0;
+  for (; i + kAvx2Lanes <= count; i += kAvx2Lanes) {
+    const auto kNanometers = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(distances + i));
+    _mm256_storeu_pd(output + i,
+                     _mm256_mul_pd(Int64ToDoubleAvx2(kNanometers), kScale));
+  }
+  ConvertScalar(distances, i, count, scale, output);
+}
+
+// Truncates through a magic add, exact while |value| < 2^51, so vectors with
+// a larger or NaN lane go through the scalar path instead
+__attribute__((target("avx2"))) auto FromAvx2(const double* values,
+                                              std::size_t count, double scale,
+                                              Distance* output) -> void {
+  constexpr double kMagic{6755399441055744.0};  // 2^52 + 2^51
+  constexpr double kLimit{2251799813685248.0};  // 2^51
+  const auto kScale = _mm256_set1_pd(scale);
+  const auto kMagicValue = _mm256_set1_pd(kMagic);
+  const auto kLimitValue = _mm256_set1_pd(kLimit);
+  const auto kSignMask = _mm256_set1_pd(-0.0);
+  std::size_t i = 0;
+  for (; i + kAvx2Lanes <= count; i += kAvx2Lanes) {
+    const auto kScaled = _mm256_mul_pd(_mm256_loadu_pd(values + i), kScale);
+    const auto kInRange = _mm256_cmp_pd(_mm256_andnot_pd(kSignMask, kScaled),
+                                        kLimitValue, _CMP_LT_OQ);
+    if (_mm256_movemask_pd(kInRange) != 0xF) {
+      FromScalar(values, i, i + kAvx2Lanes, scale, output);
+      continue;
+    }
+    const auto kTruncated =
+        _mm256_round_pd(kScaled, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+    const auto kShifted = _mm256_add_pd(kTruncated, kMagicValue);
+    const auto kNanometers =
+        _mm256_sub_epi64(_mm256_castpd_si256(kShifted),
+                         _mm256_castpd_si256(kMagicValue));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), kNanometers);
+  }
+  FromScalar(values, i, count, scale, output);
+}
+
+__attribute__((target("avx512f,avx512dq"))) auto ConvertAvx512(
+    const Distance* distances, std::size_t count, double scale,
+    double* output) -> void {
+  const auto kScale = _mm512_set1_pd(scale);
+  for (std::size_t i = 0; i < count; i += kAvx512Lanes) {
+    const auto kRemain = count - i;
+    const auto kMask = static_cast<__mmask8>(
+        kRemain >= kAvx512Lanes ? 0xFFU : ((1U << kRemain) - 1U));
+    const auto kNanometers = _mm512_maskz_loadu_epi64(kMask, distances + i);
+    _mm512_mask_storeu_pd(output + i, kMask,
+                          _mm512_mul_pd(_mm512_cvtepi64_pd(kNanometers),
+                                        kScale));
+  }
+}
+
+__attribute__((target("avx512f,avx512dq"))) auto FromAvx512(
+    const double* values, std::size_t count, double scale, Distance* output)
+    -> void {
+  const auto kScale = _mm512_set1_pd(scale);
+  for (std::size_t i = 0; i < count; i += kAvx512Lanes) {
+    const auto kRemain = count - i;
+    const auto kMask = static_cast<__mmask8>(
+        kRemain >= kAvx512Lanes ? 0xFFU : ((1U << kRemain) - 1U));
+    const auto kScaled =
+        _mm512_mul_pd(_mm512_maskz_loadu_pd(kMask, values + i), kScale);
+    _mm512_mask_storeu_epi64(output + i, kMask, _mm512_cvttpd_epi64(kScaled));
+  }
+}
+
+constexpr std::size_t kAvx2FloatLanes{8U};
+constexpr std::size_t kAvx512FloatLanes{16U};
+
+template <bool kRoot>
+__attribute__((target("avx2"))) auto OneToManyAvx2(
+    const float* xs, const float* ys, std::size_t count, float origin_x,
+    float origin_y, float* output) -> void {
+  const auto kOriginX = _mm256_set1_ps(origin_x);
+  const auto kOriginY = _mm256_set1_ps(origin_y);
+  std::size_t i = 0;
+  for (; i + kAvx2FloatLanes <= count; i += kAvx2FloatLanes) {
+    const auto kDx = _mm256_sub_ps(_mm256_loadu_ps(xs + i), kOriginX);
+    const auto kDy = _mm256_sub_ps(_mm256_loadu_ps(ys + i), kOriginY);
+    auto squared =
+        _mm256_add_ps(_mm256_mul_ps(kDx, kDx), _mm256_mul_ps(kDy, kDy));
+    if constexpr (kRoot) {
+      squared = _mm256_sqrt_ps(squared);
+    }
+    _mm256_storeu_ps(output + i, squared);
+  }
+  OneToManyScalar<kRoot>(xs, ys, i, count, origin_x, origin_y, output);
+}
+
+template <bool kRoot>
+__attribute__((target("avx2"))) auto PairwiseAvx2(
+    const float* lhs_xs, const float* lhs_ys, const float* rhs_xs,
+    const float* rhs_ys, std::size_t count, float* output) -> void {
+  std::size_t i = 0;
+  for (; i + kAvx2FloatLanes <= count; i += kAvx2FloatLanes) {
+    const auto kDx = _mm256_sub_ps(_mm256_loadu_ps(lhs_xs + i),
+                                   _mm256_loadu_ps(rhs_xs + i));
+    const auto kDy = _mm256_sub_ps(_mm256_loadu_ps(lhs_ys + i),
+                                   _mm256_loadu_ps(rhs_ys + i));
+    auto squared =
+        _mm256_add_ps(_mm256_mul_ps(kDx, kDx), _mm256_mul_ps(kDy, kDy));
+    if constexpr (kRoot) {
+      squared = _mm256_sqrt_ps(squared);
+    }
+    _mm256_storeu_ps(output + i, squared);
+  }
+  PairwiseScalar<kRoot>(lhs_xs, lhs_ys, rhs_xs, rhs_ys, i, count, output);
+}
+
+template <bool kRoot>
+__attribute__((target("avx512f"))) auto OneToManyAvx512(
+    const float* xs, const float* ys, std::size_t count, float origin_x,
+    float origin_y, float* output) -> void {
+  const auto kOriginX = _mm512_set1_ps(origin_x);
+  const auto kOriginY = _mm512_set1_ps(origin_y);
+  for (std::size_t i = 0; i < count; i += kAvx512FloatLanes) {
+    const auto kRemain = count - i;
+    const auto kMask = static_cast<__mmask16>(
+        kRemain >= kAvx512FloatLanes ? 0xFFFFU : ((1U << kRemain) - 1U));
+    const auto kDx =
+        _mm512_sub_ps(_mm512_maskz_loadu_ps(kMask, xs + i), kOriginX);
+    const auto kDy =
+        _mm512_sub_ps(_mm512_maskz_loadu_ps(kMask, ys + i), kOriginY);
+    auto squared =
+        _mm512_add_ps(_mm512_mul_ps(kDx, kDx), _mm512_mul_ps(kDy, kDy));
+    if constexpr (kRoot) {
+      squared = _mm512_maskz_sqrt_ps(kMask, squared);
+    }
+    _mm512_mask_storeu_ps(output + i, kMask, squared);
+  }
+}
+
+template <bool kRoot>
+__attribute__((target("avx512f"))) auto PairwiseAvx512(
+    const float* lhs_xs, const float* lhs_ys, const float* rhs_xs,
+    const float* rhs_ys, std::size_t count, float* output) -> void {
+  for (std::size_t i = 0; i < count; i += kAvx512FloatLanes) {
+    const auto kRemain = count - i;
+    const auto kMask = static_cast<__mmask16>(
+        kRemain >= kAvx512FloatLanes ? 0xFFFFU : ((1U << kRemain) - 1U));
+    const auto kDx = _mm512_sub_ps(_mm512_maskz_loadu_ps(kMask, lhs_xs + i),
+                                   _mm512_maskz_loadu_ps(kMask, rhs_xs + i));
+    const auto kDy = _mm512_sub_ps(_mm512_maskz_loadu_ps(kMask, lhs_ys + i),
+                                   _mm512_maskz_loadu_ps(kMask, rhs_ys + i));
+    auto squared =
+        _mm512_add_ps(_mm512_mul_ps(kDx, kDx), _mm512_mul_ps(kDy, kDy));
+    if constexpr (kRoot) {
+      squared = _mm512_maskz_sqrt_ps(kMask, squared);
+    }
+    _mm512_mask_storeu_ps(output + i, kMask, squared);
+  }
+}
+
+__attribute__((target("avx2"))) auto IsWithinAvx2(
+    const float* xs, const float* ys, std::size_t count, float origin_x,
+    float origin_y, float radius_squared, uint8_t* output) -> std::size_t {
+  const auto kOriginX = _mm256_set1_ps(origin_x);
+  const auto kOriginY = _mm256_set1_ps(origin_y);
+  const auto kRadiusSquared = _mm256_set1_ps(radius_squared);
+  std::size_t within = 0;
+  std::size_t i = 0;
+  for (; i + kAvx2FloatLanes <= count; i += kAvx2FloatLanes) {
+    const auto kDx = _mm256_sub_ps(_mm256_loadu_ps(xs + i), kOriginX);
+    const auto kDy = _mm256_sub_ps(_mm256_loadu_ps(ys + i), kOriginY);
+    const auto kSquared =
+        _mm256_add_ps(_mm256_mul_ps(kDx, kDx), _mm256_mul_ps(kDy, kDy));
+    const auto kMask = static_cast<unsigned>(_mm256_movemask_ps(
+        _mm256_cmp_ps(kSquared, kRadiusSquared, _CMP_LE_OQ)));
+    for (std::size_t lane = 0; lane < kAvx2FloatLanes; ++lane) {
+      output[i + lane] = static_cast<uint8_t>((kMask >> lane) & 1U);
+    }
+    within += static_cast<std::size_t>(__builtin_popcount(kMask));
+  }
+  return within + IsWithinScalar(xs, ys, i, count, origin_x, origin_y,
+                                 radius_squared, output);
+}
+
+__attribute__((target("avx512f"))) auto IsWithinAvx512(
+    const float* xs, const float* ys, std::size_t count, float origin_x,
+    float origin_y, float radius_squared, uint8_t* output) -> std::size_t {
+  const auto kOriginX = _mm512_set1_ps(origin_x);
+  const auto kOriginY = _mm512_set1_ps(origin_y);
+  const auto kRadiusSquared = _mm512_set1_ps(radius_squared);
+  std::size_t within = 0;
+  for (std::size_t i = 0; i < count; i += kAvx512FloatLanes) {
+    const auto kRemain = std::min(count - i, kAvx512FloatLanes);
+    const auto kMask = static_cast<__mmask16>(
+        kRemain >= kAvx512FloatLanes ? 0xFFFFU : ((1U << kRemain) - 1U));
+    const auto kDx =
+        _mm512_sub_ps(_mm512_maskz_loadu_ps(kMask, xs + i), kOriginX);
+    const auto kDy =
+        _mm512_sub_ps(_mm512_maskz_loadu_ps(kMask, ys + i), kOriginY);
+    const auto kSquared =
+        _mm512_add_ps(_mm512_mul_ps(kDx, kDx), _mm512_mul_ps(kDy, kDy));
+    const auto kWithin = static_cast<unsigned>(
+        _mm512_mask_cmp_ps_mask(kMask, kSquared, kRadiusSquared, _CMP_LE_OQ));
+    for (std::size_t lane = 0; lane < kRemain; ++lane) {
+      output[i + lane] = static_cast<uint8_t>((kWithin >> lane) & 1U);
+    }
+    within += static_cast<std::size_t>(__builtin_popcount(kWithin));
+  }
+  return within;
+}
+
+__attribute__((target("avx2"))) auto CompareAvx2(
+    const float* lhs_xs, const float* lhs_ys, const float* rhs_xs,
+    const float* rhs_ys, std::size_t count, float origin_x, float origin_y,
+    int8_t* output) -> void {
+  const auto kOriginX = _mm256_set1_ps(origin_x);
+  const auto kOriginY = _mm256_set1_ps(origin_y);
+  std::size_t i = 0;
+  for (; i + kAvx2FloatLanes <= count; i += kAvx2FloatLanes) {
+    const auto kLhsDx = _mm256_sub_ps(_mm256_loadu_ps(lhs_xs + i), kOriginX);
+    const auto kLhsDy = _mm256_sub_ps(_mm256_loadu_ps(lhs_ys + i), kOriginY);
+    const auto kRhsDx = _mm256_sub_ps(_mm256_loadu_ps(rhs_xs + i), kOriginX);
+    const auto kRhsDy = _mm256_sub_ps(_mm256_loadu_ps(rhs_ys + i), kOriginY);
+    const auto kLhs = _mm256_add_ps(_mm256_mul_ps(kLhsDx, kLhsDx),
+                                    _mm256_mul_ps(kLhsDy, kLhsDy));
+    const auto kRhs = _mm256_add_ps(_mm256_mul_ps(kRhsDx, kRhsDx),
+                                    _mm256_mul_ps(kRhsDy, kRhsDy));
+    const auto kGreater = static_cast<unsigned>(
+        _mm256_movemask_ps(_mm256_cmp_ps(kLhs, kRhs, _CMP_GT_OQ)));
+    const auto kLess = static_cast<unsigned>(
+        _mm256_movemask_ps(_mm256_cmp_ps(kLhs, kRhs, _CMP_LT_OQ)));
+    for (std::size_t lane = 0; lane < kAvx2FloatLanes; ++lane) {
+      output[i + lane] = static_cast<int8_t>(
+          static_cast<int8_t>((kGreater >> lane) & 1U) -
+          static_cast<int8_t>((kLess >> lane) & 1U));
+    }
+  }
+  CompareScalar(lhs_xs, lhs_ys, rhs_xs, rhs_ys, i, count, origin_x, origin_y,
+                output);
+}
+
+__attribute__((target("avx512f"))) auto CompareAvx512(
+    const float* lhs_xs, const float* lhs_ys, const float* rhs_xs,
+    const float* rhs_ys, std::size_t count, float origin_x, float origin_y,
+    int8_t* output) -> void {
+  const auto kOriginX = _mm512_set1_ps(origin_x);
+  const auto kOriginY = _mm512_set1_ps(origin_y);
+  for (std::size_t i = 0; i < count; i += kAvx512FloatLanes) {
+    const auto kRemain = std::min(count - i, kAvx512FloatLanes);
+    const auto kMask = static_cast<__mmask16>(
+        kRemain >= kAvx512FloatLanes ? 0xFFFFU : ((1U << kRemain) - 1U));
+    const auto kLhsDx =
+        _mm512_sub_ps(_mm512_maskz_loadu_ps(kMask, lhs_xs + i), kOriginX);
+    const auto kLhsDy =
+        _mm512_sub_ps(_mm512_maskz_loadu_ps(kMask, lhs_ys + i), kOriginY);
+    const auto kRhsDx =
+        _mm512_sub_ps(_mm512_maskz_loadu_ps(kMask, rhs_xs + i), kOriginX);
+    const auto kRhsDy =
+        _mm512_sub_ps(_mm512_maskz_loadu_ps(kMask, rhs_ys + i), kOriginY);
+    const auto kLhs = _mm512_add_ps(_mm512_mul_ps(kLhsDx, kLhsDx),
+                                    _mm512_mul_ps(kLhsDy, kLhsDy));
+    const auto kRhs = _mm512_add_ps(_mm512_mul_ps(kRhsDx, kRhsDx),
+                                    _mm512_mul_ps(kRhsDy, kRhsDy));
+    const auto kGreater = static_cast<unsigned>(
+        _mm512_mask_cmp_ps_mask(kMask, kLhs, kRhs, _CMP_GT_OQ));
+    const auto kLess = static_cast<unsigned>(
+        _mm512_mask_cmp_ps_mask(kMask, kLhs, kRhs, _CMP_LT_OQ));
+    for (std::size_t lane = 0; lane < kRemain; ++lane) {
+      output[i + lane] = static_cast<int8_t>(
+          static_cast<int8_t>((kGreater >> lane) & 1U) -
+          static_cast<int8_t>((kLess >> lane) & 1U));
+    }
+  }
+}
+
+constexpr std::size_t kAvx2IntLanes{4U};
+constexpr std::size_t kAvx512IntLanes{16U};
+
+// Differences fit int32, so mul_epi32 of their low halves is exact
+__attribute__((target("avx2"))) auto SquaredAvx2(const int32_t* xs,
+                                                 const int32_t* ys,
+                                                 std::size_t i,
+                                                 __m256i origin_x,
+                                                 __m256i origin_y) -> __m256i {
+  const auto kDx = _mm256_sub_epi64(
+      _mm256_cvtepi32_epi64(
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(xs + i))),
+      origin_x);
+  const auto kDy = _mm256_sub_epi64(
+      _mm256_cvtepi32_epi64(
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(ys + i))),
+      origin_y);
+  return _mm256_add_epi64(_mm256_mul_epi32(kDx, kDx),
+                          _mm256_mul_epi32(kDy, kDy));
+}
+
+__attribute__((target("avx2"))) auto SquaredAvx2(
+    const int32_t* xs, const int32_t* ys, std::size_t count, int32_t origin_x,
+    int32_t origin_y, uint64_t* output) -> void {
+  const auto kOriginX = _mm256_set1_epi64x(origin_x);
+  const auto kOriginY = _mm256_set1_epi64x(origin_y);
+  std::size_t i = 0;
+  for (; i + kAvx2IntLanes <= count; i += kAvx2IntLanes) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i),
+                        SquaredAvx2(xs, ys, i, kOriginX, kOriginY));
+  }
+  SquaredScalar(xs, ys, i, count, origin_x, origin_y, output);
+}
+
+__attribute__((target("avx2"))) auto IsWithinAvx2(
+    const int32_t* xs, const int32_t* ys, std::size_t count, int32_t origin_x,
+    int32_t origin_y, int64_t radius_squared, uint8_t* output)
+    -> std::size_t {
+  const auto kOriginX = _mm256_set1_epi64x(origin_x);
+  const auto kOriginY = _mm256_set1_epi64x(origin_y);
+  const auto kRadiusSquared = _mm256_set1_epi64x(radius_squared);
+  std::size_t within = 0;
+  std::size_t i = 0;
+  for (; i + kAvx2IntLanes <= count; i += kAvx2IntLanes) {
+    const auto kGreater = _mm256_cmpgt_epi64(
+        SquaredAvx2(xs, ys, i, kOriginX, kOriginY), kRadiusSquared);
+    const auto kMask = ~static_cast<unsigned>(_mm256_movemask_pd(
+                           _mm256_castsi256_pd(kGreater))) &
+                       0xFU;
+    for (std::size_t lane = 0; lane < kAvx2IntLanes; ++lane) {
+      output[i + lane] = static_cast<uint8_t>((kMask >> lane) & 1U);
+    }
+    within += static_cast<std::size_t>(__builtin_popcount(kMask));
+  }
+  return within + IsWithinScalar(xs, ys, i, count, origin_x, origin_y,
+                                 radius_squared, output);
+}
+
+// Only zero-masked AVX-512 integer forms here, since GCC warns on the
+// undefined merge sources of the unmasked ones
+__attribute__((target("avx512f"))) auto SquaredAvx512(__m256i xs, __m256i ys,
+                                                      __m512i origin_x,
+                                                      __m512i origin_y)
+    -> __m512i {
+  const auto kDx =
+      _mm512_sub_epi64(_mm512_maskz_cvtepi32_epi64(0xFFU, xs), origin_x);
+  const auto kDy =
+      _mm512_sub_epi64(_mm512_maskz_cvtepi32_epi64(0xFFU, ys), origin_y);
+  return _mm512_add_epi64(_mm512_maskz_mul_epi32(0xFFU, kDx, kDx),
+                          _mm512_maskz_mul_epi32(0xFFU, kDy, kDy));
+}
+
+__attribute__((target("avx512f"))) auto SquaredAvx512(
+    const int32_t* xs, const int32_t* ys, std::size_t count, int32_t origin_x,
+    int32_t origin_y, uint64_t* output) -> void {
+  const auto kOriginX = _mm512_set1_epi64(origin_x);
+  const auto kOriginY = _mm512_set1_epi64(origin_y);
+  for (std::size_t i = 0; i < count; i += kAvx512IntLanes) {
+    const auto kRemain = std::min(count - i, kAvx512IntLanes);
+    const auto kMask = static_cast<__mmask16>(
+        kRemain >= kAvx512IntLanes ? 0xFFFFU : ((1U << kRemain) - 1U));
+    const auto kXs = _mm512_maskz_loadu_epi32(kMask, xs + i);
+    const auto kYs = _mm512_maskz_loadu_epi32(kMask, ys + i);
+    const auto kLowXs = _mm512_maskz_extracti64x4_epi64(0xFU, kXs, 0);
+    const auto kLowYs = _mm512_maskz_extracti64x4_epi64(0xFU, kYs, 0);
+    _mm512_mask_storeu_epi64(
+        output + i, static_cast<__mmask8>(kMask),
+        SquaredAvx512(kLowXs, kLowYs, kOriginX, kOriginY));
+    if (kRemain > kAvx512Lanes) {
+      const auto kHighXs = _mm512_maskz_extracti64x4_epi64(0xFU, kXs, 1);
+      const auto kHighYs = _mm512_maskz_extracti64x4_epi64(0xFU, kYs, 1);
+      _mm512_mask_storeu_epi64(
+          output + i + kAvx512Lanes, static_cast<__mmask8>(kMask >> 8U),
+          SquaredAvx512(kHighXs, kHighYs, kOriginX, kOriginY));
+    }
+  }
+}
+
+__attribute__((target("avx512f"))) auto IsWithinAvx512(
+    const int32_t* xs, const int32_t* ys, std::size_t count, int32_t origin_x,
+    int32_t origin_y, int64_t radius_squared, uint8_t* output)
+    -> std::size_t {
+  const auto kOriginX = _mm512_set1_epi64(origin_x);
+  const auto kOriginY = _mm512_set1_epi64(origin_y);
+  const auto kRadiusSquared = _mm512_set1_epi64(radius_squared);
+  std::size_t within = 0;
+  for (std::size_t i = 0; i < count; i += kAvx512IntLanes) {
+    const auto kRemain = std::min(count - i, kAvx512IntLanes);
+    const auto kMask = static_cast<__mmask16>(
+        kRemain >= kAvx512IntLanes ? 0xFFFFU : ((1U << kRemain) - 1U));
+    const auto kXs = _mm512_maskz_loadu_epi32(kMask, xs + i);
+    const auto kYs = _mm512_maskz_loadu_epi32(kMask, ys + i);
+    const auto kLowXs = _mm512_maskz_extracti64x4_epi64(0xFU, kXs, 0);
+    const auto kLowYs = _mm512_maskz_extracti64x4_epi64(0xFU, kYs, 0);
+    const auto kLow = static_cast<unsigned>(_mm512_mask_cmple_epi64_mask(
+        static_cast<__mmask8>(kMask),
+        SquaredAvx512(kLowXs, kLowYs, kOriginX, kOriginY), kRadiusSquared));
+    const auto kHighXs = _mm512_maskz_extracti64x4_epi64(0xFU, kXs, 1);
+    const auto kHighYs = _mm512_maskz_extracti64x4_epi64(0xFU, kYs, 1);
+    const auto kHigh = static_cast<unsigned>(_mm512_mask_cmple_epi64_mask(
+        static_cast<__mmask8>(kMask >> 8U),
+        SquaredAvx512(kHighXs, kHighYs, kOriginX, kOriginY), kRadiusSquared));
+    const auto kWithin = kLow | (kHigh << 8U);
+    for (std::size_t lane = 0; lane < kRemain; ++lane) {
+      output[i + lane] = static_cast<uint8_t>((kWithin >> lane) & 1U);
+    }
+    within += static_cast<std::size_t>(__builtin_popcount(kWithin));
+  }
+  return within;
+}
+#endif
+
+#if defined(Jeong0806_GEOMETRY_SIMD_NEON)
+constexpr std::size_t kNeonLanes{2U};
+
+template <bool kRoot>
+auto OneToManyNeon(const double* xs, const double* ys, std::size_t count,
+                   double origin_x, double origin_y, double* output) -> void {
+  const auto kOriginX = vdupq_n_f64(origin_x);
+  const auto kOriginY = vdupq_n_f64(origin_y);
+  std::size_t i = 0;
+  for (; i + kNeonLanes <= count; i += kNeonLanes) {
+    const auto kDx = vsubq_f64(vld1q_f64(xs + i), kOriginX);
+    const auto kDy = vsubq_f64(vld1q_f64(ys + i), kOriginY);
+    auto squared = vaddq_f64(vmulq_f64(kDx, kDx), vmulq_f64(kDy, kDy));
+    if constexpr (kRoot) {
+      squared = vsqrtq_f64(squared);
+    }
+    vst1q_f64(output + i, squared);
+  }
+  OneToManyScalar<kRoot>(xs, ys, i, count, origin_x, origin_y, output);
+}
+
+template <bool kRoot>
+auto PairwiseNeon(const double* lhs_xs, const double* lhs_ys,
+                  const double* rhs_xs, const double* rhs_ys,
+                  std::size_t count, double* output) -> void {
+  std::size_t i = 0;
+  for (; i + kNeonLanes <= count; i += kNeonLanes) {
+    const auto kDx = vsubq_f64(vld1q_f64(lhs_xs + i), vld1q_f64(rhs_xs + i));
+    const auto kDy = vsubq_f64(vld1q_f64(lhs_ys + i), vld1q_f64(rhs_ys + i));
+    auto squared = vaddq_f64(vmulq_f64(kDx, kDx), vmulq_f64(kDy, kDy));
+    if constexpr (kRoot) {
+      squared = vsqrtq_f64(squared);
+    }
+    vst1q_f64(output + i, squared);
+  }
+  PairwiseScalar<kRoot>(lhs_xs, lhs_ys, rhs_xs, rhs_ys, i, count, output);
+}
+
+auto IsWithinNeon(const double* xs, const double* ys, std::size_t count,
+                  double origin_x, double origin_y, double radius_squared,
+                  uint8_t* output) -> std::size_t {
+  const auto kOriginX = vdupq_n_f64(origin_x);
+  const auto kOriginY = vdupq_n_f64(origin_y);
+  const auto kRadiusSquared = vdupq_n_f64(radius_squared);
+  std::size_t within = 0;
+  std::size_t i = 0;
+  for (; i + kNeonLanes <= count; i += kNeonLanes) {
+    const auto kDx = vsubq_f64(vld1q_f64(xs + i), kOriginX);
+    const auto kDy = vsubq_f64(vld1q_f64(ys + i), kOriginY);
+    const auto kSquared = vaddq_f64(vmulq_f64(kDx, kDx), vmulq_f64(kDy, kDy));
+    const auto kMask = vcleq_f64(kSquared, kRadiusSquared);
+    output[i] = static_cast<uint8_t>(vgetq_lane_u64(kMask, 0) & 1U);
+    output[i + 1U] = static_cast<uint8_t>(vgetq_lane_u64(kMask, 1) & 1U);
+    within += output[i] + output[i + 1U];
+  }
+  return within + IsWithinScalar(xs, ys, i, count, origin_x, origin_y,
+                                 radius_squared, output);
+}
+
+// Compare lanes are all ones or zero, so less minus greater is the sign
+auto CompareNeon(const double* lhs_xs, const double* lhs_ys,
+                 const double* rhs_xs, const double* rhs_ys, std::size_t count,
+                 double origin_x, double origin_y, int8_t* output) -> void {
+  const auto kOriginX = vdupq_n_f64(origin_x);
+  const auto kOriginY = vdupq_n_f64(origin_y);
+  std::size_t i = 0;
+  for (; i + kNeonLanes <= count; i += kNeonLanes) {
+    const auto kLhsDx = vsubq_f64(vld1q_f64(lhs_xs + i), kOriginX);
+    const auto kLhsDy = vsubq_f64(vld1q_f64(lhs_ys + i), kOriginY);
+    const auto kRhsDx = vsubq_f64(vld1q_f64(rhs_xs + i), kOriginX);
+    const auto kRhsDy = vsubq_f64(vld1q_f64(rhs_ys + i), kOriginY);
+    const auto kLhs =
+        vaddq_f64(vmulq_f64(kLhsDx, kLhsDx), vmulq_f64(kLhsDy, kLhsDy));
+    const auto kRhs =
+        vaddq_f64(vmulq_f64(kRhsDx, kRhsDx), vmulq_f64(kRhsDy, kRhsDy));
+    const auto kSign =
+        vsubq_s64(vreinterpretq_s64_u64(vcltq_f64(kLhs, kRhs)),
+                  vreinterpretq_s64_u64(vcgtq_f64(kLhs, kRhs)));
+    output[i] = static_cast<int8_t>(vgetq_lane_s64(kSign, 0));
+    output[i + 1U] = static_cast<int8_t>(vgetq_lane_s64(kSign, 1));
+  }
+  CompareScalar(lhs_xs, lhs_ys, rhs_xs, rhs_ys, i, count, origin_x, origin_y,
+                output);
+}
+
+auto ConvertNeon(const Distance* distances, std::size_t count, double scale,
+                 double* output) -> void {
+  const auto kScale = vdupq_n_f64(scale);
+  std::size_t i = 0;
+  for (; i + kNeonLanes <= count; i += kNeonLanes) {
+    const auto kNanometers =
+        vld1q_s64(reinterpret_cast<const int64_t*>(distances + i));
+    vst1q_f64(output + i, vmulq_f64(vcvtq_f64_s64(kNanometers), kScale));
+  }
+  ConvertScalar(distances, i, count, scale, output);
+}
+
+auto FromNeon(const double* values, std::size_t count, double scale,
+              Distance* output) -> void {
+  const auto kScale = vdupq_n_f64(scale);
+  std::size_t i = 0;
+  for (; i + kNeonLanes <= count; i += kNeonLanes) {
+    const auto kScaled = vmulq_f64(vld1q_f64(values + i), kScale);
+    vst1q_s64(reinterpret_cast<int64_t*>(output + i), vcvtq_s64_f64(kScaled));
+  }
+  FromScalar(values, i, count, scale, output);
+}
+
+constexpr std::size_t kNeonFloatLanes{4U};
+
+template <bool kRoot>
+auto OneToManyNeon(const float* xs, const float* ys, std::size_t count,
+                   float origin_x, float origin_y, float* output) -> void {
+  const auto kOriginX = vdupq_n_f32(origin_x);
+  const auto kOriginY = vdupq_n_f32(origin_y);
+  std::size_t i = 0;
+  for (; i + kNeonFloatLanes <= count; i += kNeonFloatLanes) {
+    const auto kDx = vsubq_f32(vld1q_f32(xs + i), kOriginX);
+    const auto kDy = vsubq_f32(vld1q_f32(ys + i), kOriginY);
+    auto squared = vaddq_f32(vmulq_f32(kDx, kDx), vmulq_f32(kDy, kDy));
+    if constexpr (kRoot) {
+      squared = vsqrtq_f32(squared);
+    }
+    vst1q_f32(output + i, squared);
+  }
+  OneToManyScalar<kRoot>(xs, ys, i, count, origin_x, origin_y, output);
+}
+
+template <bool kRoot>
+auto PairwiseNeon(const float* lhs_xs, const float* lhs_ys,
+                  const float* rhs_xs, const float* rhs_ys, std::size_t count,
+                  float* output) -> void {
+  std::size_t i = 0;
+  for (; i + kNeonFloatLanes <= count; i += kNeonFloatLanes) {
+    const auto kDx = vsubq_f32(vld1q_f32(lhs_xs + i), vld1q_f32(rhs_xs + i));
+    const auto kDy = vsubq_f32(vld1q_f32(lhs_ys + i), vld1q_f32(rhs_ys + i));
+    auto squared = vaddq_f32(vmulq_f32(kDx, kDx), vmulq_f32(kDy, kDy));
+    if constexpr (kRoot) {
+      squared = vsqrtq_f32(squared);
+    }
+    vst1q_f32(output + i, squared);
+  }
+  PairwiseScalar<kRoot>(lhs_xs, lhs_ys, rhs_xs, rhs_ys, i, count, output);
+}
+
+auto IsWithinNeon(const float* xs, const float* ys, std::size_t count,
+                  float origin_x, float origin_y, float radius_squared,
+                  uint8_t* output) -> std::size_t {
+  const auto kOriginX = vdupq_n_f32(origin_x);
+  const auto kOriginY = vdupq_n_f32(origin_y);
+  const auto kRadiusSquared = vdupq_n_f32(radius_squared);
+  std::size_t within = 0;
+  std::size_t i = 0;
+  for (; i + kNeonFloatLanes <= count; i += kNeonFloatLanes) {
+    const auto kDx = vsubq_f32(vld1q_f32(xs + i), kOriginX);
+    const auto kDy = vsubq_f32(vld1q_f32(ys + i), kOriginY);
+    const auto kSquared = vaddq_f32(vmulq_f32(kDx, kDx), vmulq_f32(kDy, kDy));
+    const auto kMask = vcleq_f32(kSquared, kRadiusSquared);
+    output[i] = static_cast<uint8_t>(vgetq_lane_u32(kMask, 0) & 1U);
+    output[i + 1U] = static_cast<uint8_t>(vgetq_lane_u32(kMask, 1) & 1U);
+    output[i + 2U] = static_cast<uint8_t>(vgetq_lane_u32(kMask, 2) & 1U);
+    output[i + 3U] = static_cast<uint8_t>(vgetq_lane_u32(kMask, 3) & 1U);
+    within += output[i] + output[i + 1U] + output[i + 2U] + output[i + 3U];
+  }
+  return within + IsWithinScalar(xs, ys, i, count, origin_x, origin_y,
+                                 radius_squared, output);
+}
+
+auto CompareNeon(const float* lhs_xs, const float* lhs_ys, const float* rhs_xs,
+                 const float* rhs_ys, std::size_t count, float origin_x,
+                 float origin_y, int8_t* output) -> void {
+  const auto kOriginX = vdupq_n_f32(origin_x);
+  const auto kOriginY = vdupq_n_f32(origin_y);
+  std::size_t i = 0;
+  for (; i + kNeonFloatLanes <= count; i += kNeonFloatLanes) {
+    const auto kLhsDx = vsubq_f32(vld1q_f32(lhs_xs + i), kOriginX);
+    const auto kLhsDy = vsubq_f32(vld1q_f32(lhs_ys + i), kOriginY);
+    const auto kRhsDx = vsubq_f32(vld1q_f32(rhs_xs + i), kOriginX);
+    const auto kRhsDy = vsubq_f32(vld1q_f32(rhs_ys + i), kOriginY);
+    const auto kLhs =
+        vaddq_f32(vmulq_f32(kLhsDx, kLhsDx), vmulq_f32(kLhsDy, kLhsDy));
+    const auto kRhs =
+        vaddq_f32(vmulq_f32(kRhsDx, kRhsDx), vmulq_f32(kRhsDy, kRhsDy));
+    const auto kSign =
+        vsubq_s32(vreinterpretq_s32_u32(vcltq_f32(kLhs, kRhs)),
+                  vreinterpretq_s32_u32(vcgtq_f32(kLhs, kRhs)));
+    output[i] = static_cast<int8_t>(vgetq_lane_s32(kSign, 0));
+    output[i + 1U] = static_cast<int8_t>(vgetq_lane_s32(kSign, 1));
+    output[i + 2U] = static_cast<int8_t>(vgetq_lane_s32(kSign, 2));
+    output[i + 3U] = static_cast<int8_t>(vgetq_lane_s32(kSign, 3));
+  }
+  CompareScalar(lhs_xs, lhs_ys, rhs_xs, rhs_ys, i, count, origin_x, origin_y,
+                output);
+}
+
+constexpr std::size_t kNeonIntLanes{2U};
+
+// Differences fit int32, so the narrowed widening multiply is exact
+auto SquaredNeon(const int32_t* xs, const int32_t* ys, std::size_t i,
+                 int32x2_t origin_x, int32x2_t origin_y) -> int64x2_t {
+  const auto kDx = vmovn_s64(vsubl_s32(vld1_s32(xs + i), origin_x));
+  const auto kDy = vmovn_s64(vsubl_s32(vld1_s32(ys + i), origin_y));
+  return vaddq_s64(vmull_s32(kDx, kDx), vmull_s32(kDy, kDy));
+}
+
+auto SquaredNeon(const int32_t* xs, const int32_t* ys, std::size_t count,
+                 int32_t origin_x, int32_t origin_y, uint64_t* output)
+    -> void {
+  const auto kOriginX = vdup_n_s32(origin_x);
+  const auto kOriginY = vdup_n_s32(origin_y);
+  std::size_t i = 0;
+  for (; i + kNeonIntLanes <= count; i += kNeonIntLanes) {
+    vst1q_u64(output + i, vreinterpretq_u64_s64(
+                              SquaredNeon(xs, ys, i, kOriginX, kOriginY)));
+  }
+  SquaredScalar(xs, ys, i, count, origin_x, origin_y, output);
+}
+
+auto IsWithinNeon(const int32_t* xs, const int32_t* ys, std::size_t count,
+                  int32_t origin_x, int32_t origin_y, int64_t radius_squared,
+                  uint8_t* output) -> std::size_t {
+  const auto kOriginX = vdup_n_s32(origin_x);
+  const auto kOriginY = vdup_n_s32(origin_y);
+  const auto kRadiusSquared = vdupq_n_s64(radius_squared);
+  std::size_t within = 0;
+  std::size_t i = 0;
+  for (; i + kNeonIntLanes <= count; i += kNeonIntLanes) {
+    const auto kMask = vcleq_s64(SquaredNeon(xs, ys, i, kOriginX, kOriginY),
+                                 kRadiusSquared);
+    output[i] = static_cast<uint8_t>(vgetq_lane_u64(kMask, 0) & 1U);
+    output[i + 1U] = static_cast<uint8_t>(vgetq_lane_u64(kMask, 1) & 1U);
+    within += output[i] + output[i + 1U];
+  }
+  return within + IsWithinScalar(xs, ys, i, count, origin_x, origin_y,
+                                 radius_squared, output);
+}
+#endif
+
+template <bool kRoot, typename T>
+auto OneToMany(const T* xs, const T* ys, std::size_t count, T origin_x,
+               T origin_y, T* output) -> void {
+  Instrumentation::Add(Instrumentation::Counter::kDistanceCalculations, count);
+  switch (Jeong0806::geometry::GetSimdLevel()) {
+#if defined(Jeong0806_GEOMETRY_SIMD_X86)
+    case Jeong0806::geometry::SimdLevel::kAvx512:
+      OneToManyAvx512<kRoot>(xs, ys, count, origin_x, origin_y, output);
+      break;
+    case Jeong0806::geometry::SimdLevel::kAvx2:
+      OneToManyAvx2<kRoot>(xs, ys, count, origin_x, origin_y, output);
+      break;
+#endif
+#if defined(Jeong0806_GEOMETRY_SIMD_NEON)
+    case Jeong0806::geometry::SimdLevel::kNeon:
+      OneToManyNeon<kRoot>(xs, ys, count, origin_x, origin_y, output);
+      break;
+#endif
+    default:
+      OneToManyScalar<kRoot>(xs, ys, 0U, count, origin_x, origin_y, output);
+      break;
+  }
+}
+
+template <bool kRoot, typename T>
+auto Pairwise(const T* lhs_xs, const T* lhs_ys, const T* rhs_xs,
+              const T* rhs_ys, std::size_t count, T* output) -> void {
+  Instrumentation::Add(Instrumentation::Counter::kDistanceCalculations, count);
+  switch (Jeong0806::geometry::GetSimdLevel()) {
+#if defined(Jeong0806_GEOMETRY_SIMD_X86)
+    case Jeong0806::geometry::SimdLevel::kAvx512:
+      PairwiseAvx512<kRoot>(lhs_xs, lhs_ys, rhs_xs, rhs_ys, count, output);
+      break;
+    case Jeong0806::geometry::SimdLevel::kAvx2:
+      PairwiseAvx2<kRoot>(lhs_xs, lhs_ys, rhs_xs, rhs_ys, count, output);
+      break;
+#endif
+#if defined(Jeong0806_GEOMETRY_SIMD_NEON)
+    case Jeong0806::geometry::SimdLevel::kNeon:
+      PairwiseNeon<kRoot>(lhs_xs, lhs_ys, rhs_xs, rhs_ys, count, output);
+      break;
+#endif
+    default:
+      PairwiseScalar<kRoot>(lhs_xs, lhs_ys, rhs_xs, rhs_ys, 0U, count,
+                            output);
+      break;
+  }
+}
+template <typename T>
+auto Within(const T* xs, const T* ys, std::size_t count, T origin_x,
+            T origin_y, T radius, uint8_t* output) -> std::size_t {
+  Instrumentation::Add(Instrumentation::Counter::kDistanceCalculations, count);
+  if (!(radius >= T{0})) {
+    std::fill(output, output + count, uint8_t{0});
+    return 0U;
+  }
+  const auto kRadiusSquared = radius * radius;
+  switch (Jeong0806::geometry::GetSimdLevel()) {
+#if defined(Jeong0806_GEOMETRY_SIMD_X86)
+    case Jeong0806::geometry::SimdLevel::kAvx512:
+      return IsWithinAvx512(xs, ys, count, origin_x, origin_y, kRadiusSquared,
+                            output);
+    case Jeong0806::geometry::SimdLevel::kAvx2:
+      return IsWithinAvx2(xs, ys, count, origin_x, origin_y, kRadiusSquared,
+                          output);
+#endif
+#if defined(Jeong0806_GEOMETRY_SIMD_NEON)
+    case Jeong0806::geometry::SimdLevel::kNeon:
+      return IsWithinNeon(xs, ys, count, origin_x, origin_y, kRadiusSquared,
+                          output);
+#endif
+    default:
+      return IsWithinScalar(xs, ys, 0U, count, origin_x, origin_y,
+                            kRadiusSquared, output);
+  }
+}
+
+template <typename T>
+auto Compare(const T* lhs_xs, const T* lhs_ys, const T* rhs_xs,
+             const T* rhs_ys, std::size_t count, T origin_x, T origin_y,
+             int8_t* output) -> void {
+  Instrumentation::Add(Instrumentation::Counter::kDistanceCalculations,
+                       2U * count);
+  switch (Jeong0806::geometry::GetSimdLevel()) {
+#if defined(Jeong0806_GEOMETRY_SIMD_X86)
+    case Jeong0806::geometry::SimdLevel::kAvx512:
+      CompareAvx512(lhs_xs, lhs_ys, rhs_xs, rhs_ys, count, origin_x, origin_y,
+                    output);
+      break;
+    case Jeong0806::geometry::SimdLevel::kAvx2:
+      CompareAvx2(lhs_xs, lhs_ys, rhs_xs, rhs_ys, count, origin_x, origin_y,
+                  output);
+      break;
+#endif
+#if defined(Jeong0806_GEOMETRY_SIMD_NEON)
+    case Jeong0806::geometry::SimdLevel::kNeon:
+      CompareNeon(lhs_xs, lhs_ys, rhs_xs, rhs_ys, count, origin_x, origin_y,
+                  output);
+      break;
+#endif
+    default:
+      CompareScalar(lhs_xs, lhs_ys, rhs_xs, rhs_ys, 0U, count, origin_x,
+                    origin_y, output);
+      break;
+  }
+}
+}  // namespace
+
+namespace Jeong0806::geometry::kernel {
+auto CalculateDistances(const double* xs, const double* ys, std::size_t count,
+                        double origin_x, double origin_y, double* output)
+    -> void {
+  OneToMany<true>(xs, ys, count, origin_x, origin_y, output);
+}
+
+auto CalculateSquaredDistances(const double* xs, const double* ys,
+                               std::size_t count, double origin_x,
+                               double origin_y, double* output) -> void {
+  OneToMany<false>(xs, ys, count, origin_x, origin_y, output);
+}
+
+auto CalculatePairwiseDistances(const double* lhs_xs, const double* lhs_ys,
+                                const double* rhs_xs, const double* rhs_ys,
+                                std::size_t count, double* output) -> void {
+  Pairwise<true>(lhs_xs, lhs_ys, rhs_xs, rhs_ys, count, output);
+}
+
+auto CalculatePairwiseSquaredDistances(const double* lhs_xs,
+                                       const double* lhs_ys,
+                                       const double* rhs_xs,
+                                       const double* rhs_ys, std::size_t count,
+                                       double* output) -> void {
+  Pairwise<false>(lhs_xs, lhs_ys, rhs_xs, rhs_ys, count, output);
+}
+
+auto IsWithin(const double* xs, const double* ys, std::size_t count,
+              double origin_x, double origin_y, double radius,
+              uint8_t* output) -> std::size_t {
+  return Within(xs, ys, count, origin_x, origin_y, radius, output);
+}
+
+auto CompareDistances(const double* lhs_xs, const double* lhs_ys,
+                      const double* rhs_xs, const double* rhs_ys,
+                      std::size_t count, double origin_x, double origin_y,
+                      int8_t* output) -> void {
+  Compare(lhs_xs, lhs_ys, rhs_xs, rhs_ys, count, origin_x, origin_y, output);
+}
+
+auto CalculateDistances(const float* xs, const float* ys, std::size_t count,
+                        float origin_x, float origin_y, float* output)
+    -> void {
+  OneToMany<true>(xs, ys, count, origin_x, origin_y, output);
+}
+
+auto CalculateSquaredDistances(const float* xs, const float* ys,
+                               std::size_t count, float origin_x,
+                               float origin_y, float* output) -> void {
+  OneToMany<false>(xs, ys, count, origin_x, origin_y, output);
+}
+
+auto CalculatePairwiseDistances(const float* lhs_xs, const float* lhs_ys,
+                                const float* rhs_xs, const float* rhs_ys,
+                                std::size_t count, float* output) -> void {
+  Pairwise<true>(lhs_xs, lhs_ys, rhs_xs, rhs_ys, count, output);
+}
+
+auto CalculatePairwiseSquaredDistances(const float* lhs_xs,
+                                       const float* lhs_ys,
+                                       const float* rhs_xs,
+                                       const float* rhs_ys, std::size_t count,
+                                       float* output) -> void {
+  Pairwise<false>(lhs_xs, lhs_ys, rhs_xs, rhs_ys, count, output);
+}
+
+auto IsWithin(const float* xs, const float* ys, std::size_t count,
+              float origin_x, float origin_y, float radius, uint8_t* output)
+    -> std::size_t {
+  return Within(xs, ys, count, origin_x, origin_y, radius, output);
+}
+
+auto CompareDistances(const float* lhs_xs, const float* lhs_ys,
+                      const float* rhs_xs, const float* rhs_ys,
+                      std::size_t count, float origin_x, float origin_y,
+                      int8_t* output) -> void {
+  Compare(lhs_xs, lhs_ys, rhs_xs, rhs_ys, count, origin_x, origin_y, output);
+}
+
+auto CalculateSquaredDistances(const int32_t* xs, const int32_t* ys,
+                               std::size_t count, int32_t origin_x,
+                               int32_t origin_y, uint64_t* output) -> void {
+  Instrumentation::Add(Instrumentation::Counter::kDistanceCalculations, count);
+  switch (GetSimdLevel()) {
+#if defined(Jeong0806_GEOMETRY_SIMD_X86)
+    case SimdLevel::kAvx512:
+      SquaredAvx512(xs, ys, count, origin_x, origin_y, output);
+      break;
+    case SimdLevel::kAvx2:
+      SquaredAvx2(xs, ys, count, origin_x, origin_y, output);
+      break;
+#endif
+#if defined(Jeong0806_GEOMETRY_SIMD_NEON)
+    case SimdLevel::kNeon:
+      SquaredNeon(xs, ys, count, origin_x, origin_y, output);
+      break;
+#endif
+    default:
+      SquaredScalar(xs, ys, 0U, count, origin_x, origin_y, output);
+      break;
+  }
+}
+
+auto IsWithin(const int32_t* xs, const int32_t* ys, std::size_t count,
+              int32_t origin_x, int32_t origin_y, int64_t radius,
+              uint8_t* output) -> std::size_t {
+  // Squares of larger radii overflow int64 but exceed every squared distance
+  constexpr int64_t kMaxSquarableRadius{3037000499};
+  Instrumentation::Add(Instrumentation::Counter::kDistanceCalculations, count);
+  if (radius < 0) {
+    std::fill(output, output + count, uint8_t{0});
+    return 0U;
+  }
+  const auto kRadiusSquared = (radius > kMaxSquarableRadius)
+                                  ? std::numeric_limits<int64_t>::max()
+                                  : radius * radius;
+  switch (GetSimdLevel()) {
+#if defined(Jeong0806_GEOMETRY_SIMD_X86)
+    case SimdLevel::kAvx512:
+      return IsWithinAvx512(xs, ys, count, origin_x, origin_y, kRadiusSquared,
+                            output);
+    case SimdLevel::kAvx2:
+      return IsWithinAvx2(xs, ys, count, origin_x, origin_y, kRadiusSquared,
+                          output);
+#endif
+#if defined(Jeong0806_GEOMETRY_SIMD_NEON)
+    case SimdLevel::kNeon:
+      return IsWithinNeon(xs, ys, count, origin_x, origin_y, kRadiusSquared,
+                          output);
+#endif
+    default:
+      return IsWithinScalar(xs, ys, 0U, count, origin_x, origin_y,
+                            kRadiusSquared, output);
+  }
+}
+
+auto CalculateSquaredDistances(const int64_t* xs, const int64_t* ys,
+                               std::size_t count, int64_t origin_x,
+                               int64_t origin_y, UInt128* output) -> void {
+  Instrumentation::Add(Instrumentation::Counter::kDistanceCalculations, count);
+  const Point2I kOrigin(origin_x, origin_y);
+  for (std::size_t i = 0; i < count; ++i) {
+    output[i] = kOrigin.CalculateSquaredDistance(Point2I(xs[i], ys[i]));
+  }
+}
+
+auto IsWithin(const int64_t* xs, const int64_t* ys, std::size_t count,
+              int64_t origin_x, int64_t origin_y, int64_t radius,
+              uint8_t* output) -> std::size_t {
+  Instrumentation::Add(Instrumentation::Counter::kDistanceCalculations, count);
+  if (radius < 0) {
+    std::fill(output, output + count, uint8_t{0});
+    return 0U;
+  }
+  const Point2I kOrigin(origin_x, origin_y);
+  const auto kRadiusSquared = UInt128::Multiply(static_cast<uint64_t>(radius),
+                                                static_cast<uint64_t>(radius));
+  std::size_t within = 0;
+  for (std::size_t i = 0; i < count; ++i) {
+    output[i] = (kOrigin.CalculateSquaredDistance(Point2I(xs[i], ys[i])) <=
+                 kRadiusSquared)
+                    ? 1U
+                    : 0U;
+    within += output[i];
+  }
+  return within;
+}
+
+auto ConvertDistances(const Distance* distances, std::size_t count,
+                      Distance::DistanceType type, double* output) -> void {
+  Instrumentation::Add(Instrumentation::Counter::kDistanceConversions, count);
+  const auto kScale = Distance::GetUnitScale(type);
+  switch (GetSimdLevel()) {
+#if defined(Jeong0806_GEOMETRY_SIMD_X86)
+    case SimdLevel::kAvx512:
+      ConvertAvx512(distances, count, kScale, output);
+      break;
+    case SimdLevel::kAvx2:
+      ConvertAvx2(distances, count, kScale, output);
+      break;
+#endif
+#if defined(Jeong0806_GEOMETRY_SIMD_NEON)
+    case SimdLevel::kNeon:
+      ConvertNeon(distances, count, kScale, output);
+      break;
+#endif
+    default:
+      ConvertScalar(distances, 0U, count, kScale, output);
+      break;
+  }
+}
+
+auto FromValues(const double* values, std::size_t count,
+                Distance::DistanceType type, Distance* output) -> void {
+  Instrumentation::Add(Instrumentation::Counter::kDistanceConversions, count);
+  const auto kScale = static_cast<double>(Distance::GetNanometerScale(type));
+  switch (GetSimdLevel()) {
+#if defined(Jeong0806_GEOMETRY_SIMD_X86)
+    case SimdLevel::kAvx512:
+      FromAvx512(values, count, kScale, output);
+      break;
+    case SimdLevel::kAvx2:
+      FromAvx2(values, count, kScale, output);
+      break;
+#endif
+#if defined(Jeong0806_GEOMETRY_SIMD_NEON)
+    case SimdLevel::kNeon:
+      FromNeon(values, count, kScale, output);
+      break;
+#endif
+    default:
+      FromScalar(values, 0U, count, kScale, output);
+      break;
+  }
+}
+}  // namespace Jeong0806::geometry::kernel
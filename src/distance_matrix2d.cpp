@@ -0,0 +1,176 @@
+/**
+ * @file geometry/src/distance_matrix2d.cpp
+ * @author Jeong Seong In (0806jsi@gmail.com)
+ * @brief All-pairs distance matrix class developments
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2023 Jeong0806, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/distance_matrix2d.hpp"
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "geometry/distance_kernels.hpp"
+#include "geometry/instrumentation.hpp"
+#include "geometry/parallel.hpp"
+
+namespace {
+using Jeong0806::geometry::Distance;
+using Jeong0806::geometry::DistanceMatrix2D;
+
+auto DivideRoundUp(std::size_t value, std::size_t divisor) -> std::size_t {
+  return (value + divisor - 1U) / divisor;
+}
+
+auto Store(const double* distances, std::size_t count,
+           Distance::DistanceType /* unit */, float* output) -> void {
+  for (std::size_t i = 0; i < count; ++i) {
+    output[i] = static_cast<float>(distances[i]);
+  }
+}
+
+auto Store(const double* distances, std::size_t count,
+           Distance::DistanceType unit, Distance* output) -> void {
+  for (std::size_t i = 0; i < count; ++i) {
+    output[i] = Distance(distances[i], unit);
+  }
+}
+
+// Writes one row of a tile, through a stack buffer unless T is double
+template <typename T>
+auto CalculateTileRow(const double* xs, const double* ys, std::size_t count,
+                      double origin_x, double origin_y,
+                      Distance::DistanceType unit, T* output) -> void {
+  if constexpr (std::is_same_v<T, double>) {
+    Jeong0806::geometry::kernel::CalculateDistances(xs, ys, count, origin_x,
+                                                    origin_y, output);
+  } else {
+    std::array<double, DistanceMatrix2D::kColumnTile> distances;
+    Jeong0806::geometry::kernel::CalculateDistances(xs, ys, count, origin_x,
+                                                    origin_y, distances.data());
+    Store(distances.data(), count, unit, output);
+  }
+}
+}  // namespace
+
+namespace Jeong0806::geometry {
+DistanceMatrix2D::DistanceMatrix2D(PointCloud2D rows, PointCloud2D columns,
+                                   Distance::DistanceType unit)
+    : rows_(std::move(rows)), columns_(std::move(columns)), unit_(unit) {}
+
+DistanceMatrix2D::DistanceMatrix2D(const std::vector<Point2D>& rows,
+                                   const std::vector<Point2D>& columns,
+                                   Distance::DistanceType unit,
+                                   std::pmr::memory_resource* resource)
+    : DistanceMatrix2D(PointCloud2D(rows, resource),
+                       PointCloud2D(columns, resource), unit) {}
+
+auto DistanceMatrix2D::Rows() const -> std::size_t { return rows_.Size(); }
+
+auto DistanceMatrix2D::Columns() const -> std::size_t {
+  return columns_.Size();
+}
+
+template <typename T>
+auto DistanceMatrix2D::CalculateRows(std::size_t first_row,
+                                     std::size_t row_count, T* output,
+                                     std::size_t thread_count,
+                                     Executor* executor) const -> void {
+  const Instrumentation::ScopedTimer kTimer(
+      Instrumentation::Timer::kDistanceMatrix);
+  const auto kColumns = Columns();
+  const auto kColumnTiles = DivideRoundUp(kColumns, kColumnTile);
+  const auto kTiles = DivideRoundUp(row_count, kRowTile) * kColumnTiles;
+  const auto* row_xs = rows_.GetXData();
+  const auto* row_ys = rows_.GetYData();
+  const auto* column_xs = columns_.GetXData();
+  const auto* column_ys = columns_.GetYData();
+
+  ParallelFor(
+      kTiles,
+      [&](std::size_t begin, std::size_t end) {
+        for (auto tile = begin; tile < end; ++tile) {
+          const auto kRowBegin = (tile / kColumnTiles) * kRowTile;
+          const auto kRowEnd = std::min(kRowBegin + kRowTile, row_count);
+          const auto kColumnBegin = (tile % kColumnTiles) * kColumnTile;
+          const auto kColumnCount =
+              std::min(kColumnTile, kColumns - kColumnBegin);
+          for (auto row = kRowBegin; row < kRowEnd; ++row) {
+            CalculateTileRow(column_xs + kColumnBegin,
+                             column_ys + kColumnBegin, kColumnCount,
+                             row_xs[first_row + row], row_ys[first_row + row],
+                             unit_, output + (row * kColumns) + kColumnBegin);
+          }
+        }
+      },
+      thread_count, executor);
+}
+
+template <typename T>
+auto DistanceMatrix2D::StreamRows(std::size_t block_rows,
+                                  const RowBlockCallback<T>& callback,
+                                  std::size_t thread_count,
+                                  Executor* executor) const -> void {
+  if (block_rows == 0U) {
+    throw std::invalid_argument("Block rows must be positive");
+  }
+  const auto kRows = Rows();
+  std::vector<T> block(std::min(block_rows, kRows) * Columns());
+  for (std::size_t first_row = 0; first_row < kRows; first_row += block_rows) {
+    const auto kRowCount = std::min(block_rows, kRows - first_row);
+    CalculateRows(first_row, kRowCount, block.data(), thread_count, executor);
+    callback(first_row, kRowCount, block.data());
+  }
+}
+
+auto DistanceMatrix2D::Calculate(double* output, std::size_t thread_count,
+                                 Executor* executor) const -> void {
+  CalculateRows(0U, Rows(), output, thread_count, executor);
+}
+
+auto DistanceMatrix2D::Calculate(float* output, std::size_t thread_count,
+                                 Executor* executor) const -> void {
+  CalculateRows(0U, Rows(), output, thread_count, executor);
+}
+
+auto DistanceMatrix2D::Calculate(Distance* output, std::size_t thread_count,
+                                 Executor* executor) const -> void {
+  CalculateRows(0U, Rows(), output, thread_count, executor);
+}
+
+auto DistanceMatrix2D::ToVector(std::size_t thread_count,
+                                Executor* executor) const
+    -> std::vector<double> {
+  std::vector<double> matrix(Rows() * Columns());
+  Calculate(matrix.data(), thread_count, executor);
+  return matrix;
+}
+
+auto DistanceMatrix2D::StreamRowBlocks(std::size_t block_rows,
+                                       const RowBlockCallback<double>& callback,
+                                       std::size_t thread_count,
+                                       Executor* executor) const -> void {
+  StreamRows(block_rows, callback, thread_count, executor);
+}
+
+auto DistanceMatrix2D::StreamRowBlocks(std::size_t block_rows,
+                                       const RowBlockCallback<float>& callback,
+                                       std::size_t thread_count,
+                                       Executor* executor) const -> void {
+  StreamRows(block_rows, callback, thread_count, executor);
+}
+
+auto DistanceMatrix2D::StreamRowBlocks(
+    std::size_t block_rows, const RowBlockCallback<Distance>& callback,
+    std::size_t thread_count, Executor* executor) const -> void {
+  StreamRows(block_rows, callback, thread_count, executor);
+}
+}  // namespace Jeong0806::geometry
@@ -0,0 +1,242 @@
+/**
+ * @file geometry/src/hilbert2d.cpp
+ * @author Jeong Seong In (0806jsi@gmail.com)
+ * @brief Hilbert code and spatial partition class developments
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2023 Jeong0806, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/hilbert2d.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <stdexcept>
+
+#include "geometry/instrumentation.hpp"
+#include "geometry/parallel.hpp"
+
+namespace {
+using Jeong0806::geometry::Executor;
+using Jeong0806::geometry::MortonGrid2D;
+using Jeong0806::geometry::Point2D;
+
+constexpr uint32_t kTableBits{4U};
+constexpr uint32_t kTableMask{(1U << kTableBits) - 1U};
+// Sorting on the code of 2^16 by 2^16 cells halves the radix passes, and the
+// order inside such a cell does not change how compact the shards are
+constexpr uint32_t kPartitionShift{32U};
+
+// Entry (state, x nibble, y nibble) holds the 8 code bits of the nibbles in
+// its low byte and the next state above. A state is the transform of the
+// remaining bits, bit 0 swapping x and y and bit 1 complementing both.
+constexpr auto MakeEncodeTable() -> std::array<uint16_t, 1024U> {
+  std::array<uint16_t, 1024U> table{};
+  for (uint32_t entry = 0; entry < table.size(); ++entry) {
+    auto state = entry >> (2U * kTableBits);
+    const auto kX = (entry >> kTableBits) & kTableMask;
+    const auto kY = entry & kTableMask;
+    uint32_t code = 0;
+    for (uint32_t bit = kTableBits; bit-- > 0U;) {
+      auto rx = (kX >> bit) & 1U;
+      auto ry = (kY >> bit) & 1U;
+      if ((state & 2U) != 0U) {
+        rx ^= 1U;
+        ry ^= 1U;
+      }
+      if ((state & 1U) != 0U) {
+        const auto kSwap = rx;
+        rx = ry;
+        ry = kSwap;
+      }
+      code |= ((3U * rx) ^ ry) << (2U * bit);
+      state ^= ((rx & (ry ^ 1U)) << 1U) | (ry ^ 1U);
+    }
+    table[entry] = static_cast<uint16_t>((state << 8U) | code);
+  }
+  return table;
+}
+
+constexpr auto kEncodeTable = MakeEncodeTable();
+
+auto EncodeTable(uint32_t x, uint32_t y) -> uint64_t {
+  uint64_t code = 0;
+  uint32_t state = 0;
+  for (uint32_t shift = 32U; shift > 0U;) {
+    shift -= kTableBits;
+    const auto kEntry =
+        kEncodeTable[(state << (2U * kTableBits)) |
+                     (((x >> shift) & kTableMask) << kTableBits) |
+                     ((y >> shift) & kTableMask)];
+    code = (code << (2U * kTableBits)) | (kEntry & 0xFFU);
+    state = kEntry >> 8U;
+  }
+  return code;
+}
+
+// coordinates(i) returns point i
+template <typename Coordinates>
+auto FillCodes(Coordinates coordinates, const MortonGrid2D& grid,
+               std::size_t count, uint64_t* codes, std::size_t thread_count,
+               Executor* executor) -> void {
+  Jeong0806::geometry::ParallelFor(
+      count,
+      [&](std::size_t begin, std::size_t end) {
+        for (auto i = begin; i < end; ++i) {
+          const auto [kX, kY] = grid.Quantize(coordinates(i));
+          codes[i] = EncodeTable(kX, kY);
+        }
+      },
+      thread_count, executor);
+}
+}  // namespace
+
+namespace Jeong0806::geometry {
+auto Hilbert2D::GetCode(const MortonGrid2D& grid, const Point2D& point)
+    -> uint64_t {
+  const auto [kX, kY] = grid.Quantize(point);
+  return EncodeTable(kX, kY);
+}
+
+auto Hilbert2D::ComputeCodes(const MortonGrid2D& grid, const Point2D* points,
+                             std::size_t count, uint64_t* codes,
+                             std::size_t thread_count, Executor* executor)
+    -> void {
+  FillCodes([points](std::size_t i) { return points[i]; }, grid, count, codes,
+            thread_count, executor);
+}
+
+auto Hilbert2D::ComputeCodes(const MortonGrid2D& grid,
+                             const PointCloud2D& points,
+                             std::size_t thread_count, Executor* executor)
+    -> std::vector<uint64_t> {
+  std::vector<uint64_t> codes(points.Size());
+  FillCodes(
+      [&points](std::size_t i) {
+        return Point2D(points.GetXData()[i], points.GetYData()[i]);
+      },
+      grid, codes.size(), codes.data(), thread_count, executor);
+  return codes;
+}
+
+HilbertPartition2D::HilbertPartition2D(const PointCloud2D& points,
+                                       std::size_t shard_count,
+                                       std::size_t thread_count,
+                                       Executor* executor)
+    : HilbertPartition2D(points, std::vector<double>(), shard_count,
+                         thread_count, executor) {}
+
+HilbertPartition2D::HilbertPartition2D(const PointCloud2D& points,
+                                       const std::vector<double>& weights,
+                                       std::size_t shard_count,
+                                       std::size_t thread_count,
+                                       Executor* executor) {
+  const Instrumentation::ScopedTimer kTimer(
+      Instrumentation::Timer::kHilbertPartition);
+  if (shard_count == 0U) {
+    throw std::invalid_argument("Shard count must be positive");
+  }
+  const auto kWeighted = !weights.empty();
+  if (kWeighted && (weights.size() != points.Size())) {
+    throw std::invalid_argument("Points and weights have different sizes");
+  }
+  if (!std::all_of(weights.begin(), weights.end(), [](double weight) {
+        return std::isfinite(weight) && (weight >= 0.0);
+      })) {
+    throw std::invalid_argument("Weights must be finite and non-negative");
+  }
+
+  auto codes = Hilbert2D::ComputeCodes(MortonGrid2D(points), points,
+                                       thread_count, executor);
+  for (auto& code : codes) {
+    code >>= kPartitionShift;
+  }
+  order_ = Morton2D::SortOrder(codes.data(), codes.size(), thread_count,
+                               executor);
+
+  const auto kCount = order_.size();
+  offsets_.resize(shard_count + 1U);
+  weights_.assign(shard_count, 0.0);
+  double total = 0.0;
+  for (const auto kWeight : weights) {
+    total += kWeight;
+  }
+  if (!kWeighted || (total <= 0.0)) {
+    for (std::size_t shard = 0; shard <= shard_count; ++shard) {
+      offsets_[shard] = (kCount * shard) / shard_count;
+    }
+    for (std::size_t shard = 0; shard < shard_count; ++shard) {
+      weights_[shard] =
+          kWeighted ? 0.0
+                    : static_cast<double>(offsets_[shard + 1U] -
+                                          offsets_[shard]);
+    }
+    return;
+  }
+
+  // Cut shard s - 1 from shard s once the running weight reaches s / count
+  // of the total
+  std::size_t shard = 0;
+  double running = 0.0;
+  for (std::size_t position = 0; position < kCount; ++position) {
+    while ((shard + 1U < shard_count) &&
+           (running >= total * static_cast<double>(shard + 1U) /
+                           static_cast<double>(shard_count))) {
+      offsets_[++shard] = position;
+    }
+    const auto kWeight = weights[order_[position]];
+    running += kWeight;
+    weights_[shard] += kWeight;
+  }
+  while (shard < shard_count) {
+    offsets_[++shard] = kCount;
+  }
+}
+
+auto HilbertPartition2D::GetShardCount() const -> std::size_t {
+  return weights_.size();
+}
+
+auto HilbertPartition2D::GetOrder() const -> const std::vector<uint32_t>& {
+  return order_;
+}
+
+auto HilbertPartition2D::GetShardSize(std::size_t shard) const
+    -> std::size_t {
+  CheckShard(shard);
+  return offsets_[shard + 1U] - offsets_[shard];
+}
+
+auto HilbertPartition2D::GetShardIndices(std::size_t shard) const
+    -> const uint32_t* {
+  CheckShard(shard);
+  return order_.data() + offsets_[shard];
+}
+
+auto HilbertPartition2D::GetShardWeight(std::size_t shard) const -> double {
+  CheckShard(shard);
+  return weights_[shard];
+}
+
+auto HilbertPartition2D::Gather(const PointCloud2D& points, std::size_t shard,
+                                std::pmr::memory_resource* resource) const
+    -> PointCloud2D {
+  const auto* const kIndices = GetShardIndices(shard);
+  PointCloud2D gathered(GetShardSize(shard), resource);
+  for (std::size_t i = 0; i < gathered.Size(); ++i) {
+    gathered.GetXData()[i] = points.GetXData()[kIndices[i]];
+    gathered.GetYData()[i] = points.GetYData()[kIndices[i]];
+  }
+  return gathered;
+}
+
+auto HilbertPartition2D::CheckShard(std::size_t shard) const -> void {
+  if (shard >= GetShardCount()) {
+    throw std::out_of_range("Shard index is out of range");
+  }
+}
+}  // namespace Jeong0806::geometry
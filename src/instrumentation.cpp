@@ -0,0 +1,192 @@
+/**
+ * @file geometry/src/instrumentation.cpp
+ * @author Jeong Seong In (0806jsi@gmail.com)
+ * @brief Hot path counter and timer developments
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2023 Jeong0806, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/instrumentation.hpp"
+
+#include <atomic>
+
+namespace {
+using Jeong0806::geometry::Instrumentation;
+
+constexpr std::size_t kCacheLineSize{64U};
+constexpr std::size_t kCounterCount{Instrumentation::kCounterCount};
+constexpr std::size_t kTimerCount{Instrumentation::kTimerCount};
+
+constexpr std::string_view kCounterNames[kCounterCount] = {
+    "distance_calculations", "distance_conversions", "index_node_visits",
+    "index_point_tests",     "predicate_tests",      "predicate_fallbacks"};
+constexpr std::string_view kTimerNames[kTimerCount] = {
+    "kd_tree_build", "kd_tree_query",
+    "spatial_hash_grid_build", "spatial_hash_grid_query",
+    "distance_matrix", "convex_hull",
+    "closest_pair", "polyline_simplify",
+    "spatial_sort", "hilbert_partition",
+    "point_parse", "delaunay_build",
+    "delaunay_query", "polygon_index_build",
+    "polygon_classify"};
+
+template <std::size_t kSize>
+using Totals = std::array<std::atomic<uint64_t>, kSize>;
+
+/**
+ * @brief Totals of one thread, written only by that thread
+ */
+struct alignas(kCacheLineSize) Slot {
+  Totals<kCounterCount> counters{};  ///< By counter
+  Totals<kTimerCount> calls{};       ///< Calls by timer
+  Totals<kTimerCount> ticks{};       ///< Ticks by timer
+  std::atomic<bool> in_use{true};    ///< Whether a running thread owns it
+  Slot* next{nullptr};               ///< Slot pushed before this one
+};
+
+// Slots are never freed, so snapshots walk them without a lock
+std::atomic<Slot*> slots{nullptr};
+
+auto AcquireSlot() -> Slot* {
+  for (auto* slot = slots.load(std::memory_order_acquire); slot != nullptr;
+       slot = slot->next) {
+    auto expected = false;
+    if (slot->in_use.compare_exchange_strong(expected, true,
+                                             std::memory_order_acquire)) {
+      return slot;
+    }
+  }
+  auto* const kSlot = new Slot();
+  kSlot->next = slots.load(std::memory_order_relaxed);
+  while (!slots.compare_exchange_weak(kSlot->next, kSlot,
+                                      std::memory_order_release,
+                                      std::memory_order_relaxed)) {
+  }
+  return kSlot;
+}
+
+/**
+ * @brief Hands the slot of a thread on to later threads when it exits, the
+ * totals staying in the slot
+ */
+struct SlotOwner {
+  SlotOwner() = default;
+  SlotOwner(const SlotOwner& other) = delete;
+  SlotOwner(SlotOwner&& other) = delete;
+  ~SlotOwner() { slot->in_use.store(false, std::memory_order_release); }
+
+  auto operator=(const SlotOwner& other) -> SlotOwner& = delete;
+  auto operator=(SlotOwner&& other) -> SlotOwner& = delete;
+
+  Slot* slot{AcquireSlot()};  ///< The slot of the thread
+};
+
+auto GetThreadSlot() -> Slot& {
+  thread_local const SlotOwner kOwner;
+  return *kOwner.slot;
+}
+
+// The owning thread is the only writer, so a plain load and store suffice
+auto Increase(std::atomic<uint64_t>& total, uint64_t amount) -> void {
+  total.store(total.load(std::memory_order_relaxed) + amount,
+              std::memory_order_relaxed);
+}
+}  // namespace
+
+namespace Jeong0806::geometry {
+auto Instrumentation::Snapshot::Get(Counter counter) const -> uint64_t {
+  return counters[static_cast<std::size_t>(counter)];
+}
+
+auto Instrumentation::Snapshot::Get(Timer timer) const -> TimerValue {
+  return timers[static_cast<std::size_t>(timer)];
+}
+
+auto Instrumentation::Snapshot::operator-(const Snapshot& earlier) const
+    -> Snapshot {
+  Snapshot difference;
+  for (std::size_t i = 0; i < kCounterCount; ++i) {
+    difference.counters[i] = counters[i] - earlier.counters[i];
+  }
+  for (std::size_t i = 0; i < kTimerCount; ++i) {
+    difference.timers[i].calls = timers[i].calls - earlier.timers[i].calls;
+    difference.timers[i].ticks = timers[i].ticks - earlier.timers[i].ticks;
+  }
+  return difference;
+}
+
+auto Instrumentation::Snapshot::ToText() const -> std::string {
+  std::string text;
+  for (std::size_t i = 0; i < kCounterCount; ++i) {
+    text.append(kCounterNames[i]);
+    text += ' ' + std::to_string(counters[i]) + '\n';
+  }
+  for (std::size_t i = 0; i < kTimerCount; ++i) {
+    text.append(kTimerNames[i]);
+    text += " calls=" + std::to_string(timers[i].calls) +
+            " ticks=" + std::to_string(timers[i].ticks) + '\n';
+  }
+  return text;
+}
+
+auto Instrumentation::Snapshot::ToJson() const -> std::string {
+  std::string json = "{\"enabled\":";
+  json += kEnabled ? "true" : "false";
+  json += ",\"tick_unit\":\"";
+  json.append(kTickUnit);
+  json += "\",\"counters\":{";
+  for (std::size_t i = 0; i < kCounterCount; ++i) {
+    json += (i == 0U) ? "\"" : ",\"";
+    json.append(kCounterNames[i]);
+    json += "\":" + std::to_string(counters[i]);
+  }
+  json += "},\"timers\":{";
+  for (std::size_t i = 0; i < kTimerCount; ++i) {
+    json += (i == 0U) ? "\"" : ",\"";
+    json.append(kTimerNames[i]);
+    json += "\":{\"calls\":" + std::to_string(timers[i].calls) +
+            ",\"ticks\":" + std::to_string(timers[i].ticks) + '}';
+  }
+  json += "}}";
+  return json;
+}
+
+auto Instrumentation::TakeSnapshot() -> Snapshot {
+  Snapshot snapshot;
+  for (const auto* slot = slots.load(std::memory_order_acquire);
+       slot != nullptr; slot = slot->next) {
+    for (std::size_t i = 0; i < kCounterCount; ++i) {
+      snapshot.counters[i] +=
+          slot->counters[i].load(std::memory_order_relaxed);
+    }
+    for (std::size_t i = 0; i < kTimerCount; ++i) {
+      auto& timer = snapshot.timers[i];
+      timer.calls += slot->calls[i].load(std::memory_order_relaxed);
+      timer.ticks += slot->ticks[i].load(std::memory_order_relaxed);
+    }
+  }
+  return snapshot;
+}
+
+auto Instrumentation::GetName(Counter counter) -> std::string_view {
+  return kCounterNames[static_cast<std::size_t>(counter)];
+}
+
+auto Instrumentation::GetName(Timer timer) -> std::string_view {
+  return kTimerNames[static_cast<std::size_t>(timer)];
+}
+
+auto Instrumentation::Record(Counter counter, uint64_t count) -> void {
+  Increase(GetThreadSlot().counters[static_cast<std::size_t>(counter)], count);
+}
+
+auto Instrumentation::Record(Timer timer, uint64_t ticks) -> void {
+  auto& slot = GetThreadSlot();
+  Increase(slot.calls[static_cast<std::size_t>(timer)], 1U);
+  Increase(slot.ticks[static_cast<std::size_t>(timer)], ticks);
+}
+}  // namespace Jeong0806::geometry
@@ -0,0 +1,286 @@
+/**
+ * @file geometry/src/kd_tree2d.cpp
+ * @author Jeong Seong In (0806jsi@gmail.com)
+ * @brief Static k-d tree class developments over 2-dimension points
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2023 Jeong0806, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/kd_tree2d.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <queue>
+#include <stdexcept>
+
+#include "geometry/instrumentation.hpp"
+#include "geometry/parallel.hpp"
+
+namespace {
+// Deep enough for the height of a tree over 2^32 points
+constexpr std::size_t kMaxStackDepth{64U};
+
+struct Pending {
+  uint32_t node;
+  double bound_squared;
+};
+
+auto ToNeighbor(uint32_t index, double squared)
+    -> Jeong0806::geometry::Neighbor {
+  return Jeong0806::geometry::Neighbor{index, std::sqrt(squared)};
+}
+
+auto IsCloser(double lhs_squared, uint32_t lhs_index, double rhs_squared,
+              uint32_t rhs_index) -> bool {
+  return (lhs_squared < rhs_squared) ||
+         ((lhs_squared == rhs_squared) && (lhs_index < rhs_index));
+}
+}  // namespace
+
+namespace Jeong0806::geometry {
+KdTree2D::KdTree2D(const Point2D* points, std::size_t count,
+                   std::pmr::memory_resource* resource)
+    : nodes_(resource), xs_(resource), ys_(resource), indices_(resource) {
+  const Instrumentation::ScopedTimer kTimer(
+      Instrumentation::Timer::kKdTreeBuild);
+  if (count > std::numeric_limits<uint32_t>::max()) {
+    throw std::length_error("KdTree2D supports up to 2^32 - 1 points");
+  }
+  indices_.resize(count);
+  std::iota(indices_.begin(), indices_.end(), 0U);
+  if (count > 0U) {
+    nodes_.reserve((2U * count) / kLeafSize + 1U);
+    Build(points, 0U, static_cast<uint32_t>(count));
+  }
+
+  xs_.resize(count);
+  ys_.resize(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    xs_[i] = points[indices_[i]].GetX();
+    ys_[i] = points[indices_[i]].GetY();
+  }
+}
+
+KdTree2D::KdTree2D(const std::vector<Point2D>& points,
+                   std::pmr::memory_resource* resource)
+    : KdTree2D(points.data(), points.size(), resource) {}
+
+auto KdTree2D::Size() const -> std::size_t { return indices_.size(); }
+
+auto KdTree2D::Empty() const -> bool { return indices_.empty(); }
+
+auto KdTree2D::GetResource() const -> std::pmr::memory_resource* {
+  return indices_.get_allocator().resource();
+}
+
+auto KdTree2D::Build(const Point2D* points, uint32_t begin, uint32_t end)
+    -> void {
+  const auto kNode = nodes_.size();
+  nodes_.push_back(Node{0.0, begin, end, 0U, 0U});
+  if (end - begin <= kLeafSize) {
+    return;
+  }
+
+  auto min_x = std::numeric_limits<double>::infinity();
+  auto min_y = std::numeric_limits<double>::infinity();
+  auto max_x = -std::numeric_limits<double>::infinity();
+  auto max_y = -std::numeric_limits<double>::infinity();
+  for (auto i = begin; i < end; ++i) {
+    const auto& point = points[indices_[i]];
+    min_x = std::min(min_x, point.GetX());
+    max_x = std::max(max_x, point.GetX());
+    min_y = std::min(min_y, point.GetY());
+    max_y = std::max(max_y, point.GetY());
+  }
+  const auto kAxis = ((max_y - min_y) > (max_x - min_x)) ? 1U : 0U;
+  const auto kCoordinate = [points, kAxis](uint32_t index) {
+    return (kAxis == 0U) ? points[index].GetX() : points[index].GetY();
+  };
+
+  const auto kMiddle = begin + ((end - begin) / 2U);
+  std::nth_element(indices_.begin() + begin, indices_.begin() + kMiddle,
+                   indices_.begin() + end,
+                   [&kCoordinate](uint32_t lhs, uint32_t rhs) {
+                     return kCoordinate(lhs) < kCoordinate(rhs);
+                   });
+  nodes_[kNode].axis = kAxis;
+  nodes_[kNode].split = kCoordinate(indices_[kMiddle]);
+
+  Build(points, begin, kMiddle);
+  nodes_[kNode].right = static_cast<uint32_t>(nodes_.size());
+  Build(points, kMiddle, end);
+}
+
+template <typename Visitor>
+auto KdTree2D::Search(const Point2D& query, double& bound_squared,
+                      Visitor&& visit) const -> void {
+  if (nodes_.empty()) {
+    return;
+  }
+  const double kQuery[2] = {query.GetX(), query.GetY()};
+
+  Pending stack[kMaxStackDepth];
+  std::size_t depth = 0;
+  uint64_t visited_nodes = 0;
+  uint64_t tested_points = 0;
+  stack[depth++] = Pending{0U, 0.0};
+  while (depth > 0U) {
+    const auto kPending = stack[--depth];
+    if (kPending.bound_squared > bound_squared) {
+      continue;
+    }
+
+    auto node = kPending.node;
+    while (nodes_[node].right != 0U) {
+      ++visited_nodes;
+      const auto& inner = nodes_[node];
+      const auto kDiff = kQuery[inner.axis] - inner.split;
+      const auto kNear = (kDiff < 0.0) ? node + 1U : inner.right;
+      const auto kFar = (kDiff < 0.0) ? inner.right : node + 1U;
+      stack[depth++] = Pending{kFar, kDiff * kDiff};
+      node = kNear;
+    }
+
+    const auto& leaf = nodes_[node];
+    ++visited_nodes;
+    tested_points += leaf.end - leaf.begin;
+    for (auto i = leaf.begin; i < leaf.end; ++i) {
+      const auto kDx = xs_[i] - kQuery[0];
+      const auto kDy = ys_[i] - kQuery[1];
+      visit(indices_[i], (kDx * kDx) + (kDy * kDy));
+    }
+  }
+  Instrumentation::Add(Instrumentation::Counter::kIndexNodeVisits,
+                       visited_nodes);
+  Instrumentation::Add(Instrumentation::Counter::kIndexPointTests,
+                       tested_points);
+}
+
+auto KdTree2D::Nearest(const Point2D& query) const -> Neighbor {
+  if (Empty()) {
+    throw std::out_of_range("KdTree2D is empty");
+  }
+  auto best_squared = std::numeric_limits<double>::infinity();
+  auto best_index = std::numeric_limits<uint32_t>::max();
+  Search(query, best_squared, [&](uint32_t index, double squared) {
+    if (IsCloser(squared, index, best_squared, best_index)) {
+      best_squared = squared;
+      best_index = index;
+    }
+  });
+  return ToNeighbor(best_index, best_squared);
+}
+
+auto KdTree2D::KNearest(const Point2D& query, std::size_t k) const
+    -> std::vector<Neighbor> {
+  k = std::min(k, Size());
+  if (k == 0U) {
+    return {};
+  }
+
+  using Candidate = std::pair<double, uint32_t>;
+  std::vector<Candidate> storage;
+  storage.reserve(k);
+  std::priority_queue<Candidate> heap(std::less<Candidate>(),
+                                     std::move(storage));
+  auto bound_squared = std::numeric_limits<double>::infinity();
+  Search(query, bound_squared, [&](uint32_t index, double squared) {
+    if (heap.size() < k) {
+      heap.emplace(squared, index);
+    } else if (IsCloser(squared, index, heap.top().first,
+                        heap.top().second)) {
+      heap.pop();
+      heap.emplace(squared, index);
+    } else {
+      return;
+    }
+    if (heap.size() == k) {
+      bound_squared = heap.top().first;
+    }
+  });
+
+  std::vector<Neighbor> neighbors(heap.size());
+  for (auto i = neighbors.size(); i > 0U; --i) {
+    neighbors[i - 1U] = ToNeighbor(heap.top().second, heap.top().first);
+    heap.pop();
+  }
+  return neighbors;
+}
+
+auto KdTree2D::Radius(const Point2D& query, double radius) const
+    -> std::vector<Neighbor> {
+  std::vector<Neighbor> neighbors;
+  if (!(radius >= 0.0)) {
+    return neighbors;
+  }
+  auto bound_squared = radius * radius;
+  const auto kRadiusSquared = bound_squared;
+  Search(query, bound_squared, [&](uint32_t index, double squared) {
+    if (squared <= kRadiusSquared) {
+      neighbors.push_back(ToNeighbor(index, squared));
+    }
+  });
+  std::sort(neighbors.begin(), neighbors.end());
+  return neighbors;
+}
+
+auto KdTree2D::Nearest(const std::vector<Point2D>& queries,
+                       std::size_t thread_count, Executor* executor) const
+    -> std::vector<Neighbor> {
+  const Instrumentation::ScopedTimer kTimer(
+      Instrumentation::Timer::kKdTreeQuery);
+  if (Empty() && !queries.empty()) {
+    throw std::out_of_range("KdTree2D is empty");
+  }
+  std::vector<Neighbor> results(queries.size());
+  ParallelFor(
+      queries.size(),
+      [&](std::size_t begin, std::size_t end) {
+        for (auto i = begin; i < end; ++i) {
+          results[i] = Nearest(queries[i]);
+        }
+      },
+      thread_count, executor);
+  return results;
+}
+
+auto KdTree2D::KNearest(const std::vector<Point2D>& queries, std::size_t k,
+                        std::size_t thread_count, Executor* executor) const
+    -> std::vector<std::vector<Neighbor>> {
+  const Instrumentation::ScopedTimer kTimer(
+      Instrumentation::Timer::kKdTreeQuery);
+  std::vector<std::vector<Neighbor>> results(queries.size());
+  ParallelFor(
+      queries.size(),
+      [&](std::size_t begin, std::size_t end) {
+        for (auto i = begin; i < end; ++i) {
+          results[i] = KNearest(queries[i], k);
+        }
+      },
+      thread_count, executor);
+  return results;
+}
+
+auto KdTree2D::Radius(const std::vector<Point2D>& queries, double radius,
+                      std::size_t thread_count, Executor* executor) const
+    -> std::vector<std::vector<Neighbor>> {
+  const Instrumentation::ScopedTimer kTimer(
+      Instrumentation::Timer::kKdTreeQuery);
+  std::vector<std::vector<Neighbor>> results(queries.size());
+  ParallelFor(
+      queries.size(),
+      [&](std::size_t begin, std::size_t end) {
+        for (auto i = begin; i < end; ++i) {
+          results[i] = Radius(queries[i], radius);
+        }
+      },
+      thread_count, executor);
+  return results;
+}
+}  // namespace Jeong0806::geometry
@@ -0,0 +1,94 @@
+/**
+ * @file geometry/src/memory_resource.cpp
+ * @author Jeong Seong In (0806jsi@gmail.com)
+ * @brief Arena and allocation counting memory resource developments
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2023 Jeong0806, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/memory_resource.hpp"
+
+namespace Jeong0806::geometry {
+CountingMemoryResource::CountingMemoryResource(
+    std::pmr::memory_resource* upstream)
+    : upstream_(upstream) {}
+
+auto CountingMemoryResource::GetUpstream() const
+    -> std::pmr::memory_resource* {
+  return upstream_;
+}
+
+auto CountingMemoryResource::GetAllocationCount() const -> std::size_t {
+  return allocations_.load(std::memory_order_relaxed);
+}
+
+auto CountingMemoryResource::GetDeallocationCount() const -> std::size_t {
+  return deallocations_.load(std::memory_order_relaxed);
+}
+
+auto CountingMemoryResource::GetBytesInUse() const -> std::size_t {
+  return bytes_in_use_.load(std::memory_order_relaxed);
+}
+
+auto CountingMemoryResource::GetPeakBytes() const -> std::size_t {
+  return peak_bytes_.load(std::memory_order_relaxed);
+}
+
+auto CountingMemoryResource::ResetCounts() -> void {
+  allocations_.store(0U, std::memory_order_relaxed);
+  deallocations_.store(0U, std::memory_order_relaxed);
+  peak_bytes_.store(bytes_in_use_.load(std::memory_order_relaxed),
+                    std::memory_order_relaxed);
+}
+
+auto CountingMemoryResource::do_allocate(std::size_t bytes,
+                                         std::size_t alignment) -> void* {
+  auto* const kPointer = upstream_->allocate(bytes, alignment);
+  allocations_.fetch_add(1U, std::memory_order_relaxed);
+  const auto kInUse =
+      bytes_in_use_.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+  auto peak = peak_bytes_.load(std::memory_order_relaxed);
+  while ((peak < kInUse) && !peak_bytes_.compare_exchange_weak(
+                                peak, kInUse, std::memory_order_relaxed)) {
+  }
+  return kPointer;
+}
+
+auto CountingMemoryResource::do_deallocate(void* pointer, std::size_t bytes,
+                                           std::size_t alignment) -> void {
+  upstream_->deallocate(pointer, bytes, alignment);
+  deallocations_.fetch_add(1U, std::memory_order_relaxed);
+  bytes_in_use_.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+auto CountingMemoryResource::do_is_equal(
+    const std::pmr::memory_resource& other) const noexcept -> bool {
+  return this == &other;
+}
+
+Arena::Arena(std::size_t initial_size, std::pmr::memory_resource* upstream)
+    : buffer_(initial_size, upstream), pools_(&buffer_) {}
+
+auto Arena::Release() -> void {
+  pools_.release();
+  buffer_.release();
+}
+
+auto Arena::do_allocate(std::size_t bytes, std::size_t alignment) -> void* {
+  return pools_.allocate(bytes, alignment);
+}
+
+auto Arena::do_deallocate(void* pointer, std::size_t bytes,
+                          std::size_t alignment) -> void {
+  pools_.deallocate(pointer, bytes, alignment);
+}
+
+auto Arena::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+    -> bool {
+  return this == &other;
+}
+}  // namespace Jeong0806::geometry
@@ -0,0 +1,397 @@
+/**
+ * @file geometry/src/morton2d.cpp
+ * @author Jeong Seong In (0806jsi@gmail.com)
+ * @brief Morton code, grid quantization and spatial sort class developments
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2023 Jeong0806, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/morton2d.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <tuple>
+
+#include "geometry/instrumentation.hpp"
+#include "geometry/parallel.hpp"
+#include "geometry/simd.hpp"
+
+#if defined(Jeong0806_GEOMETRY_SIMD_X86)
+#include <immintrin.h>
+#endif
+
+namespace {
+using Jeong0806::geometry::Executor;
+using Jeong0806::geometry::Morton2D;
+using Jeong0806::geometry::Point2D;
+
+constexpr double kMaxCell{4294967295.0};
+constexpr uint64_t kEvenBits{0x5555555555555555ULL};
+constexpr uint64_t kOddBits{0xAAAAAAAAAAAAAAAAULL};
+constexpr uint32_t kRadixBits{8U};
+constexpr std::size_t kRadixSize{std::size_t{1} << kRadixBits};
+constexpr uint32_t kRadixPasses{64U / kRadixBits};
+
+using Histogram = std::array<std::size_t, kRadixSize>;
+
+// Parameters of MortonGrid2D passed to the code loops
+struct Grid {
+  double min_x{0.0};
+  double min_y{0.0};
+  double scale{0.0};
+};
+
+// NaN lands in cell zero
+auto QuantizeValue(double value, double min, double scale) -> uint32_t {
+  const auto kCell = (value - min) * scale;
+  if (kCell >= kMaxCell) {
+    return std::numeric_limits<uint32_t>::max();
+  }
+  return (kCell > 0.0) ? static_cast<uint32_t>(kCell) : 0U;
+}
+
+// coordinates(i) returns the x and y of point i
+template <typename Coordinates>
+auto CodesScalar(Coordinates coordinates, const Grid& grid, std::size_t begin,
+                 std::size_t end, uint64_t* codes) -> void {
+  for (auto i = begin; i < end; ++i) {
+    const auto [kX, kY] = coordinates(i);
+    codes[i] = Morton2D::Encode(QuantizeValue(kX, grid.min_x, grid.scale),
+                                QuantizeValue(kY, grid.min_y, grid.scale));
+  }
+}
+
+#if defined(Jeong0806_GEOMETRY_SIMD_X86)
+__attribute__((target("bmi2"))) auto EncodeBmi2(const uint32_t* xs,
+                                                const uint32_t* ys,
+                                                std::size_t count,
+                                                uint64_t* codes) -> void {
+  for (std::size_t i = 0; i < count; ++i) {
+    codes[i] = _pdep_u64(xs[i], kEvenBits) | _pdep_u64(ys[i], kOddBits);
+  }
+}
+
+__attribute__((target("bmi2"))) auto DecodeBmi2(const uint64_t* codes,
+                                                std::size_t count,
+                                                uint32_t* xs, uint32_t* ys)
+    -> void {
+  for (std::size_t i = 0; i < count; ++i) {
+    xs[i] = static_cast<uint32_t>(_pext_u64(codes[i], kEvenBits));
+    ys[i] = static_cast<uint32_t>(_pext_u64(codes[i], kOddBits));
+  }
+}
+
+template <typename Coordinates>
+__attribute__((target("bmi2"))) auto CodesBmi2(Coordinates coordinates,
+                                               const Grid& grid,
+                                               std::size_t begin,
+                                               std::size_t end,
+                                               uint64_t* codes) -> void {
+  for (auto i = begin; i < end; ++i) {
+    const auto [kX, kY] = coordinates(i);
+    codes[i] =
+        _pdep_u64(QuantizeValue(kX, grid.min_x, grid.scale), kEvenBits) |
+        _pdep_u64(QuantizeValue(kY, grid.min_y, grid.scale), kOddBits);
+  }
+}
+#endif
+
+// BMI2 came with AVX2, so forcing a narrower SIMD level also disables it
+auto UseBmi2() -> bool {
+#if defined(Jeong0806_GEOMETRY_SIMD_X86)
+  static const bool kSupported = [] {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("bmi2") != 0;
+  }();
+  const auto kLevel = Jeong0806::geometry::GetSimdLevel();
+  return kSupported && ((kLevel == Jeong0806::geometry::SimdLevel::kAvx2) ||
+                        (kLevel == Jeong0806::geometry::SimdLevel::kAvx512));
+#else
+  return false;
+#endif
+}
+
+template <typename Coordinates>
+auto FillCodes(Coordinates coordinates, const Grid& grid, std::size_t count,
+               uint64_t* codes, std::size_t thread_count, Executor* executor)
+    -> void {
+  const auto kBmi2 = UseBmi2();
+  Jeong0806::geometry::ParallelFor(
+      count,
+      [&](std::size_t begin, std::size_t end) {
+#if defined(Jeong0806_GEOMETRY_SIMD_X86)
+        if (kBmi2) {
+          CodesBmi2(coordinates, grid, begin, end, codes);
+          return;
+        }
+#endif
+        CodesScalar(coordinates, grid, begin, end, codes);
+      },
+      thread_count, executor);
+  static_cast<void>(kBmi2);
+}
+
+auto CheckCount(std::size_t count) -> void {
+  if (count > std::numeric_limits<uint32_t>::max()) {
+    throw std::length_error("Morton2D sorts up to 2^32 - 1 codes");
+  }
+}
+}  // namespace
+
+namespace Jeong0806::geometry {
+auto Morton2D::Encode(const uint32_t* xs, const uint32_t* ys,
+                      std::size_t count, uint64_t* codes) -> void {
+#if defined(Jeong0806_GEOMETRY_SIMD_X86)
+  if (UseBmi2()) {
+    EncodeBmi2(xs, ys, count, codes);
+    return;
+  }
+#endif
+  for (std::size_t i = 0; i < count; ++i) {
+    codes[i] = Encode(xs[i], ys[i]);
+  }
+}
+
+auto Morton2D::Decode(const uint64_t* codes, std::size_t count, uint32_t* xs,
+                      uint32_t* ys) -> void {
+#if defined(Jeong0806_GEOMETRY_SIMD_X86)
+  if (UseBmi2()) {
+    DecodeBmi2(codes, count, xs, ys);
+    return;
+  }
+#endif
+  for (std::size_t i = 0; i < count; ++i) {
+    std::tie(xs[i], ys[i]) = Decode(codes[i]);
+  }
+}
+
+auto Morton2D::SortOrder(const uint64_t* codes, std::size_t count,
+                         std::size_t thread_count, Executor* executor)
+    -> std::vector<uint32_t> {
+  const Instrumentation::ScopedTimer kTimer(
+      Instrumentation::Timer::kSpatialSort);
+  CheckCount(count);
+  std::vector<uint32_t> order(count);
+  std::iota(order.begin(), order.end(), 0U);
+  if (count <= kMinRadixSortSize) {
+    std::stable_sort(order.begin(), order.end(),
+                     [codes](uint32_t lhs, uint32_t rhs) {
+                       return codes[lhs] < codes[rhs];
+                     });
+    return order;
+  }
+
+  thread_count = ResolveThreadCount(thread_count, executor);
+  const auto kBlocks = std::max<std::size_t>(
+      std::min(thread_count, count / kMinParallelSortSize), 1U);
+  const auto kBound = [count, kBlocks](std::size_t block) {
+    return (count * block) / kBlocks;
+  };
+  std::vector<uint64_t> keys(codes, codes + count);
+  std::vector<uint64_t> sorted_keys(count);
+  std::vector<uint32_t> sorted_order(count);
+  std::vector<Histogram> histograms(kBlocks);
+
+  for (uint32_t pass = 0; pass < kRadixPasses; ++pass) {
+    const auto kShift = pass * kRadixBits;
+    const auto kDigit = [kShift](uint64_t key) {
+      return static_cast<std::size_t>((key >> kShift) & (kRadixSize - 1U));
+    };
+    ParallelFor(
+        kBlocks,
+        [&](std::size_t begin, std::size_t end) {
+          for (auto block = begin; block < end; ++block) {
+            auto& histogram = histograms[block];
+            histogram.fill(0U);
+            for (auto i = kBound(block); i < kBound(block + 1U); ++i) {
+              ++histogram[kDigit(keys[i])];
+            }
+          }
+        },
+        thread_count, executor);
+
+    // Blocks write each digit in block order, which keeps the sort stable
+    std::size_t offset = 0;
+    auto is_uniform = false;
+    for (std::size_t digit = 0; digit < kRadixSize; ++digit) {
+      const auto kDigitStart = offset;
+      for (auto& histogram : histograms) {
+        const auto kCount = histogram[digit];
+        histogram[digit] = offset;
+        offset += kCount;
+      }
+      is_uniform = is_uniform || (offset - kDigitStart == count);
+    }
+    if (is_uniform) {
+      continue;
+    }
+
+    ParallelFor(
+        kBlocks,
+        [&](std::size_t begin, std::size_t end) {
+          for (auto block = begin; block < end; ++block) {
+            auto& histogram = histograms[block];
+            for (auto i = kBound(block); i < kBound(block + 1U); ++i) {
+              const auto kPosition = histogram[kDigit(keys[i])]++;
+              sorted_keys[kPosition] = keys[i];
+              sorted_order[kPosition] = order[i];
+            }
+          }
+        },
+        thread_count, executor);
+    keys.swap(sorted_keys);
+    order.swap(sorted_order);
+  }
+  return order;
+}
+
+auto Morton2D::Sort(PointCloud2D& points, std::size_t thread_count,
+                    Executor* executor)
+    -> std::vector<uint32_t> {
+  CheckCount(points.Size());
+  const MortonGrid2D kGrid(points);
+  const auto kOrder =
+      SortOrder(kGrid.ComputeCodes(points, thread_count, executor).data(),
+                points.Size(), thread_count, executor);
+
+  PointCloud2D sorted(points.Size(), points.GetResource());
+  ParallelFor(
+      kOrder.size(),
+      [&](std::size_t begin, std::size_t end) {
+        for (auto i = begin; i < end; ++i) {
+          sorted.GetXData()[i] = points.GetXData()[kOrder[i]];
+          sorted.GetYData()[i] = points.GetYData()[kOrder[i]];
+        }
+      },
+      thread_count, executor);
+  points = std::move(sorted);
+  return kOrder;
+}
+
+auto Morton2D::Sort(std::vector<Point2D>& points, std::size_t thread_count,
+                    Executor* executor)
+    -> std::vector<uint32_t> {
+  CheckCount(points.size());
+  const MortonGrid2D kGrid(points.data(), points.size());
+  std::vector<uint64_t> codes(points.size());
+  kGrid.ComputeCodes(points.data(), points.size(), codes.data(), thread_count,
+                     executor);
+  const auto kOrder =
+      SortOrder(codes.data(), codes.size(), thread_count, executor);
+  Permute(kOrder, points);
+  return kOrder;
+}
+
+MortonGrid2D::MortonGrid2D(const Point2D& min, const Point2D& max)
+    : min_x_(min.GetX()), min_y_(min.GetY()) {
+  if (!std::isfinite(min.GetX()) || !std::isfinite(min.GetY()) ||
+      !std::isfinite(max.GetX()) || !std::isfinite(max.GetY())) {
+    throw std::invalid_argument("Grid corners must be finite");
+  }
+  if ((max.GetX() < min.GetX()) || (max.GetY() < min.GetY())) {
+    throw std::invalid_argument("Grid max must not be below min");
+  }
+  const auto kExtent =
+      std::max(max.GetX() - min.GetX(), max.GetY() - min.GetY());
+  scale_ = (kExtent > 0.0) ? kMaxCell / kExtent : 0.0;
+}
+
+MortonGrid2D::MortonGrid2D(const Point2D* points, std::size_t count) {
+  if (count == 0U) {
+    return;
+  }
+  auto min = points[0];
+  auto max = points[0];
+  for (std::size_t i = 0; i < count; ++i) {
+    min = Point2D(std::min(min.GetX(), points[i].GetX()),
+                  std::min(min.GetY(), points[i].GetY()));
+    max = Point2D(std::max(max.GetX(), points[i].GetX()),
+                  std::max(max.GetY(), points[i].GetY()));
+    if (!std::isfinite(points[i].GetX()) || !std::isfinite(points[i].GetY())) {
+      throw std::invalid_argument("Grid corners must be finite");
+    }
+  }
+  *this = MortonGrid2D(min, max);
+}
+
+MortonGrid2D::MortonGrid2D(const PointCloud2D& points) {
+  if (points.Empty()) {
+    return;
+  }
+  const auto [kMinX, kMaxX] = std::minmax_element(
+      points.GetXData(), points.GetXData() + points.Size());
+  const auto [kMinY, kMaxY] = std::minmax_element(
+      points.GetYData(), points.GetYData() + points.Size());
+  const auto kIsFinite = [](double value) { return std::isfinite(value); };
+  if (!std::all_of(points.GetXData(), points.GetXData() + points.Size(),
+                   kIsFinite) ||
+      !std::all_of(points.GetYData(), points.GetYData() + points.Size(),
+                   kIsFinite)) {
+    throw std::invalid_argument("Grid corners must be finite");
+  }
+  *this = MortonGrid2D(Point2D(*kMinX, *kMinY), Point2D(*kMaxX, *kMaxY));
+}
+
+auto MortonGrid2D::GetMin() const -> Point2D {
+  return Point2D(min_x_, min_y_);
+}
+
+auto MortonGrid2D::GetCellSize() const -> double {
+  return (scale_ > 0.0) ? 1.0 / scale_ : 0.0;
+}
+
+auto MortonGrid2D::Quantize(const Point2D& point) const
+    -> std::pair<uint32_t, uint32_t> {
+  return {QuantizeValue(point.GetX(), min_x_, scale_),
+          QuantizeValue(point.GetY(), min_y_, scale_)};
+}
+
+auto MortonGrid2D::GetCode(const Point2D& point) const -> uint64_t {
+  const auto [kX, kY] = Quantize(point);
+  return Morton2D::Encode(kX, kY);
+}
+
+auto MortonGrid2D::GetCellMin(uint64_t code) const -> Point2D {
+  const auto [kX, kY] = Morton2D::Decode(code);
+  return Point2D(min_x_ + (kX * GetCellSize()), min_y_ + (kY * GetCellSize()));
+}
+
+auto MortonGrid2D::ComputeCodes(const double* xs, const double* ys,
+                                std::size_t count, uint64_t* codes,
+                                std::size_t thread_count,
+                                Executor* executor) const
+    -> void {
+  FillCodes(
+      [xs, ys](std::size_t i) { return std::make_pair(xs[i], ys[i]); },
+      Grid{min_x_, min_y_, scale_}, count, codes, thread_count, executor);
+}
+
+auto MortonGrid2D::ComputeCodes(const Point2D* points, std::size_t count,
+                                uint64_t* codes,
+                                std::size_t thread_count,
+                                Executor* executor) const
+    -> void {
+  FillCodes(
+      [points](std::size_t i) {
+        return std::make_pair(points[i].GetX(), points[i].GetY());
+      },
+      Grid{min_x_, min_y_, scale_}, count, codes, thread_count, executor);
+}
+
+auto MortonGrid2D::ComputeCodes(const PointCloud2D& points,
+                                std::size_t thread_count,
+                                Executor* executor) const
+    -> std::vector<uint64_t> {
+  std::vector<uint64_t> codes(points.Size());
+  ComputeCodes(points.GetXData(), points.GetYData(), points.Size(),
+               codes.data(), thread_count, executor);
+  return codes;
+}
+}  // namespace Jeong0806::geometry
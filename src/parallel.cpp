@@ -0,0 +1,276 @@
+/**
+ * @file geometry/src/parallel.cpp
+ * @author Jeong Seong In (0806jsi@gmail.com)
+ * @brief Executor, thread pool and parallel loop developments for batch
+ * geometry operations
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2023 Jeong0806, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/parallel.hpp"
+
+#include <atomic>
+#include <exception>
+#include <stdexcept>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace {
+using Jeong0806::geometry::Executor;
+using Jeong0806::geometry::ThreadPool;
+
+// Pool and queue of the worker running on this thread, if any
+thread_local const ThreadPool* current_pool = nullptr;
+thread_local std::size_t current_queue = 0;
+
+std::atomic<Executor*> default_executor{nullptr};
+
+// Never destroyed, so batch operations stay usable from static destructors
+auto GetLibraryPool() -> ThreadPool* {
+  static auto* const kPool = new ThreadPool();
+  return kPool;
+}
+
+#if defined(__linux__)
+auto CheckCpus(const std::vector<std::size_t>& cpus) -> void {
+  if (cpus.empty()) {
+    return;
+  }
+  cpu_set_t available;
+  CPU_ZERO(&available);
+  if (sched_getaffinity(0, sizeof(available), &available) != 0) {
+    throw std::runtime_error("Failed to get the CPUs of the process");
+  }
+  for (const auto kCpu : cpus) {
+    if ((kCpu >= CPU_SETSIZE) || !CPU_ISSET(kCpu, &available)) {
+      throw std::invalid_argument("CPU is not available to the process");
+    }
+  }
+}
+
+auto PinThread(std::thread& thread, std::size_t cpu) -> void {
+  cpu_set_t cpus;
+  CPU_ZERO(&cpus);
+  CPU_SET(cpu, &cpus);
+  // The CPU was checked, a failure only leaves the thread unpinned
+  static_cast<void>(
+      pthread_setaffinity_np(thread.native_handle(), sizeof(cpus), &cpus));
+}
+#endif
+}  // namespace
+
+namespace Jeong0806::geometry {
+/**
+ * @brief Tasks of one Run() call
+ */
+struct ThreadPool::Batch {
+  const std::function<void(std::size_t)>* task;  ///< The task
+  std::atomic<std::size_t> remaining;            ///< Unfinished tasks
+  std::mutex error_mutex;                        ///< Guards error
+  std::exception_ptr error;                      ///< First exception
+};
+
+auto GetDefaultThreadCount() -> std::size_t {
+  return std::max<std::size_t>(std::thread::hardware_concurrency(), 1U);
+}
+
+ThreadPool::ThreadPool(std::size_t thread_count,
+                       const std::vector<std::size_t>& cpus)
+    : thread_count_((thread_count == 0U) ? GetDefaultThreadCount()
+                                         : thread_count) {
+#if defined(__linux__)
+  CheckCpus(cpus);
+#endif
+  for (std::size_t i = 1; i < thread_count_; ++i) {
+    queues_.push_back(std::make_unique<Queue>());
+  }
+  try {
+    workers_.reserve(queues_.size());
+    for (std::size_t i = 0; i < queues_.size(); ++i) {
+      workers_.emplace_back([this, i] { Work(i); });
+#if defined(__linux__)
+      if (!cpus.empty()) {
+        PinThread(workers_.back(), cpus[i % cpus.size()]);
+      }
+#endif
+    }
+  } catch (...) {
+    Stop();
+    throw;
+  }
+  static_cast<void>(cpus);
+}
+
+ThreadPool::~ThreadPool() { Stop(); }
+
+auto ThreadPool::GetThreadCount() const -> std::size_t {
+  return thread_count_;
+}
+
+auto ThreadPool::Run(std::size_t task_count,
+                     const std::function<void(std::size_t)>& task) -> void {
+  if (task_count == 0U) {
+    return;
+  }
+  Batch batch{&task, {task_count}, {}, {}};
+  const auto kOwn = (current_pool == this);
+  auto queue = kOwn ? current_queue : 0U;
+  if (!queues_.empty() && (task_count > 1U)) {
+    {
+      // A worker keeps the tasks for itself until others steal them, other
+      // threads spread them over the workers
+      const std::lock_guard<std::mutex> kLock(mutex_);
+      if (!kOwn) {
+        queue = next_queue_;
+        next_queue_ = (next_queue_ + 1U) % queues_.size();
+      }
+      for (std::size_t i = 1; i < task_count; ++i) {
+        auto& target = *queues_[kOwn ? queue : (queue + i) % queues_.size()];
+        const std::lock_guard<std::mutex> kQueueLock(target.mutex);
+        target.tasks.push_back(Task{&batch, i});
+      }
+      pending_ += task_count - 1U;
+    }
+    wake_.notify_all();
+    Execute(Task{&batch, 0U});
+  } else {
+    for (std::size_t i = 0; i < task_count; ++i) {
+      Execute(Task{&batch, i});
+    }
+  }
+
+  // Help with queued tasks, of any batch, until the batch finished
+  Task other;
+  while (batch.remaining.load(std::memory_order_acquire) > 0U) {
+    if (TakeTask(queue, kOwn, other)) {
+      Execute(other);
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    wake_.wait(lock, [this, &batch] {
+      return (pending_ > 0U) ||
+             (batch.remaining.load(std::memory_order_acquire) == 0U);
+    });
+  }
+  if (batch.error) {
+    std::rethrow_exception(batch.error);
+  }
+}
+
+auto ThreadPool::TakeTask(std::size_t queue, bool own, Task& task) -> bool {
+  for (std::size_t i = 0; i < queues_.size(); ++i) {
+    auto& source = *queues_[(queue + i) % queues_.size()];
+    {
+      const std::lock_guard<std::mutex> kLock(source.mutex);
+      if (source.tasks.empty()) {
+        continue;
+      }
+      if (own && (i == 0U)) {
+        task = source.tasks.back();
+        source.tasks.pop_back();
+      } else {
+        task = source.tasks.front();
+        source.tasks.pop_front();
+      }
+    }
+    const std::lock_guard<std::mutex> kLock(mutex_);
+    --pending_;
+    return true;
+  }
+  return false;
+}
+
+auto ThreadPool::Execute(const Task& task) -> void {
+  auto& batch = *task.batch;
+  try {
+    (*batch.task)(task.index);
+  } catch (...) {
+    const std::lock_guard<std::mutex> kLock(batch.error_mutex);
+    if (!batch.error) {
+      batch.error = std::current_exception();
+    }
+  }
+  // The caller of Run() may destroy the batch once the count reaches zero
+  if (batch.remaining.fetch_sub(1U, std::memory_order_acq_rel) == 1U) {
+    const std::lock_guard<std::mutex> kLock(mutex_);
+    wake_.notify_all();
+  }
+}
+
+auto ThreadPool::Work(std::size_t queue) -> void {
+  current_pool = this;
+  current_queue = queue;
+  Task task;
+  while (true) {
+    if (TakeTask(queue, true, task)) {
+      Execute(task);
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    wake_.wait(lock, [this] { return stop_ || (pending_ > 0U); });
+    if (stop_) {
+      return;
+    }
+  }
+}
+
+auto ThreadPool::Stop() -> void {
+  {
+    const std::lock_guard<std::mutex> kLock(mutex_);
+    stop_ = true;
+  }
+  wake_.notify_all();
+  for (auto& worker : workers_) {
+    worker.join();
+  }
+  workers_.clear();
+}
+
+auto GetDefaultExecutor() -> Executor* {
+  auto* const kExecutor = default_executor.load(std::memory_order_acquire);
+  return (kExecutor != nullptr) ? kExecutor : GetLibraryPool();
+}
+
+auto SetDefaultExecutor(Executor* executor) -> Executor* {
+  auto* const kPrevious =
+      default_executor.exchange(executor, std::memory_order_acq_rel);
+  return (kPrevious != nullptr) ? kPrevious : GetLibraryPool();
+}
+
+auto ResolveThreadCount(std::size_t thread_count, Executor* executor)
+    -> std::size_t {
+  if (thread_count != 0U) {
+    return thread_count;
+  }
+  if (executor == nullptr) {
+    executor = GetDefaultExecutor();
+  }
+  return std::max<std::size_t>(executor->GetThreadCount(), 1U);
+}
+
+auto ParallelFor(std::size_t count,
+                 const std::function<void(std::size_t, std::size_t)>& body,
+                 std::size_t thread_count, Executor* executor) -> void {
+  if (count == 0U) {
+    return;
+  }
+  if (executor == nullptr) {
+    executor = GetDefaultExecutor();
+  }
+  thread_count = std::min(ResolveThreadCount(thread_count, executor), count);
+  if (thread_count == 1U) {
+    body(0U, count);
+    return;
+  }
+  executor->Run(thread_count, [&](std::size_t range) {
+    body((count * range) / thread_count, (count * (range + 1U)) / thread_count);
+  });
+}
+}  // namespace Jeong0806::geometry
@@ -14,57 +14,21 @@
 
 #include <cmath>
 
-namespace Jeong0806::geometry {
-Point2D::Point2D(double x, double y) : x_(x), y_(y) {}
-
-auto Point2D::CalculateDistance(const Point2D& target) const -> double {
-  return Point2D::CalculateDistance(*this, target);
-}
-
-auto Point2D::CalculateDistance(const Point2D& lhs, const Point2D& rhs)
-    -> double {
-  return std::sqrt(std::pow((lhs.x_ - rhs.x_), 2.0) +
-                   std::pow((lhs.y_ - rhs.y_), 2.0));
-}
-
-auto Point2D::GetX() const -> double { return x_; }
-
-auto Point2D::GetY() const -> double { return y_; }
-
-auto Point2D::SetX(double x) -> void { x_ = x; }
-auto Point2D::SetY(double y) -> void { y_ = y; }
-
-auto Point2D::operator+(const Point2D& other) const -> Point2D {
-  return Point2D(x_ + other.x_, y_ + other.y_);
-}
+#include "geometry/instrumentation.hpp"
 
-auto Point2D::operator-(const Point2D& other) const -> Point2D {
-  return Point2D(x_ - other.x_, y_ - other.y_);
-}
-
-auto Point2D::operator+=(const Point2D& other) -> void {
-  x_ += other.x_;
-  y_ += other.y_;
-}
-
-auto Point2D::operator-=(const Point2D& other) -> void {
-  x_ -= other.x_;
-  y_ -= other.y_;
-}
-
-auto Point2D::operator*(double scalar) const -> Point2D {
-  return Point2D(x_ * scalar, y_ * scalar);
-}
-
-auto Point2D::operator/(double scalar) const -> Point2D {
-  return Point2D(x_ / scalar, y_ / scalar);
+namespace Jeong0806::geometry {
+template <typename T>
+auto BasicPoint2<T>::CalculateDistance(const BasicPoint2& target) const -> T {
+  return BasicPoint2::CalculateDistance(*this, target);
 }
 
-auto Point2D::operator==(const Point2D& other) const -> bool {
-  return (x_ == other.x_) && (y_ == other.y_);
+template <typename T>
+auto BasicPoint2<T>::CalculateDistance(const BasicPoint2& lhs,
+                                       const BasicPoint2& rhs) -> T {
+  Instrumentation::Add(Instrumentation::Counter::kDistanceCalculations);
+  return std::sqrt(CalculateSquaredDistance(lhs, rhs));
 }
 
-auto Point2D::operator!=(const Point2D& other) const -> bool{
-  return (x_ != other.x_) || (y_ != other.y_);
-}
+template class BasicPoint2<float>;
+template class BasicPoint2<double>;
 }  // namespace Jeong0806::geometry
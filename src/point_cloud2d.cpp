@@ -0,0 +1,256 @@
+/**
+ * @file geometry/src/point_cloud2d.cpp
+ * @author Jeong Seong In (0806jsi@gmail.com)
+ * @brief Point cloud class developments with structure-of-arrays layout
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2023 Jeong0806, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/point_cloud2d.hpp"
+
+#include <stdexcept>
+
+#include "geometry/distance_kernels.hpp"
+
+namespace {
+template <typename T>
+auto CheckSameSize(const Jeong0806::geometry::BasicPointCloud2<T>& lhs,
+                   const Jeong0806::geometry::BasicPointCloud2<T>& rhs)
+    -> void {
+  if (lhs.Size() != rhs.Size()) {
+    throw std::invalid_argument("Point clouds have different sizes");
+  }
+}
+}  // namespace
+
+namespace Jeong0806::geometry {
+template <typename T>
+BasicPointCloud2<T>::BasicPointCloud2(std::size_t size,
+                                      std::pmr::memory_resource* resource)
+    : xs_(size, resource), ys_(size, resource) {}
+
+template <typename T>
+BasicPointCloud2<T>::BasicPointCloud2(const BasicPoint2<T>* points,
+                                      std::size_t count,
+                                      std::pmr::memory_resource* resource)
+    : xs_(resource), ys_(resource) {
+  Append(points, count);
+}
+
+template <typename T>
+BasicPointCloud2<T>::BasicPointCloud2(
+    const std::vector<BasicPoint2<T>>& points,
+    std::pmr::memory_resource* resource)
+    : BasicPointCloud2(points.data(), points.size(), resource) {}
+
+template <typename T>
+auto BasicPointCloud2<T>::Size() const -> std::size_t {
+  return xs_.size();
+}
+
+template <typename T>
+auto BasicPointCloud2<T>::Empty() const -> bool {
+  return xs_.empty();
+}
+
+template <typename T>
+auto BasicPointCloud2<T>::GetResource() const -> std::pmr::memory_resource* {
+  return xs_.get_allocator().resource();
+}
+
+template <typename T>
+auto BasicPointCloud2<T>::Reserve(std::size_t capacity) -> void {
+  xs_.reserve(capacity);
+  ys_.reserve(capacity);
+}
+
+template <typename T>
+auto BasicPointCloud2<T>::Resize(std::size_t size) -> void {
+  xs_.resize(size);
+  ys_.resize(size);
+}
+
+template <typename T>
+auto BasicPointCloud2<T>::Clear() -> void {
+  xs_.clear();
+  ys_.clear();
+}
+
+template <typename T>
+auto BasicPointCloud2<T>::PushBack(const BasicPoint2<T>& point) -> void {
+  xs_.push_back(point.GetX());
+  ys_.push_back(point.GetY());
+}
+
+template <typename T>
+auto BasicPointCloud2<T>::Append(const BasicPoint2<T>* points,
+                                 std::size_t count) -> void {
+  const auto kOffset = xs_.size();
+  Resize(kOffset + count);
+  for (std::size_t i = 0; i < count; ++i) {
+    xs_[kOffset + i] = points[i].GetX();
+    ys_[kOffset + i] = points[i].GetY();
+  }
+}
+
+template <typename T>
+auto BasicPointCloud2<T>::GetPoint(std::size_t index) const
+    -> BasicPoint2<T> {
+  return BasicPoint2<T>(xs_.at(index), ys_.at(index));
+}
+
+template <typename T>
+auto BasicPointCloud2<T>::SetPoint(std::size_t index,
+                                   const BasicPoint2<T>& point) -> void {
+  xs_.at(index) = point.GetX();
+  ys_.at(index) = point.GetY();
+}
+
+template <typename T>
+auto BasicPointCloud2<T>::GetXData() const -> const T* {
+  return xs_.data();
+}
+
+template <typename T>
+auto BasicPointCloud2<T>::GetYData() const -> const T* {
+  return ys_.data();
+}
+
+template <typename T>
+auto BasicPointCloud2<T>::GetXData() -> T* {
+  return xs_.data();
+}
+
+template <typename T>
+auto BasicPointCloud2<T>::GetYData() -> T* {
+  return ys_.data();
+}
+
+template <typename T>
+auto BasicPointCloud2<T>::CopyTo(BasicPoint2<T>* output) const -> void {
+  for (std::size_t i = 0; i < xs_.size(); ++i) {
+    output[i] = BasicPoint2<T>(xs_[i], ys_[i]);
+  }
+}
+
+template <typename T>
+auto BasicPointCloud2<T>::ToPoints() const -> std::vector<BasicPoint2<T>> {
+  std::vector<BasicPoint2<T>> points(xs_.size());
+  CopyTo(points.data());
+  return points;
+}
+
+template <typename T>
+auto BasicPointCloud2<T>::CalculateDistances(const BasicPoint2<T>& origin,
+                                             T* output) const -> void {
+  kernel::CalculateDistances(xs_.data(), ys_.data(), xs_.size(),
+                             origin.GetX(), origin.GetY(), output);
+}
+
+template <typename T>
+auto BasicPointCloud2<T>::CalculateDistances(
+    const BasicPoint2<T>& origin) const -> std::vector<T> {
+  std::vector<T> distances(xs_.size());
+  CalculateDistances(origin, distances.data());
+  return distances;
+}
+
+template <typename T>
+auto BasicPointCloud2<T>::CalculateSquaredDistances(
+    const BasicPoint2<T>& origin, T* output) const -> void {
+  kernel::CalculateSquaredDistances(xs_.data(), ys_.data(), xs_.size(),
+                                    origin.GetX(), origin.GetY(), output);
+}
+
+template <typename T>
+auto BasicPointCloud2<T>::CalculateSquaredDistances(
+    const BasicPoint2<T>& origin) const -> std::vector<T> {
+  std::vector<T> distances(xs_.size());
+  CalculateSquaredDistances(origin, distances.data());
+  return distances;
+}
+
+template <typename T>
+auto BasicPointCloud2<T>::CalculatePairwiseDistances(
+    const BasicPointCloud2& lhs, const BasicPointCloud2& rhs, T* output)
+    -> void {
+  CheckSameSize(lhs, rhs);
+  kernel::CalculatePairwiseDistances(lhs.xs_.data(), lhs.ys_.data(),
+                                     rhs.xs_.data(), rhs.ys_.data(),
+                                     lhs.Size(), output);
+}
+
+template <typename T>
+auto BasicPointCloud2<T>::CalculatePairwiseDistances(
+    const BasicPointCloud2& lhs, const BasicPointCloud2& rhs)
+    -> std::vector<T> {
+  CheckSameSize(lhs, rhs);
+  std::vector<T> distances(lhs.Size());
+  CalculatePairwiseDistances(lhs, rhs, distances.data());
+  return distances;
+}
+
+template <typename T>
+auto BasicPointCloud2<T>::CalculatePairwiseSquaredDistances(
+    const BasicPointCloud2& lhs, const BasicPointCloud2& rhs, T* output)
+    -> void {
+  CheckSameSize(lhs, rhs);
+  kernel::CalculatePairwiseSquaredDistances(lhs.xs_.data(), lhs.ys_.data(),
+                                            rhs.xs_.data(), rhs.ys_.data(),
+                                            lhs.Size(), output);
+}
+
+template <typename T>
+auto BasicPointCloud2<T>::CalculatePairwiseSquaredDistances(
+    const BasicPointCloud2& lhs, const BasicPointCloud2& rhs)
+    -> std::vector<T> {
+  CheckSameSize(lhs, rhs);
+  std::vector<T> distances(lhs.Size());
+  CalculatePairwiseSquaredDistances(lhs, rhs, distances.data());
+  return distances;
+}
+
+template <typename T>
+auto BasicPointCloud2<T>::IsWithin(const BasicPoint2<T>& origin, T radius,
+                                   uint8_t* output) const -> std::size_t {
+  return kernel::IsWithin(xs_.data(), ys_.data(), Size(), origin.GetX(),
+                          origin.GetY(), radius, output);
+}
+
+template <typename T>
+auto BasicPointCloud2<T>::IsWithin(const BasicPoint2<T>& origin,
+                                   T radius) const -> std::vector<uint8_t> {
+  std::vector<uint8_t> flags(Size());
+  IsWithin(origin, radius, flags.data());
+  return flags;
+}
+
+template <typename T>
+auto BasicPointCloud2<T>::CompareDistances(const BasicPointCloud2& lhs,
+                                           const BasicPointCloud2& rhs,
+                                           const BasicPoint2<T>& origin,
+                                           int8_t* output) -> void {
+  CheckSameSize(lhs, rhs);
+  kernel::CompareDistances(lhs.xs_.data(), lhs.ys_.data(), rhs.xs_.data(),
+                           rhs.ys_.data(), lhs.Size(), origin.GetX(),
+                           origin.GetY(), output);
+}
+
+template <typename T>
+auto BasicPointCloud2<T>::CompareDistances(const BasicPointCloud2& lhs,
+                                           const BasicPointCloud2& rhs,
+                                           const BasicPoint2<T>& origin)
+    -> std::vector<int8_t> {
+  CheckSameSize(lhs, rhs);
+  std::vector<int8_t> results(lhs.Size());
+  CompareDistances(lhs, rhs, origin, results.data());
+  return results;
+}
+
+template class BasicPointCloud2<float>;
+template class BasicPointCloud2<double>;
+}  // namespace Jeong0806::geometry
@@ -0,0 +1,362 @@
+/**
+ * @file geometry/src/point_file.cpp
+ * @author Jeong Seong In (0806jsi@gmail.com)
+ * @brief Binary point file format, streaming writer and mapped reader
+ * developments
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2023 Jeong0806, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/point_file.hpp"
+
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define Jeong0806_GEOMETRY_POINT_FILE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+using Jeong0806::geometry::Distance;
+using Jeong0806::geometry::PointFileHeader;
+
+constexpr std::size_t kValueBytes{sizeof(uint64_t)};
+constexpr uint64_t kHashSeed{0xCBF29CE484222325U};
+constexpr uint64_t kHashPrime{0x100000001B3U};
+// Column order of the running checksums
+constexpr std::size_t kXColumn{0U};
+constexpr std::size_t kYColumn{1U};
+constexpr std::size_t kXNanometerColumn{2U};
+constexpr std::size_t kYNanometerColumn{3U};
+
+// FNV-1a over 64-bit words, one multiply per value
+auto HashColumn(uint64_t hash, const void* data, std::size_t count)
+    -> uint64_t {
+  const auto* bytes = static_cast<const unsigned char*>(data);
+  for (std::size_t i = 0; i < count; ++i) {
+    uint64_t word = 0U;
+    std::memcpy(&word, bytes + (i * kValueBytes), kValueBytes);
+    hash = (hash ^ word) * kHashPrime;
+  }
+  return hash;
+}
+
+auto CombineChecksums(const std::array<uint64_t, 4>& checksums) -> uint64_t {
+  return HashColumn(kHashSeed, checksums.data(), checksums.size());
+}
+
+auto AlignUp(uint64_t offset) -> uint64_t {
+  constexpr uint64_t kAlignment{Jeong0806::geometry::kPointFileAlignment};
+  return (offset + kAlignment - 1U) / kAlignment * kAlignment;
+}
+
+auto MakeHeader(std::size_t count, Distance::DistanceType unit,
+                bool with_nanometers) -> PointFileHeader {
+  const auto kColumnBytes = static_cast<uint64_t>(count) * kValueBytes;
+  PointFileHeader header;
+  header.version = Jeong0806::geometry::kPointFileVersion;
+  header.byte_order = Jeong0806::geometry::kPointFileByteOrder;
+  header.count = count;
+  header.unit = static_cast<uint32_t>(unit);
+  header.x_offset = AlignUp(sizeof(PointFileHeader));
+  header.y_offset = AlignUp(header.x_offset + kColumnBytes);
+  if (with_nanometers) {
+    header.flags = Jeong0806::geometry::kPointFileHasNanometers;
+    header.x_nanometer_offset = AlignUp(header.y_offset + kColumnBytes);
+    header.y_nanometer_offset =
+        AlignUp(header.x_nanometer_offset + kColumnBytes);
+  }
+  return header;
+}
+
+auto CheckColumn(uint64_t offset, uint64_t count, std::size_t size) -> void {
+  if ((offset % Jeong0806::geometry::kPointFileAlignment != 0U) ||
+      (offset < sizeof(PointFileHeader)) || (offset > size) ||
+      (count > (size - offset) / kValueBytes)) {
+    throw std::runtime_error("Point file column is out of bounds");
+  }
+}
+
+auto CheckHeader(const PointFileHeader& header, std::size_t size) -> void {
+  if (header.magic != Jeong0806::geometry::kPointFileMagic) {
+    throw std::runtime_error("Not a point file or incomplete point file");
+  }
+  if (header.version != Jeong0806::geometry::kPointFileVersion) {
+    throw std::runtime_error("Unsupported point file version");
+  }
+  if (header.byte_order != Jeong0806::geometry::kPointFileByteOrder) {
+    throw std::runtime_error("Point file byte order does not match");
+  }
+  if (header.unit >
+      static_cast<uint32_t>(Distance::DistanceType::kNanometer)) {
+    throw std::runtime_error("Point file unit is invalid");
+  }
+  CheckColumn(header.x_offset, header.count, size);
+  CheckColumn(header.y_offset, header.count, size);
+  if ((header.flags & Jeong0806::geometry::kPointFileHasNanometers) != 0U) {
+    CheckColumn(header.x_nanometer_offset, header.count, size);
+    CheckColumn(header.y_nanometer_offset, header.count, size);
+  }
+}
+}  // namespace
+
+namespace Jeong0806::geometry {
+PointFileWriter::PointFileWriter(const std::string& path, std::size_t count,
+                                 Distance::DistanceType unit,
+                                 bool with_nanometers)
+    : file_(path, std::ios::binary | std::ios::trunc),
+      header_(MakeHeader(count, unit, with_nanometers)) {
+  checksums_.fill(kHashSeed);
+  // The zero magic marks the file incomplete until Close()
+  const PointFileHeader kPlaceholder;
+  file_.write(reinterpret_cast<const char*>(&kPlaceholder),
+              sizeof(kPlaceholder));
+  if (!file_) {
+    throw std::runtime_error("Cannot create point file " + path);
+  }
+  xs_.reserve(kChunkSize);
+  ys_.reserve(kChunkSize);
+  if (with_nanometers) {
+    x_nanometers_.reserve(kChunkSize);
+    y_nanometers_.reserve(kChunkSize);
+  }
+}
+
+PointFileWriter::~PointFileWriter() {
+  try {
+    Close();
+  } catch (...) {
+    // The file keeps its zero magic and no reader accepts it
+  }
+}
+
+auto PointFileWriter::Push(const Point2D& point) -> void {
+  if (written_ + xs_.size() >= header_.count) {
+    throw std::length_error("More points than declared for point file");
+  }
+  xs_.push_back(point.GetX());
+  ys_.push_back(point.GetY());
+  if (header_.flags != 0U) {
+    const auto kUnit = static_cast<Distance::DistanceType>(header_.unit);
+    x_nanometers_.push_back(Distance(point.GetX(), kUnit).GetNanometer());
+    y_nanometers_.push_back(Distance(point.GetY(), kUnit).GetNanometer());
+  }
+  if (xs_.size() == kChunkSize) {
+    Flush();
+  }
+}
+
+auto PointFileWriter::Push(const Point2D* points, std::size_t count) -> void {
+  for (std::size_t i = 0; i < count; ++i) {
+    Push(points[i]);
+  }
+}
+
+auto PointFileWriter::Flush() -> void {
+  const auto kCount = xs_.size();
+  const auto kPosition = static_cast<uint64_t>(written_) * kValueBytes;
+  const auto kWrite = [&](uint64_t offset, const void* data,
+                          std::size_t column) {
+    file_.seekp(static_cast<std::streamoff>(offset + kPosition));
+    file_.write(static_cast<const char*>(data),
+                static_cast<std::streamsize>(kCount * kValueBytes));
+    checksums_[column] = HashColumn(checksums_[column], data, kCount);
+  };
+  kWrite(header_.x_offset, xs_.data(), kXColumn);
+  kWrite(header_.y_offset, ys_.data(), kYColumn);
+  if (header_.flags != 0U) {
+    kWrite(header_.x_nanometer_offset, x_nanometers_.data(), kXNanometerColumn);
+    kWrite(header_.y_nanometer_offset, y_nanometers_.data(), kYNanometerColumn);
+  }
+  if (!file_) {
+    throw std::runtime_error("Cannot write point file");
+  }
+  written_ += kCount;
+  xs_.clear();
+  ys_.clear();
+  x_nanometers_.clear();
+  y_nanometers_.clear();
+}
+
+auto PointFileWriter::Close() -> void {
+  if (closed_) {
+    return;
+  }
+  closed_ = true;
+  Flush();
+  if (written_ != header_.count) {
+    throw std::runtime_error("Fewer points than declared for point file");
+  }
+  header_.magic = kPointFileMagic;
+  header_.checksum = CombineChecksums(checksums_);
+  file_.seekp(0);
+  file_.write(reinterpret_cast<const char*>(&header_), sizeof(header_));
+  file_.close();
+  if (!file_) {
+    throw std::runtime_error("Cannot write point file header");
+  }
+}
+
+auto PointFileWriter::Write(const std::string& path, const PointCloud2D& points,
+                            Distance::DistanceType unit, bool with_nanometers)
+    -> void {
+  PointFileWriter writer(path, points.Size(), unit, with_nanometers);
+  for (std::size_t i = 0; i < points.Size(); ++i) {
+    writer.Push(points.GetPoint(i));
+  }
+  writer.Close();
+}
+
+PointFileReader::PointFileReader(const std::string& path, bool verify) {
+#ifdef Jeong0806_GEOMETRY_POINT_FILE_MMAP
+  const auto kDescriptor = ::open(path.c_str(), O_RDONLY);
+  if (kDescriptor < 0) {
+    throw std::runtime_error("Cannot open point file " + path);
+  }
+  struct stat status {};
+  if (::fstat(kDescriptor, &status) != 0) {
+    ::close(kDescriptor);
+    throw std::runtime_error("Cannot stat point file " + path);
+  }
+  size_ = static_cast<std::size_t>(status.st_size);
+  if (size_ >= sizeof(PointFileHeader)) {
+    auto* mapping =
+        ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, kDescriptor, 0);
+    if (mapping != MAP_FAILED) {
+      data_ = static_cast<const unsigned char*>(mapping);
+    }
+  }
+  ::close(kDescriptor);
+#else
+  std::ifstream file(path, std::ios::binary | std::ios::ate);
+  if (!file) {
+    throw std::runtime_error("Cannot open point file " + path);
+  }
+  size_ = static_cast<std::size_t>(file.tellg());
+  buffer_.resize((size_ + kValueBytes - 1U) / kValueBytes);
+  file.seekg(0);
+  file.read(reinterpret_cast<char*>(buffer_.data()),
+            static_cast<std::streamsize>(size_));
+  if (file && (size_ >= sizeof(PointFileHeader))) {
+    data_ = reinterpret_cast<const unsigned char*>(buffer_.data());
+  }
+#endif
+  if (data_ == nullptr) {
+    Release();
+    throw std::runtime_error("Cannot map point file " + path);
+  }
+
+  std::memcpy(&header_, data_, sizeof(header_));
+  try {
+    CheckHeader(header_, size_);
+    if (verify && !Verify()) {
+      throw std::runtime_error("Point file checksum does not match");
+    }
+  } catch (...) {
+    Release();
+    throw;
+  }
+}
+
+PointFileReader::PointFileReader(PointFileReader&& other) noexcept
+    : data_(std::exchange(other.data_, nullptr)),
+      size_(std::exchange(other.size_, 0U)),
+      buffer_(std::move(other.buffer_)),
+      header_(std::exchange(other.header_, PointFileHeader())) {}
+
+PointFileReader::~PointFileReader() { Release(); }
+
+auto PointFileReader::operator=(PointFileReader&& other) noexcept
+    -> PointFileReader& {
+  if (this != &other) {
+    Release();
+    data_ = std::exchange(other.data_, nullptr);
+    size_ = std::exchange(other.size_, 0U);
+    buffer_ = std::move(other.buffer_);
+    header_ = std::exchange(other.header_, PointFileHeader());
+  }
+  return *this;
+}
+
+auto PointFileReader::Release() -> void {
+#ifdef Jeong0806_GEOMETRY_POINT_FILE_MMAP
+  if (data_ != nullptr) {
+    ::munmap(const_cast<unsigned char*>(data_), size_);
+  }
+#endif
+  data_ = nullptr;
+  size_ = 0U;
+  buffer_.clear();
+  header_ = PointFileHeader();
+}
+
+auto PointFileReader::Size() const -> std::size_t { return header_.count; }
+
+auto PointFileReader::GetUnit() const -> Distance::DistanceType {
+  return static_cast<Distance::DistanceType>(header_.unit);
+}
+
+auto PointFileReader::HasNanometers() const -> bool {
+  return (header_.flags & kPointFileHasNanometers) != 0U;
+}
+
+auto PointFileReader::Verify() const -> bool {
+  std::array<uint64_t, 4> checksums{};
+  checksums.fill(kHashSeed);
+  checksums[kXColumn] = HashColumn(kHashSeed, GetXData(), Size());
+  checksums[kYColumn] = HashColumn(kHashSeed, GetYData(), Size());
+  if (HasNanometers()) {
+    checksums[kXNanometerColumn] =
+        HashColumn(kHashSeed, GetXNanometerData(), Size());
+    checksums[kYNanometerColumn] =
+        HashColumn(kHashSeed, GetYNanometerData(), Size());
+  }
+  return CombineChecksums(checksums) == header_.checksum;
+}
+
+auto PointFileReader::GetXData() const -> const double* {
+  return reinterpret_cast<const double*>(data_ + header_.x_offset);
+}
+
+auto PointFileReader::GetYData() const -> const double* {
+  return reinterpret_cast<const double*>(data_ + header_.y_offset);
+}
+
+auto PointFileReader::GetXNanometerData() const -> const int64_t* {
+  return HasNanometers() ? reinterpret_cast<const int64_t*>(
+                               data_ + header_.x_nanometer_offset)
+                         : nullptr;
+}
+
+auto PointFileReader::GetYNanometerData() const -> const int64_t* {
+  return HasNanometers() ? reinterpret_cast<const int64_t*>(
+                               data_ + header_.y_nanometer_offset)
+                         : nullptr;
+}
+
+auto PointFileReader::GetPoint(std::size_t index) const -> Point2D {
+  if (index >= Size()) {
+    throw std::out_of_range("Point file index is out of range");
+  }
+  return Point2D(GetXData()[index], GetYData()[index]);
+}
+
+auto PointFileReader::ToPointCloud(std::pmr::memory_resource* resource) const
+    -> PointCloud2D {
+  PointCloud2D cloud(Size(), resource);
+  if (!cloud.Empty()) {
+    std::memcpy(cloud.GetXData(), GetXData(), Size() * sizeof(double));
+    std::memcpy(cloud.GetYData(), GetYData(), Size() * sizeof(double));
+  }
+  return cloud;
+}
+}  // namespace Jeong0806::geometry
@@ -0,0 +1,530 @@
+/**
+ * @file geometry/src/point_parser.cpp
+ * @author Jeong Seong In (0806jsi@gmail.com)
+ * @brief CSV and WKT point text parser class developments
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2023 Jeong0806, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/point_parser.hpp"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+#include "geometry/instrumentation.hpp"
+#include "geometry/parallel.hpp"
+
+namespace {
+using Jeong0806::geometry::CsvFormat;
+using Jeong0806::geometry::Distance;
+using Jeong0806::geometry::Executor;
+using Jeong0806::geometry::WktType;
+
+struct UnitSuffix {
+  std::string_view suffix;
+  Distance::DistanceType unit;
+};
+
+constexpr std::array<UnitSuffix, 7> kUnitSuffixes{{
+    {"km", Distance::DistanceType::kKilometer},
+    {"m", Distance::DistanceType::kMeter},
+    {"cm", Distance::DistanceType::kCentimeter},
+    {"mm", Distance::DistanceType::kMillimeter},
+    {"um", Distance::DistanceType::kMicrometer},
+    {"\xC2\xB5m", Distance::DistanceType::kMicrometer},
+    {"nm", Distance::DistanceType::kNanometer},
+}};
+
+// Nanometers per unit, indexed by Distance::DistanceType
+constexpr std::array<int64_t, 6> kUnitNanometers{
+    1'000'000'000'000, 1'000'000'000, 10'000'000, 1'000'000, 1'000, 1};
+
+// Distance stores int64 nanometers
+constexpr double kMaxNanometer{9223372036854775808.0};
+
+// Thrown inside a chunk and reported with its line after every chunk ends
+struct ParseFailure {
+  const char* position{nullptr};
+  const char* message{nullptr};
+};
+
+auto GetNanometers(Distance::DistanceType unit) -> int64_t {
+  return kUnitNanometers[static_cast<std::size_t>(unit)];
+}
+
+// Powers of ten are exact doubles, so same and larger units round once
+auto Convert(double value, Distance::DistanceType from,
+             Distance::DistanceType to) -> double {
+  const auto kFrom = GetNanometers(from);
+  const auto kTo = GetNanometers(to);
+  if (kFrom >= kTo) {
+    return value * static_cast<double>(kFrom / kTo);
+  }
+  return value / static_cast<double>(kTo / kFrom);
+}
+
+auto IsSpace(char character) -> bool {
+  return (character == ' ') || (character == '\t') || (character == '\r');
+}
+
+auto SkipSpaces(const char*& current, const char* end) -> void {
+  while ((current != end) && IsSpace(*current)) {
+    ++current;
+  }
+}
+
+auto IsLetter(char character) -> bool {
+  const auto kByte = static_cast<unsigned char>(character);
+  return ((kByte | 0x20U) >= 'a' && (kByte | 0x20U) <= 'z') || (kByte >= 0x80U);
+}
+
+// Parses a number and an optional unit suffix, advancing current past both
+auto ParseQuantity(const char*& current, const char* end,
+                   Distance::DistanceType unit)
+    -> std::pair<double, Distance::DistanceType> {
+  auto first = current;
+  if ((first != end) && (*first == '+') && (first + 1 != end) &&
+      (first[1] != '-')) {
+    ++first;
+  }
+  auto value = 0.0;
+  const auto [kLast, kError] = std::from_chars(first, end, value);
+  if ((kError != std::errc()) || !std::isfinite(value)) {
+    throw ParseFailure{current, "invalid number"};
+  }
+
+  auto suffix_end = kLast;
+  while ((suffix_end != end) && IsLetter(*suffix_end)) {
+    ++suffix_end;
+  }
+  if (suffix_end != kLast) {
+    const std::string_view kSuffix(
+        kLast, static_cast<std::size_t>(suffix_end - kLast));
+    const auto kFound = std::find_if(kUnitSuffixes.begin(),
+                                     kUnitSuffixes.end(),
+                                     [&kSuffix](const UnitSuffix& entry) {
+                                       return entry.suffix == kSuffix;
+                                     });
+    if (kFound == kUnitSuffixes.end()) {
+      throw ParseFailure{kLast, "unknown unit"};
+    }
+    unit = kFound->unit;
+  }
+  current = suffix_end;
+  return {value, unit};
+}
+
+auto ParseCoordinate(const char*& current, const char* end,
+                     Distance::DistanceType unit) -> double {
+  const auto [kValue, kUnit] = ParseQuantity(current, end, unit);
+  return Convert(kValue, kUnit, unit);
+}
+
+// Splits text into up to thread_count chunks that start on a line
+auto SplitLines(std::string_view text, std::size_t thread_count,
+                Executor* executor) -> std::vector<std::size_t> {
+  thread_count =
+      Jeong0806::geometry::ResolveThreadCount(thread_count, executor);
+  const auto kChunks = std::max<std::size_t>(
+      std::min(thread_count,
+               text.size() / Jeong0806::geometry::PointParser::kMinChunkSize),
+      1U);
+  std::vector<std::size_t> bounds{0U};
+  for (std::size_t chunk = 1; chunk < kChunks; ++chunk) {
+    auto bound = std::max((text.size() * chunk) / kChunks, bounds.back());
+    bound = text.find('\n', bound);
+    bounds.push_back((bound == std::string_view::npos) ? text.size()
+                                                       : bound + 1U);
+  }
+  bounds.push_back(text.size());
+  return bounds;
+}
+
+// Calls parse with every line of [begin, end) without its newline
+template <typename Parse>
+auto ForEachLine(const char* begin, const char* end, Parse parse) -> void {
+  while (begin != end) {
+    const auto* newline = static_cast<const char*>(
+        std::memchr(begin, '\n', static_cast<std::size_t>(end - begin)));
+    const auto* line_end = (newline == nullptr) ? end : newline;
+    parse(begin, line_end);
+    begin = (newline == nullptr) ? end : newline + 1;
+  }
+}
+
+auto IsBlank(const char* current, const char* end) -> bool {
+  SkipSpaces(current, end);
+  return current == end;
+}
+
+auto ThrowFirstFailure(std::string_view text,
+                       const std::vector<ParseFailure>& failures,
+                       const char* format) -> void {
+  for (const auto& failure : failures) {
+    if (failure.position != nullptr) {
+      const auto kLine =
+          std::count(text.data(), failure.position, '\n') + 1;
+      throw std::invalid_argument(std::string("Invalid ") + format +
+                                  " at line " + std::to_string(kLine) + ": " +
+                                  failure.message);
+    }
+  }
+}
+
+auto ParseCsvField(const char* current, const char* end,
+                   Distance::DistanceType unit) -> double {
+  SkipSpaces(current, end);
+  while ((end != current) && IsSpace(end[-1])) {
+    --end;
+  }
+  if ((end - current >= 2) && (*current == '"') && (end[-1] == '"')) {
+    ++current;
+    --end;
+  }
+  const auto kValue = ParseCoordinate(current, end, unit);
+  if (current != end) {
+    throw ParseFailure{current, "invalid number"};
+  }
+  return kValue;
+}
+
+// Parses one non-blank CSV line into x and y
+auto ParseCsvLine(const char* current, const char* end,
+                  const CsvFormat& format, Distance::DistanceType unit,
+                  double& x, double& y) -> void {
+  const auto kLastColumn = std::max(format.x_column, format.y_column);
+  for (std::size_t column = 0;; ++column) {
+    const auto* delimiter = static_cast<const char*>(std::memchr(
+        current, format.delimiter, static_cast<std::size_t>(end - current)));
+    const auto* field_end = (delimiter == nullptr) ? end : delimiter;
+    if (column == format.x_column) {
+      x = ParseCsvField(current, field_end, unit);
+    }
+    if (column == format.y_column) {
+      y = ParseCsvField(current, field_end, unit);
+    }
+    if (column == kLastColumn) {
+      return;
+    }
+    if (delimiter == nullptr) {
+      throw ParseFailure{end, "missing column"};
+    }
+    current = delimiter + 1;
+  }
+}
+
+struct WktChunk {
+  std::vector<double> xs;
+  std::vector<double> ys;
+  std::vector<std::size_t> counts;
+  std::vector<WktType> types;
+};
+
+// Matches a case-insensitive keyword followed by a non-letter
+auto ConsumeKeyword(const char*& current, const char* end,
+                    std::string_view keyword) -> bool {
+  if (static_cast<std::size_t>(end - current) < keyword.size()) {
+    return false;
+  }
+  for (std::size_t i = 0; i < keyword.size(); ++i) {
+    if ((static_cast<unsigned char>(current[i]) | 0x20U) !=
+        static_cast<unsigned char>(keyword[i])) {
+      return false;
+    }
+  }
+  const auto* const kNext = current + keyword.size();
+  if ((kNext != end) && IsLetter(*kNext)) {
+    return false;
+  }
+  current = kNext;
+  return true;
+}
+
+auto Expect(const char*& current, const char* end, char character) -> void {
+  SkipSpaces(current, end);
+  if ((current == end) || (*current != character)) {
+    throw ParseFailure{current, (character == '(') ? "expected '('"
+                                                   : "expected ')'"};
+  }
+  ++current;
+}
+
+auto ParseWktPoint(const char*& current, const char* end,
+                   Distance::DistanceType unit, WktChunk& chunk) -> void {
+  SkipSpaces(current, end);
+  chunk.xs.push_back(ParseCoordinate(current, end, unit));
+  const auto* const kSeparator = current;
+  SkipSpaces(current, end);
+  if (current == kSeparator) {
+    throw ParseFailure{current, "expected a space between coordinates"};
+  }
+  chunk.ys.push_back(ParseCoordinate(current, end, unit));
+  SkipSpaces(current, end);
+  if ((current != end) && (*current != ',') && (*current != ')')) {
+    throw ParseFailure{current, "only 2-dimensional points are supported"};
+  }
+}
+
+// Parses comma separated members until the closing parenthesis
+template <typename ParseMember>
+auto ParseWktList(const char*& current, const char* end,
+                  ParseMember parse_member) -> void {
+  Expect(current, end, '(');
+  while (true) {
+    parse_member();
+    SkipSpaces(current, end);
+    if ((current == end) || (*current != ',')) {
+      break;
+    }
+    ++current;
+  }
+  Expect(current, end, ')');
+}
+
+// Parses one non-blank WKT line into chunk
+auto ParseWktLine(const char* current, const char* end,
+                  Distance::DistanceType unit, WktChunk& chunk) -> void {
+  SkipSpaces(current, end);
+  const auto kFirstPoint = chunk.xs.size();
+  WktType type = WktType::kPoint;
+  if (ConsumeKeyword(current, end, "point")) {
+    type = WktType::kPoint;
+  } else if (ConsumeKeyword(current, end, "linestring")) {
+    type = WktType::kLineString;
+  } else if (ConsumeKeyword(current, end, "multipoint")) {
+    type = WktType::kMultiPoint;
+  } else {
+    throw ParseFailure{current, "unsupported geometry type"};
+  }
+
+  SkipSpaces(current, end);
+  if (!ConsumeKeyword(current, end, "empty")) {
+    switch (type) {
+      case WktType::kPoint:
+        Expect(current, end, '(');
+        ParseWktPoint(current, end, unit, chunk);
+        Expect(current, end, ')');
+        break;
+      case WktType::kLineString:
+        ParseWktList(current, end,
+                     [&] { ParseWktPoint(current, end, unit, chunk); });
+        break;
+      case WktType::kMultiPoint:
+        ParseWktList(current, end, [&] {
+          SkipSpaces(current, end);
+          if ((current != end) && (*current == '(')) {
+            ++current;
+            ParseWktPoint(current, end, unit, chunk);
+            Expect(current, end, ')');
+          } else if (!ConsumeKeyword(current, end, "empty")) {
+            ParseWktPoint(current, end, unit, chunk);
+          }
+        });
+        break;
+    }
+  }
+  SkipSpaces(current, end);
+  if (current != end) {
+    throw ParseFailure{current, "unexpected text after geometry"};
+  }
+  chunk.counts.push_back(chunk.xs.size() - kFirstPoint);
+  chunk.types.push_back(type);
+}
+
+auto ReadFile(const std::string& path) -> std::string {
+  std::ifstream file(path, std::ios::binary | std::ios::ate);
+  if (!file) {
+    throw std::runtime_error("Cannot open " + path);
+  }
+  std::string text(static_cast<std::size_t>(file.tellg()), '\0');
+  file.seekg(0);
+  if (!file.read(text.data(), static_cast<std::streamsize>(text.size()))) {
+    throw std::runtime_error("Cannot read " + path);
+  }
+  return text;
+}
+}  // namespace
+
+namespace Jeong0806::geometry {
+auto PointParser::ParseDistance(std::string_view text,
+                                Distance::DistanceType unit) -> Distance {
+  const auto* current = text.data();
+  const auto* end = text.data() + text.size();
+  SkipSpaces(current, end);
+  auto value = std::make_pair(0.0, unit);
+  try {
+    value = ParseQuantity(current, end, unit);
+  } catch (const ParseFailure& failure) {
+    throw std::invalid_argument(std::string("Invalid distance: ") +
+                                failure.message);
+  }
+  if (!IsBlank(current, end)) {
+    throw std::invalid_argument("Invalid distance: unexpected text");
+  }
+  if (std::abs(value.first * static_cast<double>(GetNanometers(
+                                 value.second))) >= kMaxNanometer) {
+    throw std::out_of_range("Distance does not fit in 64-bit nanometers");
+  }
+  return Distance(value.first, value.second);
+}
+
+auto PointParser::ParseCsv(std::string_view text, const CsvFormat& format,
+                           Distance::DistanceType unit,
+                           std::size_t thread_count, Executor* executor)
+    -> PointCloud2D {
+  const Instrumentation::ScopedTimer kTimer(
+      Instrumentation::Timer::kPointParse);
+  auto body = text;
+  if (format.has_header) {
+    const auto kNewline = body.find('\n');
+    body.remove_prefix((kNewline == std::string_view::npos) ? body.size()
+                                                            : kNewline + 1U);
+  }
+  const auto kBounds = SplitLines(body, thread_count, executor);
+  const auto kChunks = kBounds.size() - 1U;
+
+  // Lines bound the points of a chunk, so chunks write straight into place
+  std::vector<std::size_t> offsets(kChunks + 1U, 0U);
+  for (std::size_t chunk = 0; chunk < kChunks; ++chunk) {
+    const auto* const kBegin = body.data() + kBounds[chunk];
+    const auto* const kEnd = body.data() + kBounds[chunk + 1U];
+    const auto kLines =
+        std::count(kBegin, kEnd, '\n') +
+        (((kBegin != kEnd) && (kEnd[-1] != '\n')) ? 1 : 0);
+    offsets[chunk + 1U] = offsets[chunk] + static_cast<std::size_t>(kLines);
+  }
+  PointCloud2D points(offsets.back());
+  auto* const xs = points.GetXData();
+  auto* const ys = points.GetYData();
+
+  std::vector<std::size_t> counts(kChunks, 0U);
+  std::vector<ParseFailure> failures(kChunks);
+  ParallelFor(
+      kChunks,
+      [&](std::size_t begin, std::size_t end) {
+        for (auto chunk = begin; chunk < end; ++chunk) {
+          auto index = offsets[chunk];
+          try {
+            ForEachLine(body.data() + kBounds[chunk],
+                        body.data() + kBounds[chunk + 1U],
+                        [&](const char* line, const char* line_end) {
+                          if (!IsBlank(line, line_end)) {
+                            ParseCsvLine(line, line_end, format, unit,
+                                         xs[index], ys[index]);
+                            ++index;
+                          }
+                        });
+          } catch (const ParseFailure& failure) {
+            failures[chunk] = failure;
+          }
+          counts[chunk] = index - offsets[chunk];
+        }
+      },
+      thread_count, executor);
+  ThrowFirstFailure(text, failures, "CSV");
+
+  // Close the gaps left by blank lines
+  std::size_t size = 0;
+  for (std::size_t chunk = 0; chunk < kChunks; ++chunk) {
+    if (size != offsets[chunk]) {
+      std::copy(xs + offsets[chunk], xs + offsets[chunk] + counts[chunk],
+                xs + size);
+      std::copy(ys + offsets[chunk], ys + offsets[chunk] + counts[chunk],
+                ys + size);
+    }
+    size += counts[chunk];
+  }
+  points.Resize(size);
+  return points;
+}
+
+auto PointParser::ParseCsvFile(const std::string& path,
+                               const CsvFormat& format,
+                               Distance::DistanceType unit,
+                               std::size_t thread_count, Executor* executor)
+    -> PointCloud2D {
+  return ParseCsv(ReadFile(path), format, unit, thread_count, executor);
+}
+
+auto PointParser::ParseWkt(std::string_view text, Distance::DistanceType unit,
+                           std::size_t thread_count, Executor* executor)
+    -> WktGeometries {
+  const Instrumentation::ScopedTimer kTimer(
+      Instrumentation::Timer::kPointParse);
+  const auto kBounds = SplitLines(text, thread_count, executor);
+  const auto kChunks = kBounds.size() - 1U;
+  std::vector<WktChunk> chunks(kChunks);
+  std::vector<ParseFailure> failures(kChunks);
+  ParallelFor(
+      kChunks,
+      [&](std::size_t begin, std::size_t end) {
+        for (auto chunk = begin; chunk < end; ++chunk) {
+          try {
+            ForEachLine(text.data() + kBounds[chunk],
+                        text.data() + kBounds[chunk + 1U],
+                        [&](const char* line, const char* line_end) {
+                          if (!IsBlank(line, line_end)) {
+                            ParseWktLine(line, line_end, unit, chunks[chunk]);
+                          }
+                        });
+          } catch (const ParseFailure& failure) {
+            failures[chunk] = failure;
+          }
+        }
+      },
+      thread_count, executor);
+  ThrowFirstFailure(text, failures, "WKT");
+
+  std::vector<std::size_t> point_offsets(kChunks + 1U, 0U);
+  std::vector<std::size_t> geometry_offsets(kChunks + 1U, 0U);
+  for (std::size_t chunk = 0; chunk < kChunks; ++chunk) {
+    point_offsets[chunk + 1U] = point_offsets[chunk] + chunks[chunk].xs.size();
+    geometry_offsets[chunk + 1U] =
+        geometry_offsets[chunk] + chunks[chunk].types.size();
+  }
+  const auto kGeometryCount = geometry_offsets.back();
+  WktGeometries geometries{PointCloud2D(point_offsets.back()),
+                           std::vector<std::size_t>(kGeometryCount + 1U, 0U),
+                           std::vector<WktType>(kGeometryCount)};
+  ParallelFor(
+      kChunks,
+      [&](std::size_t begin, std::size_t end) {
+        for (auto chunk = begin; chunk < end; ++chunk) {
+          const auto& kChunk = chunks[chunk];
+          std::copy(kChunk.xs.begin(), kChunk.xs.end(),
+                    geometries.points.GetXData() + point_offsets[chunk]);
+          std::copy(kChunk.ys.begin(), kChunk.ys.end(),
+                    geometries.points.GetYData() + point_offsets[chunk]);
+          std::copy(kChunk.types.begin(), kChunk.types.end(),
+                    geometries.types.begin() +
+                        static_cast<std::ptrdiff_t>(geometry_offsets[chunk]));
+          auto offset = point_offsets[chunk];
+          for (std::size_t i = 0; i < kChunk.counts.size(); ++i) {
+            offset += kChunk.counts[i];
+            geometries.offsets[geometry_offsets[chunk] + i + 1U] = offset;
+          }
+        }
+      },
+      thread_count, executor);
+  return geometries;
+}
+
+auto PointParser::ParseWktFile(const std::string& path,
+                               Distance::DistanceType unit,
+                               std::size_t thread_count, Executor* executor)
+    -> WktGeometries {
+  return ParseWkt(ReadFile(path), unit, thread_count, executor);
+}
+}  // namespace Jeong0806::geometry
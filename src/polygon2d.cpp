@@ -0,0 +1,123 @@
+/**
+ * @file geometry/src/polygon2d.cpp
+ * @author Jeong Seong In (0806jsi@gmail.com)
+ * @brief Polygon class developments over 2-dimension point rings
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2023 Jeong0806, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/polygon2d.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include "geometry/predicates2d.hpp"
+
+namespace Jeong0806::geometry {
+Polygon2D::Polygon2D(const std::vector<Point2D>& ring,
+                     std::pmr::memory_resource* resource)
+    : points_(resource), ring_offsets_(1U, 0U, resource) {
+  AddRing(ring);
+}
+
+Polygon2D::Polygon2D(const std::vector<std::vector<Point2D>>& rings,
+                     std::pmr::memory_resource* resource)
+    : points_(resource), ring_offsets_(1U, 0U, resource) {
+  for (const auto& kRing : rings) {
+    AddRing(kRing);
+  }
+}
+
+Polygon2D::Polygon2D(const Polygon2D& other, const allocator_type& allocator)
+    : points_(other.points_, allocator.resource()),
+      ring_offsets_(other.ring_offsets_, allocator.resource()),
+      min_(other.min_),
+      max_(other.max_) {}
+
+auto Polygon2D::Empty() const -> bool { return points_.empty(); }
+
+auto Polygon2D::GetRingCount() const -> std::size_t {
+  return ring_offsets_.size() - 1U;
+}
+
+auto Polygon2D::GetEdgeCount() const -> std::size_t { return points_.size(); }
+
+auto Polygon2D::GetResource() const -> std::pmr::memory_resource* {
+  return points_.get_allocator().resource();
+}
+
+auto Polygon2D::GetPoints() const -> const std::pmr::vector<Point2D>& {
+  return points_;
+}
+
+auto Polygon2D::GetRingOffsets() const -> const std::pmr::vector<uint32_t>& {
+  return ring_offsets_;
+}
+
+auto Polygon2D::GetMin() const -> const Point2D& { return min_; }
+
+auto Polygon2D::GetMax() const -> const Point2D& { return max_; }
+
+auto Polygon2D::Contains(const Point2D& point) const -> bool {
+  if (Empty() || (point.GetX() < min_.GetX()) || (point.GetX() > max_.GetX()) ||
+      (point.GetY() < min_.GetY()) || (point.GetY() > max_.GetY())) {
+    return false;
+  }
+  auto inside = false;
+  for (std::size_t ring = 0; ring + 1U < ring_offsets_.size(); ++ring) {
+    const auto kBegin = ring_offsets_[ring];
+    const auto kEnd = ring_offsets_[ring + 1U];
+    for (auto i = kBegin; i < kEnd; ++i) {
+      const auto& kFrom = points_[i];
+      const auto& kTo = points_[(i + 1U < kEnd) ? i + 1U : kBegin];
+      // Half-open in y, so a ray through a vertex counts it once
+      if ((kFrom.GetY() > point.GetY()) == (kTo.GetY() > point.GetY())) {
+        continue;
+      }
+      const auto kOrientation = Predicates2D::Orient2D(kFrom, kTo, point);
+      if ((kOrientation != 0.0) &&
+          ((kOrientation > 0.0) == (kTo.GetY() > kFrom.GetY()))) {
+        inside = !inside;
+      }
+    }
+  }
+  return inside;
+}
+
+auto Polygon2D::AddRing(const std::vector<Point2D>& ring) -> void {
+  auto size = ring.size();
+  if ((size > 1U) && (ring.front().GetX() == ring.back().GetX()) &&
+      (ring.front().GetY() == ring.back().GetY())) {
+    --size;
+  }
+  if (size < 3U) {
+    throw std::invalid_argument("Polygon rings need at least three points");
+  }
+  if (size > std::numeric_limits<uint32_t>::max() - points_.size()) {
+    throw std::length_error("Polygon2D supports up to 2^32 - 1 points");
+  }
+  if (!std::all_of(ring.begin(), ring.end(), [](const Point2D& point) {
+        return std::isfinite(point.GetX()) && std::isfinite(point.GetY());
+      })) {
+    throw std::invalid_argument("Polygon coordinates must be finite");
+  }
+  if (Empty()) {
+    min_ = ring.front();
+    max_ = ring.front();
+  }
+  for (std::size_t i = 0; i < size; ++i) {
+    points_.push_back(ring[i]);
+    min_ = Point2D(std::min(min_.GetX(), ring[i].GetX()),
+                   std::min(min_.GetY(), ring[i].GetY()));
+    max_ = Point2D(std::max(max_.GetX(), ring[i].GetX()),
+                   std::max(max_.GetY(), ring[i].GetY()));
+  }
+  ring_offsets_.push_back(static_cast<uint32_t>(points_.size()));
+}
+}  // namespace Jeong0806::geometry
@@ -0,0 +1,458 @@
+/**
+ * @file geometry/src/polygon_index2d.cpp
+ * @author Jeong Seong In (0806jsi@gmail.com)
+ * @brief Prepared polygon index class developments for point classification
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2023 Jeong0806, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/polygon_index2d.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+#include "geometry/instrumentation.hpp"
+#include "geometry/parallel.hpp"
+#include "geometry/predicates2d.hpp"
+
+namespace {
+using Jeong0806::geometry::Point2D;
+using Jeong0806::geometry::Predicates2D;
+
+// Points whose cells are found in one pass before any is resolved
+constexpr std::size_t kBlockSize{256U};
+// Slack in cells around the edge extent within a row, far above rounding
+constexpr double kMargin{0.125};
+// Candidate reference points tried per cell before taking the last one
+constexpr uint32_t kReferenceAttempts{64U};
+
+// Whether segment pq crosses edge ab. Vertices on the line of pq count as
+// left of it, which moves the line off them consistently, so with p and q
+// off the edges the crossings of all edges have the right parity.
+auto Crosses(const Point2D& p, const Point2D& q, const Point2D& a,
+             const Point2D& b) -> bool {
+  if ((Predicates2D::Orient2D(p, q, a) >= 0.0) ==
+      (Predicates2D::Orient2D(p, q, b) >= 0.0)) {
+    return false;
+  }
+  return (Predicates2D::Orient2D(a, b, p) >= 0.0) !=
+         (Predicates2D::Orient2D(a, b, q) >= 0.0);
+}
+
+// Crosses(p, q, a, b) for an edge with q strictly on its left, testing
+// the side of p first since it mostly rules the edge out alone
+auto CrossesFromReference(const Point2D& p, const Point2D& q,
+                          const Point2D& a, const Point2D& b) -> bool {
+  return (Predicates2D::Orient2D(a, b, p) < 0.0) &&
+         ((Predicates2D::Orient2D(p, q, a) >= 0.0) !=
+          (Predicates2D::Orient2D(p, q, b) >= 0.0));
+}
+
+auto IsOnEdge(const Point2D& a, const Point2D& b, const Point2D& point)
+    -> bool {
+  return (point.GetX() >= std::min(a.GetX(), b.GetX())) &&
+         (point.GetX() <= std::max(a.GetX(), b.GetX())) &&
+         (point.GetY() >= std::min(a.GetY(), b.GetY())) &&
+         (point.GetY() <= std::max(a.GetY(), b.GetY())) &&
+         (Predicates2D::Orient2D(a, b, point) == 0.0);
+}
+}  // namespace
+
+namespace Jeong0806::geometry {
+PolygonIndex2D::PolygonIndex2D(const std::vector<Polygon2D>& zones,
+                               std::pmr::memory_resource* resource)
+    : zones_(zones.begin(), zones.end(), resource),
+      cells_(2U, resource),
+      groups_(1U, resource),
+      edges_(resource) {
+  Build();
+}
+
+auto PolygonIndex2D::Size() const -> std::size_t { return zones_.size(); }
+
+auto PolygonIndex2D::Empty() const -> bool { return zones_.empty(); }
+
+auto PolygonIndex2D::GetResource() const -> std::pmr::memory_resource* {
+  return edges_.get_allocator().resource();
+}
+
+auto PolygonIndex2D::GetZone(std::size_t zone) const -> const Polygon2D& {
+  if (zone >= zones_.size()) {
+    throw std::out_of_range("Zone index is out of range");
+  }
+  return zones_[zone];
+}
+
+auto PolygonIndex2D::GetCellCount() const -> std::size_t {
+  return static_cast<std::size_t>(columns_) * rows_;
+}
+
+auto PolygonIndex2D::Classify(const Point2D& point) const -> uint32_t {
+  return ClassifyInCell(point, GetCell(point.GetX(), point.GetY()));
+}
+
+auto PolygonIndex2D::Classify(const Point2D* points, std::size_t count,
+                              uint32_t* output, std::size_t thread_count,
+                              Executor* executor) const -> void {
+  const Instrumentation::ScopedTimer kTimer(
+      Instrumentation::Timer::kPolygonClassify);
+  ParallelFor(
+      count,
+      [&](std::size_t begin, std::size_t end) {
+        ClassifyRange([points](std::size_t i) { return points[i]; }, begin,
+                      end, output);
+      },
+      thread_count, executor);
+}
+
+auto PolygonIndex2D::Classify(const std::vector<Point2D>& points,
+                              std::size_t thread_count,
+                              Executor* executor) const
+    -> std::vector<uint32_t> {
+  std::vector<uint32_t> output(points.size());
+  Classify(points.data(), points.size(), output.data(), thread_count,
+           executor);
+  return output;
+}
+
+auto PolygonIndex2D::Classify(const PointCloud2D& points,
+                              std::size_t thread_count,
+                              Executor* executor) const
+    -> std::vector<uint32_t> {
+  const Instrumentation::ScopedTimer kTimer(
+      Instrumentation::Timer::kPolygonClassify);
+  std::vector<uint32_t> output(points.Size());
+  const auto* const kXs = points.GetXData();
+  const auto* const kYs = points.GetYData();
+  ParallelFor(
+      output.size(),
+      [&](std::size_t begin, std::size_t end) {
+        ClassifyRange(
+            [kXs, kYs](std::size_t i) { return Point2D(kXs[i], kYs[i]); },
+            begin, end, output.data());
+      },
+      thread_count, executor);
+  return output;
+}
+
+auto PolygonIndex2D::Build() -> void {
+  const Instrumentation::ScopedTimer kTimer(
+      Instrumentation::Timer::kPolygonIndexBuild);
+  if (zones_.size() > kNoZone) {
+    throw std::length_error("PolygonIndex2D supports up to 2^32 - 1 zones");
+  }
+
+  // Zero-length edges cross nothing and are left out
+  auto* const kResource = GetResource();
+  std::pmr::vector<Point2D> froms(kResource);
+  std::pmr::vector<Point2D> tos(kResource);
+  std::pmr::vector<uint32_t> edge_zones(kResource);
+  for (uint32_t zone = 0; zone < zones_.size(); ++zone) {
+    const auto& kPoints = zones_[zone].GetPoints();
+    const auto& kRingOffsets = zones_[zone].GetRingOffsets();
+    for (std::size_t ring = 0; ring + 1U < kRingOffsets.size(); ++ring) {
+      const auto kBegin = kRingOffsets[ring];
+      const auto kEnd = kRingOffsets[ring + 1U];
+      for (auto i = kBegin; i < kEnd; ++i) {
+        const auto& kFrom = kPoints[i];
+        const auto& kTo = kPoints[(i + 1U < kEnd) ? i + 1U : kBegin];
+        if ((kFrom.GetX() != kTo.GetX()) || (kFrom.GetY() != kTo.GetY())) {
+          froms.push_back(kFrom);
+          tos.push_back(kTo);
+          edge_zones.push_back(zone);
+        }
+      }
+    }
+  }
+  if (froms.size() >= kNoZone) {
+    throw std::length_error("PolygonIndex2D supports up to 2^32 - 1 edges");
+  }
+  if (froms.empty()) {
+    return;
+  }
+  const auto kEdgeCount = static_cast<uint32_t>(froms.size());
+
+  // Size the grid to about kCellsPerEdge square cells per edge
+  min_x_ = max_x_ = froms.front().GetX();
+  min_y_ = max_y_ = froms.front().GetY();
+  for (const auto& kPoint : froms) {
+    min_x_ = std::min(min_x_, kPoint.GetX());
+    min_y_ = std::min(min_y_, kPoint.GetY());
+    max_x_ = std::max(max_x_, kPoint.GetX());
+    max_y_ = std::max(max_y_, kPoint.GetY());
+  }
+  const auto kWidth = max_x_ - min_x_;
+  const auto kHeight = max_y_ - min_y_;
+  const auto kTarget = static_cast<double>(
+      std::min(std::size_t{kEdgeCount} * kCellsPerEdge, kMaxCellCount));
+  auto columns = 1.0;
+  if ((kWidth > 0.0) && (kHeight > 0.0)) {
+    columns = std::sqrt(kTarget * (kWidth / kHeight));
+  } else if (kWidth > 0.0) {
+    columns = kTarget;
+  }
+  columns = std::min(std::max(std::round(columns), 1.0), kTarget);
+  const auto kRows =
+      (kHeight > 0.0) ? std::max(std::floor(kTarget / columns), 1.0) : 1.0;
+  columns_ = static_cast<uint32_t>(columns);
+  rows_ = static_cast<uint32_t>(kRows);
+  scale_x_ = (kWidth > 0.0) ? columns / kWidth : 0.0;
+  scale_y_ = (kHeight > 0.0) ? kRows / kHeight : 0.0;
+  const auto kCellWidth = kWidth / columns;
+  const auto kCellHeight = kHeight / kRows;
+  const auto kCellCount = GetCellCount();
+
+  // List every edge in the cells it passes through. The x range of an edge
+  // within a row is taken kMargin cells wider in both directions, so
+  // rounding never drops a cell the edge touches.
+  const auto kMarginWidth = kMargin * kCellWidth;
+  std::pmr::vector<std::pair<uint32_t, uint32_t>> entries(kResource);
+  for (uint32_t edge = 0; edge < kEdgeCount; ++edge) {
+    const auto& kFrom = froms[edge];
+    const auto& kTo = tos[edge];
+    const auto kLowY = std::min(kFrom.GetY(), kTo.GetY());
+    const auto kHighY = std::max(kFrom.GetY(), kTo.GetY());
+    const auto kFirstRow = GetRow(kLowY);
+    const auto kLastRow = GetRow(kHighY);
+    const auto kFirstColumn = GetColumn(std::min(kFrom.GetX(), kTo.GetX()));
+    const auto kLastColumn = GetColumn(std::max(kFrom.GetX(), kTo.GetX()));
+    for (auto row = kFirstRow; row <= kLastRow; ++row) {
+      auto first_column = kFirstColumn;
+      auto last_column = kLastColumn;
+      if (kFirstRow != kLastRow) {
+        const auto kSlope =
+            (kTo.GetX() - kFrom.GetX()) / (kTo.GetY() - kFrom.GetY());
+        const auto kY0 =
+            std::max(kLowY, min_y_ + ((row - kMargin) * kCellHeight));
+        const auto kY1 =
+            std::min(kHighY, min_y_ + ((row + 1.0 + kMargin) * kCellHeight));
+        const auto kX0 = kFrom.GetX() + ((kY0 - kFrom.GetY()) * kSlope);
+        const auto kX1 = kFrom.GetX() + ((kY1 - kFrom.GetY()) * kSlope);
+        first_column = std::max(
+            first_column, GetColumn(std::min(kX0, kX1) - kMarginWidth));
+        last_column = std::min(
+            last_column, GetColumn(std::max(kX0, kX1) + kMarginWidth));
+      }
+      for (auto column = first_column; column <= last_column; ++column) {
+        entries.emplace_back((row * columns_) + column, edge);
+      }
+    }
+  }
+  // A stable counting sort keeps the edges of a cell in zone order
+  std::pmr::vector<std::size_t> entry_offsets(kCellCount + 1U, 0U, kResource);
+  for (const auto& kEntry : entries) {
+    ++entry_offsets[kEntry.first + 1U];
+  }
+  std::partial_sum(entry_offsets.begin(), entry_offsets.end(),
+                   entry_offsets.begin());
+  std::pmr::vector<uint32_t> entry_edges(entries.size(), kResource);
+  {
+    std::pmr::vector<std::size_t> positions(
+        entry_offsets.begin(), entry_offsets.end() - 1, kResource);
+    for (const auto& kEntry : entries) {
+      entry_edges[positions[kEntry.first]++] = kEntry.second;
+    }
+  }
+  if (entry_edges.size() >= kNoZone) {
+    throw std::length_error("PolygonIndex2D cells list over 2^32 - 1 edges");
+  }
+  entries.clear();
+  entries.shrink_to_fit();
+
+  // Spread the candidate references of a cell by the plastic number, and
+  // keep the first one in the cell and off its edges
+  // The cell past the grid stands for points outside it, and the last one
+  // ends the groups
+  cells_.assign(kCellCount + 2U, Cell{});
+  for (uint32_t cell = 0; cell < kCellCount; ++cell) {
+    const auto kRow = cell / columns_;
+    const auto kColumn = cell % columns_;
+    for (uint32_t attempt = 0; attempt < kReferenceAttempts; ++attempt) {
+      const auto kFractionX =
+          std::fmod(0.5 + (attempt * 0.7548776662466927), 1.0);
+      const auto kFractionY =
+          std::fmod(0.5 + (attempt * 0.5698402909980532), 1.0);
+      const Point2D kCandidate(min_x_ + ((kColumn + kFractionX) * kCellWidth),
+                               min_y_ + ((kRow + kFractionY) * kCellHeight));
+      cells_[cell].reference = kCandidate;
+      if ((GetColumn(kCandidate.GetX()) == kColumn) &&
+          (GetRow(kCandidate.GetY()) == kRow) &&
+          std::none_of(entry_edges.begin() + entry_offsets[cell],
+                       entry_edges.begin() + entry_offsets[cell + 1U],
+                       [&](uint32_t edge) {
+                         return IsOnEdge(froms[edge], tos[edge], kCandidate);
+                       })) {
+        break;
+      }
+    }
+  }
+
+  // Walk each row from a point left of the grid, which no zone holds, and
+  // flip the zones of the edges crossed on the way to every reference. The
+  // step into a cell stays within it and the cell before.
+  groups_.clear();
+  edges_.clear();
+  std::pmr::vector<uint32_t> stamps(kEdgeCount, kNoZone, kResource);
+  std::pmr::vector<uint8_t> inside(zones_.size(), 0U, kResource);
+  std::pmr::vector<uint32_t> active(kResource);
+  // Far enough out that the predicates do not underflow near zero
+  const auto kOutsideX =
+      min_x_ - std::max({kCellWidth, std::abs(min_x_), 1.0});
+  for (uint32_t row = 0; row < rows_; ++row) {
+    for (const auto kZone : active) {
+      inside[kZone] = 0U;
+    }
+    active.clear();
+    auto previous = Point2D(kOutsideX, cells_[row * columns_].reference.GetY());
+    for (uint32_t column = 0; column < columns_; ++column) {
+      const auto kCell = (row * columns_) + column;
+      const auto& kReference = cells_[kCell].reference;
+      const auto kCross = [&](std::size_t entry) {
+        const auto kEdge = entry_edges[entry];
+        if ((stamps[kEdge] == kCell) ||
+            !Crosses(previous, kReference, froms[kEdge], tos[kEdge])) {
+          stamps[kEdge] = kCell;
+          return;
+        }
+        stamps[kEdge] = kCell;
+        const auto kZone = edge_zones[kEdge];
+        inside[kZone] ^= 1U;
+        const auto kPosition =
+            std::lower_bound(active.begin(), active.end(), kZone);
+        if (inside[kZone] != 0U) {
+          active.insert(kPosition, kZone);
+        } else {
+          active.erase(kPosition);
+        }
+      };
+      const auto kFirstEntry =
+          entry_offsets[(column > 0U) ? kCell - 1U : kCell];
+      for (auto entry = kFirstEntry; entry < entry_offsets[kCell + 1U];
+           ++entry) {
+        kCross(entry);
+      }
+
+      const auto kFirstGroup = static_cast<uint32_t>(groups_.size());
+      cells_[kCell].first_group = kFirstGroup;
+      for (auto entry = entry_offsets[kCell]; entry < entry_offsets[kCell + 1U];
+           ++entry) {
+        const auto kEdge = entry_edges[entry];
+        const auto kZone = edge_zones[kEdge];
+        if ((groups_.size() == kFirstGroup) || (groups_.back().zone != kZone)) {
+          groups_.push_back(
+              Group{kZone, inside[kZone],
+                    static_cast<uint32_t>(edges_.size() / 2U)});
+        }
+        // Store the edge with the reference on its left. An edge whose line
+        // runs through the reference never crosses a segment from it.
+        const auto kSide =
+            Predicates2D::Orient2D(froms[kEdge], tos[kEdge], kReference);
+        if (kSide > 0.0) {
+          edges_.push_back(froms[kEdge]);
+          edges_.push_back(tos[kEdge]);
+        } else if (kSide < 0.0) {
+          edges_.push_back(tos[kEdge]);
+          edges_.push_back(froms[kEdge]);
+        }
+      }
+
+      // Zones holding the reference without edges here hold the whole cell
+      auto group = kFirstGroup;
+      for (const auto kZone : active) {
+        while ((group < groups_.size()) && (groups_[group].zone < kZone)) {
+          ++group;
+        }
+        if ((group == groups_.size()) || (groups_[group].zone != kZone)) {
+          cells_[kCell].zone = kZone;
+          break;
+        }
+      }
+      previous = kReference;
+    }
+  }
+  cells_[kCellCount].first_group = static_cast<uint32_t>(groups_.size());
+  cells_[kCellCount + 1U].first_group = static_cast<uint32_t>(groups_.size());
+  groups_.push_back(
+      Group{kNoZone, 0U, static_cast<uint32_t>(edges_.size() / 2U)});
+}
+
+auto PolygonIndex2D::GetColumn(double x) const -> uint32_t {
+  // Clamping before the conversion also maps NaN to zero
+  auto column = (x - min_x_) * scale_x_;
+  column = (column > 0.0) ? column : 0.0;
+  const auto kLast = static_cast<double>(std::max(columns_, 1U) - 1U);
+  return static_cast<uint32_t>((column < kLast) ? column : kLast);
+}
+
+auto PolygonIndex2D::GetRow(double y) const -> uint32_t {
+  auto row = (y - min_y_) * scale_y_;
+  row = (row > 0.0) ? row : 0.0;
+  const auto kLast = static_cast<double>(std::max(rows_, 1U) - 1U);
+  return static_cast<uint32_t>((row < kLast) ? row : kLast);
+}
+
+auto PolygonIndex2D::GetCell(double x, double y) const -> uint32_t {
+  const auto kInside =
+      (x >= min_x_) && (x <= max_x_) && (y >= min_y_) && (y <= max_y_);
+  const auto kCell = (GetRow(y) * columns_) + GetColumn(x);
+  return kInside ? kCell : columns_ * rows_;
+}
+
+auto PolygonIndex2D::ClassifyInCell(const Point2D& point, uint32_t cell) const
+    -> uint32_t {
+  const auto& kCell = cells_[cell];
+  const auto kLastGroup = cells_[cell + 1U].first_group;
+  for (auto group = kCell.first_group;
+       (group < kLastGroup) && (groups_[group].zone < kCell.zone); ++group) {
+    auto inside = groups_[group].inside != 0U;
+    for (auto edge = groups_[group].first_edge;
+         edge < groups_[group + 1U].first_edge; ++edge) {
+      if (CrossesFromReference(point, kCell.reference, edges_[2U * edge],
+                               edges_[(2U * edge) + 1U])) {
+        inside = !inside;
+      }
+    }
+    if (inside) {
+      return groups_[group].zone;
+    }
+  }
+  return kCell.zone;
+}
+
+template <typename PointAt>
+auto PolygonIndex2D::ClassifyRange(PointAt point_at, std::size_t begin,
+                                   std::size_t end, uint32_t* output) const
+    -> void {
+  std::array<uint32_t, kBlockSize> cells{};
+  std::array<uint32_t, kBlockSize> pending{};
+  for (auto block = begin; block < end; block += kBlockSize) {
+    const auto kSize = std::min(kBlockSize, end - block);
+    for (std::size_t i = 0; i < kSize; ++i) {
+      const auto kPoint = point_at(block + i);
+      cells[i] = GetCell(kPoint.GetX(), kPoint.GetY());
+    }
+    // Independent lookups, so the cache misses of a block overlap
+    std::size_t pending_count = 0;
+    for (std::size_t i = 0; i < kSize; ++i) {
+      const auto& kCell = cells_[cells[i]];
+      output[block + i] = kCell.zone;
+      pending[pending_count] = static_cast<uint32_t>(i);
+      pending_count += (kCell.first_group != cells_[cells[i] + 1U].first_group)
+                           ? 1U
+                           : 0U;
+    }
+    for (std::size_t i = 0; i < pending_count; ++i) {
+      output[block + pending[i]] =
+          ClassifyInCell(point_at(block + pending[i]), cells[pending[i]]);
+    }
+  }
+}
+}  // namespace Jeong0806::geometry
@@ -0,0 +1,258 @@
+/**
+ * @file geometry/src/polyline_simplifier2d.cpp
+ * @author Jeong Seong In (0806jsi@gmail.com)
+ * @brief Polyline simplification class developments with Distance tolerance
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2023 Jeong0806, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/polyline_simplifier2d.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+
+#include "geometry/instrumentation.hpp"
+
+namespace {
+using Jeong0806::geometry::Distance;
+using Jeong0806::geometry::Point2D;
+
+auto GetToleranceSquared(const Distance& tolerance,
+                         Distance::DistanceType unit) -> double {
+  if (tolerance.GetNanometer() < 0) {
+    throw std::invalid_argument("Tolerance must not be negative");
+  }
+  const auto kTolerance = tolerance.GetValue(unit);
+  return kTolerance * kTolerance;
+}
+
+// Squared distance from point to the segment [begin, end]
+auto SegmentSquaredDistance(const Point2D& point, const Point2D& begin,
+                            const Point2D& end) -> double {
+  const auto kDx = end.GetX() - begin.GetX();
+  const auto kDy = end.GetY() - begin.GetY();
+  const auto kLengthSquared = (kDx * kDx) + (kDy * kDy);
+  if (kLengthSquared == 0.0) {
+    return Point2D::CalculateSquaredDistance(point, begin);
+  }
+  const auto kT = std::clamp((((point.GetX() - begin.GetX()) * kDx) +
+                              ((point.GetY() - begin.GetY()) * kDy)) /
+                                 kLengthSquared,
+                             0.0, 1.0);
+  return Point2D::CalculateSquaredDistance(
+      point, Point2D(begin.GetX() + (kT * kDx), begin.GetY() + (kT * kDy)));
+}
+
+auto TriangleArea(const Point2D& a, const Point2D& b, const Point2D& c)
+    -> double {
+  return std::abs(((b.GetX() - a.GetX()) * (c.GetY() - a.GetY())) -
+                  ((b.GetY() - a.GetY()) * (c.GetX() - a.GetX()))) /
+         2.0;
+}
+
+auto DouglasPeucker(const Point2D* points, std::size_t count,
+                    double tolerance_squared) -> std::vector<uint8_t> {
+  std::vector<uint8_t> retained(count, 0U);
+  retained.front() = 1U;
+  retained.back() = 1U;
+  // Pending [first, last] ranges, at most one per retained point
+  std::vector<std::pair<std::size_t, std::size_t>> ranges;
+  ranges.emplace_back(0U, count - 1U);
+  while (!ranges.empty()) {
+    const auto [kFirst, kLast] = ranges.back();
+    ranges.pop_back();
+    auto farthest = kFirst;
+    auto farthest_squared = tolerance_squared;
+    for (auto i = kFirst + 1U; i < kLast; ++i) {
+      const auto kSquared =
+          SegmentSquaredDistance(points[i], points[kFirst], points[kLast]);
+      if (kSquared > farthest_squared) {
+        farthest = i;
+        farthest_squared = kSquared;
+      }
+    }
+    if (farthest != kFirst) {
+      retained[farthest] = 1U;
+      ranges.emplace_back(farthest, kLast);
+      ranges.emplace_back(kFirst, farthest);
+    }
+  }
+  return retained;
+}
+
+auto Visvalingam(const Point2D* points, std::size_t count,
+                 double tolerance_squared) -> std::vector<uint8_t> {
+  std::vector<uint8_t> retained(count, 1U);
+  std::vector<std::size_t> previous(count);
+  std::vector<std::size_t> next(count);
+  std::vector<double> areas(count, 0.0);
+  using Entry = std::pair<double, std::size_t>;
+  std::vector<Entry> storage;
+  storage.reserve(3U * count);
+  for (std::size_t i = 1; i + 1U < count; ++i) {
+    previous[i] = i - 1U;
+    next[i] = i + 1U;
+    areas[i] = TriangleArea(points[i - 1U], points[i], points[i + 1U]);
+    storage.emplace_back(areas[i], i);
+  }
+  // Stale entries stay queued and are skipped when their area is outdated
+  std::priority_queue<Entry, std::vector<Entry>, std::greater<>> queue(
+      std::greater<>(), std::move(storage));
+
+  auto removed_area = 0.0;
+  while (!queue.empty()) {
+    const auto [kArea, kIndex] = queue.top();
+    queue.pop();
+    if ((retained[kIndex] == 0U) || (kArea != areas[kIndex])) {
+      continue;
+    }
+    if (kArea >= tolerance_squared) {
+      break;
+    }
+    retained[kIndex] = 0U;
+    removed_area = std::max(removed_area, kArea);
+    const auto kPrevious = previous[kIndex];
+    const auto kNext = next[kIndex];
+    next[kPrevious] = kNext;
+    previous[kNext] = kPrevious;
+    // A neighbor never becomes cheaper to drop than a point already dropped
+    for (const auto kNeighbor : {kPrevious, kNext}) {
+      if ((kNeighbor == 0U) || (kNeighbor + 1U == count)) {
+        continue;
+      }
+      areas[kNeighbor] = std::max(
+          TriangleArea(points[previous[kNeighbor]], points[kNeighbor],
+                       points[next[kNeighbor]]),
+          removed_area);
+      queue.emplace(areas[kNeighbor], kNeighbor);
+    }
+  }
+  return retained;
+}
+}  // namespace
+
+namespace Jeong0806::geometry {
+auto PolylineSimplifier2D::SimplifyIndices(const Point2D* points,
+                                           std::size_t count,
+                                           const Distance& tolerance,
+                                           Method method,
+                                           Distance::DistanceType unit)
+    -> std::vector<std::size_t> {
+  const Instrumentation::ScopedTimer kTimer(
+      Instrumentation::Timer::kPolylineSimplify);
+  const auto kToleranceSquared = GetToleranceSquared(tolerance, unit);
+  std::vector<std::size_t> indices;
+  if (count <= 2U) {
+    for (std::size_t i = 0; i < count; ++i) {
+      indices.push_back(i);
+    }
+    return indices;
+  }
+
+  const auto kRetained =
+      (method == Method::kVisvalingam)
+          ? Visvalingam(points, count, kToleranceSquared)
+          : DouglasPeucker(points, count, kToleranceSquared);
+  for (std::size_t i = 0; i < count; ++i) {
+    if (kRetained[i] != 0U) {
+      indices.push_back(i);
+    }
+  }
+  return indices;
+}
+
+auto PolylineSimplifier2D::SimplifyIndices(const std::vector<Point2D>& points,
+                                           const Distance& tolerance,
+                                           Method method,
+                                           Distance::DistanceType unit)
+    -> std::vector<std::size_t> {
+  return SimplifyIndices(points.data(), points.size(), tolerance, method,
+                         unit);
+}
+
+auto PolylineSimplifier2D::Simplify(const Point2D* points, std::size_t count,
+                                    const Distance& tolerance, Method method,
+                                    Distance::DistanceType unit)
+    -> std::vector<Point2D> {
+  const auto kIndices =
+      SimplifyIndices(points, count, tolerance, method, unit);
+  std::vector<Point2D> simplified;
+  simplified.reserve(kIndices.size());
+  for (const auto kIndex : kIndices) {
+    simplified.push_back(points[kIndex]);
+  }
+  return simplified;
+}
+
+auto PolylineSimplifier2D::Simplify(const std::vector<Point2D>& points,
+                                    const Distance& tolerance, Method method,
+                                    Distance::DistanceType unit)
+    -> std::vector<Point2D> {
+  return Simplify(points.data(), points.size(), tolerance, method, unit);
+}
+
+StreamingPolylineSimplifier2D::StreamingPolylineSimplifier2D(
+    const Distance& tolerance, Callback callback, Distance::DistanceType unit,
+    std::size_t window_size)
+    : tolerance_squared_(GetToleranceSquared(tolerance, unit)),
+      callback_(std::move(callback)),
+      window_size_(window_size) {
+  if (window_size_ == 0U) {
+    throw std::invalid_argument("Window size must be positive");
+  }
+  window_.reserve(window_size_);
+}
+
+auto StreamingPolylineSimplifier2D::Push(const Point2D& point) -> void {
+  const Entry kEntry{input_count_++, point};
+  if (kEntry.index == 0U) {
+    Retain(kEntry);
+    return;
+  }
+
+  const auto kFits = std::all_of(
+      window_.begin(), window_.end(), [&](const Entry& entry) {
+        return SegmentSquaredDistance(entry.point, anchor_.point, point) <=
+               tolerance_squared_;
+      });
+  if (!kFits) {
+    Retain(window_.back());
+  }
+  window_.push_back(kEntry);
+  if (window_.size() == window_size_) {
+    Retain(window_.back());
+  }
+}
+
+auto StreamingPolylineSimplifier2D::Finish() -> void {
+  if (!window_.empty()) {
+    Retain(window_.back());
+  }
+  input_count_ = 0U;
+}
+
+auto StreamingPolylineSimplifier2D::GetInputCount() const -> std::size_t {
+  return input_count_;
+}
+
+auto StreamingPolylineSimplifier2D::GetBufferedCount() const -> std::size_t {
+  return window_.size();
+}
+
+auto StreamingPolylineSimplifier2D::Retain(const Entry& entry) -> void {
+  anchor_ = entry;
+  window_.clear();
+  if (callback_) {
+    callback_(anchor_.index, anchor_.point);
+  }
+}
+}  // namespace Jeong0806::geometry
@@ -0,0 +1,518 @@
+/**
+ * @file geometry/src/predicates2d.cpp
+ * @author Jeong Seong In (0806jsi@gmail.com)
+ * @brief Robust orientation and in-circle predicate class developments
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2023 Jeong0806, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/predicates2d.hpp"
+
+#include <array>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+#include "geometry/instrumentation.hpp"
+
+namespace {
+using Jeong0806::geometry::Instrumentation;
+using Jeong0806::geometry::Point2D;
+
+// Expansions are sums of non-overlapping doubles, smallest magnitude first,
+// whose components are computed with error-free transformations. They need
+// round to nearest and no contraction of a * b + c into fused multiply-adds.
+constexpr double kEpsilon{std::numeric_limits<double>::epsilon() / 2.0};
+// 2^27 + 1, splits a double into two halves of at most 26 bits
+constexpr double kSplitter{134217729.0};
+constexpr double kResultErrorBound{(3.0 + (8.0 * kEpsilon)) * kEpsilon};
+constexpr double kOrientErrorBoundA{(3.0 + (16.0 * kEpsilon)) * kEpsilon};
+constexpr double kOrientErrorBoundB{(2.0 + (12.0 * kEpsilon)) * kEpsilon};
+constexpr double kOrientErrorBoundC{(9.0 + (64.0 * kEpsilon)) * kEpsilon *
+                                    kEpsilon};
+constexpr double kInCircleErrorBoundA{(10.0 + (96.0 * kEpsilon)) * kEpsilon};
+constexpr double kInCircleErrorBoundB{(4.0 + (48.0 * kEpsilon)) * kEpsilon};
+constexpr double kInCircleErrorBoundC{(44.0 + (576.0 * kEpsilon)) *
+                                      kEpsilon * kEpsilon};
+
+using Cross = std::array<double, 4U>;
+
+// a + b == sum + tail exactly when |a| >= |b|
+auto FastTwoSumTail(double a, double b, double sum) -> double {
+  return b - (sum - a);
+}
+
+// a + b == sum + tail exactly
+auto TwoSumTail(double a, double b, double sum) -> double {
+  const auto kBVirtual = sum - a;
+  const auto kAVirtual = sum - kBVirtual;
+  return (a - kAVirtual) + (b - kBVirtual);
+}
+
+// a - b == difference + tail exactly
+auto TwoDiffTail(double a, double b, double difference) -> double {
+  const auto kBVirtual = a - difference;
+  const auto kAVirtual = difference + kBVirtual;
+  return (a - kAVirtual) + (kBVirtual - b);
+}
+
+auto Split(double a) -> std::pair<double, double> {
+  const auto kScaled = kSplitter * a;
+  const auto kHigh = kScaled - (kScaled - a);
+  return {kHigh, a - kHigh};
+}
+
+// a * b == product + tail exactly
+auto TwoProductTail(double a, double b, double product) -> double {
+  const auto [kAHigh, kALow] = Split(a);
+  const auto [kBHigh, kBLow] = Split(b);
+  const auto kError1 = product - (kAHigh * kBHigh);
+  const auto kError2 = kError1 - (kALow * kBHigh);
+  const auto kError3 = kError2 - (kAHigh * kBLow);
+  return (kALow * kBLow) - kError3;
+}
+
+// a * b - c * d exactly
+auto CrossExpansion(double a, double b, double c, double d) -> Cross {
+  const auto kLeft = a * b;
+  const auto kLeftTail = TwoProductTail(a, b, kLeft);
+  const auto kRight = c * d;
+  const auto kRightTail = TwoProductTail(c, d, kRight);
+  // (left + left tail) - (right + right tail) in two steps
+  const auto kLow = kLeftTail - kRightTail;
+  const auto kLowTail = TwoDiffTail(kLeftTail, kRightTail, kLow);
+  const auto kMiddle = kLeft + kLow;
+  const auto kMiddleTail = TwoSumTail(kLeft, kLow, kMiddle);
+  const auto kHighLow = kMiddleTail - kRight;
+  const auto kHighLowTail = TwoDiffTail(kMiddleTail, kRight, kHighLow);
+  const auto kHigh = kMiddle + kHighLow;
+  return {kLowTail, kHighLowTail, TwoSumTail(kMiddle, kHighLow, kHigh),
+          kHigh};
+}
+
+// e + f into h, dropping zero components, h_length <= e_length + f_length
+auto ExpansionSum(const double* e, std::size_t e_length, const double* f,
+                  std::size_t f_length, double* h) -> std::size_t {
+  std::size_t e_index = 0;
+  std::size_t f_index = 0;
+  // Merge the components of both in order of magnitude
+  const auto kNext = [&]() {
+    if ((f_index == f_length) ||
+        ((e_index < e_length) &&
+         ((f[f_index] > e[e_index]) == (f[f_index] > -e[e_index])))) {
+      return e[e_index++];
+    }
+    return f[f_index++];
+  };
+  std::size_t h_length = 0;
+  auto sum = kNext();
+  while ((e_index < e_length) || (f_index < f_length)) {
+    const auto kComponent = kNext();
+    const auto kSum = sum + kComponent;
+    const auto kTail = TwoSumTail(sum, kComponent, kSum);
+    sum = kSum;
+    if (kTail != 0.0) {
+      h[h_length++] = kTail;
+    }
+  }
+  if ((sum != 0.0) || (h_length == 0U)) {
+    h[h_length++] = sum;
+  }
+  return h_length;
+}
+
+// e * b into h, dropping zero components, h_length <= 2 * e_length
+auto ScaleExpansion(const double* e, std::size_t e_length, double b,
+                    double* h) -> std::size_t {
+  std::size_t h_length = 0;
+  auto sum = e[0] * b;
+  const auto kTail = TwoProductTail(e[0], b, sum);
+  if (kTail != 0.0) {
+    h[h_length++] = kTail;
+  }
+  for (std::size_t i = 1; i < e_length; ++i) {
+    const auto kProduct = e[i] * b;
+    const auto kProductTail = TwoProductTail(e[i], b, kProduct);
+    const auto kLow = sum + kProductTail;
+    const auto kLowTail = TwoSumTail(sum, kProductTail, kLow);
+    if (kLowTail != 0.0) {
+      h[h_length++] = kLowTail;
+    }
+    sum = kProduct + kLow;
+    const auto kSumTail = FastTwoSumTail(kProduct, kLow, sum);
+    if (kSumTail != 0.0) {
+      h[h_length++] = kSumTail;
+    }
+  }
+  if ((sum != 0.0) || (h_length == 0U)) {
+    h[h_length++] = sum;
+  }
+  return h_length;
+}
+
+auto Estimate(const double* e, std::size_t e_length) -> double {
+  double sum = 0.0;
+  for (std::size_t i = 0; i < e_length; ++i) {
+    sum += e[i];
+  }
+  return sum;
+}
+
+// (x^2 + y^2) * e into h for e_length <= 12, h_length <= 8 * e_length
+auto LiftExpansion(const double* e, std::size_t e_length, double x, double y,
+                   double* h) -> std::size_t {
+  std::array<double, 24U> x_once{};
+  std::array<double, 48U> x_twice{};
+  std::array<double, 24U> y_once{};
+  std::array<double, 48U> y_twice{};
+  const auto kXOnce = ScaleExpansion(e, e_length, x, x_once.data());
+  const auto kXTwice = ScaleExpansion(x_once.data(), kXOnce, x,
+                                      x_twice.data());
+  const auto kYOnce = ScaleExpansion(e, e_length, y, y_once.data());
+  const auto kYTwice = ScaleExpansion(y_once.data(), kYOnce, y,
+                                      y_twice.data());
+  return ExpansionSum(x_twice.data(), kXTwice, y_twice.data(), kYTwice, h);
+}
+
+auto OrientAdaptive(double ax, double ay, double bx, double by, double cx,
+                    double cy, double permanent) -> double {
+  const auto kAcx = ax - cx;
+  const auto kBcx = bx - cx;
+  const auto kAcy = ay - cy;
+  const auto kBcy = by - cy;
+  // Exact determinant of the rounded differences
+  const auto kB = CrossExpansion(kAcx, kBcy, kAcy, kBcx);
+  auto det = Estimate(kB.data(), kB.size());
+  auto error_bound = kOrientErrorBoundB * permanent;
+  if ((det >= error_bound) || (-det >= error_bound)) {
+    return det;
+  }
+
+  const auto kAcxTail = TwoDiffTail(ax, cx, kAcx);
+  const auto kBcxTail = TwoDiffTail(bx, cx, kBcx);
+  const auto kAcyTail = TwoDiffTail(ay, cy, kAcy);
+  const auto kBcyTail = TwoDiffTail(by, cy, kBcy);
+  if ((kAcxTail == 0.0) && (kAcyTail == 0.0) && (kBcxTail == 0.0) &&
+      (kBcyTail == 0.0)) {
+    return det;
+  }
+  // First order correction for the rounding of the differences
+  error_bound = (kOrientErrorBoundC * permanent) +
+                (kResultErrorBound * std::abs(det));
+  det += ((kAcx * kBcyTail) + (kBcy * kAcxTail)) -
+         ((kAcy * kBcxTail) + (kBcx * kAcyTail));
+  if ((det >= error_bound) || (-det >= error_bound)) {
+    return det;
+  }
+
+  std::array<double, 8U> c1{};
+  std::array<double, 12U> c2{};
+  std::array<double, 16U> d{};
+  auto u = CrossExpansion(kAcxTail, kBcy, kAcyTail, kBcx);
+  const auto kC1Length =
+      ExpansionSum(kB.data(), kB.size(), u.data(), u.size(), c1.data());
+  u = CrossExpansion(kAcx, kBcyTail, kAcy, kBcxTail);
+  const auto kC2Length =
+      ExpansionSum(c1.data(), kC1Length, u.data(), u.size(), c2.data());
+  u = CrossExpansion(kAcxTail, kBcyTail, kAcyTail, kBcxTail);
+  const auto kDLength =
+      ExpansionSum(c2.data(), kC2Length, u.data(), u.size(), d.data());
+  return d[kDLength - 1U];
+}
+
+auto OrientDeterminant(double ax, double ay, double bx, double by, double cx,
+                       double cy) -> double {
+  const auto kLeft = (ax - cx) * (by - cy);
+  const auto kRight = (ay - cy) * (bx - cx);
+  const auto kDet = kLeft - kRight;
+  // Terms of opposite signs or a zero term leave the sign of kDet exact
+  double permanent = 0.0;
+  if (kLeft > 0.0) {
+    if (kRight <= 0.0) {
+      return kDet;
+    }
+    permanent = kLeft + kRight;
+  } else if (kLeft < 0.0) {
+    if (kRight >= 0.0) {
+      return kDet;
+    }
+    permanent = -kLeft - kRight;
+  } else {
+    return kDet;
+  }
+  const auto kErrorBound = kOrientErrorBoundA * permanent;
+  if ((kDet >= kErrorBound) || (-kDet >= kErrorBound)) {
+    return kDet;
+  }
+  Instrumentation::Add(Instrumentation::Counter::kPredicateFallbacks, 1U);
+  return OrientAdaptive(ax, ay, bx, by, cx, cy, permanent);
+}
+
+// The lifted 4 by 4 determinant from the raw coordinates, exactly
+auto InCircleExact(double ax, double ay, double bx, double by, double cx,
+                   double cy, double dx, double dy) -> double {
+  const auto kAb = CrossExpansion(ax, by, bx, ay);
+  const auto kBc = CrossExpansion(bx, cy, cx, by);
+  const auto kCd = CrossExpansion(cx, dy, dx, cy);
+  const auto kDa = CrossExpansion(dx, ay, ax, dy);
+  auto ac = CrossExpansion(ax, cy, cx, ay);
+  auto bd = CrossExpansion(bx, dy, dx, by);
+
+  std::array<double, 8U> pair{};
+  std::array<double, 12U> cda{};
+  std::array<double, 12U> dab{};
+  std::array<double, 12U> abc{};
+  std::array<double, 12U> bcd{};
+  auto pair_length = ExpansionSum(kCd.data(), 4U, kDa.data(), 4U, pair.data());
+  const auto kCdaLength =
+      ExpansionSum(pair.data(), pair_length, ac.data(), 4U, cda.data());
+  pair_length = ExpansionSum(kDa.data(), 4U, kAb.data(), 4U, pair.data());
+  const auto kDabLength =
+      ExpansionSum(pair.data(), pair_length, bd.data(), 4U, dab.data());
+  for (std::size_t i = 0; i < 4U; ++i) {
+    ac[i] = -ac[i];
+    bd[i] = -bd[i];
+  }
+  pair_length = ExpansionSum(kAb.data(), 4U, kBc.data(), 4U, pair.data());
+  const auto kAbcLength =
+      ExpansionSum(pair.data(), pair_length, ac.data(), 4U, abc.data());
+  pair_length = ExpansionSum(kBc.data(), 4U, kCd.data(), 4U, pair.data());
+  const auto kBcdLength =
+      ExpansionSum(pair.data(), pair_length, bd.data(), 4U, bcd.data());
+
+  std::array<double, 96U> a_det{};
+  std::array<double, 96U> b_det{};
+  std::array<double, 96U> c_det{};
+  std::array<double, 96U> d_det{};
+  const auto kALength =
+      LiftExpansion(bcd.data(), kBcdLength, ax, ay, a_det.data());
+  const auto kBLength =
+      LiftExpansion(cda.data(), kCdaLength, bx, by, b_det.data());
+  const auto kCLength =
+      LiftExpansion(dab.data(), kDabLength, cx, cy, c_det.data());
+  const auto kDLength =
+      LiftExpansion(abc.data(), kAbcLength, dx, dy, d_det.data());
+  for (std::size_t i = 0; i < kBLength; ++i) {
+    b_det[i] = -b_det[i];
+  }
+  for (std::size_t i = 0; i < kDLength; ++i) {
+    d_det[i] = -d_det[i];
+  }
+
+  std::array<double, 192U> ab_det{};
+  std::array<double, 192U> cd_det{};
+  std::array<double, 384U> det{};
+  const auto kAbLength = ExpansionSum(a_det.data(), kALength, b_det.data(),
+                                      kBLength, ab_det.data());
+  const auto kCdLength = ExpansionSum(c_det.data(), kCLength, d_det.data(),
+                                      kDLength, cd_det.data());
+  const auto kLength = ExpansionSum(ab_det.data(), kAbLength, cd_det.data(),
+                                    kCdLength, det.data());
+  return det[kLength - 1U];
+}
+
+auto InCircleAdaptive(double ax, double ay, double bx, double by, double cx,
+                      double cy, double dx, double dy, double permanent)
+    -> double {
+  const auto kAdx = ax - dx;
+  const auto kBdx = bx - dx;
+  const auto kCdx = cx - dx;
+  const auto kAdy = ay - dy;
+  const auto kBdy = by - dy;
+  const auto kCdy = cy - dy;
+  // Exact determinant of the rounded differences
+  const auto kBc = CrossExpansion(kBdx, kCdy, kCdx, kBdy);
+  const auto kCa = CrossExpansion(kCdx, kAdy, kAdx, kCdy);
+  const auto kAb = CrossExpansion(kAdx, kBdy, kBdx, kAdy);
+  std::array<double, 32U> a_det{};
+  std::array<double, 32U> b_det{};
+  std::array<double, 32U> c_det{};
+  std::array<double, 64U> ab_det{};
+  std::array<double, 96U> fin{};
+  const auto kALength =
+      LiftExpansion(kBc.data(), kBc.size(), kAdx, kAdy, a_det.data());
+  const auto kBLength =
+      LiftExpansion(kCa.data(), kCa.size(), kBdx, kBdy, b_det.data());
+  const auto kCLength =
+      LiftExpansion(kAb.data(), kAb.size(), kCdx, kCdy, c_det.data());
+  const auto kAbLength = ExpansionSum(a_det.data(), kALength, b_det.data(),
+                                      kBLength, ab_det.data());
+  const auto kFinLength = ExpansionSum(ab_det.data(), kAbLength, c_det.data(),
+                                       kCLength, fin.data());
+  auto det = Estimate(fin.data(), kFinLength);
+  auto error_bound = kInCircleErrorBoundB * permanent;
+  if ((det >= error_bound) || (-det >= error_bound)) {
+    return det;
+  }
+
+  const auto kAdxTail = TwoDiffTail(ax, dx, kAdx);
+  const auto kAdyTail = TwoDiffTail(ay, dy, kAdy);
+  const auto kBdxTail = TwoDiffTail(bx, dx, kBdx);
+  const auto kBdyTail = TwoDiffTail(by, dy, kBdy);
+  const auto kCdxTail = TwoDiffTail(cx, dx, kCdx);
+  const auto kCdyTail = TwoDiffTail(cy, dy, kCdy);
+  if ((kAdxTail == 0.0) && (kBdxTail == 0.0) && (kCdxTail == 0.0) &&
+      (kAdyTail == 0.0) && (kBdyTail == 0.0) && (kCdyTail == 0.0)) {
+    return det;
+  }
+  // First order correction for the rounding of the differences
+  error_bound = (kInCircleErrorBoundC * permanent) +
+                (kResultErrorBound * std::abs(det));
+  det += ((((kAdx * kAdx) + (kAdy * kAdy)) *
+           (((kBdx * kCdyTail) + (kCdy * kBdxTail)) -
+            ((kBdy * kCdxTail) + (kCdx * kBdyTail)))) +
+          (2.0 * ((kAdx * kAdxTail) + (kAdy * kAdyTail)) *
+           ((kBdx * kCdy) - (kBdy * kCdx)))) +
+         ((((kBdx * kBdx) + (kBdy * kBdy)) *
+           (((kCdx * kAdyTail) + (kAdy * kCdxTail)) -
+            ((kCdy * kAdxTail) + (kAdx * kCdyTail)))) +
+          (2.0 * ((kBdx * kBdxTail) + (kBdy * kBdyTail)) *
+           ((kCdx * kAdy) - (kCdy * kAdx)))) +
+         ((((kCdx * kCdx) + (kCdy * kCdy)) *
+           (((kAdx * kBdyTail) + (kBdy * kAdxTail)) -
+            ((kAdy * kBdxTail) + (kBdx * kAdyTail)))) +
+          (2.0 * ((kCdx * kCdxTail) + (kCdy * kCdyTail)) *
+           ((kAdx * kBdy) - (kAdy * kBdx))));
+  if ((det >= error_bound) || (-det >= error_bound)) {
+    return det;
+  }
+  return InCircleExact(ax, ay, bx, by, cx, cy, dx, dy);
+}
+
+auto InCircleDeterminant(double ax, double ay, double bx, double by,
+                         double cx, double cy, double dx, double dy) -> double {
+  const auto kAdx = ax - dx;
+  const auto kBdx = bx - dx;
+  const auto kCdx = cx - dx;
+  const auto kAdy = ay - dy;
+  const auto kBdy = by - dy;
+  const auto kCdy = cy - dy;
+
+  const auto kBdxCdy = kBdx * kCdy;
+  const auto kCdxBdy = kCdx * kBdy;
+  const auto kALift = (kAdx * kAdx) + (kAdy * kAdy);
+  const auto kCdxAdy = kCdx * kAdy;
+  const auto kAdxCdy = kAdx * kCdy;
+  const auto kBLift = (kBdx * kBdx) + (kBdy * kBdy);
+  const auto kAdxBdy = kAdx * kBdy;
+  const auto kBdxAdy = kBdx * kAdy;
+  const auto kCLift = (kCdx * kCdx) + (kCdy * kCdy);
+
+  const auto kDet = (kALift * (kBdxCdy - kCdxBdy)) +
+                    (kBLift * (kCdxAdy - kAdxCdy)) +
+                    (kCLift * (kAdxBdy - kBdxAdy));
+  const auto kPermanent =
+      ((std::abs(kBdxCdy) + std::abs(kCdxBdy)) * kALift) +
+      ((std::abs(kCdxAdy) + std::abs(kAdxCdy)) * kBLift) +
+      ((std::abs(kAdxBdy) + std::abs(kBdxAdy)) * kCLift);
+  const auto kErrorBound = kInCircleErrorBoundA * kPermanent;
+  if ((kDet > kErrorBound) || (-kDet > kErrorBound)) {
+    return kDet;
+  }
+  Instrumentation::Add(Instrumentation::Counter::kPredicateFallbacks, 1U);
+  return InCircleAdaptive(ax, ay, bx, by, cx, cy, dx, dy, kPermanent);
+}
+
+auto Sign(double value) -> int8_t {
+  return static_cast<int8_t>(static_cast<int8_t>(value > 0.0) -
+                             static_cast<int8_t>(value < 0.0));
+}
+}  // namespace
+
+namespace Jeong0806::geometry {
+auto Predicates2D::Orient2D(const Point2D& a, const Point2D& b,
+                            const Point2D& c) -> double {
+  Instrumentation::Add(Instrumentation::Counter::kPredicateTests, 1U);
+  return OrientDeterminant(a.GetX(), a.GetY(), b.GetX(), b.GetY(), c.GetX(),
+                           c.GetY());
+}
+
+auto Predicates2D::InCircle(const Point2D& a, const Point2D& b,
+                            const Point2D& c, const Point2D& d) -> double {
+  Instrumentation::Add(Instrumentation::Counter::kPredicateTests, 1U);
+  return InCircleDeterminant(a.GetX(), a.GetY(), b.GetX(), b.GetY(), c.GetX(),
+                             c.GetY(), d.GetX(), d.GetY());
+}
+
+auto Predicates2D::Orient2D(const Point2D& a, const Point2D& b,
+                            const Point2D* points, std::size_t count,
+                            int8_t* output, std::size_t thread_count,
+                            Executor* executor) -> void {
+  Instrumentation::Add(Instrumentation::Counter::kPredicateTests, count);
+  ParallelFor(
+      count,
+      [&](std::size_t begin, std::size_t end) {
+        for (auto i = begin; i < end; ++i) {
+          output[i] =
+              Sign(OrientDeterminant(a.GetX(), a.GetY(), b.GetX(), b.GetY(),
+                                     points[i].GetX(), points[i].GetY()));
+        }
+      },
+      thread_count, executor);
+}
+
+auto Predicates2D::Orient2D(const Point2D& a, const Point2D& b,
+                            const PointCloud2D& points,
+                            std::size_t thread_count, Executor* executor)
+    -> std::vector<int8_t> {
+  Instrumentation::Add(Instrumentation::Counter::kPredicateTests,
+                       points.Size());
+  std::vector<int8_t> output(points.Size());
+  const auto* const kXs = points.GetXData();
+  const auto* const kYs = points.GetYData();
+  ParallelFor(
+      output.size(),
+      [&](std::size_t begin, std::size_t end) {
+        for (auto i = begin; i < end; ++i) {
+          output[i] = Sign(OrientDeterminant(a.GetX(), a.GetY(), b.GetX(),
+                                             b.GetY(), kXs[i], kYs[i]));
+        }
+      },
+      thread_count, executor);
+  return output;
+}
+
+auto Predicates2D::InCircle(const Point2D& a, const Point2D& b,
+                            const Point2D& c, const Point2D* points,
+                            std::size_t count, int8_t* output,
+                            std::size_t thread_count, Executor* executor)
+    -> void {
+  Instrumentation::Add(Instrumentation::Counter::kPredicateTests, count);
+  ParallelFor(
+      count,
+      [&](std::size_t begin, std::size_t end) {
+        for (auto i = begin; i < end; ++i) {
+          output[i] = Sign(InCircleDeterminant(
+              a.GetX(), a.GetY(), b.GetX(), b.GetY(), c.GetX(), c.GetY(),
+              points[i].GetX(), points[i].GetY()));
+        }
+      },
+      thread_count, executor);
+}
+
+auto Predicates2D::InCircle(const Point2D& a, const Point2D& b,
+                            const Point2D& c, const PointCloud2D& points,
+                            std::size_t thread_count, Executor* executor)
+    -> std::vector<int8_t> {
+  Instrumentation::Add(Instrumentation::Counter::kPredicateTests,
+                       points.Size());
+  std::vector<int8_t> output(points.Size());
+  const auto* const kXs = points.GetXData();
+  const auto* const kYs = points.GetYData();
+  ParallelFor(
+      output.size(),
+      [&](std::size_t begin, std::size_t end) {
+        for (auto i = begin; i < end; ++i) {
+          output[i] = Sign(InCircleDeterminant(a.GetX(), a.GetY(), b.GetX(),
+                                               b.GetY(), c.GetX(), c.GetY(),
+                                               kXs[i], kYs[i]));
+        }
+      },
+      thread_count, executor);
+  return output;
+}
+}  // namespace Jeong0806::geometry
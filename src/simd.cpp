@@ -0,0 +1,76 @@
+/**
+ * @file geometry/src/simd.cpp
+ * @author Jeong Seong In (0806jsi@gmail.com)
+ * @brief Runtime selection developments of the SIMD instruction set
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2023 Jeong0806, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/simd.hpp"
+
+#include <atomic>
+#include <stdexcept>
+
+namespace {
+constexpr int kUndetected{-1};
+
+std::atomic<int> active_level{kUndetected};
+}  // namespace
+
+namespace Jeong0806::geometry {
+auto DetectSimdLevel() -> SimdLevel {
+#if defined(Jeong0806_GEOMETRY_SIMD_X86)
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f") &&
+      __builtin_cpu_supports("avx512dq")) {
+    return SimdLevel::kAvx512;
+  }
+  if (__builtin_cpu_supports("avx2")) {
+    return SimdLevel::kAvx2;
+  }
+  return SimdLevel::kScalar;
+#elif defined(Jeong0806_GEOMETRY_SIMD_NEON)
+  return SimdLevel::kNeon;
+#else
+  return SimdLevel::kScalar;
+#endif
+}
+
+auto GetSimdLevel() -> SimdLevel {
+  auto level = active_level.load(std::memory_order_relaxed);
+  if (level == kUndetected) {
+    level = static_cast<int>(DetectSimdLevel());
+    active_level.store(level, std::memory_order_relaxed);
+  }
+  return static_cast<SimdLevel>(level);
+}
+
+auto SetSimdLevel(SimdLevel level) -> SimdLevel {
+  if (!IsSimdLevelSupported(level)) {
+    throw std::invalid_argument("SIMD level is not supported by this CPU");
+  }
+  active_level.store(static_cast<int>(level), std::memory_order_relaxed);
+  return level;
+}
+
+auto IsSimdLevelSupported(SimdLevel level) -> bool {
+  const auto kDetected = DetectSimdLevel();
+  switch (level) {
+    case SimdLevel::kScalar:
+      return true;
+    case SimdLevel::kNeon:
+      return kDetected == SimdLevel::kNeon;
+    case SimdLevel::kAvx2:
+      return (kDetected == SimdLevel::kAvx2) ||
+             (kDetected == SimdLevel::kAvx512);
+    case SimdLevel::kAvx512:
+      return kDetected == SimdLevel::kAvx512;
+    default:
+      return false;
+  }
+}
+}  // namespace Jeong0806::geometry
@@ -0,0 +1,337 @@
+/**
+ * @file geometry/src/spatial_hash_grid2d.cpp
+ * @author Jeong Seong In (0806jsi@gmail.com)
+ * @brief Uniform grid class developments for fixed-radius neighbor queries
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2023 Jeong0806, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/spatial_hash_grid2d.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+
+#include "geometry/instrumentation.hpp"
+#include "geometry/parallel.hpp"
+
+namespace {
+// Below this many points the build runs on the calling thread
+constexpr std::size_t kParallelBuildCount{std::size_t{1} << 14U};
+// Dense grids may have this many cells per point before switching to hashing
+constexpr double kDenseCellsPerPoint{2.0};
+constexpr double kMinDenseCells{64.0};
+// Clamp of cell indices, far from overflow when neighbors are added
+constexpr double kMaxCell{4.0e+18};
+constexpr uint64_t kHashX{0x9E3779B97F4A7C15ULL};
+constexpr uint64_t kHashY{0xC2B2AE3D27D4EB4FULL};
+
+auto NextPowerOfTwo(std::size_t value) -> std::size_t {
+  std::size_t result = 1U;
+  while (result < value) {
+    result <<= 1U;
+  }
+  return result;
+}
+}  // namespace
+
+namespace Jeong0806::geometry {
+SpatialHashGrid2D::SpatialHashGrid2D(const Point2D* points, std::size_t count,
+                                     const Distance& cell_size,
+                                     Distance::DistanceType unit,
+                                     std::size_t thread_count,
+                                     std::pmr::memory_resource* resource,
+                                     Executor* executor)
+    : unit_(unit),
+      cell_size_(cell_size.GetValue(unit)),
+      bucket_starts_(resource),
+      xs_(resource),
+      ys_(resource),
+      indices_(resource) {
+  const Instrumentation::ScopedTimer kTimer(
+      Instrumentation::Timer::kSpatialHashGridBuild);
+  if (!(cell_size_ > 0.0) || !std::isfinite(cell_size_)) {
+    throw std::invalid_argument("Cell size must be positive");
+  }
+  if (count > std::numeric_limits<uint32_t>::max()) {
+    throw std::length_error("SpatialHashGrid2D supports up to 2^32 - 1 points");
+  }
+  if (count < kParallelBuildCount) {
+    thread_count = 1U;
+  }
+  if (count == 0U) {
+    bucket_starts_.assign(1U, 0U);
+    return;
+  }
+
+  auto min_x = std::numeric_limits<double>::infinity();
+  auto min_y = std::numeric_limits<double>::infinity();
+  auto max_x = -std::numeric_limits<double>::infinity();
+  auto max_y = -std::numeric_limits<double>::infinity();
+  std::mutex bounds_mutex;
+  ParallelFor(
+      count,
+      [&](std::size_t begin, std::size_t end) {
+        auto local_min_x = std::numeric_limits<double>::infinity();
+        auto local_min_y = std::numeric_limits<double>::infinity();
+        auto local_max_x = -std::numeric_limits<double>::infinity();
+        auto local_max_y = -std::numeric_limits<double>::infinity();
+        for (auto i = begin; i < end; ++i) {
+          local_min_x = std::min(local_min_x, points[i].GetX());
+          local_max_x = std::max(local_max_x, points[i].GetX());
+          local_min_y = std::min(local_min_y, points[i].GetY());
+          local_max_y = std::max(local_max_y, points[i].GetY());
+        }
+        const std::lock_guard<std::mutex> kLock(bounds_mutex);
+        min_x = std::min(min_x, local_min_x);
+        max_x = std::max(max_x, local_max_x);
+        min_y = std::min(min_y, local_min_y);
+        max_y = std::max(max_y, local_max_y);
+      },
+      thread_count, executor);
+  origin_x_ = min_x;
+  origin_y_ = min_y;
+
+  const auto kCellsX = std::floor((max_x - min_x) / cell_size_) + 1.0;
+  const auto kCellsY = std::floor((max_y - min_y) / cell_size_) + 1.0;
+  std::size_t bucket_count = 0;
+  if (kCellsX * kCellsY <=
+      std::max(kMinDenseCells, kDenseCellsPerPoint * count)) {
+    cells_x_ = static_cast<int64_t>(kCellsX);
+    cells_y_ = static_cast<int64_t>(kCellsY);
+    bucket_count = static_cast<std::size_t>(cells_x_ * cells_y_);
+  } else {
+    bucket_count = NextPowerOfTwo(2U * count);
+  }
+
+  // Counting sort by bucket, scattered with atomic cursors
+  bucket_starts_.resize(bucket_count + 1U);
+  std::pmr::vector<uint32_t> buckets(count, resource);
+  std::pmr::vector<std::atomic<uint32_t>> cursors(bucket_count + 1U, resource);
+  ParallelFor(
+      count,
+      [&](std::size_t begin, std::size_t end) {
+        for (auto i = begin; i < end; ++i) {
+          buckets[i] = static_cast<uint32_t>(
+              GetBucket(GetCell(points[i].GetX(), origin_x_),
+                        GetCell(points[i].GetY(), origin_y_)));
+          cursors[buckets[i] + 1U].fetch_add(1U, std::memory_order_relaxed);
+        }
+      },
+      thread_count, executor);
+
+  uint32_t offset = 0;
+  for (std::size_t bucket = 0; bucket <= bucket_count; ++bucket) {
+    offset += cursors[bucket].load(std::memory_order_relaxed);
+    bucket_starts_[bucket] = offset;
+    cursors[bucket].store(offset, std::memory_order_relaxed);
+  }
+
+  indices_.resize(count);
+  ParallelFor(
+      count,
+      [&](std::size_t begin, std::size_t end) {
+        for (auto i = begin; i < end; ++i) {
+          const auto kPosition =
+              cursors[buckets[i]].fetch_add(1U, std::memory_order_relaxed);
+          indices_[kPosition] = static_cast<uint32_t>(i);
+        }
+      },
+      thread_count, executor);
+
+  // Restore input order within each bucket so the layout is deterministic
+  xs_.resize(count);
+  ys_.resize(count);
+  ParallelFor(
+      bucket_count,
+      [&](std::size_t begin, std::size_t end) {
+        for (auto bucket = begin; bucket < end; ++bucket) {
+          const auto kFirst = indices_.begin() + bucket_starts_[bucket];
+          const auto kLast = indices_.begin() + bucket_starts_[bucket + 1U];
+          std::sort(kFirst, kLast);
+          for (auto position = bucket_starts_[bucket];
+               position < bucket_starts_[bucket + 1U]; ++position) {
+            xs_[position] = points[indices_[position]].GetX();
+            ys_[position] = points[indices_[position]].GetY();
+          }
+        }
+      },
+      thread_count, executor);
+}
+
+SpatialHashGrid2D::SpatialHashGrid2D(const std::vector<Point2D>& points,
+                                     const Distance& cell_size,
+                                     Distance::DistanceType unit,
+                                     std::size_t thread_count,
+                                     std::pmr::memory_resource* resource,
+                                     Executor* executor)
+    : SpatialHashGrid2D(points.data(), points.size(), cell_size, unit,
+                        thread_count, resource, executor) {}
+
+auto SpatialHashGrid2D::Size() const -> std::size_t { return indices_.size(); }
+
+auto SpatialHashGrid2D::Empty() const -> bool { return indices_.empty(); }
+
+auto SpatialHashGrid2D::GetResource() const -> std::pmr::memory_resource* {
+  return indices_.get_allocator().resource();
+}
+
+auto SpatialHashGrid2D::GetCellSize() const -> Distance {
+  return Distance(cell_size_, unit_);
+}
+
+auto SpatialHashGrid2D::GetBucketCount() const -> std::size_t {
+  return bucket_starts_.empty() ? 0U : bucket_starts_.size() - 1U;
+}
+
+auto SpatialHashGrid2D::GetCell(double value, double origin) const
+    -> int64_t {
+  const auto kCell = std::floor((value - origin) / cell_size_);
+  return static_cast<int64_t>(std::clamp(kCell, -kMaxCell, kMaxCell));
+}
+
+auto SpatialHashGrid2D::GetBucket(int64_t cell_x, int64_t cell_y) const
+    -> std::size_t {
+  if (cells_x_ > 0) {
+    return static_cast<std::size_t>((cell_y * cells_x_) + cell_x);
+  }
+  auto hash = (static_cast<uint64_t>(cell_x) * kHashX) ^
+              (static_cast<uint64_t>(cell_y) * kHashY);
+  hash ^= hash >> 32U;
+  return static_cast<std::size_t>(hash & (GetBucketCount() - 1U));
+}
+
+template <typename Visitor>
+auto SpatialHashGrid2D::VisitBuckets(const Point2D& query, double radius,
+                                     Visitor&& visit) const -> void {
+  if (Empty() || !(radius >= 0.0)) {
+    return;
+  }
+  auto first_x = GetCell(query.GetX() - radius, origin_x_);
+  auto last_x = GetCell(query.GetX() + radius, origin_x_);
+  auto first_y = GetCell(query.GetY() - radius, origin_y_);
+  auto last_y = GetCell(query.GetY() + radius, origin_y_);
+  const auto kVisitBucket = [this, &visit](std::size_t bucket) {
+    Instrumentation::Add(Instrumentation::Counter::kIndexNodeVisits);
+    Instrumentation::Add(
+        Instrumentation::Counter::kIndexPointTests,
+        bucket_starts_[bucket + 1U] - bucket_starts_[bucket]);
+    for (auto position = bucket_starts_[bucket];
+         position < bucket_starts_[bucket + 1U]; ++position) {
+      visit(position);
+    }
+  };
+
+  if (cells_x_ > 0) {
+    first_x = std::max<int64_t>(first_x, 0);
+    first_y = std::max<int64_t>(first_y, 0);
+    last_x = std::min<int64_t>(last_x, cells_x_ - 1);
+    last_y = std::min<int64_t>(last_y, cells_y_ - 1);
+    for (auto cell_y = first_y; cell_y <= last_y; ++cell_y) {
+      for (auto cell_x = first_x; cell_x <= last_x; ++cell_x) {
+        kVisitBucket(GetBucket(cell_x, cell_y));
+      }
+    }
+    return;
+  }
+
+  // Hashed cells may share a bucket, so visit each bucket once
+  const auto kCellCount = static_cast<double>(last_x - first_x + 1) *
+                          static_cast<double>(last_y - first_y + 1);
+  if (kCellCount >= static_cast<double>(GetBucketCount())) {
+    Instrumentation::Add(Instrumentation::Counter::kIndexNodeVisits,
+                         GetBucketCount());
+    Instrumentation::Add(Instrumentation::Counter::kIndexPointTests,
+                         indices_.size());
+    for (std::size_t position = 0; position < indices_.size(); ++position) {
+      visit(static_cast<uint32_t>(position));
+    }
+    return;
+  }
+  std::vector<std::size_t> buckets;
+  buckets.reserve(static_cast<std::size_t>(kCellCount));
+  for (auto cell_y = first_y; cell_y <= last_y; ++cell_y) {
+    for (auto cell_x = first_x; cell_x <= last_x; ++cell_x) {
+      buckets.push_back(GetBucket(cell_x, cell_y));
+    }
+  }
+  std::sort(buckets.begin(), buckets.end());
+  buckets.erase(std::unique(buckets.begin(), buckets.end()), buckets.end());
+  for (const auto kBucket : buckets) {
+    kVisitBucket(kBucket);
+  }
+}
+
+auto SpatialHashGrid2D::Radius(const Point2D& query, double radius) const
+    -> std::vector<Neighbor> {
+  std::vector<Neighbor> neighbors;
+  const auto kRadiusSquared = radius * radius;
+  VisitBuckets(query, radius, [&](uint32_t position) {
+    const auto kDx = xs_[position] - query.GetX();
+    const auto kDy = ys_[position] - query.GetY();
+    const auto kSquared = (kDx * kDx) + (kDy * kDy);
+    if (kSquared <= kRadiusSquared) {
+      neighbors.push_back(Neighbor{indices_[position], std::sqrt(kSquared)});
+    }
+  });
+  std::sort(neighbors.begin(), neighbors.end());
+  return neighbors;
+}
+
+auto SpatialHashGrid2D::Radius(const Point2D& query,
+                               const Distance& radius) const
+    -> std::vector<Neighbor> {
+  return Radius(query, radius.GetValue(unit_));
+}
+
+auto SpatialHashGrid2D::PairsWithin(double radius,
+                                    std::size_t thread_count,
+                                    Executor* executor) const
+    -> std::vector<NeighborPair> {
+  const Instrumentation::ScopedTimer kTimer(
+      Instrumentation::Timer::kSpatialHashGridQuery);
+  std::vector<NeighborPair> pairs;
+  std::mutex pairs_mutex;
+  const auto kRadiusSquared = radius * radius;
+  ParallelFor(
+      indices_.size(),
+      [&](std::size_t begin, std::size_t end) {
+        std::vector<NeighborPair> local_pairs;
+        for (auto source = begin; source < end; ++source) {
+          const auto kIndex = indices_[source];
+          const Point2D kSource(xs_[source], ys_[source]);
+          VisitBuckets(kSource, radius, [&](uint32_t target) {
+            if (indices_[target] <= kIndex) {
+              return;
+            }
+            const auto kDx = xs_[target] - kSource.GetX();
+            const auto kDy = ys_[target] - kSource.GetY();
+            const auto kSquared = (kDx * kDx) + (kDy * kDy);
+            if (kSquared <= kRadiusSquared) {
+              local_pairs.push_back(
+                  NeighborPair{kIndex, indices_[target], std::sqrt(kSquared)});
+            }
+          });
+        }
+        const std::lock_guard<std::mutex> kLock(pairs_mutex);
+        pairs.insert(pairs.end(), local_pairs.begin(), local_pairs.end());
+      },
+      thread_count, executor);
+  std::sort(pairs.begin(), pairs.end());
+  return pairs;
+}
+
+auto SpatialHashGrid2D::PairsWithin(const Distance& radius,
+                                    std::size_t thread_count,
+                                    Executor* executor) const
+    -> std::vector<NeighborPair> {
+  return PairsWithin(radius.GetValue(unit_), thread_count, executor);
+}
+}  // namespace Jeong0806::geometry
@@ -0,0 +1,88 @@
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#ifndef Jeong0806_GEOMETRY_TEST_PERFORMENCE_BENCHMARK_HELPER_HPP_
+#define Jeong0806_GEOMETRY_TEST_PERFORMENCE_BENCHMARK_HELPER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "geometry/point2d.hpp"
+
+namespace Jeong0806::geometry::benchmark_helper {
+/// Smallest data size, resident in L1 cache
+constexpr int64_t kMinDataSize{int64_t{1} << 8};
+/// Largest data size, well beyond last level cache
+constexpr int64_t kMaxDataSize{int64_t{1} << 24};
+/// Multiplier between data sizes, 256 / 4K / 64K / 1M / 16M
+constexpr int64_t kDataSizeMultiplier{16};
+/// Seed of generated data so every run measures the same input
+constexpr uint64_t kSeed{0x5EED};
+/// Coordinate range of generated points
+constexpr double kCoordinateRange{1.0e+6};
+
+/**
+ * @brief Apply the data sizes from L1-resident up to larger than cache
+ * @param bench The benchmark to parameterize
+ */
+inline auto ApplyDataSizes(::benchmark::internal::Benchmark* bench) -> void {
+  bench->RangeMultiplier(kDataSizeMultiplier)->Range(kMinDataSize,
+                                                     kMaxDataSize);
+}
+
+/**
+ * @brief Make uniformly distributed random points
+ * @param count The number of points
+ * @param seed The random seed
+ * @return std::vector<Point2D> The points
+ */
+inline auto MakeRandomPoints(std::size_t count, uint64_t seed = kSeed)
+    -> std::vector<Point2D> {
+  std::mt19937_64 engine(seed);
+  std::uniform_real_distribution<double> coordinate(-kCoordinateRange,
+                                                    kCoordinateRange);
+  std::vector<Point2D> points(count);
+  for (auto& point : points) {
+    point = Point2D(coordinate(engine), coordinate(engine));
+  }
+  return points;
+}
+
+/**
+ * @brief Make uniformly distributed random values
+ * @param count The number of values
+ * @param seed The random seed
+ * @return std::vector<double> The values
+ */
+inline auto MakeRandomValues(std::size_t count, uint64_t seed = kSeed)
+    -> std::vector<double> {
+  std::mt19937_64 engine(seed);
+  std::uniform_real_distribution<double> value(0.0, kCoordinateRange);
+  std::vector<double> values(count);
+  for (auto& element : values) {
+    element = value(engine);
+  }
+  return values;
+}
+
+/**
+ * @brief Report items/s, bytes/s and ns/op of the finished benchmark loop
+ * @param state The benchmark state
+ * @param items Items processed per iteration
+ * @param bytes_per_item Bytes touched per item
+ */
+inline auto SetThroughput(::benchmark::State& state, int64_t items,
+                          int64_t bytes_per_item) -> void {
+  const auto kTotalItems = static_cast<int64_t>(state.iterations()) * items;
+  state.SetItemsProcessed(kTotalItems);
+  state.SetBytesProcessed(kTotalItems * bytes_per_item);
+  state.counters["ns_per_op"] = ::benchmark::Counter(
+      static_cast<double>(kTotalItems) * 1.0e-9,
+      ::benchmark::Counter::kIsRate | ::benchmark::Counter::kInvert);
+}
+}  // namespace Jeong0806::geometry::benchmark_helper
+
+#endif  // Jeong0806_GEOMETRY_TEST_PERFORMENCE_BENCHMARK_HELPER_HPP_
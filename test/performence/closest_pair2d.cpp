@@ -0,0 +1,81 @@
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/closest_pair2d.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "benchmark_helper.hpp"
+
+namespace {
+namespace helper = Jeong0806::geometry::benchmark_helper;
+using Jeong0806::geometry::ClosestPair2D;
+using Jeong0806::geometry::Point2D;
+
+constexpr int64_t kPointBytes{static_cast<int64_t>(sizeof(Point2D))};
+// The quadratic baseline stops where one run takes seconds
+constexpr int64_t kMaxBruteForceSize{int64_t{1} << 14};
+
+// The O(n^2) loop over Point2D::CalculateDistance these queries replace
+auto ClosestPair2DBruteForce(benchmark::State& state) -> void {
+  const auto kPoints = helper::MakeRandomPoints(state.range(0));
+  for (auto _ : state) {
+    auto best = std::numeric_limits<double>::infinity();
+    std::size_t first = 0;
+    std::size_t second = 0;
+    for (std::size_t i = 0; i < kPoints.size(); ++i) {
+      for (auto j = i + 1U; j < kPoints.size(); ++j) {
+        const auto kDistance = kPoints[i].CalculateDistance(kPoints[j]);
+        if (kDistance < best) {
+          best = kDistance;
+          first = i;
+          second = j;
+        }
+      }
+    }
+    benchmark::DoNotOptimize(best);
+    benchmark::DoNotOptimize(first);
+    benchmark::DoNotOptimize(second);
+  }
+  helper::SetThroughput(state, state.range(0), kPointBytes);
+}
+BENCHMARK(ClosestPair2DBruteForce)
+    ->RangeMultiplier(helper::kDataSizeMultiplier)
+    ->Range(helper::kMinDataSize, kMaxBruteForceSize);
+
+auto ClosestPair2DFind(benchmark::State& state) -> void {
+  const auto kPoints = helper::MakeRandomPoints(state.range(0));
+  const auto kThreadCount = static_cast<std::size_t>(state.range(1));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(ClosestPair2D::Find(kPoints, kThreadCount));
+  }
+  helper::SetThroughput(state, state.range(0), kPointBytes);
+}
+BENCHMARK(ClosestPair2DFind)
+    ->ArgsProduct({benchmark::CreateRange(helper::kMinDataSize,
+                                          helper::kMaxDataSize,
+                                          helper::kDataSizeMultiplier),
+                   {1, 0}})
+    ->UseRealTime();
+
+auto ClosestPair2DFindBetween(benchmark::State& state) -> void {
+  const auto kLhs = helper::MakeRandomPoints(state.range(0), 1U);
+  const auto kRhs = helper::MakeRandomPoints(state.range(0), 2U);
+  const auto kThreadCount = static_cast<std::size_t>(state.range(1));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        ClosestPair2D::FindBetween(kLhs, kRhs, kThreadCount));
+  }
+  helper::SetThroughput(state, 2 * state.range(0), kPointBytes);
+}
+BENCHMARK(ClosestPair2DFindBetween)
+    ->ArgsProduct({benchmark::CreateRange(helper::kMinDataSize,
+                                          helper::kMaxDataSize,
+                                          helper::kDataSizeMultiplier),
+                   {1, 0}})
+    ->UseRealTime();
+}  // namespace
@@ -0,0 +1,85 @@
+#!/usr/bin/env python3
+# Copyright (c) 2023 Jeong0806, All Rights Reserved.
+# Author Jeong Seong In (0806jsi@gmail.com)
+"""Compare Google Benchmark JSON results against a baseline.
+
+Fails when a benchmark present in both runs is slower than the baseline by
+more than the threshold. Either pass an existing result with --current, or
+pass the benchmark command after "--" to run it and write --output.
+
+    compare_benchmarks.py --baseline base.json --current new.json
+    compare_benchmarks.py --baseline base.json -- ./geometry_PERFORMENCE_BENCHMARKS
+"""
+
+import argparse
+import json
+import subprocess
+import sys
+
+METRICS = ("ns_per_op", "real_time", "cpu_time")
+
+
+def load(path):
+    with open(path, encoding="utf-8") as file:
+        results = {}
+        for entry in json.load(file)["benchmarks"]:
+            # Skip the mean/median/stddev rows of repeated runs
+            if entry.get("run_type", "iteration") != "iteration":
+                continue
+            results[entry["name"]] = entry
+        return results
+
+
+def metric_of(entry, metric):
+    if metric in entry:
+        return float(entry[metric])
+    return None
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--baseline", required=True)
+    parser.add_argument("--current")
+    parser.add_argument("--output", default="benchmark.json")
+    parser.add_argument("--threshold", type=float, default=0.10,
+                        help="allowed relative slowdown, 0.10 is 10%%")
+    parser.add_argument("--metric", choices=METRICS, default=METRICS[0])
+    parser.add_argument("command", nargs="*")
+    arguments = parser.parse_args()
+
+    current_path = arguments.current
+    if current_path is None:
+        if not arguments.command:
+            parser.error("either --current or a benchmark command is needed")
+        current_path = arguments.output
+        subprocess.run(arguments.command + [
+            "--benchmark_out=" + current_path,
+            "--benchmark_out_format=json"], check=True)
+
+    baseline = load(arguments.baseline)
+    current = load(current_path)
+
+    regressions = 0
+    compared = 0
+    for name, entry in sorted(current.items()):
+        if name not in baseline:
+            continue
+        old = metric_of(baseline[name], arguments.metric)
+        new = metric_of(entry, arguments.metric)
+        if old is None or new is None or old <= 0.0:
+            continue
+        compared += 1
+        change = (new - old) / old
+        status = "ok"
+        if change > arguments.threshold:
+            status = "REGRESSION"
+            regressions += 1
+        print(f"{status:>10} {change:+8.2%} {old:14.4f} -> {new:14.4f}  {name}")
+
+    print(f"{compared} compared, {regressions} regressed beyond "
+          f"{arguments.threshold:.0%} on {arguments.metric}")
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
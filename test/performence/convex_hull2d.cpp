@@ -0,0 +1,90 @@
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/convex_hull2d.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "benchmark_helper.hpp"
+
+namespace {
+namespace helper = Jeong0806::geometry::benchmark_helper;
+using Jeong0806::geometry::ConvexHull2D;
+using Jeong0806::geometry::Point2D;
+using Jeong0806::geometry::PointCloud2D;
+
+constexpr int64_t kPointBytes{static_cast<int64_t>(sizeof(Point2D))};
+
+auto Cross(const Point2D& o, const Point2D& a, const Point2D& b) -> double {
+  return ((a.GetX() - o.GetX()) * (b.GetY() - o.GetY())) -
+         ((a.GetY() - o.GetY()) * (b.GetX() - o.GetX()));
+}
+
+// Textbook monotone chain over a sorted copy, without pre-filter or threads
+auto ConvexHull2DBaseline(benchmark::State& state) -> void {
+  const auto kPoints = helper::MakeRandomPoints(state.range(0));
+  for (auto _ : state) {
+    auto sorted = kPoints;
+    std::sort(sorted.begin(), sorted.end(),
+              [](const Point2D& lhs, const Point2D& rhs) {
+                return (lhs.GetX() < rhs.GetX()) ||
+                       ((lhs.GetX() == rhs.GetX()) &&
+                        (lhs.GetY() < rhs.GetY()));
+              });
+    std::vector<Point2D> hull(2U * sorted.size());
+    std::size_t size = 0;
+    for (const auto& point : sorted) {
+      while ((size >= 2U) &&
+             (Cross(hull[size - 2U], hull[size - 1U], point) <= 0.0)) {
+        --size;
+      }
+      hull[size++] = point;
+    }
+    const auto kLowerSize = size + 1U;
+    for (auto i = sorted.size() - 1U; i > 0U; --i) {
+      while ((size >= kLowerSize) &&
+             (Cross(hull[size - 2U], hull[size - 1U], sorted[i - 1U]) <=
+              0.0)) {
+        --size;
+      }
+      hull[size++] = sorted[i - 1U];
+    }
+    hull.resize(size - 1U);
+    benchmark::DoNotOptimize(hull.data());
+  }
+  helper::SetThroughput(state, state.range(0), kPointBytes);
+}
+BENCHMARK(ConvexHull2DBaseline)->Apply(helper::ApplyDataSizes);
+
+auto ConvexHull2DComputeIndices(benchmark::State& state) -> void {
+  const auto kPoints = helper::MakeRandomPoints(state.range(0));
+  const auto kThreadCount = static_cast<std::size_t>(state.range(1));
+  for (auto _ : state) {
+    auto hull = ConvexHull2D::ComputeIndices(kPoints, kThreadCount);
+    benchmark::DoNotOptimize(hull.data());
+  }
+  helper::SetThroughput(state, state.range(0), kPointBytes);
+}
+BENCHMARK(ConvexHull2DComputeIndices)
+    ->ArgsProduct({benchmark::CreateRange(helper::kMinDataSize,
+                                          helper::kMaxDataSize,
+                                          helper::kDataSizeMultiplier),
+                   {1, 0}})
+    ->UseRealTime();
+
+auto ConvexHull2DComputePointCloud(benchmark::State& state) -> void {
+  const PointCloud2D kPoints(helper::MakeRandomPoints(state.range(0)));
+  for (auto _ : state) {
+    auto hull = ConvexHull2D::Compute(kPoints);
+    benchmark::DoNotOptimize(hull.GetXData());
+  }
+  helper::SetThroughput(state, state.range(0), kPointBytes);
+}
+BENCHMARK(ConvexHull2DComputePointCloud)
+    ->Apply(helper::ApplyDataSizes)
+    ->UseRealTime();
+}  // namespace
@@ -0,0 +1,82 @@
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/delaunay_triangulation2d.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "benchmark_helper.hpp"
+#include "geometry/hilbert2d.hpp"
+#include "geometry/morton2d.hpp"
+
+namespace {
+namespace helper = Jeong0806::geometry::benchmark_helper;
+using Jeong0806::geometry::DelaunayTriangulation2D;
+using Jeong0806::geometry::Hilbert2D;
+using Jeong0806::geometry::Morton2D;
+using Jeong0806::geometry::MortonGrid2D;
+using Jeong0806::geometry::Point2D;
+
+constexpr std::size_t kQueryCount{1U << 14U};
+constexpr int64_t kPointBytes{static_cast<int64_t>(sizeof(Point2D))};
+// Building beyond 2^20 sites takes seconds per iteration
+constexpr int64_t kMaxSiteCount{int64_t{1} << 20};
+
+auto DelaunayTriangulation2DBuild(benchmark::State& state) -> void {
+  const auto kPoints = helper::MakeRandomPoints(state.range(0));
+  for (auto _ : state) {
+    DelaunayTriangulation2D triangulation(kPoints);
+    benchmark::DoNotOptimize(triangulation);
+  }
+  helper::SetThroughput(state, state.range(0), kPointBytes);
+}
+BENCHMARK(DelaunayTriangulation2DBuild)
+    ->RangeMultiplier(helper::kDataSizeMultiplier)
+    ->Range(helper::kMinDataSize, kMaxSiteCount)
+    ->Unit(benchmark::kMillisecond);
+
+// Queries in random order, or along the Hilbert curve so each walk starts
+// next to the previous result
+auto DelaunayTriangulation2DNearest(benchmark::State& state) -> void {
+  const DelaunayTriangulation2D kTriangulation(
+      helper::MakeRandomPoints(state.range(0)));
+  auto queries = helper::MakeRandomPoints(kQueryCount, 7U);
+  if (state.range(1) != 0) {
+    std::vector<uint64_t> codes(queries.size());
+    Hilbert2D::ComputeCodes(MortonGrid2D(queries.data(), queries.size()),
+                            queries.data(), queries.size(), codes.data());
+    std::vector<Point2D> sorted;
+    for (const auto kIndex : Morton2D::SortOrder(codes.data(), codes.size())) {
+      sorted.push_back(queries[kIndex]);
+    }
+    queries.swap(sorted);
+  }
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(kTriangulation.Nearest(queries, 1U));
+  }
+  helper::SetThroughput(state, kQueryCount, kPointBytes);
+}
+BENCHMARK(DelaunayTriangulation2DNearest)
+    ->ArgsProduct({benchmark::CreateRange(helper::kMinDataSize, kMaxSiteCount,
+                                          helper::kDataSizeMultiplier),
+                   {0, 1}});
+
+auto DelaunayTriangulation2DVoronoiCells(benchmark::State& state) -> void {
+  const DelaunayTriangulation2D kTriangulation(
+      helper::MakeRandomPoints(state.range(0)));
+  const Point2D kMin(-helper::kCoordinateRange, -helper::kCoordinateRange);
+  const Point2D kMax(helper::kCoordinateRange, helper::kCoordinateRange);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        kTriangulation.ComputeVoronoiCells(kMin, kMax, 1U));
+  }
+  helper::SetThroughput(state, state.range(0), kPointBytes);
+}
+BENCHMARK(DelaunayTriangulation2DVoronoiCells)
+    ->RangeMultiplier(helper::kDataSizeMultiplier)
+    ->Range(helper::kMinDataSize, kMaxSiteCount)
+    ->Unit(benchmark::kMillisecond);
+}  // namespace
@@ -0,0 +1,171 @@
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/distance.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "benchmark_helper.hpp"
+
+namespace {
+namespace helper = Jeong0806::geometry::benchmark_helper;
+using Jeong0806::geometry::Distance;
+
+constexpr int64_t kDistanceBytes{static_cast<int64_t>(sizeof(Distance))};
+
+auto MakeRandomDistances(std::size_t count, uint64_t seed = helper::kSeed)
+    -> std::vector<Distance> {
+  const auto kValues = helper::MakeRandomValues(count, seed);
+  std::vector<Distance> distances(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    distances[i] = Distance(kValues[i], Distance::DistanceType::kMeter);
+  }
+  return distances;
+}
+
+auto DistanceConstructor(benchmark::State& state) -> void {
+  const auto kValues = helper::MakeRandomValues(state.range(0));
+  const auto kType = static_cast<Distance::DistanceType>(state.range(1));
+  std::vector<Distance> distances(kValues.size());
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < kValues.size(); ++i) {
+      distances[i] = Distance(kValues[i], kType);
+    }
+    benchmark::DoNotOptimize(distances.data());
+    benchmark::ClobberMemory();
+  }
+  helper::SetThroughput(state, state.range(0),
+                        sizeof(double) + kDistanceBytes);
+}
+BENCHMARK(DistanceConstructor)
+    ->ArgsProduct({benchmark::CreateRange(helper::kMinDataSize,
+                                          helper::kMaxDataSize,
+                                          helper::kDataSizeMultiplier),
+                   {static_cast<int64_t>(Distance::DistanceType::kKilometer),
+                    static_cast<int64_t>(Distance::DistanceType::kMeter),
+                    static_cast<int64_t>(Distance::DistanceType::kNanometer)}});
+
+auto DistanceGetValue(benchmark::State& state) -> void {
+  const auto kDistances = MakeRandomDistances(state.range(0));
+  const auto kType = static_cast<Distance::DistanceType>(state.range(1));
+  std::vector<double> values(kDistances.size());
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < kDistances.size(); ++i) {
+      values[i] = kDistances[i].GetValue(kType);
+    }
+    benchmark::DoNotOptimize(values.data());
+    benchmark::ClobberMemory();
+  }
+  helper::SetThroughput(state, state.range(0),
+                        sizeof(double) + kDistanceBytes);
+}
+BENCHMARK(DistanceGetValue)
+    ->ArgsProduct({benchmark::CreateRange(helper::kMinDataSize,
+                                          helper::kMaxDataSize,
+                                          helper::kDataSizeMultiplier),
+                   {static_cast<int64_t>(Distance::DistanceType::kKilometer),
+                    static_cast<int64_t>(Distance::DistanceType::kMeter),
+                    static_cast<int64_t>(Distance::DistanceType::kNanometer)}});
+
+auto DistanceOperatorAdd(benchmark::State& state) -> void {
+  const auto kDistances = MakeRandomDistances(state.range(0));
+  for (auto _ : state) {
+    Distance sum;
+    for (const auto& distance : kDistances) {
+      sum = sum + distance;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  helper::SetThroughput(state, state.range(0), kDistanceBytes);
+}
+BENCHMARK(DistanceOperatorAdd)->Apply(helper::ApplyDataSizes);
+
+auto DistanceOperatorAddEqual(benchmark::State& state) -> void {
+  const auto kDistances = MakeRandomDistances(state.range(0));
+  for (auto _ : state) {
+    Distance sum;
+    for (const auto& distance : kDistances) {
+      sum += distance;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  helper::SetThroughput(state, state.range(0), kDistanceBytes);
+}
+BENCHMARK(DistanceOperatorAddEqual)->Apply(helper::ApplyDataSizes);
+
+template <Distance::OverflowPolicy kPolicy>
+auto DistanceAddWithPolicy(benchmark::State& state) -> void {
+  const auto kDistances = MakeRandomDistances(state.range(0));
+  for (auto _ : state) {
+    Distance sum;
+    for (const auto& distance : kDistances) {
+      sum = sum.Add<kPolicy>(distance);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  helper::SetThroughput(state, state.range(0), kDistanceBytes);
+}
+BENCHMARK_TEMPLATE(DistanceAddWithPolicy, Distance::OverflowPolicy::kChecked)
+    ->Apply(helper::ApplyDataSizes);
+BENCHMARK_TEMPLATE(DistanceAddWithPolicy,
+                   Distance::OverflowPolicy::kSaturating)
+    ->Apply(helper::ApplyDataSizes);
+BENCHMARK_TEMPLATE(DistanceAddWithPolicy, Distance::OverflowPolicy::kWrapping)
+    ->Apply(helper::ApplyDataSizes);
+
+auto DistanceOperatorSubtract(benchmark::State& state) -> void {
+  const auto kDistances = MakeRandomDistances(state.range(0));
+  for (auto _ : state) {
+    Distance difference;
+    for (const auto& distance : kDistances) {
+      difference = difference - distance;
+    }
+    benchmark::DoNotOptimize(difference);
+  }
+  helper::SetThroughput(state, state.range(0), kDistanceBytes);
+}
+BENCHMARK(DistanceOperatorSubtract)->Apply(helper::ApplyDataSizes);
+
+auto DistanceOperatorMultiply(benchmark::State& state) -> void {
+  auto distances = MakeRandomDistances(state.range(0));
+  for (auto _ : state) {
+    for (auto& distance : distances) {
+      distance = distance * 1.0;
+    }
+    benchmark::DoNotOptimize(distances.data());
+    benchmark::ClobberMemory();
+  }
+  helper::SetThroughput(state, state.range(0), 2 * kDistanceBytes);
+}
+BENCHMARK(DistanceOperatorMultiply)->Apply(helper::ApplyDataSizes);
+
+auto DistanceOperatorDivide(benchmark::State& state) -> void {
+  auto distances = MakeRandomDistances(state.range(0));
+  for (auto _ : state) {
+    for (auto& distance : distances) {
+      distance = distance / 1.0;
+    }
+    benchmark::DoNotOptimize(distances.data());
+    benchmark::ClobberMemory();
+  }
+  helper::SetThroughput(state, state.range(0), 2 * kDistanceBytes);
+}
+BENCHMARK(DistanceOperatorDivide)->Apply(helper::ApplyDataSizes);
+
+auto DistanceOperatorLess(benchmark::State& state) -> void {
+  const auto kLhs = MakeRandomDistances(state.range(0), 1U);
+  const auto kRhs = MakeRandomDistances(state.range(0), 2U);
+  for (auto _ : state) {
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < kLhs.size(); ++i) {
+      count += (kLhs[i] < kRhs[i]) ? 1U : 0U;
+    }
+    benchmark::DoNotOptimize(count);
+  }
+  helper::SetThroughput(state, state.range(0), 2 * kDistanceBytes);
+}
+BENCHMARK(DistanceOperatorLess)->Apply(helper::ApplyDataSizes);
+}  // namespace
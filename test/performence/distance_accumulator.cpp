@@ -0,0 +1,66 @@
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/distance_accumulator.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "benchmark_helper.hpp"
+
+namespace {
+namespace helper = Jeong0806::geometry::benchmark_helper;
+using Jeong0806::geometry::Distance;
+using Jeong0806::geometry::DistanceAccumulator;
+
+constexpr int64_t kDistanceBytes{static_cast<int64_t>(sizeof(Distance))};
+
+auto MakeRandomDistances(std::size_t count) -> std::vector<Distance> {
+  const auto kValues = helper::MakeRandomValues(count);
+  std::vector<Distance> distances(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    distances[i] = Distance(kValues[i], Distance::DistanceType::kMeter);
+  }
+  return distances;
+}
+
+// Inexact baseline summing converted values in double
+auto DistanceAccumulatorDoubleSum(benchmark::State& state) -> void {
+  const auto kDistances = MakeRandomDistances(state.range(0));
+  for (auto _ : state) {
+    double sum{0.0};
+    for (const auto& distance : kDistances) {
+      sum += distance.GetValue(Distance::DistanceType::kMeter);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  helper::SetThroughput(state, state.range(0), kDistanceBytes);
+}
+BENCHMARK(DistanceAccumulatorDoubleSum)->Apply(helper::ApplyDataSizes);
+
+auto DistanceAccumulatorAddEach(benchmark::State& state) -> void {
+  const auto kDistances = MakeRandomDistances(state.range(0));
+  for (auto _ : state) {
+    DistanceAccumulator accumulator;
+    for (const auto& distance : kDistances) {
+      accumulator += distance;
+    }
+    benchmark::DoNotOptimize(accumulator);
+  }
+  helper::SetThroughput(state, state.range(0), kDistanceBytes);
+}
+BENCHMARK(DistanceAccumulatorAddEach)->Apply(helper::ApplyDataSizes);
+
+auto DistanceAccumulatorAddBatch(benchmark::State& state) -> void {
+  const auto kDistances = MakeRandomDistances(state.range(0));
+  for (auto _ : state) {
+    DistanceAccumulator accumulator;
+    accumulator.Add(kDistances);
+    benchmark::DoNotOptimize(accumulator);
+  }
+  helper::SetThroughput(state, state.range(0), kDistanceBytes);
+}
+BENCHMARK(DistanceAccumulatorAddBatch)->Apply(helper::ApplyDataSizes);
+}  // namespace
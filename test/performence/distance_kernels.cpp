@@ -0,0 +1,192 @@
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/distance_kernels.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "benchmark_helper.hpp"
+#include "geometry/simd.hpp"
+
+namespace {
+namespace helper = Jeong0806::geometry::benchmark_helper;
+namespace geometry = Jeong0806::geometry;
+
+constexpr int64_t kValueBytes{static_cast<int64_t>(sizeof(double))};
+
+auto ApplySizesAndLevels(benchmark::internal::Benchmark* bench) -> void {
+  std::vector<int64_t> levels;
+  for (const auto kLevel :
+       {geometry::SimdLevel::kScalar, geometry::SimdLevel::kNeon,
+        geometry::SimdLevel::kAvx2, geometry::SimdLevel::kAvx512}) {
+    if (geometry::IsSimdLevelSupported(kLevel)) {
+      levels.push_back(static_cast<int64_t>(kLevel));
+    }
+  }
+  bench->ArgsProduct({benchmark::CreateRange(helper::kMinDataSize,
+                                             helper::kMaxDataSize,
+                                             helper::kDataSizeMultiplier),
+                      levels});
+}
+
+/**
+ * @brief Select the SIMD level of the benchmark and restore it on exit
+ */
+class ScopedSimdLevel {
+ public:
+  explicit ScopedSimdLevel(int64_t level)
+      : previous_(geometry::GetSimdLevel()) {
+    geometry::SetSimdLevel(static_cast<geometry::SimdLevel>(level));
+  }
+  ScopedSimdLevel(const ScopedSimdLevel& other) = delete;
+  ScopedSimdLevel(ScopedSimdLevel&& other) = delete;
+  ~ScopedSimdLevel() { geometry::SetSimdLevel(previous_); }
+
+  auto operator=(const ScopedSimdLevel& other) -> ScopedSimdLevel& = delete;
+  auto operator=(ScopedSimdLevel&& other) -> ScopedSimdLevel& = delete;
+
+ private:
+  geometry::SimdLevel previous_;
+};
+
+// Random values truncated to integer ticks
+template <typename T>
+auto MakeRandomTicks(std::size_t count, uint64_t seed) -> std::vector<T> {
+  const auto kValues = helper::MakeRandomValues(count, seed);
+  return std::vector<T>(kValues.begin(), kValues.end());
+}
+
+auto KernelCalculateDistances(benchmark::State& state) -> void {
+  const ScopedSimdLevel kLevel(state.range(1));
+  const auto kXs = helper::MakeRandomValues(state.range(0), 1U);
+  const auto kYs = helper::MakeRandomValues(state.range(0), 2U);
+  std::vector<double> output(kXs.size());
+  for (auto _ : state) {
+    geometry::kernel::CalculateDistances(kXs.data(), kYs.data(), kXs.size(),
+                                         1.0, 2.0, output.data());
+    benchmark::DoNotOptimize(output.data());
+    benchmark::ClobberMemory();
+  }
+  helper::SetThroughput(state, state.range(0), 3 * kValueBytes);
+}
+BENCHMARK(KernelCalculateDistances)->Apply(ApplySizesAndLevels);
+
+auto KernelCalculateSquaredDistances(benchmark::State& state) -> void {
+  const ScopedSimdLevel kLevel(state.range(1));
+  const auto kXs = helper::MakeRandomValues(state.range(0), 1U);
+  const auto kYs = helper::MakeRandomValues(state.range(0), 2U);
+  std::vector<double> output(kXs.size());
+  for (auto _ : state) {
+    geometry::kernel::CalculateSquaredDistances(
+        kXs.data(), kYs.data(), kXs.size(), 1.0, 2.0, output.data());
+    benchmark::DoNotOptimize(output.data());
+    benchmark::ClobberMemory();
+  }
+  helper::SetThroughput(state, state.range(0), 3 * kValueBytes);
+}
+BENCHMARK(KernelCalculateSquaredDistances)->Apply(ApplySizesAndLevels);
+
+auto KernelCalculatePairwiseDistances(benchmark::State& state) -> void {
+  const ScopedSimdLevel kLevel(state.range(1));
+  const auto kLhsXs = helper::MakeRandomValues(state.range(0), 1U);
+  const auto kLhsYs = helper::MakeRandomValues(state.range(0), 2U);
+  const auto kRhsXs = helper::MakeRandomValues(state.range(0), 3U);
+  const auto kRhsYs = helper::MakeRandomValues(state.range(0), 4U);
+  std::vector<double> output(kLhsXs.size());
+  for (auto _ : state) {
+    geometry::kernel::CalculatePairwiseDistances(
+        kLhsXs.data(), kLhsYs.data(), kRhsXs.data(), kRhsYs.data(),
+        kLhsXs.size(), output.data());
+    benchmark::DoNotOptimize(output.data());
+    benchmark::ClobberMemory();
+  }
+  helper::SetThroughput(state, state.range(0), 5 * kValueBytes);
+}
+BENCHMARK(KernelCalculatePairwiseDistances)->Apply(ApplySizesAndLevels);
+
+auto KernelConvertDistances(benchmark::State& state) -> void {
+  const ScopedSimdLevel kLevel(state.range(1));
+  const auto kValues = helper::MakeRandomValues(state.range(0));
+  std::vector<geometry::Distance> distances(kValues.size());
+  for (std::size_t i = 0; i < kValues.size(); ++i) {
+    distances[i] = geometry::Distance(kValues[i]);
+  }
+  std::vector<double> output(kValues.size());
+  for (auto _ : state) {
+    geometry::kernel::ConvertDistances(
+        distances.data(), distances.size(),
+        geometry::Distance::DistanceType::kKilometer, output.data());
+    benchmark::DoNotOptimize(output.data());
+    benchmark::ClobberMemory();
+  }
+  helper::SetThroughput(state, state.range(0), 2 * kValueBytes);
+}
+BENCHMARK(KernelConvertDistances)->Apply(ApplySizesAndLevels);
+
+auto KernelFromValues(benchmark::State& state) -> void {
+  const ScopedSimdLevel kLevel(state.range(1));
+  const auto kValues = helper::MakeRandomValues(state.range(0));
+  std::vector<geometry::Distance> output(kValues.size());
+  for (auto _ : state) {
+    geometry::kernel::FromValues(kValues.data(), kValues.size(),
+                                 geometry::Distance::DistanceType::kMeter,
+                                 output.data());
+    benchmark::DoNotOptimize(output.data());
+    benchmark::ClobberMemory();
+  }
+  helper::SetThroughput(state, state.range(0), 2 * kValueBytes);
+}
+BENCHMARK(KernelFromValues)->Apply(ApplySizesAndLevels);
+
+auto KernelCalculateSquaredDistancesInt32(benchmark::State& state) -> void {
+  const ScopedSimdLevel kLevel(state.range(1));
+  const auto kXs = MakeRandomTicks<int32_t>(state.range(0), 1U);
+  const auto kYs = MakeRandomTicks<int32_t>(state.range(0), 2U);
+  std::vector<uint64_t> output(kXs.size());
+  for (auto _ : state) {
+    geometry::kernel::CalculateSquaredDistances(kXs.data(), kYs.data(),
+                                                kXs.size(), 1, 2,
+                                                output.data());
+    benchmark::DoNotOptimize(output.data());
+    benchmark::ClobberMemory();
+  }
+  helper::SetThroughput(state, state.range(0),
+                        2 * sizeof(int32_t) + sizeof(uint64_t));
+}
+BENCHMARK(KernelCalculateSquaredDistancesInt32)->Apply(ApplySizesAndLevels);
+
+auto KernelIsWithinInt32(benchmark::State& state) -> void {
+  const ScopedSimdLevel kLevel(state.range(1));
+  const auto kXs = MakeRandomTicks<int32_t>(state.range(0), 1U);
+  const auto kYs = MakeRandomTicks<int32_t>(state.range(0), 2U);
+  std::vector<uint8_t> output(kXs.size());
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(geometry::kernel::IsWithin(
+        kXs.data(), kYs.data(), kXs.size(), 0, 0,
+        static_cast<int64_t>(helper::kCoordinateRange / 2.0), output.data()));
+    benchmark::ClobberMemory();
+  }
+  helper::SetThroughput(state, state.range(0),
+                        2 * sizeof(int32_t) + sizeof(uint8_t));
+}
+BENCHMARK(KernelIsWithinInt32)->Apply(ApplySizesAndLevels);
+
+auto KernelCalculateSquaredDistancesInt64(benchmark::State& state) -> void {
+  const auto kXs = MakeRandomTicks<int64_t>(state.range(0), 1U);
+  const auto kYs = MakeRandomTicks<int64_t>(state.range(0), 2U);
+  std::vector<geometry::UInt128> output(kXs.size());
+  for (auto _ : state) {
+    geometry::kernel::CalculateSquaredDistances(kXs.data(), kYs.data(),
+                                                kXs.size(), 1, 2,
+                                                output.data());
+    benchmark::DoNotOptimize(output.data());
+    benchmark::ClobberMemory();
+  }
+  helper::SetThroughput(state, state.range(0),
+                        2 * sizeof(int64_t) + sizeof(geometry::UInt128));
+}
+BENCHMARK(KernelCalculateSquaredDistancesInt64)->Apply(helper::ApplyDataSizes);
+}  // namespace
@@ -0,0 +1,96 @@
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/distance_matrix2d.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "benchmark_helper.hpp"
+
+namespace {
+namespace helper = Jeong0806::geometry::benchmark_helper;
+using Jeong0806::geometry::Distance;
+using Jeong0806::geometry::DistanceMatrix2D;
+using Jeong0806::geometry::Point2D;
+
+// Square matrices, the largest one takes 128 MiB of doubles
+constexpr int64_t kMinSide{1 << 8};
+constexpr int64_t kMaxSide{1 << 12};
+constexpr int kSideMultiplier{4};
+constexpr std::size_t kBlockRows{64U};
+
+template <typename T>
+auto SetMatrixThroughput(benchmark::State& state) -> void {
+  helper::SetThroughput(state, state.range(0) * state.range(0),
+                        static_cast<int64_t>(sizeof(T)));
+}
+
+// The double loop over Point2D::CalculateDistance this engine replaces
+auto DistanceMatrix2DNaive(benchmark::State& state) -> void {
+  const auto kRows = helper::MakeRandomPoints(state.range(0), 1U);
+  const auto kColumns = helper::MakeRandomPoints(state.range(0), 2U);
+  std::vector<double> matrix(kRows.size() * kColumns.size());
+  for (auto _ : state) {
+    for (std::size_t row = 0; row < kRows.size(); ++row) {
+      for (std::size_t column = 0; column < kColumns.size(); ++column) {
+        matrix[(row * kColumns.size()) + column] =
+            kRows[row].CalculateDistance(kColumns[column]);
+      }
+    }
+    benchmark::DoNotOptimize(matrix.data());
+    benchmark::ClobberMemory();
+  }
+  SetMatrixThroughput<double>(state);
+}
+BENCHMARK(DistanceMatrix2DNaive)
+    ->RangeMultiplier(kSideMultiplier)
+    ->Range(kMinSide, kMaxSide);
+
+template <typename T>
+auto DistanceMatrix2DCalculate(benchmark::State& state) -> void {
+  const DistanceMatrix2D kMatrix(helper::MakeRandomPoints(state.range(0), 1U),
+                                 helper::MakeRandomPoints(state.range(0), 2U));
+  std::vector<T> matrix(kMatrix.Rows() * kMatrix.Columns());
+  const auto kThreadCount = static_cast<std::size_t>(state.range(1));
+  for (auto _ : state) {
+    kMatrix.Calculate(matrix.data(), kThreadCount);
+    benchmark::DoNotOptimize(matrix.data());
+    benchmark::ClobberMemory();
+  }
+  SetMatrixThroughput<T>(state);
+}
+BENCHMARK_TEMPLATE(DistanceMatrix2DCalculate, double)
+    ->ArgsProduct({benchmark::CreateRange(kMinSide, kMaxSide, kSideMultiplier),
+                   {1, 0}})
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(DistanceMatrix2DCalculate, float)
+    ->ArgsProduct({benchmark::CreateRange(kMinSide, kMaxSide, kSideMultiplier),
+                   {1, 0}})
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(DistanceMatrix2DCalculate, Distance)
+    ->ArgsProduct({benchmark::CreateRange(kMinSide, kMaxSide, kSideMultiplier),
+                   {1, 0}})
+    ->UseRealTime();
+
+auto DistanceMatrix2DStreamRowBlocks(benchmark::State& state) -> void {
+  const DistanceMatrix2D kMatrix(helper::MakeRandomPoints(state.range(0), 1U),
+                                 helper::MakeRandomPoints(state.range(0), 2U));
+  for (auto _ : state) {
+    double sum = 0.0;
+    kMatrix.StreamRowBlocks(kBlockRows, [&](std::size_t /* first_row */,
+                                            std::size_t /* row_count */,
+                                            const double* values) {
+      sum += values[0];
+    });
+    benchmark::DoNotOptimize(sum);
+  }
+  SetMatrixThroughput<double>(state);
+}
+BENCHMARK(DistanceMatrix2DStreamRowBlocks)
+    ->RangeMultiplier(kSideMultiplier)
+    ->Range(kMinSide, kMaxSide)
+    ->UseRealTime();
+}  // namespace
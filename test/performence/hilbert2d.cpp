@@ -0,0 +1,99 @@
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/hilbert2d.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "benchmark_helper.hpp"
+#include "geometry/kd_tree2d.hpp"
+#include "geometry/parallel.hpp"
+
+namespace {
+namespace helper = Jeong0806::geometry::benchmark_helper;
+namespace geometry = Jeong0806::geometry;
+
+constexpr std::size_t kShardCount{64U};
+
+auto HilbertPartition(benchmark::State& state) -> void {
+  const geometry::PointCloud2D kPoints(
+      helper::MakeRandomPoints(state.range(0)));
+  for (auto _ : state) {
+    const geometry::HilbertPartition2D kPartition(
+        kPoints, kShardCount, static_cast<std::size_t>(state.range(1)));
+    benchmark::DoNotOptimize(kPartition.GetOrder().data());
+  }
+  helper::SetThroughput(state, state.range(0),
+                        static_cast<int64_t>(sizeof(geometry::Point2D)));
+}
+BENCHMARK(HilbertPartition)
+    ->ArgsProduct({benchmark::CreateRange(helper::kMinDataSize,
+                                          helper::kMaxDataSize,
+                                          helper::kDataSizeMultiplier),
+                   {1, 0}})
+    ->UseRealTime();
+
+// Each shard answers the nearest queries of its points, the shards being
+// index ranges of random input or Hilbert shards. Reports the summed
+// bounding box area of the shards relative to the whole box.
+auto HilbertShardNearestQueries(benchmark::State& state) -> void {
+  const auto kQueries = helper::MakeRandomPoints(state.range(0));
+  const geometry::PointCloud2D kPoints(kQueries);
+  const geometry::KdTree2D kTree(helper::MakeRandomPoints(state.range(0), 1U));
+  std::vector<uint32_t> order(kQueries.size());
+  std::vector<std::size_t> offsets(kShardCount + 1U);
+  if (state.range(1) == 0) {
+    std::iota(order.begin(), order.end(), 0U);
+    for (std::size_t shard = 0; shard <= kShardCount; ++shard) {
+      offsets[shard] = (order.size() * shard) / kShardCount;
+    }
+  } else {
+    const geometry::HilbertPartition2D kPartition(kPoints, kShardCount);
+    order = kPartition.GetOrder();
+    for (std::size_t shard = 0; shard < kShardCount; ++shard) {
+      offsets[shard + 1U] = offsets[shard] + kPartition.GetShardSize(shard);
+    }
+  }
+
+  for (auto _ : state) {
+    geometry::ParallelFor(kShardCount, [&](std::size_t begin,
+                                           std::size_t end) {
+      for (auto i = offsets[begin]; i < offsets[end]; ++i) {
+        benchmark::DoNotOptimize(kTree.Nearest(kQueries[order[i]]));
+      }
+    });
+  }
+
+  double area = 0.0;
+  for (std::size_t shard = 0; shard < kShardCount; ++shard) {
+    auto min = geometry::Point2D(helper::kCoordinateRange,
+                                 helper::kCoordinateRange);
+    auto max = geometry::Point2D(-helper::kCoordinateRange,
+                                 -helper::kCoordinateRange);
+    for (auto i = offsets[shard]; i < offsets[shard + 1U]; ++i) {
+      const auto& kPoint = kQueries[order[i]];
+      min = geometry::Point2D(std::min(min.GetX(), kPoint.GetX()),
+                              std::min(min.GetY(), kPoint.GetY()));
+      max = geometry::Point2D(std::max(max.GetX(), kPoint.GetX()),
+                              std::max(max.GetY(), kPoint.GetY()));
+    }
+    if (offsets[shard] < offsets[shard + 1U]) {
+      area += (max.GetX() - min.GetX()) * (max.GetY() - min.GetY());
+    }
+  }
+  state.counters["shard_area"] =
+      area / (4.0 * helper::kCoordinateRange * helper::kCoordinateRange);
+  helper::SetThroughput(state, state.range(0),
+                        static_cast<int64_t>(sizeof(geometry::Point2D)));
+}
+BENCHMARK(HilbertShardNearestQueries)
+    ->ArgsProduct({benchmark::CreateRange(helper::kMinDataSize,
+                                          helper::kMaxDataSize,
+                                          helper::kDataSizeMultiplier),
+                   {0, 1}})
+    ->UseRealTime();
+}  // namespace
@@ -0,0 +1,100 @@
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/kd_tree2d.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "benchmark/benchmark.h"
+#include "benchmark_helper.hpp"
+
+namespace {
+namespace helper = Jeong0806::geometry::benchmark_helper;
+using Jeong0806::geometry::KdTree2D;
+using Jeong0806::geometry::Point2D;
+
+constexpr std::size_t kQueryCount{1024U};
+constexpr int64_t kPointBytes{static_cast<int64_t>(sizeof(Point2D))};
+
+auto KdTree2DBuild(benchmark::State& state) -> void {
+  const auto kPoints = helper::MakeRandomPoints(state.range(0));
+  for (auto _ : state) {
+    KdTree2D tree(kPoints);
+    benchmark::DoNotOptimize(tree);
+  }
+  helper::SetThroughput(state, state.range(0), kPointBytes);
+}
+BENCHMARK(KdTree2DBuild)->Apply(helper::ApplyDataSizes);
+
+auto KdTree2DNearest(benchmark::State& state) -> void {
+  const KdTree2D kTree(helper::MakeRandomPoints(state.range(0)));
+  const auto kQueries = helper::MakeRandomPoints(kQueryCount, 7U);
+  for (auto _ : state) {
+    for (const auto& query : kQueries) {
+      benchmark::DoNotOptimize(kTree.Nearest(query));
+    }
+  }
+  helper::SetThroughput(state, kQueryCount, kPointBytes);
+}
+BENCHMARK(KdTree2DNearest)->Apply(helper::ApplyDataSizes);
+
+auto KdTree2DNearestBruteForce(benchmark::State& state) -> void {
+  const auto kPoints = helper::MakeRandomPoints(state.range(0));
+  const auto kQueries = helper::MakeRandomPoints(kQueryCount, 7U);
+  for (auto _ : state) {
+    for (const auto& query : kQueries) {
+      auto best = std::numeric_limits<double>::infinity();
+      for (const auto& point : kPoints) {
+        const auto kDistance = Point2D::CalculateDistance(point, query);
+        best = (kDistance < best) ? kDistance : best;
+      }
+      benchmark::DoNotOptimize(best);
+    }
+  }
+  helper::SetThroughput(state, kQueryCount, kPointBytes);
+}
+BENCHMARK(KdTree2DNearestBruteForce)
+    ->RangeMultiplier(helper::kDataSizeMultiplier)
+    ->Range(helper::kMinDataSize, helper::kMinDataSize << 8);
+
+auto KdTree2DKNearest(benchmark::State& state) -> void {
+  const KdTree2D kTree(helper::MakeRandomPoints(state.range(0)));
+  const auto kQueries = helper::MakeRandomPoints(kQueryCount, 7U);
+  for (auto _ : state) {
+    for (const auto& query : kQueries) {
+      benchmark::DoNotOptimize(kTree.KNearest(query, 16U));
+    }
+  }
+  helper::SetThroughput(state, kQueryCount, kPointBytes);
+}
+BENCHMARK(KdTree2DKNearest)->Apply(helper::ApplyDataSizes);
+
+auto KdTree2DRadius(benchmark::State& state) -> void {
+  const KdTree2D kTree(helper::MakeRandomPoints(state.range(0)));
+  const auto kQueries = helper::MakeRandomPoints(kQueryCount, 7U);
+  // Keeps about 16 points per query at every data size
+  const auto kRadius = 2.0 * helper::kCoordinateRange *
+                       std::sqrt(16.0 / (3.14159 * state.range(0)));
+  for (auto _ : state) {
+    for (const auto& query : kQueries) {
+      benchmark::DoNotOptimize(kTree.Radius(query, kRadius));
+    }
+  }
+  helper::SetThroughput(state, kQueryCount, kPointBytes);
+}
+BENCHMARK(KdTree2DRadius)->Apply(helper::ApplyDataSizes);
+
+auto KdTree2DNearestBatch(benchmark::State& state) -> void {
+  const KdTree2D kTree(helper::MakeRandomPoints(state.range(0)));
+  const auto kQueries = helper::MakeRandomPoints(kQueryCount * 16U, 7U);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(kTree.Nearest(kQueries));
+  }
+  helper::SetThroughput(state, static_cast<int64_t>(kQueries.size()),
+                        kPointBytes);
+}
+BENCHMARK(KdTree2DNearestBatch)->Apply(helper::ApplyDataSizes)->UseRealTime();
+}  // namespace
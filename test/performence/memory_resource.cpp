@@ -0,0 +1,70 @@
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/memory_resource.hpp"
+
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "benchmark_helper.hpp"
+#include "geometry/kd_tree2d.hpp"
+#include "geometry/point_cloud2d.hpp"
+
+namespace {
+namespace helper = Jeong0806::geometry::benchmark_helper;
+using Jeong0806::geometry::Arena;
+using Jeong0806::geometry::KdTree2D;
+using Jeong0806::geometry::Point2D;
+using Jeong0806::geometry::PointCloud2D;
+
+// Small per-request containers, where allocation dominates
+constexpr int64_t kMinRequestSize{16};
+constexpr int64_t kMaxRequestSize{4096};
+constexpr std::size_t kContainersPerRequest{64U};
+
+auto ApplyRequestSizes(benchmark::internal::Benchmark* bench) -> void {
+  bench->RangeMultiplier(helper::kDataSizeMultiplier)
+      ->Range(kMinRequestSize, kMaxRequestSize);
+}
+
+// Builds and drops the containers of one request, growing the clouds point
+// by point so every growth step allocates
+auto RunRequest(const std::vector<Point2D>& points,
+                std::pmr::memory_resource* resource) -> void {
+  for (std::size_t i = 0; i < kContainersPerRequest; ++i) {
+    PointCloud2D cloud(0U, resource);
+    for (const auto& point : points) {
+      cloud.PushBack(point);
+    }
+    const KdTree2D kTree(points, resource);
+    benchmark::DoNotOptimize(cloud.GetXData());
+    benchmark::DoNotOptimize(kTree.Size());
+  }
+}
+
+auto MemoryResourceDefault(benchmark::State& state) -> void {
+  const auto kPoints = helper::MakeRandomPoints(state.range(0));
+  for (auto _ : state) {
+    RunRequest(kPoints, std::pmr::get_default_resource());
+  }
+  helper::SetThroughput(
+      state, state.range(0) * static_cast<int64_t>(kContainersPerRequest),
+      static_cast<int64_t>(sizeof(Point2D)));
+}
+BENCHMARK(MemoryResourceDefault)->Apply(ApplyRequestSizes);
+
+auto MemoryResourceArena(benchmark::State& state) -> void {
+  const auto kPoints = helper::MakeRandomPoints(state.range(0));
+  Arena arena;
+  for (auto _ : state) {
+    RunRequest(kPoints, &arena);
+    arena.Release();
+  }
+  helper::SetThroughput(
+      state, state.range(0) * static_cast<int64_t>(kContainersPerRequest),
+      static_cast<int64_t>(sizeof(Point2D)));
+}
+BENCHMARK(MemoryResourceArena)->Apply(ApplyRequestSizes);
+}  // namespace
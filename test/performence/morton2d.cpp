@@ -0,0 +1,131 @@
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/morton2d.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "benchmark_helper.hpp"
+#include "geometry/kd_tree2d.hpp"
+#include "geometry/simd.hpp"
+
+namespace {
+namespace helper = Jeong0806::geometry::benchmark_helper;
+namespace geometry = Jeong0806::geometry;
+
+constexpr int64_t kCodeBytes{static_cast<int64_t>(sizeof(uint64_t))};
+
+auto MakeRandomCodes(std::size_t count) -> std::vector<uint64_t> {
+  std::mt19937_64 engine(helper::kSeed);
+  std::vector<uint64_t> codes(count);
+  for (auto& code : codes) {
+    code = engine();
+  }
+  return codes;
+}
+
+auto ApplySizesAndThreads(benchmark::internal::Benchmark* bench) -> void {
+  bench
+      ->ArgsProduct({benchmark::CreateRange(helper::kMinDataSize,
+                                            helper::kMaxDataSize,
+                                            helper::kDataSizeMultiplier),
+                     {1, 0}})
+      ->UseRealTime();
+}
+
+// Scalar bit spreading against BMI2 pdep, selected through the SIMD level
+auto MortonEncode(benchmark::State& state) -> void {
+  const auto kPrevious = geometry::GetSimdLevel();
+  geometry::SetSimdLevel(static_cast<geometry::SimdLevel>(state.range(1)));
+  const auto kCodes = MakeRandomCodes(state.range(0));
+  std::vector<uint32_t> xs(kCodes.size());
+  std::vector<uint32_t> ys(kCodes.size());
+  std::transform(kCodes.begin(), kCodes.end(), xs.begin(),
+                 [](uint64_t code) { return static_cast<uint32_t>(code); });
+  std::transform(
+      kCodes.begin(), kCodes.end(), ys.begin(),
+      [](uint64_t code) { return static_cast<uint32_t>(code >> 32U); });
+  std::vector<uint64_t> output(kCodes.size());
+  for (auto _ : state) {
+    geometry::Morton2D::Encode(xs.data(), ys.data(), xs.size(),
+                               output.data());
+    benchmark::DoNotOptimize(output.data());
+    benchmark::ClobberMemory();
+  }
+  geometry::SetSimdLevel(kPrevious);
+  helper::SetThroughput(state, state.range(0), 2 * kCodeBytes);
+}
+BENCHMARK(MortonEncode)
+    ->ArgsProduct({benchmark::CreateRange(helper::kMinDataSize,
+                                          helper::kMaxDataSize,
+                                          helper::kDataSizeMultiplier),
+                   {static_cast<int64_t>(geometry::SimdLevel::kScalar),
+                    static_cast<int64_t>(geometry::DetectSimdLevel())}});
+
+// Comparison sort of the order, the baseline of the radix sort
+auto MortonSortOrderStdSort(benchmark::State& state) -> void {
+  const auto kCodes = MakeRandomCodes(state.range(0));
+  for (auto _ : state) {
+    std::vector<uint32_t> order(kCodes.size());
+    std::iota(order.begin(), order.end(), 0U);
+    std::stable_sort(order.begin(), order.end(),
+                     [&kCodes](uint32_t lhs, uint32_t rhs) {
+                       return kCodes[lhs] < kCodes[rhs];
+                     });
+    benchmark::DoNotOptimize(order.data());
+  }
+  helper::SetThroughput(state, state.range(0), kCodeBytes);
+}
+BENCHMARK(MortonSortOrderStdSort)->Apply(helper::ApplyDataSizes);
+
+auto MortonSortOrder(benchmark::State& state) -> void {
+  const auto kCodes = MakeRandomCodes(state.range(0));
+  for (auto _ : state) {
+    const auto kOrder = geometry::Morton2D::SortOrder(
+        kCodes.data(), kCodes.size(), static_cast<std::size_t>(state.range(1)));
+    benchmark::DoNotOptimize(kOrder.data());
+  }
+  helper::SetThroughput(state, state.range(0), kCodeBytes);
+}
+BENCHMARK(MortonSortOrder)->Apply(ApplySizesAndThreads);
+
+auto MortonSortPoints(benchmark::State& state) -> void {
+  const geometry::PointCloud2D kPoints(
+      helper::MakeRandomPoints(state.range(0)));
+  for (auto _ : state) {
+    auto points = kPoints;
+    benchmark::DoNotOptimize(geometry::Morton2D::Sort(
+        points, static_cast<std::size_t>(state.range(1))));
+  }
+  helper::SetThroughput(state, state.range(0),
+                        static_cast<int64_t>(sizeof(geometry::Point2D)));
+}
+BENCHMARK(MortonSortPoints)->Apply(ApplySizesAndThreads);
+
+// Nearest queries in arbitrary order against queries in Z-order, the access
+// pattern neighbor-based algorithms inherit from their input order
+auto MortonNearestQueries(benchmark::State& state) -> void {
+  auto points = helper::MakeRandomPoints(state.range(0));
+  if (state.range(1) != 0) {
+    static_cast<void>(geometry::Morton2D::Sort(points));
+  }
+  const geometry::KdTree2D kTree(helper::MakeRandomPoints(state.range(0), 1U));
+  for (auto _ : state) {
+    for (const auto& point : points) {
+      benchmark::DoNotOptimize(kTree.Nearest(point));
+    }
+  }
+  helper::SetThroughput(state, state.range(0),
+                        static_cast<int64_t>(sizeof(geometry::Point2D)));
+}
+BENCHMARK(MortonNearestQueries)
+    ->ArgsProduct({benchmark::CreateRange(helper::kMinDataSize,
+                                          helper::kMaxDataSize,
+                                          helper::kDataSizeMultiplier),
+                   {0, 1}});
+}  // namespace
@@ -0,0 +1,72 @@
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/parallel.hpp"
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "benchmark_helper.hpp"
+
+namespace {
+namespace helper = Jeong0806::geometry::benchmark_helper;
+namespace geometry = Jeong0806::geometry;
+
+constexpr std::size_t kThreadCount{4U};
+
+auto SumSquares(const std::vector<geometry::Point2D>& points, std::size_t begin,
+                std::size_t end) -> double {
+  double sum = 0.0;
+  for (auto i = begin; i < end; ++i) {
+    sum += (points[i].GetX() * points[i].GetX()) +
+           (points[i].GetY() * points[i].GetY());
+  }
+  return sum;
+}
+
+// A short batch operation on the shared pool
+auto ParallelForPool(benchmark::State& state) -> void {
+  const auto kPoints = helper::MakeRandomPoints(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(geometry::ParallelReduce(
+        kPoints.size(), 0.0,
+        [&kPoints](std::size_t begin, std::size_t end) {
+          return SumSquares(kPoints, begin, end);
+        },
+        [](double lhs, double rhs) { return lhs + rhs; }, kThreadCount));
+  }
+  helper::SetThroughput(state, state.range(0),
+                        static_cast<int64_t>(sizeof(geometry::Point2D)));
+}
+BENCHMARK(ParallelForPool)->Apply(helper::ApplyDataSizes)->UseRealTime();
+
+// The same operation starting a thread per range on every call
+auto ParallelForSpawn(benchmark::State& state) -> void {
+  const auto kPoints = helper::MakeRandomPoints(state.range(0));
+  for (auto _ : state) {
+    std::vector<double> sums(kThreadCount);
+    std::vector<std::thread> threads;
+    for (std::size_t range = 1; range < kThreadCount; ++range) {
+      threads.emplace_back([&kPoints, &sums, range] {
+        sums[range] =
+            SumSquares(kPoints, (kPoints.size() * range) / kThreadCount,
+                       (kPoints.size() * (range + 1U)) / kThreadCount);
+      });
+    }
+    sums[0] = SumSquares(kPoints, 0U, kPoints.size() / kThreadCount);
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    double sum = 0.0;
+    for (const auto kSum : sums) {
+      sum += kSum;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  helper::SetThroughput(state, state.range(0),
+                        static_cast<int64_t>(sizeof(geometry::Point2D)));
+}
+BENCHMARK(ParallelForSpawn)->Apply(helper::ApplyDataSizes)->UseRealTime();
+}  // namespace
@@ -0,0 +1,170 @@
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/point2d.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+#include "benchmark/benchmark.h"
+#include "benchmark_helper.hpp"
+
+namespace {
+namespace helper = Jeong0806::geometry::benchmark_helper;
+using Jeong0806::geometry::Point2D;
+
+constexpr int64_t kPointBytes{static_cast<int64_t>(sizeof(Point2D))};
+
+auto Point2DCalculateDistance(benchmark::State& state) -> void {
+  const auto kPoints = helper::MakeRandomPoints(state.range(0));
+  const Point2D kOrigin(1.0, 2.0);
+  for (auto _ : state) {
+    double sum = 0.0;
+    for (const auto& point : kPoints) {
+      sum += point.CalculateDistance(kOrigin);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  helper::SetThroughput(state, state.range(0), kPointBytes);
+}
+BENCHMARK(Point2DCalculateDistance)->Apply(helper::ApplyDataSizes);
+
+auto Point2DStaticCalculateDistance(benchmark::State& state) -> void {
+  const auto kLhs = helper::MakeRandomPoints(state.range(0), 1U);
+  const auto kRhs = helper::MakeRandomPoints(state.range(0), 2U);
+  for (auto _ : state) {
+    double sum = 0.0;
+    for (std::size_t i = 0; i < kLhs.size(); ++i) {
+      sum += Point2D::CalculateDistance(kLhs[i], kRhs[i]);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  helper::SetThroughput(state, state.range(0), 2 * kPointBytes);
+}
+BENCHMARK(Point2DStaticCalculateDistance)->Apply(helper::ApplyDataSizes);
+
+// Threshold check through sqrt, the baseline for Point2DIsWithin
+auto Point2DCalculateDistanceThreshold(benchmark::State& state) -> void {
+  const auto kPoints = helper::MakeRandomPoints(state.range(0));
+  const Point2D kOrigin(1.0, 2.0);
+  const auto kRadius = helper::kCoordinateRange / 2.0;
+  for (auto _ : state) {
+    std::size_t within = 0;
+    for (const auto& point : kPoints) {
+      within += point.CalculateDistance(kOrigin) <= kRadius ? 1U : 0U;
+    }
+    benchmark::DoNotOptimize(within);
+  }
+  helper::SetThroughput(state, state.range(0), kPointBytes);
+}
+BENCHMARK(Point2DCalculateDistanceThreshold)->Apply(helper::ApplyDataSizes);
+
+auto Point2DIsWithin(benchmark::State& state) -> void {
+  const auto kPoints = helper::MakeRandomPoints(state.range(0));
+  const Point2D kOrigin(1.0, 2.0);
+  const auto kRadius = helper::kCoordinateRange / 2.0;
+  for (auto _ : state) {
+    std::size_t within = 0;
+    for (const auto& point : kPoints) {
+      within += point.IsWithin(kOrigin, kRadius) ? 1U : 0U;
+    }
+    benchmark::DoNotOptimize(within);
+  }
+  helper::SetThroughput(state, state.range(0), kPointBytes);
+}
+BENCHMARK(Point2DIsWithin)->Apply(helper::ApplyDataSizes);
+
+auto Point2DCompareDistance(benchmark::State& state) -> void {
+  const auto kLhs = helper::MakeRandomPoints(state.range(0), 1U);
+  const auto kRhs = helper::MakeRandomPoints(state.range(0), 2U);
+  const Point2D kOrigin(1.0, 2.0);
+  for (auto _ : state) {
+    int64_t sum = 0;
+    for (std::size_t i = 0; i < kLhs.size(); ++i) {
+      sum += Point2D::CompareDistance(kLhs[i], kRhs[i], kOrigin);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  helper::SetThroughput(state, state.range(0), 2 * kPointBytes);
+}
+BENCHMARK(Point2DCompareDistance)->Apply(helper::ApplyDataSizes);
+
+auto Point2DGetXY(benchmark::State& state) -> void {
+  const auto kPoints = helper::MakeRandomPoints(state.range(0));
+  for (auto _ : state) {
+    double sum = 0.0;
+    for (const auto& point : kPoints) {
+      sum += point.GetX() + point.GetY();
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  helper::SetThroughput(state, state.range(0), kPointBytes);
+}
+BENCHMARK(Point2DGetXY)->Apply(helper::ApplyDataSizes);
+
+auto Point2DOperatorAdd(benchmark::State& state) -> void {
+  const auto kPoints = helper::MakeRandomPoints(state.range(0));
+  for (auto _ : state) {
+    Point2D sum;
+    for (const auto& point : kPoints) {
+      sum = sum + point;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  helper::SetThroughput(state, state.range(0), kPointBytes);
+}
+BENCHMARK(Point2DOperatorAdd)->Apply(helper::ApplyDataSizes);
+
+auto Point2DOperatorSubtract(benchmark::State& state) -> void {
+  const auto kPoints = helper::MakeRandomPoints(state.range(0));
+  for (auto _ : state) {
+    Point2D difference;
+    for (const auto& point : kPoints) {
+      difference -= point;
+    }
+    benchmark::DoNotOptimize(difference);
+  }
+  helper::SetThroughput(state, state.range(0), kPointBytes);
+}
+BENCHMARK(Point2DOperatorSubtract)->Apply(helper::ApplyDataSizes);
+
+auto Point2DOperatorMultiply(benchmark::State& state) -> void {
+  auto points = helper::MakeRandomPoints(state.range(0));
+  for (auto _ : state) {
+    for (auto& point : points) {
+      point = point * 1.0000001;
+    }
+    benchmark::DoNotOptimize(points.data());
+    benchmark::ClobberMemory();
+  }
+  helper::SetThroughput(state, state.range(0), 2 * kPointBytes);
+}
+BENCHMARK(Point2DOperatorMultiply)->Apply(helper::ApplyDataSizes);
+
+auto Point2DOperatorDivide(benchmark::State& state) -> void {
+  auto points = helper::MakeRandomPoints(state.range(0));
+  for (auto _ : state) {
+    for (auto& point : points) {
+      point = point / 1.0000001;
+    }
+    benchmark::DoNotOptimize(points.data());
+    benchmark::ClobberMemory();
+  }
+  helper::SetThroughput(state, state.range(0), 2 * kPointBytes);
+}
+BENCHMARK(Point2DOperatorDivide)->Apply(helper::ApplyDataSizes);
+
+auto Point2DOperatorEqual(benchmark::State& state) -> void {
+  const auto kLhs = helper::MakeRandomPoints(state.range(0), 1U);
+  const auto kRhs = helper::MakeRandomPoints(state.range(0), 1U);
+  for (auto _ : state) {
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < kLhs.size(); ++i) {
+      count += (kLhs[i] == kRhs[i]) ? 1U : 0U;
+    }
+    benchmark::DoNotOptimize(count);
+  }
+  helper::SetThroughput(state, state.range(0), 2 * kPointBytes);
+}
+BENCHMARK(Point2DOperatorEqual)->Apply(helper::ApplyDataSizes);
+}  // namespace
@@ -0,0 +1,166 @@
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/point_cloud2d.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "benchmark_helper.hpp"
+
+namespace {
+namespace helper = Jeong0806::geometry::benchmark_helper;
+using Jeong0806::geometry::Point2D;
+using Jeong0806::geometry::Point2F;
+using Jeong0806::geometry::PointCloud2D;
+using Jeong0806::geometry::PointCloud2F;
+
+constexpr int64_t kPointBytes{static_cast<int64_t>(sizeof(Point2D))};
+constexpr int64_t kFloatPointBytes{static_cast<int64_t>(sizeof(Point2F))};
+
+auto PointCloud2DFromPoints(benchmark::State& state) -> void {
+  const auto kPoints = helper::MakeRandomPoints(state.range(0));
+  for (auto _ : state) {
+    PointCloud2D cloud(kPoints);
+    benchmark::DoNotOptimize(cloud.GetXData());
+  }
+  helper::SetThroughput(state, state.range(0), 2 * kPointBytes);
+}
+BENCHMARK(PointCloud2DFromPoints)->Apply(helper::ApplyDataSizes);
+
+auto PointCloud2DToPoints(benchmark::State& state) -> void {
+  const PointCloud2D kCloud(helper::MakeRandomPoints(state.range(0)));
+  std::vector<Point2D> points(kCloud.Size());
+  for (auto _ : state) {
+    kCloud.CopyTo(points.data());
+    benchmark::DoNotOptimize(points.data());
+    benchmark::ClobberMemory();
+  }
+  helper::SetThroughput(state, state.range(0), 2 * kPointBytes);
+}
+BENCHMARK(PointCloud2DToPoints)->Apply(helper::ApplyDataSizes);
+
+auto PointCloud2DCalculateDistances(benchmark::State& state) -> void {
+  const PointCloud2D kCloud(helper::MakeRandomPoints(state.range(0)));
+  const Point2D kOrigin(1.0, 2.0);
+  std::vector<double> distances(kCloud.Size());
+  for (auto _ : state) {
+    kCloud.CalculateDistances(kOrigin, distances.data());
+    benchmark::DoNotOptimize(distances.data());
+    benchmark::ClobberMemory();
+  }
+  helper::SetThroughput(state, state.range(0),
+                        kPointBytes + static_cast<int64_t>(sizeof(double)));
+}
+BENCHMARK(PointCloud2DCalculateDistances)->Apply(helper::ApplyDataSizes);
+
+auto PointCloud2DCalculatePairwiseDistances(benchmark::State& state) -> void {
+  const PointCloud2D kLhs(helper::MakeRandomPoints(state.range(0), 1U));
+  const PointCloud2D kRhs(helper::MakeRandomPoints(state.range(0), 2U));
+  std::vector<double> distances(kLhs.Size());
+  for (auto _ : state) {
+    PointCloud2D::CalculatePairwiseDistances(kLhs, kRhs, distances.data());
+    benchmark::DoNotOptimize(distances.data());
+    benchmark::ClobberMemory();
+  }
+  helper::SetThroughput(
+      state, state.range(0),
+      2 * kPointBytes + static_cast<int64_t>(sizeof(double)));
+}
+BENCHMARK(PointCloud2DCalculatePairwiseDistances)
+    ->Apply(helper::ApplyDataSizes);
+
+auto PointCloud2DIsWithin(benchmark::State& state) -> void {
+  const PointCloud2D kCloud(helper::MakeRandomPoints(state.range(0)));
+  const Point2D kOrigin(1.0, 2.0);
+  std::vector<uint8_t> flags(kCloud.Size());
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(kCloud.IsWithin(
+        kOrigin, helper::kCoordinateRange / 2.0, flags.data()));
+    benchmark::ClobberMemory();
+  }
+  helper::SetThroughput(state, state.range(0),
+                        kPointBytes + static_cast<int64_t>(sizeof(uint8_t)));
+}
+BENCHMARK(PointCloud2DIsWithin)->Apply(helper::ApplyDataSizes);
+
+auto PointCloud2DCompareDistances(benchmark::State& state) -> void {
+  const PointCloud2D kLhs(helper::MakeRandomPoints(state.range(0), 1U));
+  const PointCloud2D kRhs(helper::MakeRandomPoints(state.range(0), 2U));
+  const Point2D kOrigin(1.0, 2.0);
+  std::vector<int8_t> results(kLhs.Size());
+  for (auto _ : state) {
+    PointCloud2D::CompareDistances(kLhs, kRhs, kOrigin, results.data());
+    benchmark::DoNotOptimize(results.data());
+    benchmark::ClobberMemory();
+  }
+  helper::SetThroughput(state, state.range(0),
+                        2 * kPointBytes + static_cast<int64_t>(sizeof(int8_t)));
+}
+BENCHMARK(PointCloud2DCompareDistances)->Apply(helper::ApplyDataSizes);
+
+auto PointCloud2FCalculateDistances(benchmark::State& state) -> void {
+  const PointCloud2D kWide(helper::MakeRandomPoints(state.range(0)));
+  const PointCloud2F kCloud(kWide);
+  const Point2F kOrigin(1.0F, 2.0F);
+  std::vector<float> distances(kCloud.Size());
+  for (auto _ : state) {
+    kCloud.CalculateDistances(kOrigin, distances.data());
+    benchmark::DoNotOptimize(distances.data());
+    benchmark::ClobberMemory();
+  }
+  helper::SetThroughput(state, state.range(0),
+                        kFloatPointBytes + static_cast<int64_t>(sizeof(float)));
+
+  // Error against the double kernel on the unrounded coordinates
+  const auto kExpected = kWide.CalculateDistances(kOrigin);
+  double max_absolute = 0.0;
+  double max_relative = 0.0;
+  for (std::size_t i = 0; i < kExpected.size(); ++i) {
+    const auto kError = std::abs(distances[i] - kExpected[i]);
+    max_absolute = std::max(max_absolute, kError);
+    max_relative = std::max(max_relative, kError / kExpected[i]);
+  }
+  state.counters["max_abs_error"] = max_absolute;
+  state.counters["max_rel_error"] = max_relative;
+}
+BENCHMARK(PointCloud2FCalculateDistances)->Apply(helper::ApplyDataSizes);
+
+auto PointCloud2FCalculatePairwiseDistances(benchmark::State& state) -> void {
+  const PointCloud2F kLhs(
+      PointCloud2D(helper::MakeRandomPoints(state.range(0), 1U)));
+  const PointCloud2F kRhs(
+      PointCloud2D(helper::MakeRandomPoints(state.range(0), 2U)));
+  std::vector<float> distances(kLhs.Size());
+  for (auto _ : state) {
+    PointCloud2F::CalculatePairwiseDistances(kLhs, kRhs, distances.data());
+    benchmark::DoNotOptimize(distances.data());
+    benchmark::ClobberMemory();
+  }
+  helper::SetThroughput(
+      state, state.range(0),
+      2 * kFloatPointBytes + static_cast<int64_t>(sizeof(float)));
+}
+BENCHMARK(PointCloud2FCalculatePairwiseDistances)
+    ->Apply(helper::ApplyDataSizes);
+
+auto PointCloud2FIsWithin(benchmark::State& state) -> void {
+  const PointCloud2F kCloud(
+      PointCloud2D(helper::MakeRandomPoints(state.range(0))));
+  const Point2F kOrigin(1.0F, 2.0F);
+  std::vector<uint8_t> flags(kCloud.Size());
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(kCloud.IsWithin(
+        kOrigin, static_cast<float>(helper::kCoordinateRange / 2.0),
+        flags.data()));
+    benchmark::ClobberMemory();
+  }
+  helper::SetThroughput(
+      state, state.range(0),
+      kFloatPointBytes + static_cast<int64_t>(sizeof(uint8_t)));
+}
+BENCHMARK(PointCloud2FIsWithin)->Apply(helper::ApplyDataSizes);
+}  // namespace
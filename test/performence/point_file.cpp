@@ -0,0 +1,105 @@
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/point_file.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "benchmark_helper.hpp"
+#include "geometry/distance_kernels.hpp"
+
+namespace {
+namespace helper = Jeong0806::geometry::benchmark_helper;
+using Jeong0806::geometry::Point2D;
+using Jeong0806::geometry::PointCloud2D;
+using Jeong0806::geometry::PointFileReader;
+using Jeong0806::geometry::PointFileWriter;
+
+constexpr int64_t kPointBytes{static_cast<int64_t>(sizeof(Point2D))};
+// Text files of the largest size take hundreds of MiB
+constexpr int64_t kMaxFileSize{int64_t{1} << 20};
+
+auto MakePath(const std::string& extension) -> std::string {
+  return "geometry_point_file_benchmark." + extension;
+}
+
+auto ApplyFileSizes(benchmark::internal::Benchmark* bench) -> void {
+  bench->RangeMultiplier(helper::kDataSizeMultiplier)
+      ->Range(helper::kMinDataSize, kMaxFileSize);
+}
+
+// Loading points from text, the path the binary format replaces
+auto PointFileTextLoad(benchmark::State& state) -> void {
+  const auto kPath = MakePath("txt");
+  {
+    std::ofstream file(kPath);
+    file.precision(17);
+    for (const auto& point : helper::MakeRandomPoints(state.range(0))) {
+      file << point.GetX() << ' ' << point.GetY() << '\n';
+    }
+  }
+  for (auto _ : state) {
+    std::ifstream file(kPath);
+    std::vector<Point2D> points;
+    double x = 0.0;
+    double y = 0.0;
+    while (file >> x >> y) {
+      points.emplace_back(x, y);
+    }
+    benchmark::DoNotOptimize(points.data());
+  }
+  std::remove(kPath.c_str());
+  helper::SetThroughput(state, state.range(0), kPointBytes);
+}
+BENCHMARK(PointFileTextLoad)->Apply(ApplyFileSizes);
+
+auto PointFileWrite(benchmark::State& state) -> void {
+  const auto kPath = MakePath("bin");
+  const auto kPoints = helper::MakeRandomPoints(state.range(0));
+  for (auto _ : state) {
+    PointFileWriter writer(kPath, kPoints.size());
+    writer.Push(kPoints.data(), kPoints.size());
+    writer.Close();
+  }
+  std::remove(kPath.c_str());
+  helper::SetThroughput(state, state.range(0), kPointBytes);
+}
+BENCHMARK(PointFileWrite)->Apply(ApplyFileSizes);
+
+// Mapping plus one kernel pass over the mapped columns
+auto PointFileMapAndCalculate(benchmark::State& state) -> void {
+  const auto kPath = MakePath("bin");
+  const PointCloud2D kPoints(helper::MakeRandomPoints(state.range(0)));
+  PointFileWriter::Write(kPath, kPoints);
+  std::vector<double> distances(state.range(0));
+  for (auto _ : state) {
+    const PointFileReader kReader(kPath);
+    Jeong0806::geometry::kernel::CalculateDistances(
+        kReader.GetXData(), kReader.GetYData(), kReader.Size(), 0.0, 0.0,
+        distances.data());
+    benchmark::DoNotOptimize(distances.data());
+  }
+  std::remove(kPath.c_str());
+  helper::SetThroughput(state, state.range(0), kPointBytes);
+}
+BENCHMARK(PointFileMapAndCalculate)->Apply(ApplyFileSizes);
+
+auto PointFileVerify(benchmark::State& state) -> void {
+  const auto kPath = MakePath("bin");
+  const PointCloud2D kPoints(helper::MakeRandomPoints(state.range(0)));
+  PointFileWriter::Write(kPath, kPoints);
+  const PointFileReader kReader(kPath);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(kReader.Verify());
+  }
+  std::remove(kPath.c_str());
+  helper::SetThroughput(state, state.range(0), kPointBytes);
+}
+BENCHMARK(PointFileVerify)->Apply(ApplyFileSizes);
+}  // namespace
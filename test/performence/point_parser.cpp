@@ -0,0 +1,99 @@
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/point_parser.hpp"
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "benchmark_helper.hpp"
+
+namespace {
+namespace helper = Jeong0806::geometry::benchmark_helper;
+using Jeong0806::geometry::CsvFormat;
+using Jeong0806::geometry::Distance;
+using Jeong0806::geometry::Point2D;
+using Jeong0806::geometry::PointParser;
+
+auto MakeCsv(int64_t count) -> std::string {
+  std::ostringstream stream;
+  stream.precision(17);
+  for (const auto& point : helper::MakeRandomPoints(count)) {
+    stream << point.GetX() << ',' << point.GetY() << '\n';
+  }
+  return stream.str();
+}
+
+auto MakeWkt(int64_t count) -> std::string {
+  std::ostringstream stream;
+  stream.precision(17);
+  for (const auto& point : helper::MakeRandomPoints(count)) {
+    stream << "POINT (" << point.GetX() << ' ' << point.GetY() << ")\n";
+  }
+  return stream.str();
+}
+
+// Bytes per item are the average text length of a point
+auto SetTextThroughput(benchmark::State& state, const std::string& text)
+    -> void {
+  helper::SetThroughput(state, state.range(0),
+                        static_cast<int64_t>(text.size()) / state.range(0));
+}
+
+// Parsing through iostreams, the path the parser replaces
+auto PointParserCsvStream(benchmark::State& state) -> void {
+  const auto kText = MakeCsv(state.range(0));
+  for (auto _ : state) {
+    std::istringstream stream(kText);
+    std::vector<Point2D> points;
+    double x = 0.0;
+    double y = 0.0;
+    char comma = '\0';
+    while (stream >> x >> comma >> y) {
+      points.emplace_back(x, y);
+    }
+    benchmark::DoNotOptimize(points.data());
+  }
+  SetTextThroughput(state, kText);
+}
+BENCHMARK(PointParserCsvStream)
+    ->Apply(helper::ApplyDataSizes)
+    ->UseRealTime();
+
+auto PointParserCsv(benchmark::State& state) -> void {
+  const auto kText = MakeCsv(state.range(0));
+  for (auto _ : state) {
+    const auto kPoints = PointParser::ParseCsv(
+        kText, CsvFormat(), Distance::DistanceType::kMeter,
+        static_cast<std::size_t>(state.range(1)));
+    benchmark::DoNotOptimize(kPoints.GetXData());
+  }
+  SetTextThroughput(state, kText);
+}
+BENCHMARK(PointParserCsv)
+    ->ArgsProduct({benchmark::CreateRange(helper::kMinDataSize,
+                                          helper::kMaxDataSize,
+                                          helper::kDataSizeMultiplier),
+                   {1, 0}})
+    ->UseRealTime();
+
+auto PointParserWkt(benchmark::State& state) -> void {
+  const auto kText = MakeWkt(state.range(0));
+  for (auto _ : state) {
+    const auto kGeometries = PointParser::ParseWkt(
+        kText, Distance::DistanceType::kMeter,
+        static_cast<std::size_t>(state.range(1)));
+    benchmark::DoNotOptimize(kGeometries.points.GetXData());
+  }
+  SetTextThroughput(state, kText);
+}
+BENCHMARK(PointParserWkt)
+    ->ArgsProduct({benchmark::CreateRange(helper::kMinDataSize,
+                                          helper::kMaxDataSize,
+                                          helper::kDataSizeMultiplier),
+                   {1, 0}})
+    ->UseRealTime();
+}  // namespace
@@ -0,0 +1,114 @@
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/polygon_index2d.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "benchmark_helper.hpp"
+#include "geometry/polygon2d.hpp"
+
+namespace {
+namespace helper = Jeong0806::geometry::benchmark_helper;
+using Jeong0806::geometry::Point2D;
+using Jeong0806::geometry::PointCloud2D;
+using Jeong0806::geometry::Polygon2D;
+using Jeong0806::geometry::PolygonIndex2D;
+
+constexpr uint32_t kZonesPerSide{64U};
+constexpr uint32_t kZoneVertices{32U};
+constexpr int64_t kPointBytes{static_cast<int64_t>(sizeof(Point2D))};
+// Testing every zone per point takes microseconds, so the baseline stops
+// early
+constexpr int64_t kMaxBaselineSize{int64_t{1} << 16};
+
+// A grid of jagged disjoint stars, 4096 zones of 32 edges over the range
+auto MakeZones() -> std::vector<Polygon2D> {
+  std::mt19937_64 engine(helper::kSeed);
+  std::uniform_real_distribution<double> scale(0.5, 1.0);
+  const auto kPitch = 2.0 * helper::kCoordinateRange / kZonesPerSide;
+  std::vector<Polygon2D> zones;
+  for (uint32_t i = 0; i < kZonesPerSide * kZonesPerSide; ++i) {
+    const auto kCenterX =
+        -helper::kCoordinateRange + (kPitch * ((i % kZonesPerSide) + 0.5));
+    const auto kCenterY =
+        -helper::kCoordinateRange + (kPitch * ((i / kZonesPerSide) + 0.5));
+    std::vector<Point2D> ring;
+    for (uint32_t j = 0; j < kZoneVertices; ++j) {
+      const auto kAngle = 6.283185307179586 * j / kZoneVertices;
+      const auto kRadius = 0.5 * kPitch * scale(engine);
+      ring.emplace_back(kCenterX + (kRadius * std::cos(kAngle)),
+                        kCenterY + (kRadius * std::sin(kAngle)));
+    }
+    zones.emplace_back(ring);
+  }
+  return zones;
+}
+
+auto PolygonIndex2DBuild(benchmark::State& state) -> void {
+  const auto kZones = MakeZones();
+  for (auto _ : state) {
+    PolygonIndex2D index(kZones);
+    benchmark::DoNotOptimize(index);
+  }
+  helper::SetThroughput(state, kZones.size() * kZoneVertices, kPointBytes);
+}
+BENCHMARK(PolygonIndex2DBuild)->Unit(benchmark::kMillisecond);
+
+// A bounding box check and a crossing test per zone, the cost the index
+// removes
+auto PolygonIndex2DClassifyBaseline(benchmark::State& state) -> void {
+  const auto kZones = MakeZones();
+  const auto kPoints = helper::MakeRandomPoints(state.range(0));
+  std::vector<uint32_t> output(kPoints.size());
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < kPoints.size(); ++i) {
+      output[i] = PolygonIndex2D::kNoZone;
+      for (uint32_t zone = 0; zone < kZones.size(); ++zone) {
+        if (kZones[zone].Contains(kPoints[i])) {
+          output[i] = zone;
+          break;
+        }
+      }
+    }
+    benchmark::DoNotOptimize(output.data());
+    benchmark::ClobberMemory();
+  }
+  helper::SetThroughput(state, state.range(0), kPointBytes);
+}
+BENCHMARK(PolygonIndex2DClassifyBaseline)
+    ->RangeMultiplier(helper::kDataSizeMultiplier)
+    ->Range(helper::kMinDataSize, kMaxBaselineSize);
+
+auto PolygonIndex2DClassify(benchmark::State& state) -> void {
+  const PolygonIndex2D kIndex(MakeZones());
+  const auto kPoints = helper::MakeRandomPoints(state.range(0));
+  std::vector<uint32_t> output(kPoints.size());
+  for (auto _ : state) {
+    kIndex.Classify(kPoints.data(), kPoints.size(), output.data(), 1U);
+    benchmark::DoNotOptimize(output.data());
+    benchmark::ClobberMemory();
+  }
+  helper::SetThroughput(state, state.range(0), kPointBytes);
+}
+BENCHMARK(PolygonIndex2DClassify)
+    ->RangeMultiplier(helper::kDataSizeMultiplier)
+    ->Range(helper::kMinDataSize, helper::kMaxDataSize);
+
+auto PolygonIndex2DClassifyPointCloud(benchmark::State& state) -> void {
+  const PolygonIndex2D kIndex(MakeZones());
+  const PointCloud2D kPoints(helper::MakeRandomPoints(state.range(0)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(kIndex.Classify(kPoints, 1U));
+  }
+  helper::SetThroughput(state, state.range(0), kPointBytes);
+}
+BENCHMARK(PolygonIndex2DClassifyPointCloud)
+    ->RangeMultiplier(helper::kDataSizeMultiplier)
+    ->Range(helper::kMinDataSize, helper::kMaxDataSize);
+}  // namespace
@@ -0,0 +1,75 @@
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/polyline_simplifier2d.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "benchmark_helper.hpp"
+
+namespace {
+namespace helper = Jeong0806::geometry::benchmark_helper;
+using Jeong0806::geometry::Distance;
+using Jeong0806::geometry::Point2D;
+using Jeong0806::geometry::PolylineSimplifier2D;
+using Jeong0806::geometry::StreamingPolylineSimplifier2D;
+
+constexpr int64_t kPointBytes{static_cast<int64_t>(sizeof(Point2D))};
+// Samples a meter apart with tolerance of a few samples
+constexpr double kStep{1.0};
+constexpr double kTolerance{5.0};
+
+auto MakeTrack(std::size_t count) -> std::vector<Point2D> {
+  std::mt19937_64 engine(helper::kSeed);
+  std::uniform_real_distribution<double> step(-kStep, kStep);
+  std::vector<Point2D> points(count);
+  double x = 0.0;
+  double y = 0.0;
+  for (auto& point : points) {
+    point = Point2D(x, y);
+    x += kStep;
+    y += step(engine);
+  }
+  return points;
+}
+
+template <PolylineSimplifier2D::Method kMethod>
+auto PolylineSimplifier2DSimplifyIndices(benchmark::State& state) -> void {
+  const auto kTrack = MakeTrack(state.range(0));
+  for (auto _ : state) {
+    auto indices = PolylineSimplifier2D::SimplifyIndices(
+        kTrack, Distance(kTolerance), kMethod);
+    benchmark::DoNotOptimize(indices.data());
+  }
+  helper::SetThroughput(state, state.range(0), kPointBytes);
+}
+BENCHMARK_TEMPLATE(PolylineSimplifier2DSimplifyIndices,
+                   PolylineSimplifier2D::Method::kDouglasPeucker)
+    ->Apply(helper::ApplyDataSizes);
+BENCHMARK_TEMPLATE(PolylineSimplifier2DSimplifyIndices,
+                   PolylineSimplifier2D::Method::kVisvalingam)
+    ->Apply(helper::ApplyDataSizes);
+
+auto PolylineSimplifier2DStreaming(benchmark::State& state) -> void {
+  const auto kTrack = MakeTrack(state.range(0));
+  std::size_t retained = 0;
+  StreamingPolylineSimplifier2D simplifier(
+      Distance(kTolerance),
+      [&retained](std::size_t /* index */, const Point2D& /* point */) {
+        ++retained;
+      });
+  for (auto _ : state) {
+    for (const auto& point : kTrack) {
+      simplifier.Push(point);
+    }
+    simplifier.Finish();
+    benchmark::DoNotOptimize(retained);
+  }
+  helper::SetThroughput(state, state.range(0), kPointBytes);
+}
+BENCHMARK(PolylineSimplifier2DStreaming)->Apply(helper::ApplyDataSizes);
+}  // namespace
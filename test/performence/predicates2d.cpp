@@ -0,0 +1,108 @@
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/predicates2d.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "benchmark_helper.hpp"
+
+namespace {
+namespace helper = Jeong0806::geometry::benchmark_helper;
+namespace geometry = Jeong0806::geometry;
+
+const geometry::Point2D kLineBegin(-helper::kCoordinateRange,
+                                   -helper::kCoordinateRange / 3.0);
+const geometry::Point2D kLineEnd(helper::kCoordinateRange,
+                                 helper::kCoordinateRange / 7.0);
+const geometry::Point2D kCircleA(helper::kCoordinateRange, 0.0);
+const geometry::Point2D kCircleB(0.0, helper::kCoordinateRange);
+const geometry::Point2D kCircleC(-helper::kCoordinateRange, 0.0);
+
+// Random points, or points on the line or circle up to rounding so nearly
+// every test falls back to the adaptive stages
+auto MakePoints(std::size_t count, bool degenerate, bool circle)
+    -> std::vector<geometry::Point2D> {
+  if (!degenerate) {
+    return helper::MakeRandomPoints(count);
+  }
+  std::mt19937_64 engine(helper::kSeed);
+  std::uniform_real_distribution<double> parameter(0.0, 1.0);
+  std::vector<geometry::Point2D> points(count);
+  for (auto& point : points) {
+    const auto kT = parameter(engine);
+    if (circle) {
+      const auto kAngle = 6.283185307179586 * kT;
+      point = geometry::Point2D(helper::kCoordinateRange * std::cos(kAngle),
+                                helper::kCoordinateRange * std::sin(kAngle));
+    } else {
+      point = geometry::Point2D(
+          kLineBegin.GetX() + (kT * (kLineEnd.GetX() - kLineBegin.GetX())),
+          kLineBegin.GetY() + (kT * (kLineEnd.GetY() - kLineBegin.GetY())));
+    }
+  }
+  return points;
+}
+
+auto ApplySizesAndInputs(benchmark::internal::Benchmark* bench) -> void {
+  bench->ArgsProduct({benchmark::CreateRange(helper::kMinDataSize,
+                                             helper::kMaxDataSize,
+                                             helper::kDataSizeMultiplier),
+                      {0, 1}});
+}
+
+// The plain determinant without error bounds, for the cost of the filter
+auto PredicatesOrient2DBaseline(benchmark::State& state) -> void {
+  const auto kPoints = MakePoints(state.range(0), state.range(1) != 0, false);
+  std::vector<int8_t> output(kPoints.size());
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < kPoints.size(); ++i) {
+      const auto kDet =
+          ((kLineBegin.GetX() - kPoints[i].GetX()) *
+           (kLineEnd.GetY() - kPoints[i].GetY())) -
+          ((kLineBegin.GetY() - kPoints[i].GetY()) *
+           (kLineEnd.GetX() - kPoints[i].GetX()));
+      output[i] = static_cast<int8_t>(static_cast<int8_t>(kDet > 0.0) -
+                                      static_cast<int8_t>(kDet < 0.0));
+    }
+    benchmark::DoNotOptimize(output.data());
+    benchmark::ClobberMemory();
+  }
+  helper::SetThroughput(state, state.range(0),
+                        static_cast<int64_t>(sizeof(geometry::Point2D)));
+}
+BENCHMARK(PredicatesOrient2DBaseline)->Apply(ApplySizesAndInputs);
+
+auto PredicatesOrient2D(benchmark::State& state) -> void {
+  const auto kPoints = MakePoints(state.range(0), state.range(1) != 0, false);
+  std::vector<int8_t> output(kPoints.size());
+  for (auto _ : state) {
+    geometry::Predicates2D::Orient2D(kLineBegin, kLineEnd, kPoints.data(),
+                                     kPoints.size(), output.data(), 1U);
+    benchmark::DoNotOptimize(output.data());
+    benchmark::ClobberMemory();
+  }
+  helper::SetThroughput(state, state.range(0),
+                        static_cast<int64_t>(sizeof(geometry::Point2D)));
+}
+BENCHMARK(PredicatesOrient2D)->Apply(ApplySizesAndInputs);
+
+auto PredicatesInCircle(benchmark::State& state) -> void {
+  const auto kPoints = MakePoints(state.range(0), state.range(1) != 0, true);
+  std::vector<int8_t> output(kPoints.size());
+  for (auto _ : state) {
+    geometry::Predicates2D::InCircle(kCircleA, kCircleB, kCircleC,
+                                     kPoints.data(), kPoints.size(),
+                                     output.data(), 1U);
+    benchmark::DoNotOptimize(output.data());
+    benchmark::ClobberMemory();
+  }
+  helper::SetThroughput(state, state.range(0),
+                        static_cast<int64_t>(sizeof(geometry::Point2D)));
+}
+BENCHMARK(PredicatesInCircle)->Apply(ApplySizesAndInputs);
+}  // namespace
@@ -0,0 +1,77 @@
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/quantity.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "benchmark_helper.hpp"
+
+namespace {
+namespace helper = Jeong0806::geometry::benchmark_helper;
+using Jeong0806::geometry::Distance;
+using Jeong0806::geometry::Kilometers;
+using Jeong0806::geometry::Meters;
+
+constexpr int64_t kValueBytes{static_cast<int64_t>(sizeof(double))};
+
+auto MakeRandomMeters(std::size_t count) -> std::vector<Meters> {
+  const auto kValues = helper::MakeRandomValues(count);
+  std::vector<Meters> meters(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    meters[i] = Meters(kValues[i]);
+  }
+  return meters;
+}
+
+// Meter to kilometer through a Distance with runtime unit switches
+auto QuantityRuntimeUnitConversion(benchmark::State& state) -> void {
+  const auto kValues = helper::MakeRandomValues(state.range(0));
+  auto from = Distance::DistanceType::kMeter;
+  auto to = Distance::DistanceType::kKilometer;
+  benchmark::DoNotOptimize(from);
+  benchmark::DoNotOptimize(to);
+  std::vector<double> converted(kValues.size());
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < kValues.size(); ++i) {
+      converted[i] = Distance(kValues[i], from).GetValue(to);
+    }
+    benchmark::DoNotOptimize(converted.data());
+    benchmark::ClobberMemory();
+  }
+  helper::SetThroughput(state, state.range(0), 2 * kValueBytes);
+}
+BENCHMARK(QuantityRuntimeUnitConversion)->Apply(helper::ApplyDataSizes);
+
+auto QuantityConversion(benchmark::State& state) -> void {
+  const auto kMeters = MakeRandomMeters(state.range(0));
+  std::vector<Kilometers> converted(kMeters.size());
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < kMeters.size(); ++i) {
+      converted[i] = Kilometers(kMeters[i]);
+    }
+    benchmark::DoNotOptimize(converted.data());
+    benchmark::ClobberMemory();
+  }
+  helper::SetThroughput(state, state.range(0), 2 * kValueBytes);
+}
+BENCHMARK(QuantityConversion)->Apply(helper::ApplyDataSizes);
+
+auto QuantityToDistance(benchmark::State& state) -> void {
+  const auto kMeters = MakeRandomMeters(state.range(0));
+  std::vector<Distance> distances(kMeters.size());
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < kMeters.size(); ++i) {
+      distances[i] = kMeters[i].ToDistance();
+    }
+    benchmark::DoNotOptimize(distances.data());
+    benchmark::ClobberMemory();
+  }
+  helper::SetThroughput(state, state.range(0),
+                        kValueBytes + static_cast<int64_t>(sizeof(Distance)));
+}
+BENCHMARK(QuantityToDistance)->Apply(helper::ApplyDataSizes);
+}  // namespace
@@ -0,0 +1,64 @@
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/spatial_hash_grid2d.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "benchmark/benchmark.h"
+#include "benchmark_helper.hpp"
+
+namespace {
+namespace helper = Jeong0806::geometry::benchmark_helper;
+using Jeong0806::geometry::Distance;
+using Jeong0806::geometry::Point2D;
+using Jeong0806::geometry::SpatialHashGrid2D;
+
+constexpr std::size_t kQueryCount{1024U};
+constexpr int64_t kPointBytes{static_cast<int64_t>(sizeof(Point2D))};
+
+// Keeps about 16 points per radius query at every data size
+auto RadiusFor(int64_t count) -> double {
+  return 2.0 * helper::kCoordinateRange * std::sqrt(16.0 / (3.14159 * count));
+}
+
+auto SpatialHashGrid2DBuild(benchmark::State& state) -> void {
+  const auto kPoints = helper::MakeRandomPoints(state.range(0));
+  const Distance kCellSize(RadiusFor(state.range(0)));
+  for (auto _ : state) {
+    SpatialHashGrid2D grid(kPoints, kCellSize);
+    benchmark::DoNotOptimize(grid);
+  }
+  helper::SetThroughput(state, state.range(0), kPointBytes);
+}
+BENCHMARK(SpatialHashGrid2DBuild)->Apply(helper::ApplyDataSizes)->UseRealTime();
+
+auto SpatialHashGrid2DRadius(benchmark::State& state) -> void {
+  const auto kRadius = RadiusFor(state.range(0));
+  const SpatialHashGrid2D kGrid(helper::MakeRandomPoints(state.range(0)),
+                                Distance(kRadius));
+  const auto kQueries = helper::MakeRandomPoints(kQueryCount, 7U);
+  for (auto _ : state) {
+    for (const auto& query : kQueries) {
+      benchmark::DoNotOptimize(kGrid.Radius(query, kRadius));
+    }
+  }
+  helper::SetThroughput(state, kQueryCount, kPointBytes);
+}
+BENCHMARK(SpatialHashGrid2DRadius)->Apply(helper::ApplyDataSizes);
+
+auto SpatialHashGrid2DPairsWithin(benchmark::State& state) -> void {
+  const auto kRadius = RadiusFor(state.range(0)) / 4.0;
+  const SpatialHashGrid2D kGrid(helper::MakeRandomPoints(state.range(0)),
+                                Distance(kRadius));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(kGrid.PairsWithin(kRadius));
+  }
+  helper::SetThroughput(state, state.range(0), kPointBytes);
+}
+BENCHMARK(SpatialHashGrid2DPairsWithin)
+    ->Apply(helper::ApplyDataSizes)
+    ->UseRealTime();
+}  // namespace
@@ -0,0 +1,83 @@
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/closest_pair2d.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "random_points.hpp"
+
+namespace {
+// Large enough to split into several blocks per thread count
+constexpr uint32_t kPointCount = 10000U;
+constexpr uint32_t kSetCount = 1500U;
+// Integer coordinates give exact distances and many ties
+constexpr int kRange = 20000;
+
+using Jeong0806::geometry::test_helper::MakeRandomGridPoints;
+
+// Lowest distance, then lowest first and second index
+auto BruteForce(const std::vector<Jeong0806::geometry::Point2D>& lhs,
+                const std::vector<Jeong0806::geometry::Point2D>& rhs,
+                bool same_set) -> Jeong0806::geometry::NeighborPair {
+  Jeong0806::geometry::NeighborPair best{
+      0U, 0U, std::numeric_limits<double>::infinity()};
+  for (std::size_t i = 0; i < lhs.size(); ++i) {
+    for (auto j = same_set ? i + 1U : 0U; j < rhs.size(); ++j) {
+      const auto kDistance = std::sqrt(
+          Jeong0806::geometry::Point2D::CalculateSquaredDistance(lhs[i],
+                                                                 rhs[j]));
+      if (kDistance < best.distance) {
+        best = Jeong0806::geometry::NeighborPair{i, j, kDistance};
+      }
+    }
+  }
+  return best;
+}
+}  // namespace
+
+namespace Jeong0806::geometry {
+TEST(GeometryClosestPair2D, Degenerate) {
+  const std::vector<Point2D> kOne{Point2D(1.0, 1.0)};
+  EXPECT_THROW(static_cast<void>(ClosestPair2D::Find(kOne)),
+               std::invalid_argument);
+  EXPECT_THROW(static_cast<void>(
+                   ClosestPair2D::FindBetween(kOne, std::vector<Point2D>())),
+               std::invalid_argument);
+
+  const std::vector<Point2D> kTwo{Point2D(0.0, 0.0), Point2D(3.0, 4.0)};
+  EXPECT_EQ(ClosestPair2D::Find(kTwo), (NeighborPair{0U, 1U, 5.0}));
+
+  const std::vector<Point2D> kDuplicates{Point2D(5.0, 5.0), Point2D(1.0, 1.0),
+                                         Point2D(9.0, 9.0), Point2D(1.0, 1.0),
+                                         Point2D(5.0, 5.0)};
+  EXPECT_EQ(ClosestPair2D::Find(kDuplicates), (NeighborPair{0U, 4U, 0.0}));
+}
+
+TEST(GeometryClosestPair2D, Find) {
+  const auto kPoints = MakeRandomGridPoints(kPointCount, kRange);
+  const auto kExpected = BruteForce(kPoints, kPoints, true);
+  for (const std::size_t kThreadCount : {1U, 2U, 3U, 0U}) {
+    EXPECT_EQ(ClosestPair2D::Find(kPoints, kThreadCount), kExpected);
+  }
+}
+
+TEST(GeometryClosestPair2D, FindBetween) {
+  const auto kLhs = MakeRandomGridPoints(kSetCount, kRange);
+  const auto kRhs = MakeRandomGridPoints(kSetCount / 2U, kRange);
+  const auto kExpected = BruteForce(kLhs, kRhs, false);
+  for (const std::size_t kThreadCount : {1U, 2U, 3U, 0U}) {
+    EXPECT_EQ(ClosestPair2D::FindBetween(kLhs, kRhs, kThreadCount),
+              kExpected);
+  }
+
+  const auto kPair = ClosestPair2D::FindBetween(kLhs, kRhs);
+  EXPECT_NEAR(kPair.GetDistance().GetValue(Distance::DistanceType::kMeter),
+              kLhs[kPair.first].CalculateDistance(kRhs[kPair.second]), 1.0e-9);
+}
+}  // namespace Jeong0806::geometry
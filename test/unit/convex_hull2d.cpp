@@ -0,0 +1,114 @@
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/convex_hull2d.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "random_points.hpp"
+
+namespace {
+// Large enough to split into several blocks per thread count
+constexpr uint32_t kPointCount = 40000U;
+constexpr double kRange = 1000.0;
+
+using Jeong0806::geometry::test_helper::MakeRandomPoints;
+
+auto Cross(const Jeong0806::geometry::Point2D& o,
+           const Jeong0806::geometry::Point2D& a,
+           const Jeong0806::geometry::Point2D& b) -> double {
+  return ((a.GetX() - o.GetX()) * (b.GetY() - o.GetY())) -
+         ((a.GetY() - o.GetY()) * (b.GetX() - o.GetX()));
+}
+
+// Every vertex turns left and no point lies to the right of an edge
+auto ExpectConvexHull(const std::vector<Jeong0806::geometry::Point2D>& points,
+                      const std::vector<Jeong0806::geometry::Point2D>& hull)
+    -> void {
+  ASSERT_GE(hull.size(), 3U);
+  for (std::size_t i = 0; i < hull.size(); ++i) {
+    const auto& kFrom = hull[i];
+    const auto& kTo = hull[(i + 1U) % hull.size()];
+    EXPECT_GT(Cross(kFrom, kTo, hull[(i + 2U) % hull.size()]), 0.0);
+    for (const auto& point : points) {
+      ASSERT_GE(Cross(kFrom, kTo, point), 0.0);
+    }
+  }
+}
+}  // namespace
+
+namespace Jeong0806::geometry {
+TEST(GeometryConvexHull2D, Degenerate) {
+  EXPECT_TRUE(ConvexHull2D::ComputeIndices(std::vector<Point2D>()).empty());
+
+  const std::vector<Point2D> kSame{Point2D(1.0, 2.0), Point2D(1.0, 2.0),
+                                   Point2D(1.0, 2.0)};
+  EXPECT_EQ(ConvexHull2D::ComputeIndices(kSame), std::vector<std::size_t>{0U});
+
+  const std::vector<Point2D> kCollinear{Point2D(2.0, 2.0), Point2D(0.0, 0.0),
+                                        Point2D(1.0, 1.0), Point2D(3.0, 3.0),
+                                        Point2D(0.0, 0.0)};
+  EXPECT_EQ(ConvexHull2D::ComputeIndices(kCollinear),
+            (std::vector<std::size_t>{1U, 3U}));
+}
+
+TEST(GeometryConvexHull2D, Square) {
+  auto points = MakeRandomPoints(kPointCount, kRange);
+  points.emplace_back(kRange, kRange);
+  points.emplace_back(0.0, kRange);
+  points.emplace_back(0.0, 0.0);
+  points.emplace_back(kRange, 0.0);
+  // Points on the edges are not vertices
+  points.emplace_back(kRange / 2.0, 0.0);
+  points.emplace_back(0.0, kRange / 2.0);
+
+  const std::vector<std::size_t> kExpected{kPointCount + 2U, kPointCount + 3U,
+                                           kPointCount, kPointCount + 1U};
+  EXPECT_EQ(ConvexHull2D::ComputeIndices(points, 1U), kExpected);
+  EXPECT_EQ(ConvexHull2D::ComputeIndices(points, 4U), kExpected);
+  EXPECT_EQ(ConvexHull2D::Compute(points),
+            (std::vector<Point2D>{Point2D(0.0, 0.0), Point2D(kRange, 0.0),
+                                  Point2D(kRange, kRange),
+                                  Point2D(0.0, kRange)}));
+}
+
+TEST(GeometryConvexHull2D, Random) {
+  const auto kPoints = MakeRandomPoints(kPointCount, kRange);
+  const auto kHull = ConvexHull2D::Compute(kPoints, 1U);
+  ExpectConvexHull(kPoints, kHull);
+
+  // Starts from the lowest point in x then y order
+  const auto kLowest =
+      std::min_element(kPoints.begin(), kPoints.end(),
+                       [](const Point2D& lhs, const Point2D& rhs) {
+                         return (lhs.GetX() < rhs.GetX()) ||
+                                ((lhs.GetX() == rhs.GetX()) &&
+                                 (lhs.GetY() < rhs.GetY()));
+                       });
+  EXPECT_EQ(kHull.front(), *kLowest);
+}
+
+TEST(GeometryConvexHull2D, ThreadCount) {
+  const auto kPoints = MakeRandomPoints(kPointCount, kRange);
+  const auto kExpected = ConvexHull2D::ComputeIndices(kPoints, 1U);
+  for (const std::size_t kThreadCount : {2U, 3U, 8U, 0U}) {
+    EXPECT_EQ(ConvexHull2D::ComputeIndices(kPoints, kThreadCount), kExpected);
+  }
+}
+
+TEST(GeometryConvexHull2D, PointCloud) {
+  const auto kPoints = MakeRandomPoints(kPointCount, kRange);
+  const PointCloud2D kCloud(kPoints);
+  const auto kExpected = ConvexHull2D::ComputeIndices(kPoints);
+  EXPECT_EQ(ConvexHull2D::ComputeIndices(kCloud, 4U), kExpected);
+
+  const auto kHull = ConvexHull2D::Compute(kCloud);
+  ASSERT_EQ(kHull.Size(), kExpected.size());
+  for (std::size_t i = 0; i < kExpected.size(); ++i) {
+    EXPECT_EQ(kHull.GetPoint(i), kPoints[kExpected[i]]);
+  }
+}
+}  // namespace Jeong0806::geometry
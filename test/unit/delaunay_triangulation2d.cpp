@@ -0,0 +1,281 @@
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/delaunay_triangulation2d.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <stdexcept>
+#include <vector>
+
+#include "geometry/convex_hull2d.hpp"
+#include "geometry/predicates2d.hpp"
+#include "gtest/gtest.h"
+#include "random_points.hpp"
+
+namespace {
+constexpr uint32_t kPointCount = 2000U;
+constexpr uint32_t kQueryCount = 500U;
+constexpr uint32_t kGridSize = 30U;
+constexpr double kRange = 1000.0;
+
+using Jeong0806::geometry::DelaunayTriangulation2D;
+using Jeong0806::geometry::Neighbor;
+using Jeong0806::geometry::Point2D;
+using Jeong0806::geometry::Predicates2D;
+using Jeong0806::geometry::test_helper::MakeRandomPoints;
+
+auto BruteForce(const std::vector<Point2D>& points, const Point2D& query)
+    -> Neighbor {
+  Neighbor best{0U, Point2D::CalculateDistance(points[0], query)};
+  for (std::size_t i = 1; i < points.size(); ++i) {
+    best = std::min(best,
+                    Neighbor{i, Point2D::CalculateDistance(points[i], query)});
+  }
+  return best;
+}
+
+auto Next(uint32_t edge) -> uint32_t {
+  return (edge % 3U == 2U) ? edge - 2U : edge + 1U;
+}
+
+// Counter-clockwise triangles, consistent opposites and no site inside the
+// circle across any edge, which makes the triangulation Delaunay
+auto ExpectDelaunay(const DelaunayTriangulation2D& triangulation) -> void {
+  const auto& kTriangles = triangulation.GetTriangles();
+  const auto& kHalfedges = triangulation.GetHalfedges();
+  ASSERT_EQ(kTriangles.size(), 3U * triangulation.GetTriangleCount());
+  ASSERT_EQ(kHalfedges.size(), kTriangles.size());
+  const auto kSite = [&](uint32_t edge) {
+    return triangulation.GetSite(kTriangles[edge]);
+  };
+  for (uint32_t edge = 0; edge < kTriangles.size(); edge += 3U) {
+    EXPECT_GT(Predicates2D::Orient2D(kSite(edge), kSite(edge + 1U),
+                                     kSite(edge + 2U)),
+              0.0);
+  }
+  std::size_t hull_edges = 0;
+  for (uint32_t edge = 0; edge < kTriangles.size(); ++edge) {
+    const auto kOpposite = kHalfedges[edge];
+    if (kOpposite == DelaunayTriangulation2D::kInvalid) {
+      ++hull_edges;
+      continue;
+    }
+    ASSERT_EQ(kHalfedges[kOpposite], edge);
+    EXPECT_EQ(kTriangles[kOpposite], kTriangles[Next(edge)]);
+    EXPECT_EQ(kTriangles[Next(kOpposite)], kTriangles[edge]);
+    const auto kFirst = edge - (edge % 3U);
+    EXPECT_LE(Predicates2D::InCircle(kSite(kFirst), kSite(kFirst + 1U),
+                                     kSite(kFirst + 2U),
+                                     kSite(Next(Next(kOpposite)))),
+              0.0);
+  }
+  EXPECT_EQ(hull_edges, triangulation.GetHull().size());
+}
+
+auto CalculateArea(const std::vector<Point2D>& polygon) -> double {
+  double area = 0.0;
+  for (std::size_t i = 0; i < polygon.size(); ++i) {
+    const auto& kNext = polygon[(i + 1U) % polygon.size()];
+    area += (polygon[i].GetX() * kNext.GetY()) -
+            (kNext.GetX() * polygon[i].GetY());
+  }
+  return 0.5 * area;
+}
+}  // namespace
+
+namespace Jeong0806::geometry {
+TEST(GeometryDelaunayTriangulation2D, Empty) {
+  const DelaunayTriangulation2D kEmpty;
+  EXPECT_TRUE(kEmpty.Empty());
+  EXPECT_EQ(kEmpty.GetTriangleCount(), 0U);
+  EXPECT_THROW(static_cast<void>(kEmpty.Nearest(Point2D())),
+               std::out_of_range);
+  EXPECT_TRUE(kEmpty.Nearest(std::vector<Point2D>()).empty());
+
+  const DelaunayTriangulation2D kSingle(std::vector<Point2D>{Point2D(1, 2)});
+  EXPECT_EQ(kSingle.Size(), 1U);
+  EXPECT_EQ(kSingle.GetTriangleCount(), 0U);
+  EXPECT_EQ(kSingle.Nearest(Point2D(4, 6)), Neighbor({0U, 5.0}));
+  EXPECT_EQ(kSingle.ComputeVoronoiCell(0U, Point2D(0, 0), Point2D(2, 3))
+                .size(),
+            4U);
+  EXPECT_THROW(static_cast<void>(kSingle.GetNeighbors(1U)), std::out_of_range);
+  EXPECT_THROW(static_cast<void>(kSingle.Nearest(Point2D(), 1U)),
+               std::out_of_range);
+  EXPECT_THROW(static_cast<void>(kSingle.ComputeVoronoiCell(
+                   0U, Point2D(1, 1), Point2D(0, 2))),
+               std::invalid_argument);
+  EXPECT_THROW(DelaunayTriangulation2D(std::vector<Point2D>{
+                   Point2D(0, 0), Point2D(std::nan(""), 1)}),
+               std::invalid_argument);
+}
+
+TEST(GeometryDelaunayTriangulation2D, Square) {
+  const std::vector<Point2D> kPoints = {Point2D(0, 0), Point2D(2, 0),
+                                        Point2D(2, 2), Point2D(0, 2),
+                                        Point2D(1, 1)};
+  const DelaunayTriangulation2D kTriangulation(kPoints);
+  ExpectDelaunay(kTriangulation);
+  EXPECT_EQ(kTriangulation.GetTriangleCount(), 4U);
+  EXPECT_EQ(kTriangulation.GetNeighborCount(4U), 4U);
+  EXPECT_EQ(kTriangulation.GetNeighborCount(0U), 3U);
+
+  // The hull is counter-clockwise from any of its sites
+  std::vector<uint32_t> hull(kTriangulation.GetHull().begin(),
+                             kTriangulation.GetHull().end());
+  ASSERT_EQ(hull.size(), 4U);
+  std::rotate(hull.begin(), std::find(hull.begin(), hull.end(), 0U),
+              hull.end());
+  EXPECT_EQ(hull, std::vector<uint32_t>({0U, 1U, 2U, 3U}));
+
+  // The cell of the center is the diamond between the corners
+  const auto kCell =
+      kTriangulation.ComputeVoronoiCell(4U, Point2D(-1, -1), Point2D(3, 3));
+  EXPECT_EQ(kCell.size(), 4U);
+  EXPECT_DOUBLE_EQ(CalculateArea(kCell), 2.0);
+}
+
+TEST(GeometryDelaunayTriangulation2D, Random) {
+  const auto kPoints = MakeRandomPoints(kPointCount, kRange);
+  const DelaunayTriangulation2D kTriangulation(kPoints);
+  ExpectDelaunay(kTriangulation);
+  const auto kHullSize = kTriangulation.GetHull().size();
+  EXPECT_EQ(kTriangulation.GetTriangleCount(),
+            (2U * kPointCount) - 2U - kHullSize);
+
+  auto hull = ConvexHull2D::ComputeIndices(kPoints);
+  auto triangulation_hull = std::vector<std::size_t>(
+      kTriangulation.GetHull().begin(), kTriangulation.GetHull().end());
+  std::sort(hull.begin(), hull.end());
+  std::sort(triangulation_hull.begin(), triangulation_hull.end());
+  EXPECT_EQ(triangulation_hull, hull);
+
+  // Neighbors are symmetric and match the half-edges
+  std::size_t neighbor_count = 0;
+  for (uint32_t site = 0; site < kPointCount; ++site) {
+    const auto kNeighbors = kTriangulation.GetNeighbors(site);
+    EXPECT_EQ(kNeighbors.size(), kTriangulation.GetNeighborCount(site));
+    for (const auto kNeighbor : kNeighbors) {
+      const auto kBack = kTriangulation.GetNeighbors(kNeighbor);
+      EXPECT_NE(std::find(kBack.begin(), kBack.end(), site), kBack.end());
+    }
+    neighbor_count += kTriangulation.GetNeighborCount(site);
+  }
+  EXPECT_EQ(neighbor_count,
+            kTriangulation.GetTriangles().size() + kHullSize);
+
+  // The build order does not depend on the threads sorting the sites
+  const DelaunayTriangulation2D kSingleThread(kPoints, 1U);
+  EXPECT_EQ(kSingleThread.GetTriangles(), kTriangulation.GetTriangles());
+  EXPECT_EQ(kSingleThread.GetHalfedges(), kTriangulation.GetHalfedges());
+}
+
+TEST(GeometryDelaunayTriangulation2D, Grid) {
+  // Cocircular and collinear everywhere, with every site twice
+  std::vector<Point2D> points;
+  for (uint32_t i = 0; i < 2U * kGridSize * kGridSize; ++i) {
+    const auto kCell = i % (kGridSize * kGridSize);
+    points.emplace_back(kCell % kGridSize, kCell / kGridSize);
+  }
+  const DelaunayTriangulation2D kTriangulation(points);
+  ExpectDelaunay(kTriangulation);
+  EXPECT_EQ(kTriangulation.GetTriangleCount(),
+            2U * (kGridSize - 1U) * (kGridSize - 1U));
+  EXPECT_EQ(kTriangulation.GetHull().size(), 4U * (kGridSize - 1U));
+  for (uint32_t i = 0; i < kGridSize * kGridSize; ++i) {
+    EXPECT_EQ(kTriangulation.GetVertex(i), i);
+    EXPECT_EQ(kTriangulation.GetVertex(i + (kGridSize * kGridSize)), i);
+    EXPECT_EQ(kTriangulation.GetNeighborCount(i + (kGridSize * kGridSize)),
+              0U);
+    EXPECT_TRUE(kTriangulation
+                    .ComputeVoronoiCell(i + (kGridSize * kGridSize),
+                                        Point2D(0, 0), Point2D(1, 1))
+                    .empty());
+  }
+
+  // A query at the center of a cell ties with four sites
+  const Point2D kQuery(3.5, 7.5);
+  EXPECT_EQ(kTriangulation.Nearest(kQuery, 899U).index, 213U);
+  EXPECT_EQ(kTriangulation.Nearest(kQuery, 0U).index, 213U);
+  EXPECT_EQ(kTriangulation.Nearest(Point2D(3.0, 7.5), 1799U).index, 213U);
+}
+
+TEST(GeometryDelaunayTriangulation2D, Collinear) {
+  std::vector<Point2D> points;
+  for (uint32_t i = 0; i < kPointCount; ++i) {
+    const auto kT = static_cast<double>(std::rand() % 1000);
+    points.emplace_back(2.0 * kT, 1.0 - kT);
+  }
+  const DelaunayTriangulation2D kTriangulation(points);
+  EXPECT_EQ(kTriangulation.GetTriangleCount(), 0U);
+  EXPECT_TRUE(kTriangulation.GetHull().empty());
+  for (uint32_t i = 0; i < kQueryCount; ++i) {
+    const Point2D kQuery(kRange * std::rand() / RAND_MAX,
+                         -kRange * std::rand() / RAND_MAX);
+    EXPECT_EQ(kTriangulation.Nearest(kQuery, std::rand() % kPointCount),
+              BruteForce(points, kQuery));
+  }
+}
+
+TEST(GeometryDelaunayTriangulation2D, Nearest) {
+  const auto kPoints = MakeRandomPoints(kPointCount, kRange);
+  const DelaunayTriangulation2D kTriangulation(kPoints);
+  std::vector<Point2D> queries;
+  for (uint32_t i = 0; i < kQueryCount; ++i) {
+    // Including queries far outside the hull
+    queries.emplace_back((3.0 * kRange * std::rand() / RAND_MAX) - kRange,
+                         (3.0 * kRange * std::rand() / RAND_MAX) - kRange);
+    const auto kExpected = BruteForce(kPoints, queries.back());
+    EXPECT_EQ(kTriangulation.Nearest(queries.back()), kExpected);
+    EXPECT_EQ(kTriangulation.Nearest(queries.back(), kExpected.index),
+              kExpected);
+    EXPECT_EQ(
+        kTriangulation.Nearest(queries.back(), std::rand() % kPointCount),
+        kExpected);
+  }
+  for (const std::size_t kThreads : {1U, 4U}) {
+    const auto kResults = kTriangulation.Nearest(queries, kThreads);
+    ASSERT_EQ(kResults.size(), queries.size());
+    for (std::size_t i = 0; i < queries.size(); ++i) {
+      EXPECT_EQ(kResults[i], BruteForce(kPoints, queries[i]));
+    }
+  }
+}
+
+TEST(GeometryDelaunayTriangulation2D, VoronoiCells) {
+  const auto kPoints = MakeRandomPoints(kPointCount, kRange);
+  const DelaunayTriangulation2D kTriangulation(kPoints);
+  const Point2D kMin(-10.0, -10.0);
+  const Point2D kMax(kRange + 10.0, kRange + 10.0);
+  for (const std::size_t kThreads : {1U, 4U}) {
+    const auto kCells = kTriangulation.ComputeVoronoiCells(kMin, kMax,
+                                                           kThreads);
+    ASSERT_EQ(kCells.size(), kPointCount);
+    // The cells tile the box
+    double area = 0.0;
+    for (const auto& kCell : kCells) {
+      EXPECT_GE(kCell.size(), 3U);
+      EXPECT_GT(CalculateArea(kCell), 0.0);
+      area += CalculateArea(kCell);
+    }
+    EXPECT_NEAR(area, (kRange + 20.0) * (kRange + 20.0), 1.0e-6);
+    EXPECT_EQ(kCells[7], kTriangulation.ComputeVoronoiCell(7U, kMin, kMax));
+  }
+
+  // A point lies in the cell of its nearest site
+  for (uint32_t i = 0; i < kQueryCount; ++i) {
+    const Point2D kQuery(kRange * std::rand() / RAND_MAX,
+                         kRange * std::rand() / RAND_MAX);
+    const auto kCell = kTriangulation.ComputeVoronoiCell(
+        kTriangulation.Nearest(kQuery).index, kMin, kMax);
+    for (std::size_t j = 0; j < kCell.size(); ++j) {
+      EXPECT_GE(Predicates2D::Orient2D(kCell[j],
+                                       kCell[(j + 1U) % kCell.size()], kQuery),
+                -1.0e-9);
+    }
+  }
+}
+}  // namespace Jeong0806::geometry
@@ -3,7 +3,12 @@
 
 #include "geometry/distance.hpp"
 
+#include <cmath>
 #include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
 
 #include "gtest/gtest.h"
 
@@ -36,6 +41,26 @@ TEST(GeometryDistance, ConstructorWithValue) {
   }
 }
 
+TEST(GeometryDistance, ValueType) {
+  static_assert(std::is_trivially_copyable_v<Distance>);
+  static_assert(std::is_standard_layout_v<Distance>);
+  static_assert(sizeof(Distance) == sizeof(int64_t));
+
+  constexpr Distance kKilometer(1.0, Distance::DistanceType::kKilometer);
+  constexpr Distance kMeter(1000.0, Distance::DistanceType::kMeter);
+  static_assert(kKilometer == kMeter);
+  static_assert(kKilometer.GetValue(Distance::DistanceType::kNanometer) ==
+                1.0e+12);
+  static_assert(kKilometer + kMeter > kMeter);
+  static_assert(kKilometer * 2.0 == Distance(2.0e+3));
+
+  Distance distances[2] = {kKilometer, Distance(5.0)};
+  Distance copied[2];
+  std::memcpy(copied, distances, sizeof(distances));
+  EXPECT_EQ(copied[0], distances[0]);
+  EXPECT_EQ(copied[1], distances[1]);
+}
+
 TEST(GeometryDistance, AssignmentOperator) {
   Distance distance1;
   auto distance2 = distance1;
@@ -72,6 +97,116 @@ TEST(GeometryDistance, GetValue) {
   }
 }
 
+TEST(GeometryDistance, CompileTimeUnit) {
+  static_assert(Distance::GetNanometerScale(
+                    Distance::DistanceType::kKilometer) == 1000000000000);
+  static_assert(Distance::GetNanometerScale(
+                    Distance::DistanceType::kNanometer) == 1);
+  static_assert(Distance::FromValue<Distance::DistanceType::kKilometer>(1.5) ==
+                Distance(1500.0));
+  static_assert(
+      Distance(2.5).GetValue<Distance::DistanceType::kMillimeter>() == 2500.0);
+
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const auto kValue = static_cast<double>(std::rand()) / 7.0;
+    const Distance kDistance(kValue, Distance::DistanceType::kCentimeter);
+
+    EXPECT_EQ(Distance::FromValue<Distance::DistanceType::kCentimeter>(kValue),
+              kDistance);
+    EXPECT_EQ(Distance::FromValue<Distance::DistanceType::kNanometer>(kValue),
+              Distance(kValue, Distance::DistanceType::kNanometer));
+    EXPECT_EQ(kDistance.GetValue<Distance::DistanceType::kKilometer>(),
+              kDistance.GetValue(Distance::DistanceType::kKilometer));
+    EXPECT_EQ(kDistance.GetValue<Distance::DistanceType::kNanometer>(),
+              kDistance.GetValue(Distance::DistanceType::kNanometer));
+  }
+}
+
+TEST(GeometryDistance, IntegerArithmetic) {
+  static_assert(Distance::FromNanometer(7).GetNanometer() == 7);
+  static_assert((Distance::FromNanometer(3) + Distance::FromNanometer(4)) ==
+                Distance::FromNanometer(7));
+  static_assert(Distance::FromNanometer(-9)
+                    .Divide<Distance::OverflowPolicy::kChecked>(2)
+                    .GetNanometer() == -4);
+
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const auto kLhs = static_cast<int64_t>(std::rand());
+    const auto kRhs = static_cast<int64_t>(std::rand()) - (RAND_MAX / 2);
+    const auto kDistance = Distance::FromNanometer(kLhs);
+
+    EXPECT_EQ((kDistance + Distance::FromNanometer(kRhs)).GetNanometer(),
+              kLhs + kRhs);
+    EXPECT_EQ((kDistance - Distance::FromNanometer(kRhs)).GetNanometer(),
+              kLhs - kRhs);
+    EXPECT_EQ(kDistance.Multiply(kRhs, Distance::OverflowPolicy::kChecked)
+                  .GetNanometer(),
+              kLhs * kRhs);
+    if (kRhs != 0) {
+      EXPECT_EQ(kDistance.Divide(kRhs, Distance::OverflowPolicy::kWrapping)
+                    .GetNanometer(),
+                kLhs / kRhs);
+    }
+  }
+}
+
+TEST(GeometryDistance, OverflowPolicy) {
+  constexpr auto kMax = std::numeric_limits<int64_t>::max();
+  constexpr auto kMin = std::numeric_limits<int64_t>::min();
+  const auto kLargest = Distance::FromNanometer(kMax);
+  const auto kSmallest = Distance::FromNanometer(kMin);
+  const auto kOne = Distance::FromNanometer(1);
+
+  EXPECT_THROW(static_cast<void>(kLargest + kOne), std::overflow_error);
+  EXPECT_THROW(static_cast<void>(kSmallest - kOne), std::overflow_error);
+  EXPECT_THROW(static_cast<void>(
+                   kLargest.Multiply<Distance::OverflowPolicy::kChecked>(2)),
+               std::overflow_error);
+  EXPECT_THROW(static_cast<void>(
+                   kSmallest.Divide<Distance::OverflowPolicy::kChecked>(-1)),
+               std::overflow_error);
+  EXPECT_THROW(static_cast<void>(
+                   kOne.Divide<Distance::OverflowPolicy::kWrapping>(0)),
+               std::invalid_argument);
+  EXPECT_THROW(static_cast<void>(kLargest * 2.0), std::overflow_error);
+  EXPECT_THROW(static_cast<void>(kSmallest / 0.5), std::overflow_error);
+  EXPECT_THROW(static_cast<void>(kOne * std::nan("")), std::overflow_error);
+  EXPECT_THROW(static_cast<void>(kOne / 0.0), std::invalid_argument);
+  auto scaled = kOne;
+  EXPECT_THROW(scaled *= std::numeric_limits<double>::infinity(),
+               std::overflow_error);
+  EXPECT_EQ(scaled, kOne);
+
+  EXPECT_EQ(kLargest.Add(kOne, Distance::OverflowPolicy::kSaturating),
+            kLargest);
+  EXPECT_EQ(kSmallest.Subtract(kOne, Distance::OverflowPolicy::kSaturating),
+            kSmallest);
+  EXPECT_EQ(kLargest.Multiply(-3, Distance::OverflowPolicy::kSaturating),
+            kSmallest);
+  EXPECT_EQ(kSmallest.Multiply(-1, Distance::OverflowPolicy::kSaturating),
+            kLargest);
+  EXPECT_EQ(kSmallest.Divide(-1, Distance::OverflowPolicy::kSaturating),
+            kLargest);
+
+  EXPECT_EQ(kLargest.Add(kOne, Distance::OverflowPolicy::kWrapping), kSmallest);
+  EXPECT_EQ(kSmallest.Subtract(kOne, Distance::OverflowPolicy::kWrapping),
+            kLargest);
+  EXPECT_EQ(kSmallest.Multiply(-1, Distance::OverflowPolicy::kWrapping),
+            kSmallest);
+
+  // Edge values that do not overflow
+  EXPECT_EQ(kSmallest.Multiply<Distance::OverflowPolicy::kChecked>(1),
+            kSmallest);
+  EXPECT_EQ(Distance::FromNanometer(kMin / 2)
+                .Multiply<Distance::OverflowPolicy::kChecked>(2),
+            kSmallest);
+  EXPECT_EQ(Distance::FromNanometer(-kMax)
+                .Subtract<Distance::OverflowPolicy::kChecked>(kOne),
+            kSmallest);
+  EXPECT_EQ(kSmallest * 1.0, kSmallest);
+  EXPECT_EQ(Distance::FromNanometer(-7) / 2.0, Distance::FromNanometer(-3));
+}
+
 TEST(GeometryDistance, SetValue) {
   for (uint32_t i; i < kTestCount; ++i) {
     const auto kValue = static_cast<double>(std::rand());
@@ -0,0 +1,105 @@
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/distance_accumulator.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 1000U;
+}
+
+namespace Jeong0806::geometry {
+TEST(GeometryDistanceAccumulator, Add) {
+  constexpr auto kSum = [] {
+    DistanceAccumulator accumulator;
+    accumulator += Distance::FromNanometer(5);
+    accumulator += Distance::FromNanometer(-8);
+    return accumulator.ToDistance();
+  }();
+  static_assert(kSum == Distance::FromNanometer(-3));
+
+  DistanceAccumulator accumulator;
+  int64_t expected{0};
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const auto kNanometer = static_cast<int64_t>(std::rand()) - (RAND_MAX / 2);
+    accumulator.Add(Distance::FromNanometer(kNanometer));
+    expected += kNanometer;
+  }
+  EXPECT_TRUE(accumulator.IsRepresentable());
+  EXPECT_EQ(accumulator.ToDistance().GetNanometer(), expected);
+  EXPECT_DOUBLE_EQ(accumulator.GetValue(Distance::DistanceType::kMeter),
+                   Distance::FromNanometer(expected).GetValue(
+                       Distance::DistanceType::kMeter));
+
+  accumulator.Reset();
+  EXPECT_EQ(accumulator, DistanceAccumulator());
+}
+
+TEST(GeometryDistanceAccumulator, BatchAdd) {
+  std::vector<Distance> distances(kTestCount);
+  DistanceAccumulator expected;
+  for (auto& distance : distances) {
+    // Spread the values over the whole int64 range
+    const auto kNanometer =
+        static_cast<int64_t>((static_cast<uint64_t>(std::rand()) << 33U) ^
+                             (static_cast<uint64_t>(std::rand()) << 2U) ^
+                             static_cast<uint64_t>(std::rand()));
+    distance = Distance::FromNanometer(kNanometer);
+    expected += distance;
+  }
+
+  DistanceAccumulator accumulator;
+  accumulator.Add(distances);
+  EXPECT_EQ(accumulator, expected);
+
+  DistanceAccumulator merged;
+  DistanceAccumulator first;
+  DistanceAccumulator second;
+  first.Add(distances.data(), kTestCount / 2U);
+  second.Add(distances.data() + (kTestCount / 2U), kTestCount / 2U);
+  merged += first;
+  merged += second;
+  EXPECT_EQ(merged, expected);
+}
+
+TEST(GeometryDistanceAccumulator, Overflow) {
+  constexpr auto kMax = std::numeric_limits<int64_t>::max();
+  constexpr auto kMin = std::numeric_limits<int64_t>::min();
+
+  DistanceAccumulator accumulator;
+  accumulator += Distance::FromNanometer(kMax);
+  accumulator += Distance::FromNanometer(kMax);
+  EXPECT_FALSE(accumulator.IsRepresentable());
+  EXPECT_EQ(accumulator.GetHigh(), 0);
+  EXPECT_EQ(accumulator.GetLow(), static_cast<uint64_t>(kMax) * 2U);
+  EXPECT_THROW(static_cast<void>(accumulator.ToDistance()),
+               std::overflow_error);
+  EXPECT_EQ(accumulator.ToDistance(Distance::OverflowPolicy::kSaturating),
+            Distance::FromNanometer(kMax));
+  EXPECT_EQ(accumulator.ToDistance(Distance::OverflowPolicy::kWrapping),
+            Distance::FromNanometer(-2));
+  EXPECT_DOUBLE_EQ(accumulator.GetValue(Distance::DistanceType::kNanometer),
+                   static_cast<double>(kMax) * 2.0);
+
+  // The intermediate sum overflows int64 but the total is exact
+  accumulator += Distance::FromNanometer(kMin);
+  accumulator += Distance::FromNanometer(kMin);
+  accumulator += Distance::FromNanometer(3);
+  EXPECT_TRUE(accumulator.IsRepresentable());
+  EXPECT_EQ(accumulator.ToDistance(), Distance::FromNanometer(1));
+
+  DistanceAccumulator negative;
+  negative += Distance::FromNanometer(kMin);
+  negative += Distance::FromNanometer(-1);
+  EXPECT_FALSE(negative.IsRepresentable());
+  EXPECT_EQ(negative.ToDistance(Distance::OverflowPolicy::kSaturating),
+            Distance::FromNanometer(kMin));
+}
+}  // namespace Jeong0806::geometry
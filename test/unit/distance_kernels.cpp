@@ -0,0 +1,408 @@
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/distance_kernels.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "geometry/point2d.hpp"
+#include "geometry/point2i.hpp"
+#include "geometry/simd.hpp"
+#include "gtest/gtest.h"
+
+namespace {
+// Not a multiple of any lane width so every kernel runs its tail path
+constexpr uint32_t kTestCount = 1003U;
+
+constexpr Jeong0806::geometry::SimdLevel kAllLevels[] = {
+    Jeong0806::geometry::SimdLevel::kScalar,
+    Jeong0806::geometry::SimdLevel::kNeon,
+    Jeong0806::geometry::SimdLevel::kAvx2,
+    Jeong0806::geometry::SimdLevel::kAvx512};
+
+auto MakeRandomValues(uint32_t count) -> std::vector<double> {
+  std::vector<double> values(count);
+  for (auto& value : values) {
+    value = static_cast<double>(std::rand()) - (RAND_MAX / 2);
+  }
+  return values;
+}
+}  // namespace
+
+namespace Jeong0806::geometry {
+TEST(GeometryDistanceKernels, SimdLevel) {
+  const auto kDetected = DetectSimdLevel();
+
+  EXPECT_TRUE(IsSimdLevelSupported(SimdLevel::kScalar));
+  EXPECT_TRUE(IsSimdLevelSupported(kDetected));
+  EXPECT_EQ(SetSimdLevel(SimdLevel::kScalar), SimdLevel::kScalar);
+  EXPECT_EQ(GetSimdLevel(), SimdLevel::kScalar);
+  for (const auto kLevel : kAllLevels) {
+    if (!IsSimdLevelSupported(kLevel)) {
+      EXPECT_THROW(SetSimdLevel(kLevel), std::invalid_argument);
+    }
+  }
+  SetSimdLevel(kDetected);
+}
+
+TEST(GeometryDistanceKernels, CalculateDistances) {
+  const auto kXs = MakeRandomValues(kTestCount);
+  const auto kYs = MakeRandomValues(kTestCount);
+  const auto kOriginX = static_cast<double>(std::rand());
+  const auto kOriginY = static_cast<double>(std::rand());
+  const auto kDetected = DetectSimdLevel();
+
+  std::vector<double> expected(kTestCount);
+  std::vector<double> expected_squared(kTestCount);
+  SetSimdLevel(SimdLevel::kScalar);
+  kernel::CalculateDistances(kXs.data(), kYs.data(), kTestCount, kOriginX,
+                             kOriginY, expected.data());
+  kernel::CalculateSquaredDistances(kXs.data(), kYs.data(), kTestCount,
+                                    kOriginX, kOriginY,
+                                    expected_squared.data());
+
+  for (const auto kLevel : kAllLevels) {
+    if (!IsSimdLevelSupported(kLevel)) {
+      continue;
+    }
+    SetSimdLevel(kLevel);
+    std::vector<double> distances(kTestCount);
+    std::vector<double> squared_distances(kTestCount);
+    kernel::CalculateDistances(kXs.data(), kYs.data(), kTestCount, kOriginX,
+                               kOriginY, distances.data());
+    kernel::CalculateSquaredDistances(kXs.data(), kYs.data(), kTestCount,
+                                      kOriginX, kOriginY,
+                                      squared_distances.data());
+    EXPECT_EQ(distances, expected);
+    EXPECT_EQ(squared_distances, expected_squared);
+  }
+  SetSimdLevel(kDetected);
+}
+
+TEST(GeometryDistanceKernels, CalculatePairwiseDistances) {
+  const auto kLhsXs = MakeRandomValues(kTestCount);
+  const auto kLhsYs = MakeRandomValues(kTestCount);
+  const auto kRhsXs = MakeRandomValues(kTestCount);
+  const auto kRhsYs = MakeRandomValues(kTestCount);
+  const auto kDetected = DetectSimdLevel();
+
+  std::vector<double> expected(kTestCount);
+  std::vector<double> expected_squared(kTestCount);
+  SetSimdLevel(SimdLevel::kScalar);
+  kernel::CalculatePairwiseDistances(kLhsXs.data(), kLhsYs.data(),
+                                     kRhsXs.data(), kRhsYs.data(), kTestCount,
+                                     expected.data());
+  kernel::CalculatePairwiseSquaredDistances(
+      kLhsXs.data(), kLhsYs.data(), kRhsXs.data(), kRhsYs.data(), kTestCount,
+      expected_squared.data());
+
+  for (const auto kLevel : kAllLevels) {
+    if (!IsSimdLevelSupported(kLevel)) {
+      continue;
+    }
+    SetSimdLevel(kLevel);
+    std::vector<double> distances(kTestCount);
+    std::vector<double> squared_distances(kTestCount);
+    kernel::CalculatePairwiseDistances(kLhsXs.data(), kLhsYs.data(),
+                                       kRhsXs.data(), kRhsYs.data(),
+                                       kTestCount, distances.data());
+    kernel::CalculatePairwiseSquaredDistances(
+        kLhsXs.data(), kLhsYs.data(), kRhsXs.data(), kRhsYs.data(), kTestCount,
+        squared_distances.data());
+    EXPECT_EQ(distances, expected);
+    EXPECT_EQ(squared_distances, expected_squared);
+  }
+  SetSimdLevel(kDetected);
+}
+
+TEST(GeometryDistanceKernels, IsWithin) {
+  const auto kXs = MakeRandomValues(kTestCount);
+  const auto kYs = MakeRandomValues(kTestCount);
+  const auto kRadius = static_cast<double>(RAND_MAX / 2);
+  const auto kDetected = DetectSimdLevel();
+
+  std::vector<uint8_t> expected(kTestCount);
+  std::size_t expected_count = 0;
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    expected[i] = std::hypot(kXs[i], kYs[i]) <= kRadius ? 1U : 0U;
+    expected_count += expected[i];
+  }
+
+  for (const auto kLevel : kAllLevels) {
+    if (!IsSimdLevelSupported(kLevel)) {
+      continue;
+    }
+    SetSimdLevel(kLevel);
+    std::vector<uint8_t> flags(kTestCount);
+    EXPECT_EQ(kernel::IsWithin(kXs.data(), kYs.data(), kTestCount, 0.0, 0.0,
+                               kRadius, flags.data()),
+              expected_count);
+    EXPECT_EQ(flags, expected);
+    EXPECT_EQ(kernel::IsWithin(kXs.data(), kYs.data(), kTestCount, 0.0, 0.0,
+                               -kRadius, flags.data()),
+              0U);
+    EXPECT_EQ(flags, std::vector<uint8_t>(kTestCount, 0U));
+  }
+  SetSimdLevel(kDetected);
+}
+
+TEST(GeometryDistanceKernels, CompareDistances) {
+  const auto kLhsXs = MakeRandomValues(kTestCount);
+  const auto kLhsYs = MakeRandomValues(kTestCount);
+  auto rhs_xs = MakeRandomValues(kTestCount);
+  auto rhs_ys = MakeRandomValues(kTestCount);
+  // Mirrored points tie with their lhs counterparts
+  for (uint32_t i = 0; i < kTestCount; i += 7U) {
+    rhs_xs[i] = -kLhsXs[i];
+    rhs_ys[i] = kLhsYs[i];
+  }
+  const auto kDetected = DetectSimdLevel();
+
+  std::vector<int8_t> expected(kTestCount);
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const auto kLhs = std::hypot(kLhsXs[i], kLhsYs[i]);
+    const auto kRhs = std::hypot(rhs_xs[i], rhs_ys[i]);
+    expected[i] = static_cast<int8_t>((kLhs > kRhs) - (kLhs < kRhs));
+  }
+
+  for (const auto kLevel : kAllLevels) {
+    if (!IsSimdLevelSupported(kLevel)) {
+      continue;
+    }
+    SetSimdLevel(kLevel);
+    std::vector<int8_t> results(kTestCount);
+    kernel::CompareDistances(kLhsXs.data(), kLhsYs.data(), rhs_xs.data(),
+                             rhs_ys.data(), kTestCount, 0.0, 0.0,
+                             results.data());
+    EXPECT_EQ(results, expected);
+  }
+  SetSimdLevel(kDetected);
+}
+
+TEST(GeometryDistanceKernels, FloatKernels) {
+  const auto kXs = MakeRandomValues(kTestCount);
+  const auto kYs = MakeRandomValues(kTestCount);
+  const std::vector<float> kFloatXs(kXs.begin(), kXs.end());
+  const std::vector<float> kFloatYs(kYs.begin(), kYs.end());
+  const std::vector<float> kRhsXs(kFloatYs.rbegin(), kFloatYs.rend());
+  const std::vector<float> kRhsYs(kFloatXs.rbegin(), kFloatXs.rend());
+  const auto kOrigin = Point2F(static_cast<float>(std::rand()),
+                               static_cast<float>(std::rand()));
+  const auto kRadius = static_cast<float>(RAND_MAX / 2);
+  const auto kDetected = DetectSimdLevel();
+
+  std::vector<double> wide(kTestCount);
+  kernel::CalculateDistances(kXs.data(), kYs.data(), kTestCount,
+                             kOrigin.GetX(), kOrigin.GetY(), wide.data());
+
+  for (const auto kLevel : kAllLevels) {
+    if (!IsSimdLevelSupported(kLevel)) {
+      continue;
+    }
+    SetSimdLevel(kLevel);
+    std::vector<float> distances(kTestCount);
+    std::vector<float> squared_distances(kTestCount);
+    std::vector<float> pairwise(kTestCount);
+    std::vector<float> pairwise_squared(kTestCount);
+    std::vector<uint8_t> flags(kTestCount);
+    std::vector<int8_t> results(kTestCount);
+    kernel::CalculateDistances(kFloatXs.data(), kFloatYs.data(), kTestCount,
+                               kOrigin.GetX(), kOrigin.GetY(),
+                               distances.data());
+    kernel::CalculateSquaredDistances(kFloatXs.data(), kFloatYs.data(),
+                                      kTestCount, kOrigin.GetX(),
+                                      kOrigin.GetY(),
+                                      squared_distances.data());
+    kernel::CalculatePairwiseDistances(kFloatXs.data(), kFloatYs.data(),
+                                       kRhsXs.data(), kRhsYs.data(),
+                                       kTestCount, pairwise.data());
+    kernel::CalculatePairwiseSquaredDistances(
+        kFloatXs.data(), kFloatYs.data(), kRhsXs.data(), kRhsYs.data(),
+        kTestCount, pairwise_squared.data());
+    std::size_t expected_count = 0;
+    for (uint32_t i = 0; i < kTestCount; ++i) {
+      expected_count += Point2F(kFloatXs[i], kFloatYs[i])
+                            .IsWithin(kOrigin, kRadius);
+    }
+    EXPECT_EQ(kernel::IsWithin(kFloatXs.data(), kFloatYs.data(), kTestCount,
+                               kOrigin.GetX(), kOrigin.GetY(), kRadius,
+                               flags.data()),
+              expected_count);
+    kernel::CompareDistances(kFloatXs.data(), kFloatYs.data(), kRhsXs.data(),
+                             kRhsYs.data(), kTestCount, kOrigin.GetX(),
+                             kOrigin.GetY(), results.data());
+
+    // Every level rounds the same float steps as Point2F
+    for (uint32_t i = 0; i < kTestCount; ++i) {
+      const Point2F kPoint(kFloatXs[i], kFloatYs[i]);
+      const Point2F kRhs(kRhsXs[i], kRhsYs[i]);
+      EXPECT_EQ(distances[i], kPoint.CalculateDistance(kOrigin));
+      EXPECT_EQ(squared_distances[i], kPoint.CalculateSquaredDistance(kOrigin));
+      EXPECT_EQ(pairwise[i], kPoint.CalculateDistance(kRhs));
+      EXPECT_EQ(pairwise_squared[i], kPoint.CalculateSquaredDistance(kRhs));
+      EXPECT_EQ(flags[i], kPoint.IsWithin(kOrigin, kRadius) ? 1U : 0U);
+      EXPECT_EQ(results[i], Point2F::CompareDistance(kPoint, kRhs, kOrigin));
+      EXPECT_NEAR(distances[i], wide[i], wide[i] * 1e-6);
+    }
+  }
+  SetSimdLevel(kDetected);
+}
+
+TEST(GeometryDistanceKernels, IntegerKernels) {
+  // Extreme coordinates give differences of 2^31 - 2 and sums near 2^63
+  constexpr int32_t kLimit32 = Point2I32::kLimit;
+  std::mt19937_64 engine(kTestCount);
+  std::uniform_int_distribution<int32_t> coordinate32(-kLimit32, kLimit32);
+  std::vector<int32_t> xs32(kTestCount);
+  std::vector<int32_t> ys32(kTestCount);
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    xs32[i] = (i % 7U == 0U) ? kLimit32 : coordinate32(engine);
+    ys32[i] = (i % 11U == 0U) ? kLimit32 : coordinate32(engine);
+  }
+  const Point2I32 kOrigin32(-kLimit32, -kLimit32);
+  const auto kRadius = static_cast<int64_t>(kLimit32) * 2 - 1;
+  const auto kDetected = DetectSimdLevel();
+
+  std::vector<uint64_t> expected(kTestCount);
+  std::vector<uint8_t> expected_within(kTestCount);
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const auto kSquared =
+        Point2I32(xs32[i], ys32[i]).CalculateSquaredDistance(kOrigin32);
+    EXPECT_EQ(kSquared.high, 0U);
+    expected[i] = kSquared.low;
+    expected_within[i] =
+        Point2I32(xs32[i], ys32[i]).IsWithin(kOrigin32, kRadius) ? 1U : 0U;
+  }
+  for (const auto kLevel : kAllLevels) {
+    if (!IsSimdLevelSupported(kLevel)) {
+      continue;
+    }
+    SetSimdLevel(kLevel);
+    std::vector<uint64_t> squared(kTestCount);
+    kernel::CalculateSquaredDistances(xs32.data(), ys32.data(), kTestCount,
+                                      kOrigin32.GetX(), kOrigin32.GetY(),
+                                      squared.data());
+    EXPECT_EQ(squared, expected);
+
+    std::vector<uint8_t> within(kTestCount);
+    std::size_t expected_count = 0;
+    for (const auto kFlag : expected_within) {
+      expected_count += kFlag;
+    }
+    EXPECT_EQ(kernel::IsWithin(xs32.data(), ys32.data(), kTestCount,
+                               kOrigin32.GetX(), kOrigin32.GetY(), kRadius,
+                               within.data()),
+              expected_count);
+    EXPECT_EQ(within, expected_within);
+    // Radii whose squares overflow int64 hold every point
+    EXPECT_EQ(kernel::IsWithin(xs32.data(), ys32.data(), kTestCount,
+                               kOrigin32.GetX(), kOrigin32.GetY(),
+                               int64_t{1} << 40, within.data()),
+              kTestCount);
+    EXPECT_EQ(kernel::IsWithin(xs32.data(), ys32.data(), kTestCount,
+                               kOrigin32.GetX(), kOrigin32.GetY(), -1,
+                               within.data()),
+              0U);
+  }
+  SetSimdLevel(kDetected);
+
+  std::vector<int64_t> xs64(kTestCount);
+  std::vector<int64_t> ys64(kTestCount);
+  std::uniform_int_distribution<int64_t> coordinate64(-Point2I::kLimit,
+                                                      Point2I::kLimit);
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    xs64[i] = coordinate64(engine);
+    ys64[i] = coordinate64(engine);
+  }
+  std::vector<UInt128> squared64(kTestCount);
+  kernel::CalculateSquaredDistances(xs64.data(), ys64.data(), kTestCount, 0,
+                                    0, squared64.data());
+  std::vector<uint8_t> within64(kTestCount);
+  const auto kRadius64 = Point2I::kLimit / 2;
+  const auto kWithin64 =
+      kernel::IsWithin(xs64.data(), ys64.data(), kTestCount, 0, 0, kRadius64,
+                       within64.data());
+  std::size_t expected_within64 = 0;
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const Point2I kPoint(xs64[i], ys64[i]);
+    EXPECT_EQ(squared64[i], kPoint.CalculateSquaredDistance(Point2I()));
+    const auto kFlag = kPoint.IsWithin(Point2I(), kRadius64) ? 1U : 0U;
+    EXPECT_EQ(within64[i], kFlag);
+    expected_within64 += kFlag;
+  }
+  EXPECT_EQ(kWithin64, expected_within64);
+}
+
+TEST(GeometryDistanceKernels, ConvertDistances) {
+  constexpr Distance::DistanceType kTypes[] = {
+      Distance::DistanceType::kKilometer, Distance::DistanceType::kMeter,
+      Distance::DistanceType::kCentimeter, Distance::DistanceType::kMillimeter,
+      Distance::DistanceType::kMicrometer, Distance::DistanceType::kNanometer};
+  // Full int64 range, so the AVX2 conversion must round like the scalar one
+  std::mt19937_64 engine(kTestCount);
+  std::vector<Distance> distances(kTestCount);
+  for (auto& distance : distances) {
+    distance = Distance(static_cast<double>(static_cast<int64_t>(engine())),
+                        Distance::DistanceType::kNanometer);
+  }
+  distances[0] = Distance(9.2e+18, Distance::DistanceType::kNanometer);
+  distances[1] = Distance(-9.2e+18, Distance::DistanceType::kNanometer);
+  distances[2] = Distance(-1.0, Distance::DistanceType::kNanometer);
+  distances[3] = Distance();
+  const auto kDetected = DetectSimdLevel();
+
+  for (const auto kLevel : kAllLevels) {
+    if (!IsSimdLevelSupported(kLevel)) {
+      continue;
+    }
+    SetSimdLevel(kLevel);
+    for (const auto kType : kTypes) {
+      std::vector<double> values(kTestCount);
+      kernel::ConvertDistances(distances.data(), kTestCount, kType,
+                               values.data());
+      for (uint32_t i = 0; i < kTestCount; ++i) {
+        EXPECT_EQ(values[i], distances[i].GetValue(kType));
+      }
+    }
+  }
+  SetSimdLevel(kDetected);
+}
+
+TEST(GeometryDistanceKernels, FromValues) {
+  constexpr Distance::DistanceType kTypes[] = {
+      Distance::DistanceType::kMeter, Distance::DistanceType::kMicrometer,
+      Distance::DistanceType::kNanometer};
+  // Mixes small values with ones past 2^51 nanometers and fractions
+  std::mt19937_64 engine(kTestCount);
+  std::uniform_real_distribution<double> small(-1.0e+6, 1.0e+6);
+  std::uniform_real_distribution<double> large(-9.0e+9, 9.0e+9);
+  std::vector<double> values(kTestCount);
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    values[i] = (i % 5U == 0U) ? large(engine) : small(engine);
+  }
+  values[0] = -0.5;
+  values[1] = 0.0;
+  const auto kDetected = DetectSimdLevel();
+
+  for (const auto kLevel : kAllLevels) {
+    if (!IsSimdLevelSupported(kLevel)) {
+      continue;
+    }
+    SetSimdLevel(kLevel);
+    for (const auto kType : kTypes) {
+      std::vector<Distance> distances(kTestCount);
+      kernel::FromValues(values.data(), kTestCount, kType, distances.data());
+      for (uint32_t i = 0; i < kTestCount; ++i) {
+        EXPECT_EQ(distances[i], Distance(values[i], kType));
+      }
+    }
+  }
+  SetSimdLevel(kDetected);
+}
+}  // namespace Jeong0806::geometry
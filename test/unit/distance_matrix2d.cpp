@@ -0,0 +1,110 @@
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/distance_matrix2d.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "random_points.hpp"
+
+namespace {
+// Neither side is a multiple of a tile so every edge tile is exercised
+constexpr uint32_t kRowCount = 75U;
+constexpr uint32_t kColumnCount = 2100U;
+constexpr double kRange = RAND_MAX / 1000.0;
+
+using Jeong0806::geometry::test_helper::MakeRandomPoints;
+}  // namespace
+
+namespace Jeong0806::geometry {
+TEST(GeometryDistanceMatrix2D, Constructor) {
+  DistanceMatrix2D matrix1;
+  EXPECT_EQ(matrix1.Rows(), 0U);
+  EXPECT_EQ(matrix1.Columns(), 0U);
+  EXPECT_TRUE(matrix1.ToVector().empty());
+
+  const auto kRows = MakeRandomPoints(kRowCount, kRange);
+  const auto kColumns = MakeRandomPoints(kColumnCount, kRange);
+  DistanceMatrix2D matrix2(kRows, kColumns);
+  EXPECT_EQ(matrix2.Rows(), kRowCount);
+  EXPECT_EQ(matrix2.Columns(), kColumnCount);
+  DistanceMatrix2D matrix3{PointCloud2D(kRows), PointCloud2D(kColumns)};
+  EXPECT_EQ(matrix3.ToVector(), matrix2.ToVector());
+}
+
+TEST(GeometryDistanceMatrix2D, Calculate) {
+  const auto kRows = MakeRandomPoints(kRowCount, kRange);
+  const auto kColumns = MakeRandomPoints(kColumnCount, kRange);
+  DistanceMatrix2D matrix(kRows, kColumns);
+
+  for (const auto kThreadCount : {1U, 4U}) {
+    const auto kValues = matrix.ToVector(kThreadCount);
+    ASSERT_EQ(kValues.size(), kRowCount * kColumnCount);
+    for (uint32_t row = 0; row < kRowCount; ++row) {
+      for (uint32_t column = 0; column < kColumnCount; ++column) {
+        EXPECT_EQ(kValues[(row * kColumnCount) + column],
+                  Point2D::CalculateDistance(kRows[row], kColumns[column]));
+      }
+    }
+  }
+}
+
+TEST(GeometryDistanceMatrix2D, CalculateFloatAndDistance) {
+  const auto kRows = MakeRandomPoints(kRowCount, kRange);
+  const auto kColumns = MakeRandomPoints(kColumnCount, kRange);
+  DistanceMatrix2D matrix(kRows, kColumns, Distance::DistanceType::kKilometer);
+  const auto kValues = matrix.ToVector();
+
+  std::vector<float> floats(kValues.size());
+  std::vector<Distance> distances(kValues.size());
+  matrix.Calculate(floats.data(), 3U);
+  matrix.Calculate(distances.data(), 3U);
+  for (std::size_t i = 0; i < kValues.size(); ++i) {
+    EXPECT_EQ(floats[i], static_cast<float>(kValues[i]));
+    EXPECT_EQ(distances[i],
+              Distance(kValues[i], Distance::DistanceType::kKilometer));
+  }
+}
+
+TEST(GeometryDistanceMatrix2D, StreamRowBlocks) {
+  const auto kRows = MakeRandomPoints(kRowCount, kRange);
+  const auto kColumns = MakeRandomPoints(kColumnCount, kRange);
+  DistanceMatrix2D matrix(kRows, kColumns);
+  const auto kValues = matrix.ToVector();
+
+  std::vector<double> streamed;
+  std::size_t next_row = 0;
+  matrix.StreamRowBlocks(
+      16U,
+      [&](std::size_t first_row, std::size_t row_count, const double* values) {
+        EXPECT_EQ(first_row, next_row);
+        EXPECT_LE(row_count, 16U);
+        streamed.insert(streamed.end(), values,
+                        values + (row_count * kColumnCount));
+        next_row += row_count;
+      },
+      2U);
+  EXPECT_EQ(next_row, kRowCount);
+  EXPECT_EQ(streamed, kValues);
+
+  std::vector<Distance> distances(kValues.size());
+  matrix.Calculate(distances.data());
+  std::vector<Distance> streamed_distances;
+  matrix.StreamRowBlocks(
+      kRowCount, [&](std::size_t /* first_row */, std::size_t row_count,
+                     const Distance* values) {
+        streamed_distances.insert(streamed_distances.end(), values,
+                                  values + (row_count * kColumnCount));
+      });
+  EXPECT_EQ(streamed_distances, distances);
+
+  EXPECT_THROW(matrix.StreamRowBlocks(
+                   0U, [](std::size_t, std::size_t, const float*) {}),
+               std::invalid_argument);
+}
+}  // namespace Jeong0806::geometry
@@ -0,0 +1,164 @@
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/hilbert2d.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "random_points.hpp"
+
+namespace {
+constexpr uint32_t kPointCount = 20000U;
+constexpr double kRange = 1000.0;
+
+using Jeong0806::geometry::test_helper::MakeRandomPointCloud;
+}  // namespace
+
+namespace Jeong0806::geometry {
+TEST(GeometryHilbert2D, EncodeDecode) {
+  static_assert(Hilbert2D::Encode(0U, 0U) == 0U);
+  static_assert(Hilbert2D::Decode(0U).first == 0U);
+  static_assert(Hilbert2D::Decode(Hilbert2D::Encode(12345U, 678U)).second ==
+                678U);
+
+  // Consecutive codes are edge-adjacent cells
+  auto previous = Hilbert2D::Decode(0U);
+  for (uint64_t code = 1; code < 4096U; ++code) {
+    const auto kCell = Hilbert2D::Decode(code);
+    const auto kDx = (kCell.first > previous.first)
+                         ? kCell.first - previous.first
+                         : previous.first - kCell.first;
+    const auto kDy = (kCell.second > previous.second)
+                         ? kCell.second - previous.second
+                         : previous.second - kCell.second;
+    EXPECT_EQ(kDx + kDy, 1U);
+    EXPECT_EQ(Hilbert2D::Encode(kCell.first, kCell.second), code);
+    previous = kCell;
+  }
+  const auto kLast = std::numeric_limits<uint64_t>::max();
+  const auto [kX, kY] = Hilbert2D::Decode(kLast);
+  EXPECT_EQ(Hilbert2D::Encode(kX, kY), kLast);
+  for (int i = 0; i < 1000; ++i) {
+    const auto kCellX = static_cast<uint32_t>(std::rand()) * 2654435761U;
+    const auto kCellY = static_cast<uint32_t>(std::rand()) * 2246822519U;
+    const auto kCell = Hilbert2D::Decode(Hilbert2D::Encode(kCellX, kCellY));
+    EXPECT_EQ(kCell.first, kCellX);
+    EXPECT_EQ(kCell.second, kCellY);
+  }
+
+  const auto kPoints = MakeRandomPointCloud(1000U, kRange);
+  const MortonGrid2D kGrid(kPoints);
+  const auto kCodes = Hilbert2D::ComputeCodes(kGrid, kPoints, 2U);
+  const auto kVector = kPoints.ToPoints();
+  std::vector<uint64_t> codes(kVector.size());
+  Hilbert2D::ComputeCodes(kGrid, kVector.data(), kVector.size(), codes.data());
+  EXPECT_EQ(codes, kCodes);
+  for (std::size_t i = 0; i < kVector.size(); ++i) {
+    const auto [kCellX, kCellY] = kGrid.Quantize(kVector[i]);
+    EXPECT_EQ(kCodes[i], Hilbert2D::Encode(kCellX, kCellY));
+    EXPECT_EQ(kCodes[i], Hilbert2D::GetCode(kGrid, kVector[i]));
+  }
+}
+
+TEST(GeometryHilbertPartition2D, Partition) {
+  constexpr std::size_t kShards = 7U;
+  const auto kPoints = MakeRandomPointCloud(kPointCount, kRange);
+  const HilbertPartition2D kPartition(kPoints, kShards, 3U);
+  ASSERT_EQ(kPartition.GetShardCount(), kShards);
+
+  // Shards cover every point once, in order of 2^16 by 2^16 cells along the
+  // curve, with balanced counts
+  const auto kCodes = Hilbert2D::ComputeCodes(MortonGrid2D(kPoints), kPoints);
+  std::vector<bool> seen(kPointCount, false);
+  std::size_t position = 0;
+  double area = 0.0;
+  for (std::size_t shard = 0; shard < kShards; ++shard) {
+    const auto kSize = kPartition.GetShardSize(shard);
+    EXPECT_GE(kSize, kPointCount / kShards);
+    EXPECT_LE(kSize, (kPointCount / kShards) + 1U);
+    EXPECT_DOUBLE_EQ(kPartition.GetShardWeight(shard),
+                     static_cast<double>(kSize));
+    const auto* const kIndices = kPartition.GetShardIndices(shard);
+    EXPECT_EQ(kIndices, kPartition.GetOrder().data() + position);
+    for (std::size_t i = 0; i < kSize; ++i) {
+      EXPECT_FALSE(seen[kIndices[i]]);
+      seen[kIndices[i]] = true;
+      if (position + i > 0U) {
+        EXPECT_LE(kCodes[kPartition.GetOrder()[position + i - 1U]] >> 32U,
+                  kCodes[kIndices[i]] >> 32U);
+      }
+    }
+    position += kSize;
+
+    const auto kShard = kPartition.Gather(kPoints, shard);
+    ASSERT_EQ(kShard.Size(), kSize);
+    for (std::size_t i = 0; i < kSize; ++i) {
+      EXPECT_EQ(kShard.GetPoint(i), kPoints.GetPoint(kIndices[i]));
+    }
+    const auto [kMinX, kMaxX] = std::minmax_element(
+        kShard.GetXData(), kShard.GetXData() + kShard.Size());
+    const auto [kMinY, kMaxY] = std::minmax_element(
+        kShard.GetYData(), kShard.GetYData() + kShard.Size());
+    area += (*kMaxX - *kMinX) * (*kMaxY - *kMinY);
+  }
+  EXPECT_EQ(position, kPointCount);
+  EXPECT_TRUE(std::all_of(seen.begin(), seen.end(), [](bool is) {
+    return is;
+  }));
+  // Compact shards overlap little, index ranges of random points would
+  // each span the whole square
+  EXPECT_LT(area, 2.0 * kRange * kRange);
+
+  EXPECT_THROW(static_cast<void>(kPartition.GetShardSize(kShards)),
+               std::out_of_range);
+  EXPECT_THROW(static_cast<void>(HilbertPartition2D(kPoints, 0U)),
+               std::invalid_argument);
+  EXPECT_EQ(HilbertPartition2D().GetShardCount(), 0U);
+  const HilbertPartition2D kEmpty(PointCloud2D(), 3U);
+  EXPECT_EQ(kEmpty.GetShardCount(), 3U);
+  EXPECT_EQ(kEmpty.GetShardSize(2U), 0U);
+}
+
+TEST(GeometryHilbertPartition2D, Weighted) {
+  constexpr std::size_t kShards = 4U;
+  const auto kPoints = MakeRandomPointCloud(kPointCount, kRange);
+  std::vector<double> weights(kPointCount);
+  double total = 0.0;
+  double max_weight = 0.0;
+  for (std::size_t i = 0; i < kPointCount; ++i) {
+    // Points on the left are ten times as expensive
+    weights[i] = (kPoints.GetXData()[i] < kRange / 2.0) ? 10.0 : 1.0;
+    total += weights[i];
+    max_weight = std::max(max_weight, weights[i]);
+  }
+  const HilbertPartition2D kPartition(kPoints, weights, kShards);
+  std::size_t count = 0;
+  for (std::size_t shard = 0; shard < kShards; ++shard) {
+    double weight = 0.0;
+    const auto* const kIndices = kPartition.GetShardIndices(shard);
+    for (std::size_t i = 0; i < kPartition.GetShardSize(shard); ++i) {
+      weight += weights[kIndices[i]];
+    }
+    count += kPartition.GetShardSize(shard);
+    EXPECT_DOUBLE_EQ(kPartition.GetShardWeight(shard), weight);
+    EXPECT_NEAR(weight, total / kShards, max_weight);
+  }
+  EXPECT_EQ(count, kPointCount);
+
+  EXPECT_THROW(static_cast<void>(HilbertPartition2D(
+                   kPoints, std::vector<double>(3U, 1.0), kShards)),
+               std::invalid_argument);
+  weights[5] = -1.0;
+  EXPECT_THROW(static_cast<void>(HilbertPartition2D(kPoints, weights, 2U)),
+               std::invalid_argument);
+  weights[5] = std::numeric_limits<double>::quiet_NaN();
+  EXPECT_THROW(static_cast<void>(HilbertPartition2D(kPoints, weights, 2U)),
+               std::invalid_argument);
+}
+}  // namespace Jeong0806::geometry
@@ -0,0 +1,139 @@
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/instrumentation.hpp"
+
+#include <cstdint>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "geometry/distance.hpp"
+#include "geometry/kd_tree2d.hpp"
+#include "geometry/point2d.hpp"
+#include "gtest/gtest.h"
+#include "random_points.hpp"
+
+namespace {
+constexpr uint32_t kPointCount = 1000U;
+constexpr int kRange = 1000;
+
+using Jeong0806::geometry::test_helper::MakeRandomGridPoints;
+
+// Zero when the instrumentation is compiled out
+constexpr auto Expected(uint64_t count) -> uint64_t {
+  return Jeong0806::geometry::Instrumentation::kEnabled ? count : 0U;
+}
+}  // namespace
+
+namespace Jeong0806::geometry {
+TEST(GeometryInstrumentation, Names) {
+  std::set<std::string_view> names;
+  for (std::size_t i = 0; i < Instrumentation::kCounterCount; ++i) {
+    names.insert(
+        Instrumentation::GetName(static_cast<Instrumentation::Counter>(i)));
+  }
+  for (std::size_t i = 0; i < Instrumentation::kTimerCount; ++i) {
+    names.insert(
+        Instrumentation::GetName(static_cast<Instrumentation::Timer>(i)));
+  }
+  EXPECT_EQ(names.size(),
+            Instrumentation::kCounterCount + Instrumentation::kTimerCount);
+  EXPECT_EQ(names.count(""), 0U);
+  EXPECT_EQ(
+      Instrumentation::GetName(Instrumentation::Counter::kDistanceCalculations),
+      "distance_calculations");
+  EXPECT_EQ(Instrumentation::GetName(Instrumentation::Timer::kKdTreeBuild),
+            "kd_tree_build");
+}
+
+TEST(GeometryInstrumentation, CountDistances) {
+  const Point2D kLhs(0.0, 0.0);
+  const Point2D kRhs(3.0, 4.0);
+  const auto kBefore = Instrumentation::TakeSnapshot();
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_DOUBLE_EQ(kLhs.CalculateDistance(kRhs), 5.0);
+  }
+  const auto kDistance = Distance(1.5, Distance::DistanceType::kKilometer);
+  EXPECT_DOUBLE_EQ(kDistance.GetValue(Distance::DistanceType::kMeter), 1500.0);
+  const auto kDelta = Instrumentation::TakeSnapshot() - kBefore;
+  EXPECT_EQ(kDelta.Get(Instrumentation::Counter::kDistanceCalculations),
+            Expected(10U));
+  EXPECT_EQ(kDelta.Get(Instrumentation::Counter::kDistanceConversions),
+            Expected(2U));
+
+  // Compile time conversions stay constant expressions
+  static_assert(Distance(1.5, Distance::DistanceType::kKilometer)
+                        .GetValue<Distance::DistanceType::kNanometer>() ==
+                    1.5e+12,
+                "Distance conversions must stay constexpr");
+}
+
+TEST(GeometryInstrumentation, CountExitedThreads) {
+  const auto kBefore = Instrumentation::TakeSnapshot();
+  std::vector<std::thread> threads;
+  for (int thread = 0; thread < 4; ++thread) {
+    threads.emplace_back([] {
+      for (int i = 0; i < 25; ++i) {
+        Instrumentation::Add(Instrumentation::Counter::kIndexPointTests, 2U);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  const auto kDelta = Instrumentation::TakeSnapshot() - kBefore;
+  EXPECT_EQ(kDelta.Get(Instrumentation::Counter::kIndexPointTests),
+            Expected(200U));
+}
+
+TEST(GeometryInstrumentation, TimeIndexOperations) {
+  const auto kPoints = MakeRandomGridPoints(kPointCount, kRange);
+  const auto kBefore = Instrumentation::TakeSnapshot();
+  const KdTree2D kTree(kPoints);
+  const auto kNeighbors = kTree.Nearest(kPoints, 2U);
+  EXPECT_EQ(kNeighbors.size(), kPointCount);
+  const auto kDelta = Instrumentation::TakeSnapshot() - kBefore;
+
+  EXPECT_EQ(kDelta.Get(Instrumentation::Timer::kKdTreeBuild).calls,
+            Expected(1U));
+  EXPECT_EQ(kDelta.Get(Instrumentation::Timer::kKdTreeQuery).calls,
+            Expected(1U));
+  EXPECT_EQ(kDelta.Get(Instrumentation::Timer::kConvexHull).calls, 0U);
+  // Every query reaches at least one leaf holding its own point
+  EXPECT_GE(kDelta.Get(Instrumentation::Counter::kIndexNodeVisits),
+            Expected(kPointCount));
+  EXPECT_GE(kDelta.Get(Instrumentation::Counter::kIndexPointTests),
+            Expected(kPointCount));
+  if (!Instrumentation::kEnabled) {
+    EXPECT_EQ(kDelta.Get(Instrumentation::Timer::kKdTreeBuild).ticks, 0U);
+  }
+}
+
+TEST(GeometryInstrumentation, Format) {
+  Instrumentation::Snapshot snapshot;
+  snapshot.counters[static_cast<std::size_t>(
+      Instrumentation::Counter::kDistanceConversions)] = 42U;
+  snapshot.timers[static_cast<std::size_t>(
+      Instrumentation::Timer::kPointParse)] = {3U, 900U};
+
+  const auto kText = snapshot.ToText();
+  EXPECT_NE(kText.find("distance_conversions 42\n"), std::string::npos);
+  EXPECT_NE(kText.find("point_parse calls=3 ticks=900\n"), std::string::npos);
+
+  const auto kJson = snapshot.ToJson();
+  EXPECT_EQ(kJson.front(), '{');
+  EXPECT_EQ(kJson.back(), '}');
+  EXPECT_NE(kJson.find("\"distance_conversions\":42"), std::string::npos);
+  EXPECT_NE(kJson.find("\"point_parse\":{\"calls\":3,\"ticks\":900}"),
+            std::string::npos);
+  EXPECT_NE(kJson.find(std::string("\"tick_unit\":\"") +
+                       std::string(Instrumentation::kTickUnit) + "\""),
+            std::string::npos);
+
+  const auto kZero = snapshot - snapshot;
+  EXPECT_EQ(kZero.Get(Instrumentation::Counter::kDistanceConversions), 0U);
+  EXPECT_EQ(kZero.Get(Instrumentation::Timer::kPointParse).calls, 0U);
+}
+}  // namespace Jeong0806::geometry
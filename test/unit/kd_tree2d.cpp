@@ -0,0 +1,135 @@
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/kd_tree2d.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "random_points.hpp"
+
+namespace {
+constexpr uint32_t kPointCount = 2000U;
+constexpr uint32_t kQueryCount = 200U;
+constexpr double kRange = 1000.0;
+
+using Jeong0806::geometry::test_helper::MakeRandomPoints;
+
+auto BruteForce(const std::vector<Jeong0806::geometry::Point2D>& points,
+                const Jeong0806::geometry::Point2D& query)
+    -> std::vector<Jeong0806::geometry::Neighbor> {
+  std::vector<Jeong0806::geometry::Neighbor> neighbors;
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    neighbors.push_back(Jeong0806::geometry::Neighbor{
+        i, Jeong0806::geometry::Point2D::CalculateDistance(points[i], query)});
+  }
+  std::sort(neighbors.begin(), neighbors.end());
+  return neighbors;
+}
+}  // namespace
+
+namespace Jeong0806::geometry {
+TEST(GeometryKdTree2D, Constructor) {
+  KdTree2D tree1;
+  EXPECT_TRUE(tree1.Empty());
+  EXPECT_THROW(static_cast<void>(tree1.Nearest(Point2D())), std::out_of_range);
+  EXPECT_TRUE(tree1.KNearest(Point2D(), 3U).empty());
+  EXPECT_TRUE(tree1.Radius(Point2D(), 1.0).empty());
+
+  const auto kPoints = MakeRandomPoints(kPointCount, kRange);
+  KdTree2D tree2(kPoints);
+  EXPECT_EQ(tree2.Size(), kPoints.size());
+}
+
+TEST(GeometryKdTree2D, Nearest) {
+  const auto kPoints = MakeRandomPoints(kPointCount, kRange);
+  KdTree2D tree(kPoints);
+
+  for (uint32_t i = 0; i < kQueryCount; ++i) {
+    const Point2D kQuery(kRange * std::rand() / RAND_MAX,
+                         kRange * std::rand() / RAND_MAX);
+    const auto kExpected = BruteForce(kPoints, kQuery).front();
+    const auto kNeighbor = tree.Nearest(kQuery);
+    EXPECT_EQ(kNeighbor.index, kExpected.index);
+    EXPECT_DOUBLE_EQ(kNeighbor.distance, kExpected.distance);
+  }
+}
+
+TEST(GeometryKdTree2D, NearestWithDuplicates) {
+  const std::vector<Point2D> kPoints(50U, Point2D(1.0, 1.0));
+  KdTree2D tree(kPoints);
+
+  EXPECT_EQ(tree.Nearest(Point2D(0.0, 0.0)).index, 0U);
+  EXPECT_EQ(tree.KNearest(Point2D(0.0, 0.0), 50U).size(), 50U);
+}
+
+TEST(GeometryKdTree2D, KNearest) {
+  const auto kPoints = MakeRandomPoints(kPointCount, kRange);
+  KdTree2D tree(kPoints);
+
+  for (uint32_t i = 0; i < kQueryCount; ++i) {
+    const Point2D kQuery(kRange * std::rand() / RAND_MAX,
+                         kRange * std::rand() / RAND_MAX);
+    const auto kK = static_cast<std::size_t>(1U + (i % 20U));
+    const auto kExpected = BruteForce(kPoints, kQuery);
+    const auto kNeighbors = tree.KNearest(kQuery, kK);
+    ASSERT_EQ(kNeighbors.size(), kK);
+    for (std::size_t j = 0; j < kK; ++j) {
+      EXPECT_EQ(kNeighbors[j].index, kExpected[j].index);
+      EXPECT_DOUBLE_EQ(kNeighbors[j].distance, kExpected[j].distance);
+    }
+  }
+  EXPECT_EQ(tree.KNearest(Point2D(), kPointCount * 2U).size(), kPointCount);
+}
+
+TEST(GeometryKdTree2D, Radius) {
+  const auto kPoints = MakeRandomPoints(kPointCount, kRange);
+  KdTree2D tree(kPoints);
+
+  for (uint32_t i = 0; i < kQueryCount; ++i) {
+    const Point2D kQuery(kRange * std::rand() / RAND_MAX,
+                         kRange * std::rand() / RAND_MAX);
+    const auto kRadius = 5.0 * (i % 20U);
+    auto expected = BruteForce(kPoints, kQuery);
+    expected.erase(std::find_if(expected.begin(), expected.end(),
+                                [kRadius](const Neighbor& neighbor) {
+                                  return neighbor.distance > kRadius;
+                                }),
+                   expected.end());
+    const auto kNeighbors = tree.Radius(kQuery, kRadius);
+    ASSERT_EQ(kNeighbors.size(), expected.size());
+    for (std::size_t j = 0; j < expected.size(); ++j) {
+      EXPECT_EQ(kNeighbors[j].index, expected[j].index);
+    }
+  }
+  EXPECT_TRUE(tree.Radius(Point2D(), -1.0).empty());
+}
+
+TEST(GeometryKdTree2D, BatchQueries) {
+  const auto kPoints = MakeRandomPoints(kPointCount, kRange);
+  const auto kQueries = MakeRandomPoints(kQueryCount, kRange);
+  KdTree2D tree(kPoints);
+
+  const auto kNearest = tree.Nearest(kQueries, 4U);
+  const auto kKNearest = tree.KNearest(kQueries, 5U, 4U);
+  const auto kRadius = tree.Radius(kQueries, 30.0, 4U);
+  ASSERT_EQ(kNearest.size(), kQueries.size());
+  for (std::size_t i = 0; i < kQueries.size(); ++i) {
+    EXPECT_EQ(kNearest[i], tree.Nearest(kQueries[i]));
+    EXPECT_EQ(kKNearest[i], tree.KNearest(kQueries[i], 5U));
+    EXPECT_EQ(kRadius[i], tree.Radius(kQueries[i], 30.0));
+  }
+}
+
+TEST(GeometryKdTree2D, NeighborDistance) {
+  const Neighbor kNeighbor{0U, 1.5};
+
+  EXPECT_EQ(kNeighbor.GetDistance(), Distance(1.5));
+  EXPECT_EQ(kNeighbor.GetDistance(Distance::DistanceType::kKilometer),
+            Distance(1500.0));
+}
+}  // namespace Jeong0806::geometry
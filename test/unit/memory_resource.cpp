@@ -0,0 +1,136 @@
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/memory_resource.hpp"
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "geometry/aligned_allocator.hpp"
+#include "geometry/delaunay_triangulation2d.hpp"
+#include "geometry/distance_matrix2d.hpp"
+#include "geometry/kd_tree2d.hpp"
+#include "geometry/point_cloud2d.hpp"
+#include "geometry/polygon_index2d.hpp"
+#include "geometry/spatial_hash_grid2d.hpp"
+#include "gtest/gtest.h"
+#include "random_points.hpp"
+
+namespace {
+constexpr uint32_t kPointCount = 1000U;
+constexpr double kRange = 1000.0;
+
+using Jeong0806::geometry::test_helper::MakeRandomPoints;
+
+auto IsAligned(const void* pointer) -> bool {
+  return reinterpret_cast<uintptr_t>(pointer) %
+             Jeong0806::geometry::kSimdAlignment ==
+         0U;
+}
+}  // namespace
+
+namespace Jeong0806::geometry {
+TEST(GeometryMemoryResource, Counting) {
+  CountingMemoryResource counting;
+  {
+    PointCloud2D points(kPointCount, &counting);
+    EXPECT_EQ(points.GetResource(), &counting);
+    EXPECT_TRUE(IsAligned(points.GetXData()));
+    EXPECT_TRUE(IsAligned(points.GetYData()));
+    EXPECT_EQ(counting.GetAllocationCount(), 2U);
+    EXPECT_EQ(counting.GetBytesInUse(), 2U * kPointCount * sizeof(double));
+
+    // Copies go back to the default resource, moves keep the resource
+    const auto kCopy = points;
+    EXPECT_EQ(kCopy.GetResource(), std::pmr::get_default_resource());
+    const auto kMoved = std::move(points);
+    EXPECT_EQ(kMoved.GetResource(), &counting);
+    EXPECT_EQ(counting.GetAllocationCount(), 2U);
+  }
+  EXPECT_EQ(counting.GetDeallocationCount(), 2U);
+  EXPECT_EQ(counting.GetBytesInUse(), 0U);
+  EXPECT_EQ(counting.GetPeakBytes(), 2U * kPointCount * sizeof(double));
+
+  counting.ResetCounts();
+  EXPECT_EQ(counting.GetAllocationCount(), 0U);
+  EXPECT_EQ(counting.GetPeakBytes(), 0U);
+
+  auto* const kDefault = std::pmr::set_default_resource(&counting);
+  const PointCloud2D kDefaulted(kPointCount);
+  std::pmr::set_default_resource(kDefault);
+  EXPECT_EQ(kDefaulted.GetResource(), &counting);
+  EXPECT_EQ(counting.GetAllocationCount(), 2U);
+}
+
+TEST(GeometryMemoryResource, AlignedAllocator) {
+  CountingMemoryResource counting;
+  const AlignedAllocator<double> kDefault;
+  const AlignedAllocator<double> kCounting(&counting);
+  const AlignedAllocator<float> kRebound(kCounting);
+  EXPECT_EQ(kDefault.resource(), std::pmr::get_default_resource());
+  EXPECT_EQ(kRebound.resource(), &counting);
+  EXPECT_TRUE(kCounting == kRebound);
+  EXPECT_TRUE(kDefault != kCounting);
+}
+
+TEST(GeometryMemoryResource, Arena) {
+  const auto kPoints = MakeRandomPoints(kPointCount, kRange);
+  const Point2D kQuery(kRange / 2.0, kRange / 2.0);
+  const KdTree2D kTree(kPoints);
+  const SpatialHashGrid2D kGrid(kPoints, Distance(kRange / 20.0));
+  const DistanceMatrix2D kMatrix(kPoints, kPoints);
+  const DelaunayTriangulation2D kTriangulation(kPoints);
+  std::vector<Polygon2D> zones;
+  for (uint32_t i = 0; i + 2U < kPointCount; i += 3U) {
+    zones.emplace_back(std::vector<Point2D>{kPoints[i], kPoints[i + 1U],
+                                            kPoints[i + 2U]});
+  }
+  const PolygonIndex2D kIndex(zones);
+
+  CountingMemoryResource upstream;
+  {
+    Arena arena(Arena::kDefaultInitialSize, &upstream);
+    for (int request = 0; request < 10; ++request) {
+      const PointCloud2D kCloud(kPoints, &arena);
+      EXPECT_TRUE(IsAligned(kCloud.GetXData()));
+      EXPECT_EQ(kCloud.ToPoints(), kPoints);
+
+      const KdTree2D kArenaTree(kPoints, &arena);
+      EXPECT_EQ(kArenaTree.GetResource(), &arena);
+      EXPECT_EQ(kArenaTree.KNearest(kQuery, 10U), kTree.KNearest(kQuery, 10U));
+
+      const SpatialHashGrid2D kArenaGrid(kPoints, Distance(kRange / 20.0),
+                                         Distance::DistanceType::kMeter, 0U,
+                                         &arena);
+      EXPECT_EQ(kArenaGrid.GetResource(), &arena);
+      EXPECT_EQ(kArenaGrid.PairsWithin(kRange / 50.0),
+                kGrid.PairsWithin(kRange / 50.0));
+
+      const DistanceMatrix2D kArenaMatrix(
+          kPoints, kPoints, Distance::DistanceType::kMeter, &arena);
+      EXPECT_EQ(kArenaMatrix.ToVector(), kMatrix.ToVector());
+
+      const DelaunayTriangulation2D kArenaTriangulation(kPoints, 0U, &arena);
+      EXPECT_EQ(kArenaTriangulation.GetResource(), &arena);
+      EXPECT_EQ(kArenaTriangulation.GetTriangles(),
+                kTriangulation.GetTriangles());
+
+      const PolygonIndex2D kArenaIndex(zones, &arena);
+      EXPECT_EQ(kArenaIndex.GetResource(), &arena);
+      EXPECT_EQ(kArenaIndex.GetZone(0U).GetResource(), &arena);
+      EXPECT_EQ(kArenaIndex.Classify(kPoints), kIndex.Classify(kPoints));
+    }
+    // Freed blocks are reused, so later requests take nothing new upstream
+    EXPECT_LT(upstream.GetAllocationCount(), 20U);
+    EXPECT_GT(upstream.GetBytesInUse(), 0U);
+
+    arena.Release();
+    EXPECT_EQ(upstream.GetBytesInUse(), 0U);
+    const PointCloud2D kAfterRelease(kPoints, &arena);
+    EXPECT_EQ(kAfterRelease.ToPoints(), kPoints);
+  }
+  EXPECT_EQ(upstream.GetBytesInUse(), 0U);
+  EXPECT_EQ(upstream.GetAllocationCount(), upstream.GetDeallocationCount());
+}
+}  // namespace Jeong0806::geometry
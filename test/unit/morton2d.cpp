@@ -0,0 +1,163 @@
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/morton2d.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "geometry/simd.hpp"
+#include "gtest/gtest.h"
+#include "random_points.hpp"
+
+namespace {
+// Several radix sort blocks of kMinParallelSortSize
+constexpr uint32_t kPointCount = 70000U;
+constexpr double kRange = 1000.0;
+
+using Jeong0806::geometry::test_helper::MakeRandomPoints;
+
+auto RandomCode() -> uint64_t {
+  return (static_cast<uint64_t>(std::rand()) << 42U) ^
+         (static_cast<uint64_t>(std::rand()) << 21U) ^
+         static_cast<uint64_t>(std::rand());
+}
+
+auto StableSortOrder(const std::vector<uint64_t>& codes)
+    -> std::vector<uint32_t> {
+  std::vector<uint32_t> order(codes.size());
+  std::iota(order.begin(), order.end(), 0U);
+  std::stable_sort(order.begin(), order.end(),
+                   [&codes](uint32_t lhs, uint32_t rhs) {
+                     return codes[lhs] < codes[rhs];
+                   });
+  return order;
+}
+}  // namespace
+
+namespace Jeong0806::geometry {
+TEST(GeometryMorton2D, EncodeDecode) {
+  constexpr auto kMax = std::numeric_limits<uint32_t>::max();
+  static_assert(Morton2D::Encode(1U, 0U) == 1U);
+  static_assert(Morton2D::Encode(0U, 1U) == 2U);
+  static_assert(Morton2D::Encode(3U, 3U) == 15U);
+  static_assert(Morton2D::Encode(kMax, 0U) == 0x5555555555555555ULL);
+  static_assert(Morton2D::Encode(kMax, kMax) ==
+                std::numeric_limits<uint64_t>::max());
+  static_assert(Morton2D::Decode(Morton2D::Encode(12345U, kMax)).first ==
+                12345U);
+
+  std::vector<uint32_t> xs(1000U);
+  std::vector<uint32_t> ys(xs.size());
+  for (std::size_t i = 0; i < xs.size(); ++i) {
+    xs[i] = static_cast<uint32_t>(RandomCode());
+    ys[i] = static_cast<uint32_t>(RandomCode());
+  }
+  const auto kPrevious = GetSimdLevel();
+  for (const auto kLevel : {SimdLevel::kScalar, DetectSimdLevel()}) {
+    SetSimdLevel(kLevel);
+    std::vector<uint64_t> codes(xs.size());
+    Morton2D::Encode(xs.data(), ys.data(), xs.size(), codes.data());
+    std::vector<uint32_t> decoded_xs(xs.size());
+    std::vector<uint32_t> decoded_ys(xs.size());
+    Morton2D::Decode(codes.data(), codes.size(), decoded_xs.data(),
+                     decoded_ys.data());
+    for (std::size_t i = 0; i < xs.size(); ++i) {
+      EXPECT_EQ(codes[i], Morton2D::Encode(xs[i], ys[i]));
+    }
+    EXPECT_EQ(decoded_xs, xs);
+    EXPECT_EQ(decoded_ys, ys);
+  }
+  SetSimdLevel(kPrevious);
+}
+
+TEST(GeometryMorton2D, Grid) {
+  const MortonGrid2D kGrid(Point2D(-10.0, 0.0), Point2D(10.0, 5.0));
+  constexpr auto kMax = std::numeric_limits<uint32_t>::max();
+  EXPECT_EQ(kGrid.GetCode(Point2D(-10.0, 0.0)), 0U);
+  EXPECT_EQ(kGrid.Quantize(Point2D(10.0, 5.0)),
+            std::make_pair(kMax, kMax / 4U));
+  EXPECT_EQ(kGrid.Quantize(Point2D(-20.0, 100.0)), std::make_pair(0U, kMax));
+  EXPECT_DOUBLE_EQ(kGrid.GetCellSize(), 20.0 / kMax);
+
+  const Point2D kPoint(1.25, 3.5);
+  const auto kCellMin = kGrid.GetCellMin(kGrid.GetCode(kPoint));
+  EXPECT_LE(kCellMin.GetX(), kPoint.GetX());
+  EXPECT_LE(kCellMin.GetY(), kPoint.GetY());
+  EXPECT_LT(kPoint.GetX() - kCellMin.GetX(), 2.0 * kGrid.GetCellSize());
+  EXPECT_LT(kPoint.GetY() - kCellMin.GetY(), 2.0 * kGrid.GetCellSize());
+
+  const auto kPoints = MakeRandomPoints(1000U, kRange);
+  const PointCloud2D kCloud(kPoints);
+  const MortonGrid2D kCloudGrid(kCloud);
+  EXPECT_EQ(MortonGrid2D(kPoints.data(), kPoints.size()).GetMin(),
+            kCloudGrid.GetMin());
+  const auto kCodes = kCloudGrid.ComputeCodes(kCloud);
+  std::vector<uint64_t> point_codes(kPoints.size());
+  kCloudGrid.ComputeCodes(kPoints.data(), kPoints.size(), point_codes.data(),
+                          4U);
+  EXPECT_EQ(point_codes, kCodes);
+  for (std::size_t i = 0; i < kPoints.size(); ++i) {
+    EXPECT_EQ(kCodes[i], kCloudGrid.GetCode(kPoints[i]));
+  }
+
+  EXPECT_EQ(MortonGrid2D(Point2D(1.0, 1.0), Point2D(1.0, 1.0)).GetCellSize(),
+            0.0);
+  EXPECT_THROW(MortonGrid2D(Point2D(1.0, 0.0), Point2D(0.0, 1.0)),
+               std::invalid_argument);
+  EXPECT_THROW(
+      MortonGrid2D(Point2D(0.0, 0.0),
+                   Point2D(std::numeric_limits<double>::infinity(), 1.0)),
+      std::invalid_argument);
+}
+
+TEST(GeometryMorton2D, SortOrder) {
+  for (const std::size_t kCount : {0U, 1U, 100U, 70000U}) {
+    std::vector<uint64_t> codes(kCount);
+    for (std::size_t i = 0; i < kCount; ++i) {
+      // Duplicates check stability, the shift leaves uniform byte passes
+      codes[i] = (RandomCode() % 5000U) << 24U;
+    }
+    const auto kExpected = StableSortOrder(codes);
+    EXPECT_EQ(Morton2D::SortOrder(codes.data(), codes.size(), 1U), kExpected);
+    EXPECT_EQ(Morton2D::SortOrder(codes.data(), codes.size(), 4U), kExpected);
+
+    for (auto& code : codes) {
+      code = RandomCode();
+    }
+    EXPECT_EQ(Morton2D::SortOrder(codes.data(), codes.size(), 4U),
+              StableSortOrder(codes));
+  }
+}
+
+TEST(GeometryMorton2D, Sort) {
+  const auto kPoints = MakeRandomPoints(kPointCount, kRange);
+  PointCloud2D cloud(kPoints);
+  const auto kOrder = Morton2D::Sort(cloud, 4U);
+  ASSERT_EQ(kOrder.size(), kPoints.size());
+  for (std::size_t i = 0; i < kOrder.size(); ++i) {
+    EXPECT_EQ(cloud.GetPoint(i), kPoints[kOrder[i]]);
+  }
+  const auto kCodes = MortonGrid2D(cloud).ComputeCodes(cloud);
+  EXPECT_TRUE(std::is_sorted(kCodes.begin(), kCodes.end()));
+
+  auto points = kPoints;
+  EXPECT_EQ(Morton2D::Sort(points, 1U), kOrder);
+  EXPECT_EQ(points, cloud.ToPoints());
+
+  std::vector<std::size_t> payload(kPoints.size());
+  std::iota(payload.begin(), payload.end(), 0U);
+  Morton2D::Permute(kOrder, payload);
+  EXPECT_TRUE(std::equal(payload.begin(), payload.end(), kOrder.begin()));
+  payload.pop_back();
+  EXPECT_THROW(Morton2D::Permute(kOrder, payload), std::invalid_argument);
+
+  PointCloud2D empty;
+  EXPECT_TRUE(Morton2D::Sort(empty).empty());
+}
+}  // namespace Jeong0806::geometry
@@ -0,0 +1,233 @@
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/parallel.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <functional>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "geometry/kd_tree2d.hpp"
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 1000U;
+
+// Forwards to a pool and counts the batches it was given
+class CountingExecutor : public Jeong0806::geometry::Executor {
+ public:
+  explicit CountingExecutor(Jeong0806::geometry::Executor* executor)
+      : executor_(executor) {}
+
+  [[nodiscard]] auto GetThreadCount() const -> std::size_t override {
+    return executor_->GetThreadCount();
+  }
+  auto Run(std::size_t task_count,
+           const std::function<void(std::size_t)>& task) -> void override {
+    ++batches_;
+    executor_->Run(task_count, task);
+  }
+
+  [[nodiscard]] auto GetBatchCount() const -> std::size_t { return batches_; }
+
+ protected:
+ private:
+  Jeong0806::geometry::Executor* executor_;
+  std::atomic<std::size_t> batches_{0U};
+};
+}  // namespace
+
+namespace Jeong0806::geometry {
+TEST(GeometryParallel, GetDefaultThreadCount) {
+  EXPECT_GE(GetDefaultThreadCount(), 1U);
+}
+
+TEST(GeometryParallel, ParallelForCoversEveryItemOnce) {
+  for (std::size_t thread_count = 0; thread_count <= 8U; ++thread_count) {
+    std::vector<std::atomic<uint32_t>> visits(kTestCount);
+    ParallelFor(
+        kTestCount,
+        [&visits](std::size_t begin, std::size_t end) {
+          for (auto i = begin; i < end; ++i) {
+            ++visits[i];
+          }
+        },
+        thread_count);
+    for (const auto& visit : visits) {
+      EXPECT_EQ(visit.load(), 1U);
+    }
+  }
+}
+
+TEST(GeometryParallel, ParallelForEmpty) {
+  auto called = false;
+  ParallelFor(0U, [&called](std::size_t, std::size_t) { called = true; });
+  EXPECT_FALSE(called);
+}
+
+TEST(GeometryParallel, ParallelForRethrows) {
+  EXPECT_THROW(ParallelFor(
+                   kTestCount,
+                   [](std::size_t begin, std::size_t) {
+                     if (begin == 0U) {
+                       throw std::runtime_error("first range");
+                     }
+                   },
+                   4U),
+               std::runtime_error);
+}
+
+TEST(GeometryParallel, ThreadPoolRun) {
+  for (const std::size_t kThreads : {1U, 2U, 4U}) {
+    ThreadPool pool(kThreads);
+    EXPECT_EQ(pool.GetThreadCount(), kThreads);
+    std::vector<std::atomic<uint32_t>> visits(kTestCount);
+    pool.Run(kTestCount, [&visits](std::size_t task) { ++visits[task]; });
+    for (const auto& visit : visits) {
+      EXPECT_EQ(visit.load(), 1U);
+    }
+    pool.Run(0U, [](std::size_t) { FAIL(); });
+  }
+  EXPECT_EQ(ThreadPool().GetThreadCount(), GetDefaultThreadCount());
+}
+
+TEST(GeometryParallel, ThreadPoolRunRethrowsAfterEveryTask) {
+  ThreadPool pool(3U);
+  std::atomic<uint32_t> finished{0U};
+  EXPECT_THROW(pool.Run(kTestCount,
+                        [&finished](std::size_t task) {
+                          if (task % 100U == 7U) {
+                            throw std::runtime_error("task");
+                          }
+                          ++finished;
+                        }),
+               std::runtime_error);
+  EXPECT_EQ(finished.load(), kTestCount - 10U);
+}
+
+TEST(GeometryParallel, ThreadPoolNested) {
+  // Callers waiting on inner loops run queued tasks, so even a pool of two
+  // threads finishes with every outer task blocked on an inner loop
+  for (const std::size_t kThreads : {1U, 2U, 4U}) {
+    ThreadPool pool(kThreads);
+    std::vector<std::atomic<uint32_t>> visits(kTestCount);
+    ParallelFor(
+        10U,
+        [&](std::size_t begin, std::size_t end) {
+          for (auto outer = begin; outer < end; ++outer) {
+            ParallelFor(
+                kTestCount / 10U,
+                [&](std::size_t inner_begin, std::size_t inner_end) {
+                  for (auto inner = inner_begin; inner < inner_end; ++inner) {
+                    ++visits[(outer * (kTestCount / 10U)) + inner];
+                  }
+                },
+                4U, &pool);
+          }
+        },
+        10U, &pool);
+    for (const auto& visit : visits) {
+      EXPECT_EQ(visit.load(), 1U);
+    }
+  }
+}
+
+TEST(GeometryParallel, ThreadPoolConcurrentCallers) {
+  ThreadPool pool(3U);
+  std::vector<uint64_t> sums(4U);
+  std::vector<std::thread> callers;
+  for (std::size_t caller = 0; caller < sums.size(); ++caller) {
+    callers.emplace_back([&pool, &sums, caller] {
+      for (int repeat = 0; repeat < 20; ++repeat) {
+        sums[caller] += ParallelReduce(
+            std::size_t{kTestCount}, uint64_t{0},
+            [](std::size_t begin, std::size_t end) {
+              uint64_t sum = 0;
+              for (auto i = begin; i < end; ++i) {
+                sum += i;
+              }
+              return sum;
+            },
+            std::plus<>(), 8U, &pool);
+      }
+    });
+  }
+  for (auto& caller : callers) {
+    caller.join();
+  }
+  for (const auto kSum : sums) {
+    EXPECT_EQ(kSum, 20U * (kTestCount * (kTestCount - 1U) / 2U));
+  }
+}
+
+TEST(GeometryParallel, ThreadPoolAffinity) {
+  ThreadPool pool(2U, {0U});
+  std::atomic<uint32_t> visits{0U};
+  pool.Run(kTestCount, [&visits](std::size_t) { ++visits; });
+  EXPECT_EQ(visits.load(), kTestCount);
+#if defined(__linux__)
+  EXPECT_THROW(ThreadPool(2U, {1U << 20U}), std::invalid_argument);
+#endif
+}
+
+TEST(GeometryParallel, ParallelReduce) {
+  std::vector<double> values(kTestCount);
+  for (auto& value : values) {
+    value = static_cast<double>(std::rand() % 1000);
+  }
+  const auto kExpected = std::accumulate(values.begin(), values.end(), 0.0);
+  const auto kSum = [&values](std::size_t begin, std::size_t end) {
+    return std::accumulate(values.begin() + static_cast<std::ptrdiff_t>(begin),
+                           values.begin() + static_cast<std::ptrdiff_t>(end),
+                           0.0);
+  };
+  for (std::size_t thread_count = 0; thread_count <= 8U; ++thread_count) {
+    EXPECT_DOUBLE_EQ(
+        ParallelReduce(values.size(), 0.0, kSum, std::plus<>(), thread_count),
+        kExpected);
+  }
+  EXPECT_DOUBLE_EQ(ParallelReduce(0U, 5.0, kSum, std::plus<>()), 5.0);
+}
+
+TEST(GeometryParallel, InjectedExecutor) {
+  ThreadPool pool(2U);
+  CountingExecutor executor(&pool);
+  std::vector<Point2D> points;
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    points.emplace_back(std::rand() % 1000, std::rand() % 1000);
+  }
+  const KdTree2D kTree(points);
+  const auto kNeighbors = kTree.Nearest(points, 4U, &executor);
+  EXPECT_EQ(executor.GetBatchCount(), 1U);
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    EXPECT_DOUBLE_EQ(kNeighbors[i].distance, 0.0);
+  }
+
+  auto* const kPrevious = SetDefaultExecutor(&executor);
+  EXPECT_EQ(GetDefaultExecutor(), &executor);
+  static_cast<void>(kTree.Nearest(points, 2U));
+  EXPECT_EQ(executor.GetBatchCount(), 2U);
+  EXPECT_EQ(SetDefaultExecutor(kPrevious), &executor);
+  EXPECT_EQ(GetDefaultExecutor(), kPrevious);
+}
+
+TEST(GeometryParallel, ParallelSort) {
+  std::vector<int32_t> values(kMinParallelSortSize * 5U);
+  for (auto& value : values) {
+    value = std::rand() % 1000;
+  }
+  auto expected = values;
+  std::sort(expected.begin(), expected.end());
+  for (std::size_t thread_count = 0; thread_count <= 8U; ++thread_count) {
+    auto sorted = values;
+    ParallelSort(sorted.begin(), sorted.end(), std::less<>(), thread_count);
+    EXPECT_EQ(sorted, expected);
+  }
+}
+}  // namespace Jeong0806::geometry
@@ -6,8 +6,10 @@
 #include <cmath>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <limits>
 #include <stdexcept>
+#include <type_traits>
 
 #include "gtest/gtest.h"
 
@@ -23,6 +25,27 @@ TEST(GeometryPoint2D, Constructor) {
   Point2D point4(std::move(point2));
 }
 
+TEST(GeometryPoint2D, ValueType) {
+  static_assert(std::is_trivially_copyable_v<Point2D>);
+  static_assert(std::is_standard_layout_v<Point2D>);
+  static_assert(sizeof(Point2D) == 2U * sizeof(double));
+
+  constexpr Point2D kTable[] = {Point2D(1.0, 2.0) + Point2D(3.0, 4.0),
+                                Point2D(1.0, 2.0) - Point2D(3.0, 4.0),
+                                Point2D(1.0, 2.0) * 2.0,
+                                Point2D(1.0, 2.0) / 2.0};
+  static_assert(kTable[0] == Point2D(4.0, 6.0));
+  static_assert(kTable[1] == Point2D(-2.0, -2.0));
+  static_assert(kTable[2].GetX() == 2.0 && kTable[2].GetY() == 4.0);
+  static_assert(kTable[3] != Point2D(1.0, 2.0));
+
+  Point2D points[2] = {Point2D(1.0, 2.0), Point2D(3.0, 4.0)};
+  Point2D copied[2];
+  std::memcpy(copied, points, sizeof(points));
+  EXPECT_EQ(copied[0], points[0]);
+  EXPECT_EQ(copied[1], points[1]);
+}
+
 TEST(GeometryPoint2D, AssignmentOperator) {
   Point2D point1;
   auto point2 = point1;
@@ -39,8 +62,8 @@ TEST(GeometryPoint2D, CalculateDistance) {
     Point2D source(kSourceX, kSourceY);
     Point2D target(kTargetX, kTargetY);
 
-    EXPECT_EQ(std::sqrt(std::pow((kSourceX - kTargetX), 2.0) +
-                        std::pow((kSourceY - kTargetY), 2.0)),
+    EXPECT_EQ(std::sqrt((kSourceX - kTargetX) * (kSourceX - kTargetX) +
+                        (kSourceY - kTargetY) * (kSourceY - kTargetY)),
               source.CalculateDistance(target));
   }
 }
@@ -55,12 +78,102 @@ TEST(GeometryPoint2D, StaticCalculateDistance) {
     Point2D source(kSourceX, kSourceY);
     Point2D target(kTargetX, kTargetY);
 
-    EXPECT_EQ(std::sqrt(std::pow((kSourceX - kTargetX), 2.0) +
-                        std::pow((kSourceY - kTargetY), 2.0)),
+    EXPECT_EQ(std::sqrt((kSourceX - kTargetX) * (kSourceX - kTargetX) +
+                        (kSourceY - kTargetY) * (kSourceY - kTargetY)),
               Point2D::CalculateDistance(source, target));
   }
 }
 
+TEST(GeometryPoint2D, CalculateSquaredDistance) {
+  static_assert(Point2D(0.0, 0.0).CalculateSquaredDistance(Point2D(3.0, 4.0)) ==
+                25.0);
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const auto kSourceX = static_cast<double>(std::rand());
+    const auto kSourceY = static_cast<double>(std::rand());
+    const auto kTargetX = static_cast<double>(std::rand());
+    const auto kTargetY = static_cast<double>(std::rand());
+
+    Point2D source(kSourceX, kSourceY);
+    Point2D target(kTargetX, kTargetY);
+
+    EXPECT_EQ((kSourceX - kTargetX) * (kSourceX - kTargetX) +
+                  (kSourceY - kTargetY) * (kSourceY - kTargetY),
+              source.CalculateSquaredDistance(target));
+    EXPECT_EQ(source.CalculateSquaredDistance(target),
+              Point2D::CalculateSquaredDistance(target, source));
+  }
+}
+
+TEST(GeometryPoint2D, IsWithin) {
+  static_assert(Point2D(0.0, 0.0).IsWithin(Point2D(3.0, 4.0), 5.0));
+  static_assert(!Point2D(0.0, 0.0).IsWithin(Point2D(3.0, 4.0), 4.999));
+  EXPECT_TRUE(Point2D().IsWithin(Point2D(), 0.0));
+  EXPECT_FALSE(Point2D().IsWithin(Point2D(), -1.0));
+  EXPECT_FALSE(Point2D().IsWithin(Point2D(),
+                                  std::numeric_limits<double>::quiet_NaN()));
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const Point2D kSource(static_cast<double>(std::rand()),
+                          static_cast<double>(std::rand()));
+    const Point2D kTarget(static_cast<double>(std::rand()),
+                          static_cast<double>(std::rand()));
+    const auto kRadius = static_cast<double>(std::rand());
+
+    EXPECT_EQ(kSource.CalculateDistance(kTarget) <= kRadius,
+              kSource.IsWithin(kTarget, kRadius));
+  }
+}
+
+TEST(GeometryPoint2D, CompareDistance) {
+  static_assert(Point2D::CompareDistance(Point2D(1.0, 0.0), Point2D(0.0, 2.0),
+                                         Point2D()) == -1);
+  static_assert(Point2D::CompareDistance(Point2D(1.0, 0.0), Point2D(0.0, 1.0),
+                                         Point2D()) == 0);
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const Point2D kLhs(static_cast<double>(std::rand()),
+                       static_cast<double>(std::rand()));
+    const Point2D kRhs(static_cast<double>(std::rand()),
+                       static_cast<double>(std::rand()));
+    const Point2D kOrigin(static_cast<double>(std::rand()),
+                          static_cast<double>(std::rand()));
+    const auto kLhsDistance = kLhs.CalculateDistance(kOrigin);
+    const auto kRhsDistance = kRhs.CalculateDistance(kOrigin);
+
+    EXPECT_EQ((kLhsDistance > kRhsDistance) - (kLhsDistance < kRhsDistance),
+              Point2D::CompareDistance(kLhs, kRhs, kOrigin));
+    EXPECT_EQ(Point2D::CompareDistance(kLhs, kRhs, kOrigin),
+              -Point2D::CompareDistance(kRhs, kLhs, kOrigin));
+  }
+}
+
+TEST(GeometryPoint2D, FloatPoint) {
+  static_assert(std::is_same_v<Point2D, BasicPoint2<double>>);
+  static_assert(sizeof(Point2F) == 2U * sizeof(float));
+  static_assert(std::is_convertible_v<Point2F, Point2D>);
+  static_assert(!std::is_convertible_v<Point2D, Point2F>);
+  static_assert(Point2F(0.0F, 0.0F).CalculateSquaredDistance(
+                    Point2F(3.0F, 4.0F)) == 25.0F);
+
+  // Widening is exact and narrowing rounds to nearest
+  constexpr Point2D kWide = Point2F(0.1F, -0.2F);
+  static_assert(kWide.GetX() == static_cast<double>(0.1F));
+  constexpr Point2F kNarrow(Point2D(0.1, 16777217.0));
+  static_assert(kNarrow.GetX() == 0.1F && kNarrow.GetY() == 16777216.0F);
+  static_assert(Point2F(kWide) == Point2F(0.1F, -0.2F));
+
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const Point2D kSource(static_cast<double>(std::rand() % 20001 - 10000),
+                          static_cast<double>(std::rand() % 20001 - 10000));
+    const Point2D kTarget(static_cast<double>(std::rand() % 20001 - 10000),
+                          static_cast<double>(std::rand() % 20001 - 10000));
+    const auto kExpected = kSource.CalculateDistance(kTarget);
+    const auto kDistance =
+        Point2F(kSource).CalculateDistance(Point2F(kTarget));
+
+    static_assert(std::is_same_v<decltype(kDistance), const float>);
+    EXPECT_NEAR(kDistance, kExpected, kExpected * 1e-6);
+  }
+}
+
 TEST(GeometryPoint2D, GetX) {
   for (uint32_t i = 0; i < kTestCount; ++i) {
     const auto kSourceX = static_cast<double>(std::rand());
@@ -0,0 +1,225 @@
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/point2i.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+#include "geometry/distance.hpp"
+#include "geometry/point2d.hpp"
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 1000U;
+}
+
+namespace Jeong0806::geometry {
+TEST(GeometryPoint2I, ValueType) {
+  static_assert(std::is_trivially_copyable_v<Point2I>);
+  static_assert(std::is_standard_layout_v<Point2I32>);
+  static_assert(Point2I::kTickNanometers == 1);
+  static_assert(Point2I32::kTickNanometers == 1000000);
+  static_assert(Point2I::kLimit == (int64_t{1} << 62) - 1);
+  static_assert(Point2I32::kLimit == (int32_t{1} << 30) - 1);
+  // The limit keeps every coordinate a valid Distance
+  static_assert(BasicPoint2I<int64_t, 1000>::kLimit ==
+                std::numeric_limits<int64_t>::max() / 1000);
+
+  constexpr Point2I32 kPoint(3, -4);
+  static_assert(kPoint.GetX() == 3);
+  static_assert(kPoint.GetY() == -4);
+  static_assert(kPoint.CalculateSquaredDistance(Point2I32()) ==
+                UInt128{0U, 25U});
+  EXPECT_EQ(Point2I(), Point2I(0, 0));
+}
+
+TEST(GeometryPoint2I, UInt128) {
+  constexpr auto kMax = std::numeric_limits<uint64_t>::max();
+  // (2^64 - 1)^2 = 2^128 - 2^65 + 1
+  static_assert(UInt128::Multiply(kMax, kMax) == UInt128{kMax - 1U, 1U});
+  static_assert(UInt128::Multiply(1ULL << 32U, 1ULL << 32U) ==
+                UInt128{1U, 0U});
+  static_assert(UInt128{0U, kMax} + UInt128{0U, 1U} == UInt128{1U, 0U});
+  EXPECT_LT(UInt128({0U, kMax}), UInt128({1U, 0U}));
+  EXPECT_GT(UInt128({1U, 0U}), UInt128({0U, kMax}));
+  EXPECT_LE(UInt128({1U, 0U}), UInt128({1U, 0U}));
+  EXPECT_GE(UInt128({1U, 1U}), UInt128({1U, 0U}));
+  EXPECT_NE(UInt128({1U, 1U}), UInt128({0U, 1U}));
+  EXPECT_DOUBLE_EQ(UInt128({1U, 0U}).ToDouble(), 18446744073709551616.0);
+
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const auto kLhs = static_cast<uint64_t>(std::rand());
+    const auto kRhs = static_cast<uint64_t>(std::rand());
+    EXPECT_EQ(UInt128::Multiply(kLhs, kRhs), UInt128({0U, kLhs * kRhs}));
+  }
+}
+
+TEST(GeometryPoint2I, FromDistances) {
+  // Halves round away from zero
+  EXPECT_EQ(Point2I32::FromDistances(Distance::FromNanometer(1500000),
+                                     Distance::FromNanometer(-1500000)),
+            Point2I32(2, -2));
+  EXPECT_EQ(Point2I32::FromDistances(Distance::FromNanometer(1499999),
+                                     Distance::FromNanometer(-1499999)),
+            Point2I32(1, -1));
+  EXPECT_EQ(Point2I32::FromDistances(Distance::FromNanometer(500000),
+                                     Distance::FromNanometer(-499999)),
+            Point2I32(1, 0));
+  EXPECT_EQ(Point2I::FromDistances(
+                Distance(1.5, Distance::DistanceType::kMeter),
+                Distance::FromNanometer(-7)),
+            Point2I(1500000000, -7));
+
+  const auto kLimit = Point2I32::kLimit * 1000000LL;
+  EXPECT_EQ(Point2I32::FromDistances(Distance::FromNanometer(kLimit),
+                                     Distance::FromNanometer(-kLimit)),
+            Point2I32(Point2I32::kLimit, -Point2I32::kLimit));
+  const auto kBeyond = kLimit + 500000LL;
+  EXPECT_THROW(static_cast<void>(Point2I32::FromDistances(
+                   Distance::FromNanometer(kBeyond), Distance())),
+               std::out_of_range);
+  EXPECT_THROW(static_cast<void>(Point2I32::FromDistances(
+                   Distance(), Distance::FromNanometer(-kBeyond))),
+               std::out_of_range);
+  EXPECT_THROW(static_cast<void>(Point2I::FromDistances(
+                   Distance::FromNanometer(std::numeric_limits<int64_t>::max()),
+                   Distance())),
+               std::out_of_range);
+}
+
+TEST(GeometryPoint2I, DistanceRoundTrip) {
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const auto kX = static_cast<int64_t>(std::rand()) * std::rand();
+    const auto kY = -static_cast<int64_t>(std::rand()) * std::rand();
+    const Point2I kPoint(kX, kY);
+    EXPECT_EQ(kPoint.GetXDistance().GetNanometer(), kX);
+    EXPECT_EQ(kPoint.GetYDistance().GetNanometer(), kY);
+    EXPECT_EQ(
+        Point2I::FromDistances(kPoint.GetXDistance(), kPoint.GetYDistance()),
+        kPoint);
+
+    const Point2I32 kPoint32(std::rand() % Point2I32::kLimit,
+                             -(std::rand() % Point2I32::kLimit));
+    EXPECT_EQ(kPoint32.GetXDistance().GetNanometer(),
+              kPoint32.GetX() * 1000000LL);
+    EXPECT_EQ(Point2I32::FromDistances(kPoint32.GetXDistance(),
+                                       kPoint32.GetYDistance()),
+              kPoint32);
+  }
+}
+
+TEST(GeometryPoint2I, FromPoint) {
+  EXPECT_EQ(Point2I32::FromPoint(Point2D(1.0625, -2.0625),
+                                 Distance::DistanceType::kMeter),
+            Point2I32(1063, -2063));
+  EXPECT_EQ(Point2I32::FromPoint(Point2D(0.4, -0.6),
+                                 Distance::DistanceType::kMillimeter),
+            Point2I32(0, -1));
+  EXPECT_EQ(Point2I::FromPoint(Point2D(12.5, -3.25),
+                               Distance::DistanceType::kMicrometer),
+            Point2I(12500, -3250));
+
+  const auto kPoint = Point2I32(1234567, -7654321);
+  const auto kMeters = kPoint.ToPoint(Distance::DistanceType::kMeter);
+  EXPECT_DOUBLE_EQ(kMeters.GetX(), 1234.567);
+  EXPECT_DOUBLE_EQ(kMeters.GetY(), -7654.321);
+  EXPECT_EQ(Point2I32::FromPoint(kMeters, Distance::DistanceType::kMeter),
+            kPoint);
+
+  EXPECT_THROW(static_cast<void>(Point2I32::FromPoint(
+                   Point2D(1.1e+3, 0.0), Distance::DistanceType::kKilometer)),
+               std::out_of_range);
+  EXPECT_THROW(static_cast<void>(Point2I::FromPoint(
+                   Point2D(std::numeric_limits<double>::quiet_NaN(), 0.0),
+                   Distance::DistanceType::kMeter)),
+               std::out_of_range);
+  EXPECT_THROW(static_cast<void>(Point2I::FromPoint(
+                   Point2D(0.0, std::numeric_limits<double>::infinity()),
+                   Distance::DistanceType::kMeter)),
+               std::out_of_range);
+}
+
+TEST(GeometryPoint2I, SquaredDistance) {
+  // Differences of 2^63 - 2 still square exactly
+  constexpr auto kLimit = Point2I::kLimit;
+  const Point2I kLow(-kLimit, -kLimit);
+  const Point2I kHigh(kLimit, kLimit);
+  const auto kDifference = static_cast<uint64_t>(kLimit) * 2U;
+  const auto kSquared = UInt128::Multiply(kDifference, kDifference);
+  EXPECT_EQ(kLow.CalculateSquaredDistance(kHigh), kSquared + kSquared);
+  EXPECT_EQ(Point2I::CalculateSquaredDistance(kHigh, kLow),
+            kSquared + kSquared);
+
+  // Doubles can not tell these apart, the integers can
+  const Point2I kOrigin(0, 0);
+  const Point2I kFar(1LL << 53, 0);
+  const Point2I kFarther((1LL << 53) + 1, 0);
+  EXPECT_EQ(Point2I::CompareDistance(kFar, kFarther, kOrigin), -1);
+  EXPECT_EQ(Point2I::CompareDistance(kFarther, kFar, kOrigin), 1);
+  EXPECT_EQ(Point2I::CompareDistance(kFar, Point2I(0, -(1LL << 53)), kOrigin),
+            0);
+
+  EXPECT_TRUE(kOrigin.IsWithin(Point2I(3, 4), 5));
+  EXPECT_FALSE(kOrigin.IsWithin(Point2I(3, 4), 4));
+  EXPECT_FALSE(kOrigin.IsWithin(kOrigin, -1));
+  // The diagonal of the range is longer than the largest radius
+  EXPECT_FALSE(kLow.IsWithin(kHigh, std::numeric_limits<int64_t>::max()));
+  EXPECT_TRUE(kLow.IsWithin(Point2I(kLimit, -kLimit),
+                            std::numeric_limits<int64_t>::max()));
+}
+
+TEST(GeometryPoint2I, Operator) {
+  const Point2I32 kPoint(1, 2);
+  EXPECT_EQ(kPoint, Point2I32(1, 2));
+  EXPECT_NE(kPoint, Point2I32(2, 1));
+  EXPECT_LT(kPoint, Point2I32(1, 3));
+  EXPECT_LT(kPoint, Point2I32(2, 0));
+  EXPECT_FALSE(kPoint < kPoint);
+
+  auto point = kPoint;
+  point.SetX(-5);
+  point.SetY(7);
+  EXPECT_EQ(point, Point2I32(-5, 7));
+
+  // Coordinates past kLimit would overflow the exact distances
+  EXPECT_THROW(Point2I(std::numeric_limits<int64_t>::max(), 0),
+               std::out_of_range);
+  EXPECT_THROW(Point2I32(0, -Point2I32::kLimit - 1), std::out_of_range);
+  EXPECT_THROW(point.SetX(Point2I32::kLimit + 1), std::out_of_range);
+  EXPECT_THROW(point.SetY(std::numeric_limits<int32_t>::min()),
+               std::out_of_range);
+  EXPECT_EQ(point, Point2I32(-5, 7));
+}
+
+TEST(GeometryPoint2I, Deduplicate) {
+  // Coordinates 0.4 mm apart snap to the same cell and hash equally
+  std::unordered_set<Point2I32> snapped;
+  std::vector<Point2I32> unique;
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const auto kX = std::rand() % 100;
+    const auto kY = std::rand() % 100;
+    const auto kPoint = Point2I32::FromPoint(
+        Point2D(kX + (0.4 * (i % 2U)), kY - (0.4 * (i % 3U == 0U))),
+        Distance::DistanceType::kMillimeter);
+    EXPECT_EQ(kPoint, Point2I32(kX, kY));
+    if (snapped.insert(kPoint).second) {
+      unique.push_back(kPoint);
+    }
+  }
+  EXPECT_EQ(snapped.size(), unique.size());
+  for (const auto& kPoint : unique) {
+    EXPECT_EQ(snapped.count(kPoint), 1U);
+    EXPECT_EQ(std::hash<Point2I32>()(kPoint),
+              std::hash<Point2I32>()(Point2I32(kPoint.GetX(), kPoint.GetY())));
+  }
+  EXPECT_NE(std::hash<Point2I>()(Point2I(1, 2)),
+            std::hash<Point2I>()(Point2I(2, 1)));
+}
+}  // namespace Jeong0806::geometry
@@ -0,0 +1,173 @@
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/point_cloud2d.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "random_points.hpp"
+
+namespace {
+constexpr uint32_t kTestCount = 1000U;
+constexpr double kRange = RAND_MAX;
+
+using Jeong0806::geometry::test_helper::MakeRandomPoints;
+}  // namespace
+
+namespace Jeong0806::geometry {
+TEST(GeometryPointCloud2D, Constructor) {
+  PointCloud2D cloud1;
+  EXPECT_TRUE(cloud1.Empty());
+
+  PointCloud2D cloud2(kTestCount);
+  EXPECT_EQ(cloud2.Size(), kTestCount);
+  EXPECT_EQ(cloud2.GetPoint(0), Point2D());
+
+  const auto kPoints = MakeRandomPoints(kTestCount, kRange);
+  PointCloud2D cloud3(kPoints);
+  EXPECT_EQ(cloud3.Size(), kPoints.size());
+  PointCloud2D cloud4(kPoints.data(), kPoints.size());
+  EXPECT_EQ(cloud4.Size(), kPoints.size());
+}
+
+TEST(GeometryPointCloud2D, Alignment) {
+  PointCloud2D cloud(kTestCount);
+
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(cloud.GetXData()) % kSimdAlignment,
+            0U);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(cloud.GetYData()) % kSimdAlignment,
+            0U);
+}
+
+TEST(GeometryPointCloud2D, ToPoints) {
+  const auto kPoints = MakeRandomPoints(kTestCount, kRange);
+  PointCloud2D cloud(kPoints);
+
+  EXPECT_EQ(cloud.ToPoints(), kPoints);
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    EXPECT_EQ(cloud.GetXData()[i], kPoints[i].GetX());
+    EXPECT_EQ(cloud.GetYData()[i], kPoints[i].GetY());
+  }
+}
+
+TEST(GeometryPointCloud2D, PushBackAndSetPoint) {
+  PointCloud2D cloud;
+  cloud.PushBack(Point2D(1.0, 2.0));
+  cloud.SetPoint(0, Point2D(3.0, 4.0));
+
+  EXPECT_EQ(cloud.GetPoint(0), Point2D(3.0, 4.0));
+  EXPECT_THROW(static_cast<void>(cloud.GetPoint(1)), std::out_of_range);
+  EXPECT_THROW(cloud.SetPoint(1, Point2D()), std::out_of_range);
+}
+
+TEST(GeometryPointCloud2D, CalculateDistances) {
+  const auto kPoints = MakeRandomPoints(kTestCount, kRange);
+  const Point2D kOrigin(static_cast<double>(std::rand()),
+                        static_cast<double>(std::rand()));
+  PointCloud2D cloud(kPoints);
+
+  const auto kDistances = cloud.CalculateDistances(kOrigin);
+  const auto kSquaredDistances = cloud.CalculateSquaredDistances(kOrigin);
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const auto kExpected = Point2D::CalculateDistance(kPoints[i], kOrigin);
+    EXPECT_DOUBLE_EQ(kDistances[i], kExpected);
+    EXPECT_DOUBLE_EQ(kSquaredDistances[i], kExpected * kExpected);
+  }
+}
+
+TEST(GeometryPointCloud2D, CalculatePairwiseDistances) {
+  const auto kLhsPoints = MakeRandomPoints(kTestCount, kRange);
+  const auto kRhsPoints = MakeRandomPoints(kTestCount, kRange);
+  PointCloud2D lhs(kLhsPoints);
+  PointCloud2D rhs(kRhsPoints);
+
+  const auto kDistances = PointCloud2D::CalculatePairwiseDistances(lhs, rhs);
+  const auto kSquaredDistances =
+      PointCloud2D::CalculatePairwiseSquaredDistances(lhs, rhs);
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const auto kExpected =
+        Point2D::CalculateDistance(kLhsPoints[i], kRhsPoints[i]);
+    EXPECT_DOUBLE_EQ(kDistances[i], kExpected);
+    EXPECT_DOUBLE_EQ(kSquaredDistances[i], kExpected * kExpected);
+  }
+
+  PointCloud2D shorter(kTestCount - 1U);
+  EXPECT_THROW(PointCloud2D::CalculatePairwiseDistances(lhs, shorter),
+               std::invalid_argument);
+}
+
+TEST(GeometryPointCloud2D, IsWithin) {
+  const auto kPoints = MakeRandomPoints(kTestCount, kRange);
+  const Point2D kOrigin(static_cast<double>(std::rand()),
+                        static_cast<double>(std::rand()));
+  const auto kRadius = static_cast<double>(RAND_MAX / 2);
+  PointCloud2D cloud(kPoints);
+
+  const auto kFlags = cloud.IsWithin(kOrigin, kRadius);
+  std::vector<uint8_t> flags(kTestCount);
+  std::size_t expected_count = 0;
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const auto kExpected = kPoints[i].IsWithin(kOrigin, kRadius);
+    EXPECT_EQ(kFlags[i], kExpected ? 1U : 0U);
+    expected_count += kExpected ? 1U : 0U;
+  }
+  EXPECT_EQ(cloud.IsWithin(kOrigin, kRadius, flags.data()), expected_count);
+  EXPECT_EQ(flags, kFlags);
+}
+
+TEST(GeometryPointCloud2D, CompareDistances) {
+  const auto kLhsPoints = MakeRandomPoints(kTestCount, kRange);
+  const auto kRhsPoints = MakeRandomPoints(kTestCount, kRange);
+  const Point2D kOrigin(static_cast<double>(std::rand()),
+                        static_cast<double>(std::rand()));
+  PointCloud2D lhs(kLhsPoints);
+  PointCloud2D rhs(kRhsPoints);
+
+  const auto kResults = PointCloud2D::CompareDistances(lhs, rhs, kOrigin);
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    EXPECT_EQ(kResults[i],
+              Point2D::CompareDistance(kLhsPoints[i], kRhsPoints[i], kOrigin));
+  }
+  EXPECT_EQ(PointCloud2D::CompareDistances(lhs, lhs, kOrigin),
+            std::vector<int8_t>(kTestCount, 0));
+
+  PointCloud2D shorter(kTestCount - 1U);
+  EXPECT_THROW(PointCloud2D::CompareDistances(lhs, shorter, kOrigin),
+               std::invalid_argument);
+}
+
+TEST(GeometryPointCloud2D, FloatCloud) {
+  const auto kPoints = MakeRandomPoints(kTestCount, kRange);
+  const Point2F kOrigin(static_cast<float>(std::rand()),
+                        static_cast<float>(std::rand()));
+  const PointCloud2D kWide(kPoints);
+  const PointCloud2F kCloud(kWide);
+  EXPECT_EQ(kCloud.Size(), kTestCount);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(kCloud.GetXData()) % kSimdAlignment,
+            0U);
+
+  const auto kDistances = kCloud.CalculateDistances(kOrigin);
+  const auto kFlags = kCloud.IsWithin(kOrigin, RAND_MAX / 2);
+  const auto kResults = PointCloud2F::CompareDistances(kCloud, kCloud, kOrigin);
+  const auto kWideDistances = kWide.CalculateDistances(kOrigin);
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const auto kPoint = Point2F(kPoints[i]);
+    EXPECT_EQ(kCloud.GetPoint(i), kPoint);
+    EXPECT_EQ(kDistances[i], kPoint.CalculateDistance(kOrigin));
+    EXPECT_EQ(kFlags[i], kPoint.IsWithin(kOrigin, RAND_MAX / 2) ? 1U : 0U);
+    EXPECT_EQ(kResults[i], 0);
+    EXPECT_NEAR(kDistances[i], kWideDistances[i], kWideDistances[i] * 1e-6);
+  }
+
+  // Widening back is exact
+  const PointCloud2D kRoundTrip(kCloud);
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    EXPECT_EQ(kRoundTrip.GetPoint(i), Point2D(kCloud.GetPoint(i)));
+  }
+}
+}  // namespace Jeong0806::geometry
@@ -0,0 +1,139 @@
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/point_file.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "geometry/distance_kernels.hpp"
+#include "gtest/gtest.h"
+#include "random_points.hpp"
+
+namespace {
+// Spans several writer chunks and ends with a partial one
+constexpr uint32_t kPointCount = 10000U;
+constexpr double kRange = 1000.0;
+
+using Jeong0806::geometry::test_helper::MakeRandomPoints;
+
+auto MakePath(const std::string& name) -> std::string {
+  return ::testing::TempDir() + "geometry_point_file_" + name + ".bin";
+}
+}  // namespace
+
+namespace Jeong0806::geometry {
+TEST(GeometryPointFile, RoundTrip) {
+  const auto kPath = MakePath("round_trip");
+  const auto kPoints = MakeRandomPoints(kPointCount, kRange);
+  {
+    PointFileWriter writer(kPath, kPoints.size(),
+                           Distance::DistanceType::kKilometer, true);
+    writer.Push(kPoints.data(), kPoints.size() / 2U);
+    for (auto i = kPoints.size() / 2U; i < kPoints.size(); ++i) {
+      writer.Push(kPoints[i]);
+    }
+    writer.Close();
+  }
+
+  const PointFileReader kReader(kPath, true);
+  ASSERT_EQ(kReader.Size(), kPoints.size());
+  EXPECT_EQ(kReader.GetUnit(), Distance::DistanceType::kKilometer);
+  EXPECT_TRUE(kReader.HasNanometers());
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(kReader.GetXData()) %
+                kPointFileAlignment,
+            0U);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(kReader.GetYData()) %
+                kPointFileAlignment,
+            0U);
+  for (std::size_t i = 0; i < kPoints.size(); ++i) {
+    EXPECT_EQ(kReader.GetPoint(i), kPoints[i]);
+    EXPECT_EQ(kReader.GetXNanometerData()[i],
+              Distance(kPoints[i].GetX(), Distance::DistanceType::kKilometer)
+                  .GetNanometer());
+    EXPECT_EQ(kReader.GetYNanometerData()[i],
+              Distance(kPoints[i].GetY(), Distance::DistanceType::kKilometer)
+                  .GetNanometer());
+  }
+  EXPECT_THROW(static_cast<void>(kReader.GetPoint(kPoints.size())),
+               std::out_of_range);
+
+  const PointCloud2D kCloud(kPoints);
+  EXPECT_EQ(kReader.ToPointCloud().ToPoints(), kPoints);
+  std::remove(kPath.c_str());
+}
+
+TEST(GeometryPointFile, ZeroCopyKernel) {
+  const auto kPath = MakePath("zero_copy");
+  const PointCloud2D kCloud(MakeRandomPoints(kPointCount, kRange));
+  PointFileWriter::Write(kPath, kCloud);
+
+  PointFileReader reader(kPath);
+  EXPECT_FALSE(reader.HasNanometers());
+  EXPECT_EQ(reader.GetXNanometerData(), nullptr);
+  const Point2D kOrigin(kRange / 2.0, kRange / 3.0);
+  std::vector<double> mapped(reader.Size());
+  kernel::CalculateDistances(reader.GetXData(), reader.GetYData(),
+                             reader.Size(), kOrigin.GetX(), kOrigin.GetY(),
+                             mapped.data());
+  EXPECT_EQ(mapped, kCloud.CalculateDistances(kOrigin));
+
+  const auto kMoved = std::move(reader);
+  EXPECT_EQ(kMoved.Size(), kCloud.Size());
+  EXPECT_EQ(reader.Size(), 0U);
+  std::remove(kPath.c_str());
+}
+
+TEST(GeometryPointFile, Empty) {
+  const auto kPath = MakePath("empty");
+  PointFileWriter::Write(kPath, PointCloud2D());
+  const PointFileReader kReader(kPath, true);
+  EXPECT_EQ(kReader.Size(), 0U);
+  EXPECT_TRUE(kReader.ToPointCloud().Empty());
+  std::remove(kPath.c_str());
+}
+
+TEST(GeometryPointFile, Invalid) {
+  const auto kPath = MakePath("invalid");
+  EXPECT_THROW(PointFileReader{MakePath("missing")}, std::runtime_error);
+
+  {
+    PointFileWriter writer(kPath, 2U);
+    writer.Push(Point2D(1.0, 2.0));
+    writer.Push(Point2D(3.0, 4.0));
+    EXPECT_THROW(writer.Push(Point2D(5.0, 6.0)), std::length_error);
+  }
+  EXPECT_NO_THROW(static_cast<void>(PointFileReader(kPath, true)));
+
+  {
+    PointFileWriter writer(kPath, 2U);
+    writer.Push(Point2D(1.0, 2.0));
+    EXPECT_THROW(writer.Close(), std::runtime_error);
+  }
+  // Incomplete files keep the zero magic
+  EXPECT_THROW(PointFileReader{kPath}, std::runtime_error);
+
+  PointFileWriter::Write(kPath,
+                         PointCloud2D(MakeRandomPoints(kPointCount, kRange)));
+  {
+    std::fstream file(kPath, std::ios::binary | std::ios::in | std::ios::out);
+    file.seekp(static_cast<std::streamoff>(sizeof(PointFileHeader)) + 3);
+    file.put('\x7F');
+  }
+  EXPECT_FALSE(PointFileReader(kPath).Verify());
+  EXPECT_THROW(static_cast<void>(PointFileReader(kPath, true)),
+               std::runtime_error);
+
+  {
+    std::ofstream file(kPath, std::ios::binary | std::ios::trunc);
+    file << "x,y\n1.0,2.0\n";
+  }
+  EXPECT_THROW(PointFileReader{kPath}, std::runtime_error);
+  std::remove(kPath.c_str());
+}
+}  // namespace Jeong0806::geometry
@@ -0,0 +1,221 @@
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/point_parser.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "random_points.hpp"
+
+namespace {
+// Several chunks of PointParser::kMinChunkSize
+constexpr uint32_t kPointCount = 50000U;
+constexpr double kRange = 1000.0;
+
+using Jeong0806::geometry::test_helper::MakeRandomPoints;
+
+auto GetMessage(const std::function<void()>& parse) -> std::string {
+  try {
+    parse();
+  } catch (const std::invalid_argument& error) {
+    return error.what();
+  }
+  return "";
+}
+}  // namespace
+
+namespace Jeong0806::geometry {
+TEST(GeometryPointParser, ParseDistance) {
+  EXPECT_EQ(PointParser::ParseDistance("12.5km"),
+            Distance(12.5, Distance::DistanceType::kKilometer));
+  EXPECT_EQ(PointParser::ParseDistance(" 300m "), Distance(300.0));
+  EXPECT_EQ(PointParser::ParseDistance("-4cm"),
+            Distance(-4.0, Distance::DistanceType::kCentimeter));
+  EXPECT_EQ(PointParser::ParseDistance("+7mm"),
+            Distance(7.0, Distance::DistanceType::kMillimeter));
+  EXPECT_EQ(PointParser::ParseDistance("3um"),
+            PointParser::ParseDistance("3\xC2\xB5m"));
+  EXPECT_EQ(PointParser::ParseDistance("1e3nm").GetNanometer(), 1000);
+  EXPECT_EQ(PointParser::ParseDistance("2", Distance::DistanceType::kKilometer),
+            Distance(2.0, Distance::DistanceType::kKilometer));
+
+  for (const auto* text : {"", "km", "1.5 km", "1.5ft", "1.5m2", "nan", "inf",
+                           "+-1", "1,5"}) {
+    EXPECT_THROW(static_cast<void>(PointParser::ParseDistance(text)),
+                 std::invalid_argument)
+        << text;
+  }
+  EXPECT_THROW(static_cast<void>(PointParser::ParseDistance("1e10km")),
+               std::out_of_range);
+}
+
+TEST(GeometryPointParser, ParseCsv) {
+  const auto kPoints =
+      PointParser::ParseCsv("1,2\n\n 3.5 , -4e1 \r\n\"5\",6km\r\n  \n7mm,8");
+  ASSERT_EQ(kPoints.Size(), 4U);
+  EXPECT_EQ(kPoints.GetPoint(0), Point2D(1.0, 2.0));
+  EXPECT_EQ(kPoints.GetPoint(1), Point2D(3.5, -40.0));
+  EXPECT_EQ(kPoints.GetPoint(2), Point2D(5.0, 6000.0));
+  EXPECT_EQ(kPoints.GetPoint(3), Point2D(0.007, 8.0));
+
+  CsvFormat format;
+  format.delimiter = ';';
+  format.x_column = 2U;
+  format.y_column = 0U;
+  format.has_header = true;
+  const auto kColumns = PointParser::ParseCsv(
+      "y;name;x\n1;a;2;extra\n3;b;4\n", format,
+      Distance::DistanceType::kKilometer);
+  ASSERT_EQ(kColumns.Size(), 2U);
+  EXPECT_EQ(kColumns.GetPoint(0), Point2D(2.0, 1.0));
+  EXPECT_EQ(kColumns.GetPoint(1), Point2D(4.0, 3.0));
+  EXPECT_EQ(PointParser::ParseCsv("5m,1\n", CsvFormat(),
+                                  Distance::DistanceType::kKilometer)
+                .GetPoint(0),
+            Point2D(0.005, 1.0));
+
+  EXPECT_TRUE(PointParser::ParseCsv("").Empty());
+  EXPECT_TRUE(PointParser::ParseCsv("x,y", format).Empty());
+}
+
+TEST(GeometryPointParser, ParseCsvInvalid) {
+  EXPECT_EQ(GetMessage([] {
+              static_cast<void>(PointParser::ParseCsv("1,2\n\n3\n"));
+            }),
+            "Invalid CSV at line 3: missing column");
+  EXPECT_EQ(GetMessage([] {
+              static_cast<void>(PointParser::ParseCsv("1,2\n3,4x\n"));
+            }),
+            "Invalid CSV at line 2: unknown unit");
+  EXPECT_EQ(GetMessage([] {
+              static_cast<void>(PointParser::ParseCsv("1,2 3\n"));
+            }),
+            "Invalid CSV at line 1: invalid number");
+  EXPECT_THROW(static_cast<void>(PointParser::ParseCsv("1,\n")),
+               std::invalid_argument);
+  EXPECT_THROW(static_cast<void>(PointParser::ParseCsvFile("missing.csv")),
+               std::runtime_error);
+}
+
+TEST(GeometryPointParser, ParseCsvParallel) {
+  const auto kPoints = MakeRandomPoints(kPointCount, kRange, -kRange / 2.0);
+  std::ostringstream stream;
+  stream.precision(17);
+  for (std::size_t i = 0; i < kPoints.size(); ++i) {
+    stream << kPoints[i].GetX() << ',' << kPoints[i].GetY() << '\n';
+    if (i % 1000U == 0U) {
+      stream << '\n';
+    }
+  }
+  const auto kText = stream.str();
+  ASSERT_GT(kText.size(), 4U * PointParser::kMinChunkSize);
+  EXPECT_EQ(PointParser::ParseCsv(kText, CsvFormat(),
+                                  Distance::DistanceType::kMeter, 1U)
+                .ToPoints(),
+            kPoints);
+  EXPECT_EQ(PointParser::ParseCsv(kText, CsvFormat(),
+                                  Distance::DistanceType::kMeter, 4U)
+                .ToPoints(),
+            kPoints);
+
+  auto invalid = kText;
+  invalid[invalid.size() / 2U] = '?';
+  const auto kLine =
+      std::count(invalid.begin(), invalid.begin() + invalid.size() / 2U,
+                 '\n') +
+      1;
+  EXPECT_EQ(GetMessage([&invalid] {
+              static_cast<void>(PointParser::ParseCsv(
+                  invalid, CsvFormat(), Distance::DistanceType::kMeter, 4U));
+            })
+                .rfind("Invalid CSV at line " + std::to_string(kLine) + ":",
+                       0),
+            0U);
+
+  const auto kPath = ::testing::TempDir() + "geometry_point_parser.csv";
+  std::ofstream(kPath) << kText;
+  EXPECT_EQ(PointParser::ParseCsvFile(kPath).ToPoints(), kPoints);
+  std::remove(kPath.c_str());
+}
+
+TEST(GeometryPointParser, ParseWkt) {
+  const auto kGeometries = PointParser::ParseWkt(
+      "POINT (1 2)\n"
+      "\n"
+      "linestring(0 0, 1km 1, 2 -2)\r\n"
+      "MultiPoint ((1 1), (2 2))\n"
+      "MULTIPOINT (3 3, 4 4)\n"
+      "POINT EMPTY\n");
+  ASSERT_EQ(kGeometries.types.size(), 5U);
+  EXPECT_EQ(kGeometries.types,
+            (std::vector<WktType>{WktType::kPoint, WktType::kLineString,
+                                  WktType::kMultiPoint, WktType::kMultiPoint,
+                                  WktType::kPoint}));
+  EXPECT_EQ(kGeometries.offsets,
+            (std::vector<std::size_t>{0U, 1U, 4U, 6U, 8U, 8U}));
+  EXPECT_EQ(kGeometries.points.ToPoints(),
+            (std::vector<Point2D>{Point2D(1.0, 2.0), Point2D(0.0, 0.0),
+                                  Point2D(1000.0, 1.0), Point2D(2.0, -2.0),
+                                  Point2D(1.0, 1.0), Point2D(2.0, 2.0),
+                                  Point2D(3.0, 3.0), Point2D(4.0, 4.0)}));
+
+  const auto kEmpty = PointParser::ParseWkt("");
+  EXPECT_TRUE(kEmpty.points.Empty());
+  EXPECT_EQ(kEmpty.offsets, std::vector<std::size_t>{0U});
+}
+
+TEST(GeometryPointParser, ParseWktInvalid) {
+  EXPECT_EQ(GetMessage([] {
+              static_cast<void>(PointParser::ParseWkt("POINT (1 2)\nPOLYGON"));
+            }),
+            "Invalid WKT at line 2: unsupported geometry type");
+  EXPECT_EQ(GetMessage([] {
+              static_cast<void>(PointParser::ParseWkt("POINT (1 2 3)"));
+            }),
+            "Invalid WKT at line 1: only 2-dimensional points are supported");
+  for (const auto* text : {"POINT 1 2", "POINT (1 2", "POINT (12)",
+                           "POINTS (1 2)", "POINT (1 2) x",
+                           "LINESTRING (1 2,)"}) {
+    EXPECT_THROW(static_cast<void>(PointParser::ParseWkt(text)),
+                 std::invalid_argument)
+        << text;
+  }
+}
+
+TEST(GeometryPointParser, ParseWktParallel) {
+  const auto kPoints = MakeRandomPoints(kPointCount, kRange, -kRange / 2.0);
+  std::ostringstream stream;
+  stream.precision(17);
+  std::vector<std::size_t> offsets{0U};
+  for (std::size_t i = 0; i < kPoints.size();) {
+    const auto kCount =
+        std::min<std::size_t>(1U + (i % 5U), kPoints.size() - i);
+    stream << "LINESTRING (";
+    for (std::size_t j = 0; j < kCount; ++j, ++i) {
+      stream << (j == 0U ? "" : ", ") << kPoints[i].GetX() << ' '
+             << kPoints[i].GetY();
+    }
+    stream << ")\n";
+    offsets.push_back(i);
+  }
+  const auto kText = stream.str();
+  const auto kSerial =
+      PointParser::ParseWkt(kText, Distance::DistanceType::kMeter, 1U);
+  const auto kParallel =
+      PointParser::ParseWkt(kText, Distance::DistanceType::kMeter, 4U);
+  EXPECT_EQ(kSerial.points.ToPoints(), kPoints);
+  EXPECT_EQ(kSerial.offsets, offsets);
+  EXPECT_EQ(kParallel.points.ToPoints(), kPoints);
+  EXPECT_EQ(kParallel.offsets, offsets);
+  EXPECT_EQ(kParallel.types, kSerial.types);
+}
+}  // namespace Jeong0806::geometry
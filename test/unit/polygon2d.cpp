@@ -0,0 +1,101 @@
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/polygon2d.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <memory_resource>
+#include <stdexcept>
+#include <vector>
+
+#include "geometry/memory_resource.hpp"
+#include "gtest/gtest.h"
+
+namespace {
+using Jeong0806::geometry::CountingMemoryResource;
+using Jeong0806::geometry::Point2D;
+using Jeong0806::geometry::Polygon2D;
+
+auto MakeSquare(double min, double max) -> std::vector<Point2D> {
+  return {Point2D(min, min), Point2D(max, min), Point2D(max, max),
+          Point2D(min, max)};
+}
+}  // namespace
+
+TEST(GeometryPolygon2D, Construct) {
+  const Polygon2D kEmpty;
+  EXPECT_TRUE(kEmpty.Empty());
+  EXPECT_EQ(kEmpty.GetRingCount(), 0U);
+  EXPECT_FALSE(kEmpty.Contains(Point2D(0.0, 0.0)));
+
+  // The repeated first point is dropped
+  auto ring = MakeSquare(-1.0, 2.0);
+  ring.push_back(ring.front());
+  const Polygon2D kPolygon({ring, MakeSquare(0.0, 1.0)});
+  EXPECT_FALSE(kPolygon.Empty());
+  EXPECT_EQ(kPolygon.GetRingCount(), 2U);
+  EXPECT_EQ(kPolygon.GetEdgeCount(), 8U);
+  EXPECT_EQ(kPolygon.GetRingOffsets(),
+            (std::pmr::vector<uint32_t>{0U, 4U, 8U}));
+  EXPECT_EQ(kPolygon.GetMin(), Point2D(-1.0, -1.0));
+  EXPECT_EQ(kPolygon.GetMax(), Point2D(2.0, 2.0));
+
+  EXPECT_THROW(Polygon2D({Point2D(0.0, 0.0), Point2D(1.0, 0.0)}),
+               std::invalid_argument);
+  EXPECT_THROW(Polygon2D({Point2D(0.0, 0.0), Point2D(1.0, 0.0),
+                          Point2D(0.0, 0.0)}),
+               std::invalid_argument);
+  EXPECT_THROW(
+      Polygon2D({Point2D(0.0, 0.0), Point2D(1.0, 0.0),
+                 Point2D(0.0, std::numeric_limits<double>::quiet_NaN())}),
+      std::invalid_argument);
+}
+
+TEST(GeometryPolygon2D, Contains) {
+  // A square with a square hole, the hole wound the same way
+  const Polygon2D kPolygon({MakeSquare(0.0, 4.0), MakeSquare(1.0, 3.0)});
+  EXPECT_TRUE(kPolygon.Contains(Point2D(0.5, 0.5)));
+  EXPECT_TRUE(kPolygon.Contains(Point2D(3.5, 2.0)));
+  EXPECT_FALSE(kPolygon.Contains(Point2D(2.0, 2.0)));
+  EXPECT_FALSE(kPolygon.Contains(Point2D(5.0, 2.0)));
+  EXPECT_FALSE(kPolygon.Contains(Point2D(-0.5, 2.0)));
+
+  // Rays through vertices count them once
+  const Polygon2D kDiamond({Point2D(0.0, -2.0), Point2D(2.0, 0.0),
+                            Point2D(0.0, 2.0), Point2D(-2.0, 0.0)});
+  EXPECT_TRUE(kDiamond.Contains(Point2D(-1.0, 0.0)));
+  EXPECT_TRUE(kDiamond.Contains(Point2D(0.0, 1.0)));
+  EXPECT_FALSE(kDiamond.Contains(Point2D(-3.0, 0.0)));
+  EXPECT_FALSE(kDiamond.Contains(Point2D(1.5, 1.5)));
+
+  // A concave polygon whose notch the ray crosses
+  const Polygon2D kNotch({Point2D(0.0, 0.0), Point2D(4.0, 0.0),
+                          Point2D(4.0, 4.0), Point2D(2.0, 1.0),
+                          Point2D(0.0, 4.0)});
+  EXPECT_TRUE(kNotch.Contains(Point2D(0.5, 3.0)));
+  EXPECT_TRUE(kNotch.Contains(Point2D(3.5, 3.0)));
+  EXPECT_FALSE(kNotch.Contains(Point2D(2.0, 3.0)));
+  EXPECT_TRUE(kNotch.Contains(Point2D(2.0, 0.5)));
+}
+
+TEST(GeometryPolygon2D, Resource) {
+  CountingMemoryResource counting;
+  {
+    const Polygon2D kPolygon({MakeSquare(0.0, 4.0), MakeSquare(1.0, 3.0)},
+                             &counting);
+    EXPECT_EQ(kPolygon.GetResource(), &counting);
+    EXPECT_GT(counting.GetBytesInUse(), 0U);
+
+    // Copies go back to the default resource unless a container gives one
+    const auto kCopy = kPolygon;
+    EXPECT_EQ(kCopy.GetResource(), std::pmr::get_default_resource());
+    std::pmr::vector<Polygon2D> polygons(&counting);
+    polygons.push_back(kCopy);
+    EXPECT_EQ(polygons.front().GetResource(), &counting);
+    EXPECT_EQ(polygons.front().GetPoints(), kPolygon.GetPoints());
+    EXPECT_EQ(polygons.front().GetRingOffsets(), kPolygon.GetRingOffsets());
+    EXPECT_TRUE(polygons.front().Contains(Point2D(0.5, 0.5)));
+  }
+  EXPECT_EQ(counting.GetBytesInUse(), 0U);
+}
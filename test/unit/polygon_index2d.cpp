@@ -0,0 +1,155 @@
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/polygon_index2d.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kZoneCount = 60U;
+constexpr uint32_t kQueryCount = 20000U;
+constexpr uint32_t kTileCount = 10U;
+constexpr double kRange = 1000.0;
+constexpr double kTwoPi = 6.283185307179586;
+
+using Jeong0806::geometry::Point2D;
+using Jeong0806::geometry::PointCloud2D;
+using Jeong0806::geometry::Polygon2D;
+using Jeong0806::geometry::PolygonIndex2D;
+
+auto Random(double range) -> double {
+  return range * std::rand() / RAND_MAX;
+}
+
+// A jagged ring around a center, star shaped so it never crosses itself
+auto MakeStar(const Point2D& center, double radius, uint32_t count)
+    -> std::vector<Point2D> {
+  std::vector<Point2D> ring;
+  for (uint32_t i = 0; i < count; ++i) {
+    const auto kAngle = kTwoPi * i / count;
+    const auto kRadius = radius * (0.3 + Random(0.7));
+    ring.emplace_back(center.GetX() + (kRadius * std::cos(kAngle)),
+                      center.GetY() + (kRadius * std::sin(kAngle)));
+  }
+  return ring;
+}
+
+auto BruteForce(const std::vector<Polygon2D>& zones, const Point2D& point)
+    -> uint32_t {
+  for (uint32_t zone = 0; zone < zones.size(); ++zone) {
+    if (zones[zone].Contains(point)) {
+      return zone;
+    }
+  }
+  return PolygonIndex2D::kNoZone;
+}
+}  // namespace
+
+TEST(GeometryPolygonIndex2D, Empty) {
+  const PolygonIndex2D kDefault;
+  EXPECT_TRUE(kDefault.Empty());
+  EXPECT_EQ(kDefault.GetCellCount(), 0U);
+  EXPECT_EQ(kDefault.Classify(Point2D(0.0, 0.0)), PolygonIndex2D::kNoZone);
+  EXPECT_EQ(kDefault.Classify(std::vector<Point2D>(3U)),
+            std::vector<uint32_t>(3U, PolygonIndex2D::kNoZone));
+  EXPECT_THROW(static_cast<void>(kDefault.GetZone(0U)), std::out_of_range);
+
+  const PolygonIndex2D kEmptyZones(std::vector<Polygon2D>(2U));
+  EXPECT_EQ(kEmptyZones.Size(), 2U);
+  EXPECT_EQ(kEmptyZones.Classify(Point2D(0.0, 0.0)), PolygonIndex2D::kNoZone);
+}
+
+TEST(GeometryPolygonIndex2D, Random) {
+  // Overlapping stars, every third with a hole
+  std::vector<Polygon2D> zones;
+  for (uint32_t zone = 0; zone < kZoneCount; ++zone) {
+    const Point2D kCenter(Random(kRange), Random(kRange));
+    const auto kRadius = 20.0 + Random(80.0);
+    const auto kCount = 3U + (std::rand() % 60U);
+    if (zone % 3U == 0U) {
+      zones.emplace_back(std::vector<std::vector<Point2D>>{
+          MakeStar(kCenter, kRadius, kCount),
+          MakeStar(kCenter, 0.25 * kRadius, kCount)});
+    } else {
+      zones.emplace_back(MakeStar(kCenter, kRadius, kCount));
+    }
+  }
+  const PolygonIndex2D kIndex(zones);
+  EXPECT_EQ(kIndex.Size(), kZoneCount);
+  EXPECT_GT(kIndex.GetCellCount(), 0U);
+  EXPECT_EQ(kIndex.GetZone(1U).GetPoints(), zones[1].GetPoints());
+
+  std::vector<Point2D> points;
+  std::vector<uint32_t> expected;
+  for (uint32_t i = 0; i < kQueryCount; ++i) {
+    points.emplace_back(Random(1.2 * kRange) - (0.1 * kRange),
+                        Random(1.2 * kRange) - (0.1 * kRange));
+    expected.push_back(BruteForce(zones, points.back()));
+    ASSERT_EQ(kIndex.Classify(points.back()), expected.back()) << i;
+  }
+  for (const auto kThreads : {1U, 4U}) {
+    EXPECT_EQ(kIndex.Classify(points, kThreads), expected);
+    EXPECT_EQ(kIndex.Classify(PointCloud2D(points), kThreads), expected);
+  }
+  EXPECT_EQ(kIndex.Classify(Point2D(std::nan(""), 0.0)),
+            PolygonIndex2D::kNoZone);
+}
+
+TEST(GeometryPolygonIndex2D, Tiles) {
+  // Unit squares sharing edges, with vertices on the grid lines and the
+  // cell centers of the index
+  std::vector<Polygon2D> zones;
+  for (uint32_t i = 0; i < kTileCount * kTileCount; ++i) {
+    const double kX = i % kTileCount;
+    const double kY = i / kTileCount;
+    zones.emplace_back(std::vector<Point2D>{
+        Point2D(kX, kY), Point2D(kX + 0.5, kY), Point2D(kX + 1.0, kY),
+        Point2D(kX + 1.0, kY + 1.0), Point2D(kX, kY + 1.0)});
+  }
+  const PolygonIndex2D kIndex(zones);
+  for (uint32_t i = 0; i < 4U * kTileCount * 4U * kTileCount; ++i) {
+    const auto kX = 0.125 + (0.25 * (i % (4U * kTileCount)));
+    const auto kY = 0.125 + (0.25 * (i / (4U * kTileCount)));
+    EXPECT_EQ(kIndex.Classify(Point2D(kX, kY)),
+              static_cast<uint32_t>(std::floor(kY)) * kTileCount +
+                  static_cast<uint32_t>(std::floor(kX)));
+  }
+
+  // Points on a shared edge go to one of its tiles
+  for (uint32_t i = 1; i < kTileCount; ++i) {
+    const auto kZone = kIndex.Classify(Point2D(i, 2.5));
+    EXPECT_TRUE((kZone == (2U * kTileCount) + i - 1U) ||
+                (kZone == (2U * kTileCount) + i));
+  }
+  EXPECT_EQ(kIndex.Classify(Point2D(-0.5, 2.5)), PolygonIndex2D::kNoZone);
+  EXPECT_EQ(kIndex.Classify(Point2D(5.5, 10.5)), PolygonIndex2D::kNoZone);
+}
+
+TEST(GeometryPolygonIndex2D, Nested) {
+  // A frame with a hole holding a smaller zone, and a zone over both
+  const std::vector<Polygon2D> kZones = {
+      Polygon2D({Point2D(6.0, 6.0), Point2D(9.0, 6.0), Point2D(9.0, 9.0),
+                 Point2D(6.0, 9.0)}),
+      Polygon2D(std::vector<std::vector<Point2D>>{
+          {Point2D(0.0, 0.0), Point2D(10.0, 0.0), Point2D(10.0, 10.0),
+           Point2D(0.0, 10.0)},
+          {Point2D(2.0, 2.0), Point2D(8.0, 2.0), Point2D(8.0, 8.0),
+           Point2D(2.0, 8.0)}}),
+      Polygon2D({Point2D(3.0, 3.0), Point2D(7.0, 3.0), Point2D(7.0, 7.0),
+                 Point2D(3.0, 7.0)})};
+  const PolygonIndex2D kIndex(kZones);
+  EXPECT_EQ(kIndex.Classify(Point2D(1.0, 1.0)), 1U);
+  EXPECT_EQ(kIndex.Classify(Point2D(2.5, 2.5)), PolygonIndex2D::kNoZone);
+  EXPECT_EQ(kIndex.Classify(Point2D(5.0, 5.0)), 2U);
+  EXPECT_EQ(kIndex.Classify(Point2D(6.5, 6.5)), 0U);
+  EXPECT_EQ(kIndex.Classify(Point2D(8.5, 8.5)), 0U);
+  EXPECT_EQ(kIndex.Classify(Point2D(9.5, 9.5)), 1U);
+  EXPECT_EQ(kIndex.Classify(Point2D(7.5, 7.5)), 0U);
+  EXPECT_EQ(kIndex.Classify(Point2D(11.0, 5.0)), PolygonIndex2D::kNoZone);
+}
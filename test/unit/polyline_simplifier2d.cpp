@@ -0,0 +1,192 @@
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/polyline_simplifier2d.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kPointCount = 5000U;
+constexpr double kStep = 10.0;
+constexpr double kTolerance = 15.0;
+
+// Random walk like a sampled vehicle track
+auto MakeTrack(uint32_t count) -> std::vector<Jeong0806::geometry::Point2D> {
+  std::vector<Jeong0806::geometry::Point2D> points;
+  double x = 0.0;
+  double y = 0.0;
+  for (uint32_t i = 0; i < count; ++i) {
+    points.emplace_back(x, y);
+    x += kStep * std::rand() / RAND_MAX;
+    y += kStep * (static_cast<double>(std::rand()) / RAND_MAX - 0.5);
+  }
+  return points;
+}
+
+auto SegmentDistance(const Jeong0806::geometry::Point2D& point,
+                     const Jeong0806::geometry::Point2D& begin,
+                     const Jeong0806::geometry::Point2D& end) -> double {
+  const auto kDx = end.GetX() - begin.GetX();
+  const auto kDy = end.GetY() - begin.GetY();
+  const auto kLengthSquared = (kDx * kDx) + (kDy * kDy);
+  auto t = 0.0;
+  if (kLengthSquared > 0.0) {
+    t = std::clamp((((point.GetX() - begin.GetX()) * kDx) +
+                    ((point.GetY() - begin.GetY()) * kDy)) /
+                       kLengthSquared,
+                   0.0, 1.0);
+  }
+  return point.CalculateDistance(Jeong0806::geometry::Point2D(
+      begin.GetX() + (t * kDx), begin.GetY() + (t * kDy)));
+}
+
+// Every dropped point lies within tolerance of its retained segment
+auto ExpectWithinTolerance(
+    const std::vector<Jeong0806::geometry::Point2D>& points,
+    const std::vector<std::size_t>& indices, double tolerance) -> void {
+  ASSERT_GE(indices.size(), 2U);
+  EXPECT_EQ(indices.front(), 0U);
+  EXPECT_EQ(indices.back(), points.size() - 1U);
+  for (std::size_t i = 0; i + 1U < indices.size(); ++i) {
+    ASSERT_LT(indices[i], indices[i + 1U]);
+    for (auto j = indices[i] + 1U; j < indices[i + 1U]; ++j) {
+      EXPECT_LE(SegmentDistance(points[j], points[indices[i]],
+                                points[indices[i + 1U]]),
+                tolerance + 1.0e-9);
+    }
+  }
+}
+
+// Reference recursive Douglas-Peucker
+auto Recurse(const std::vector<Jeong0806::geometry::Point2D>& points,
+             std::size_t first, std::size_t last, double tolerance,
+             std::vector<std::size_t>& indices) -> void {
+  auto farthest = first;
+  auto farthest_distance = tolerance;
+  for (auto i = first + 1U; i < last; ++i) {
+    const auto kDistance = SegmentDistance(points[i], points[first],
+                                           points[last]);
+    if (kDistance > farthest_distance) {
+      farthest = i;
+      farthest_distance = kDistance;
+    }
+  }
+  if (farthest != first) {
+    Recurse(points, first, farthest, tolerance, indices);
+    indices.push_back(farthest);
+    Recurse(points, farthest, last, tolerance, indices);
+  }
+}
+}  // namespace
+
+namespace Jeong0806::geometry {
+TEST(GeometryPolylineSimplifier2D, Degenerate) {
+  EXPECT_TRUE(PolylineSimplifier2D::SimplifyIndices(std::vector<Point2D>(),
+                                                    Distance(1.0))
+                  .empty());
+  const std::vector<Point2D> kTwo{Point2D(0.0, 0.0), Point2D(1.0, 1.0)};
+  EXPECT_EQ(PolylineSimplifier2D::Simplify(kTwo, Distance(10.0)), kTwo);
+  EXPECT_THROW(static_cast<void>(PolylineSimplifier2D::SimplifyIndices(
+                   kTwo, Distance(-1.0))),
+               std::invalid_argument);
+  EXPECT_THROW(StreamingPolylineSimplifier2D(Distance(-1.0), nullptr),
+               std::invalid_argument);
+  EXPECT_THROW(StreamingPolylineSimplifier2D(
+                   Distance(1.0), nullptr, Distance::DistanceType::kMeter, 0U),
+               std::invalid_argument);
+}
+
+TEST(GeometryPolylineSimplifier2D, DouglasPeucker) {
+  const std::vector<Point2D> kZigzag{Point2D(0.0, 0.0), Point2D(1.0, 0.1),
+                                     Point2D(2.0, -0.1), Point2D(3.0, 5.0),
+                                     Point2D(4.0, 6.0), Point2D(5.0, 7.0),
+                                     Point2D(6.0, 8.1)};
+  EXPECT_EQ(PolylineSimplifier2D::SimplifyIndices(kZigzag, Distance(0.5)),
+            (std::vector<std::size_t>{0U, 2U, 3U, 6U}));
+  // The tolerance is converted to the coordinate unit
+  EXPECT_EQ(PolylineSimplifier2D::SimplifyIndices(
+                kZigzag, Distance(500.0, Distance::DistanceType::kMillimeter),
+                PolylineSimplifier2D::Method::kDouglasPeucker,
+                Distance::DistanceType::kMeter),
+            (std::vector<std::size_t>{0U, 2U, 3U, 6U}));
+
+  const auto kTrack = MakeTrack(kPointCount);
+  const auto kIndices =
+      PolylineSimplifier2D::SimplifyIndices(kTrack, Distance(kTolerance));
+  ExpectWithinTolerance(kTrack, kIndices, kTolerance);
+  EXPECT_LT(kIndices.size(), kTrack.size() / 2U);
+
+  std::vector<std::size_t> expected{0U};
+  Recurse(kTrack, 0U, kTrack.size() - 1U, kTolerance, expected);
+  expected.push_back(kTrack.size() - 1U);
+  EXPECT_EQ(kIndices, expected);
+}
+
+TEST(GeometryPolylineSimplifier2D, Visvalingam) {
+  const std::vector<Point2D> kPoints{Point2D(0.0, 0.0), Point2D(1.0, 0.01),
+                                     Point2D(2.0, 0.0), Point2D(3.0, 4.0),
+                                     Point2D(4.0, 0.0)};
+  EXPECT_EQ(PolylineSimplifier2D::SimplifyIndices(
+                kPoints, Distance(0.5),
+                PolylineSimplifier2D::Method::kVisvalingam),
+            (std::vector<std::size_t>{0U, 2U, 3U, 4U}));
+  EXPECT_EQ(PolylineSimplifier2D::SimplifyIndices(
+                kPoints, Distance(100.0),
+                PolylineSimplifier2D::Method::kVisvalingam),
+            (std::vector<std::size_t>{0U, 4U}));
+
+  const auto kTrack = MakeTrack(kPointCount);
+  const auto kAll = PolylineSimplifier2D::SimplifyIndices(
+      kTrack, Distance(0.0), PolylineSimplifier2D::Method::kVisvalingam);
+  EXPECT_EQ(kAll.size(), kTrack.size());
+  const auto kSimplified = PolylineSimplifier2D::Simplify(
+      kTrack, Distance(kTolerance),
+      PolylineSimplifier2D::Method::kVisvalingam);
+  EXPECT_LT(kSimplified.size(), kTrack.size() / 2U);
+  EXPECT_EQ(kSimplified.front(), kTrack.front());
+  EXPECT_EQ(kSimplified.back(), kTrack.back());
+}
+
+TEST(GeometryPolylineSimplifier2D, Streaming) {
+  constexpr std::size_t kWindowSize = 64U;
+  const auto kTrack = MakeTrack(kPointCount);
+  std::vector<std::size_t> indices;
+  std::vector<Point2D> retained;
+  StreamingPolylineSimplifier2D simplifier(
+      Distance(kTolerance),
+      [&](std::size_t index, const Point2D& point) {
+        indices.push_back(index);
+        retained.push_back(point);
+      },
+      Distance::DistanceType::kMeter, kWindowSize);
+  for (const auto& point : kTrack) {
+    simplifier.Push(point);
+    EXPECT_LT(simplifier.GetBufferedCount(), kWindowSize);
+  }
+  EXPECT_EQ(simplifier.GetInputCount(), kTrack.size());
+  simplifier.Finish();
+  EXPECT_EQ(simplifier.GetBufferedCount(), 0U);
+
+  ExpectWithinTolerance(kTrack, indices, kTolerance);
+  EXPECT_LT(indices.size(), kTrack.size() / 2U);
+  for (std::size_t i = 0; i < indices.size(); ++i) {
+    EXPECT_EQ(retained[i], kTrack[indices[i]]);
+  }
+  for (std::size_t i = 0; i + 1U < indices.size(); ++i) {
+    EXPECT_LE(indices[i + 1U] - indices[i], kWindowSize);
+  }
+
+  // A finished simplifier starts a new polyline
+  indices.clear();
+  simplifier.Push(Point2D(1.0, 1.0));
+  simplifier.Finish();
+  EXPECT_EQ(indices, std::vector<std::size_t>{0U});
+}
+}  // namespace Jeong0806::geometry
@@ -0,0 +1,226 @@
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/predicates2d.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+#include "geometry/instrumentation.hpp"
+#include "geometry/point2d.hpp"
+#include "geometry/point_cloud2d.hpp"
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 1000U;
+// The grid of near-collinear points spans kGridSize ulps in each axis
+constexpr int64_t kGridSize = 64;
+
+#if defined(__SIZEOF_INT128__)
+__extension__ using Int128 = __int128;
+
+auto SignOf(Int128 value) -> int {
+  return static_cast<int>(value > 0) - static_cast<int>(value < 0);
+}
+#endif
+
+auto SignOf(double value) -> int {
+  return static_cast<int>(value > 0.0) - static_cast<int>(value < 0.0);
+}
+
+// Zero when the instrumentation is compiled out
+constexpr auto Expected(uint64_t count) -> uint64_t {
+  return Jeong0806::geometry::Instrumentation::kEnabled ? count : 0U;
+}
+
+auto NaiveOrient(const Jeong0806::geometry::Point2D& a,
+                 const Jeong0806::geometry::Point2D& b,
+                 const Jeong0806::geometry::Point2D& c) -> double {
+  return ((a.GetX() - c.GetX()) * (b.GetY() - c.GetY())) -
+         ((a.GetY() - c.GetY()) * (b.GetX() - c.GetX()));
+}
+
+auto MakeRandomValue() -> double {
+  return static_cast<double>(std::rand()) / RAND_MAX;
+}
+}  // namespace
+
+namespace Jeong0806::geometry {
+TEST(GeometryPredicates2D, Orient2D) {
+  const Point2D kA(0.0, 0.0);
+  const Point2D kB(1.0, 0.0);
+  EXPECT_GT(Predicates2D::Orient2D(kA, kB, Point2D(0.0, 1.0)), 0.0);
+  EXPECT_LT(Predicates2D::Orient2D(kA, kB, Point2D(0.0, -1.0)), 0.0);
+  EXPECT_EQ(Predicates2D::Orient2D(kA, kB, Point2D(7.0, 0.0)), 0.0);
+  EXPECT_DOUBLE_EQ(Predicates2D::Orient2D(kA, kB, Point2D(3.0, 2.0)), 2.0);
+  // Collinear with coordinates whose differences round
+  EXPECT_EQ(Predicates2D::Orient2D(Point2D(0.1, 0.1), Point2D(0.3, 0.3),
+                                   Point2D(0.7, 0.7)),
+            0.0);
+}
+
+#if defined(__SIZEOF_INT128__)
+TEST(GeometryPredicates2D, Orient2DNearCollinear) {
+  // Points ulps apart around 0.5 against a line through (12, 12) and
+  // (24, 24), compared with the exact sign in units of 2^-53
+  constexpr double kUlp = 1.0 / 9007199254740992.0;  // 2^-53
+  constexpr int64_t kScale = int64_t{1} << 53;
+  const Point2D kB(12.0, 12.0);
+  const Point2D kC(24.0, 24.0);
+  const auto kBefore = Instrumentation::TakeSnapshot();
+  uint32_t naive_errors = 0;
+  for (int64_t i = 0; i < kGridSize; ++i) {
+    for (int64_t j = 0; j < kGridSize; ++j) {
+      const Point2D kA(0.5 + (static_cast<double>(i) * kUlp),
+                       0.5 + (static_cast<double>(j) * kUlp));
+      const Int128 kAx = (kScale / 2) + i;
+      const Int128 kAy = (kScale / 2) + j;
+      const Int128 kBc = Int128{12} * kScale;
+      const Int128 kCc = Int128{24} * kScale;
+      const auto kExact =
+          SignOf(((kAx - kCc) * (kBc - kCc)) - ((kAy - kCc) * (kBc - kCc)));
+      EXPECT_EQ(SignOf(Predicates2D::Orient2D(kA, kB, kC)), kExact);
+      // Every permutation agrees
+      EXPECT_EQ(SignOf(Predicates2D::Orient2D(kB, kC, kA)), kExact);
+      EXPECT_EQ(SignOf(Predicates2D::Orient2D(kB, kA, kC)), -kExact);
+      naive_errors += (SignOf(NaiveOrient(kA, kB, kC)) != kExact) ? 1U : 0U;
+    }
+  }
+  // The plain determinant gets some of them wrong
+  EXPECT_GT(naive_errors, 0U);
+  const auto kDelta = Instrumentation::TakeSnapshot() - kBefore;
+  EXPECT_EQ(kDelta.Get(Instrumentation::Counter::kPredicateTests),
+            Expected(3U * kGridSize * kGridSize));
+  EXPECT_GE(kDelta.Get(Instrumentation::Counter::kPredicateFallbacks),
+            Expected(naive_errors));
+}
+#endif
+
+TEST(GeometryPredicates2D, InCircle) {
+  const Point2D kA(1.0, 0.0);
+  const Point2D kB(0.0, 1.0);
+  const Point2D kC(-1.0, 0.0);
+  EXPECT_GT(Predicates2D::InCircle(kA, kB, kC, Point2D(0.0, 0.0)), 0.0);
+  EXPECT_LT(Predicates2D::InCircle(kA, kB, kC, Point2D(2.0, 0.0)), 0.0);
+  EXPECT_EQ(Predicates2D::InCircle(kA, kB, kC, Point2D(0.0, -1.0)), 0.0);
+  // Clockwise circle points flip the sign
+  EXPECT_LT(Predicates2D::InCircle(kC, kB, kA, Point2D(0.0, 0.0)), 0.0);
+}
+
+#if defined(__SIZEOF_INT128__)
+TEST(GeometryPredicates2D, InCircleNearCocircular) {
+  // Rectangle corners are cocircular, and the fourth one moves by at most one
+  // unit. Coordinates up to 2^22 keep the exact determinant within 2^100.
+  constexpr int64_t kRange = int64_t{1} << 22;
+  const auto kBefore = Instrumentation::TakeSnapshot();
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const int64_t kX0 = (std::rand() % (2 * kRange)) - kRange;
+    const int64_t kY0 = (std::rand() % (2 * kRange)) - kRange;
+    const int64_t kX1 = (std::rand() % (2 * kRange)) - kRange;
+    const int64_t kY1 = (std::rand() % (2 * kRange)) - kRange;
+    const int64_t kCorner[4][2] = {{kX0, kY0},
+                                   {kX1, kY0},
+                                   {kX1, kY1},
+                                   {kX0 + (static_cast<int64_t>(i) % 3) - 1,
+                                    kY1 + (static_cast<int64_t>(i / 3U) % 3) -
+                                        1}};
+    Int128 dx[3];
+    Int128 dy[3];
+    Int128 lift[3];
+    for (int k = 0; k < 3; ++k) {
+      dx[k] = kCorner[k][0] - kCorner[3][0];
+      dy[k] = kCorner[k][1] - kCorner[3][1];
+      lift[k] = (dx[k] * dx[k]) + (dy[k] * dy[k]);
+    }
+    const auto kExact =
+        SignOf((lift[0] * ((dx[1] * dy[2]) - (dx[2] * dy[1]))) +
+               (lift[1] * ((dx[2] * dy[0]) - (dx[0] * dy[2]))) +
+               (lift[2] * ((dx[0] * dy[1]) - (dx[1] * dy[0]))));
+    Point2D points[4];
+    for (int k = 0; k < 4; ++k) {
+      points[k] = Point2D(static_cast<double>(kCorner[k][0]),
+                          static_cast<double>(kCorner[k][1]));
+    }
+    EXPECT_EQ(SignOf(Predicates2D::InCircle(points[0], points[1], points[2],
+                                            points[3])),
+              kExact);
+    EXPECT_EQ(SignOf(Predicates2D::InCircle(points[1], points[0], points[2],
+                                            points[3])),
+              -kExact);
+  }
+  const auto kDelta = Instrumentation::TakeSnapshot() - kBefore;
+  // The cocircular ninth of them can not pass the filter
+  EXPECT_GE(kDelta.Get(Instrumentation::Counter::kPredicateFallbacks),
+            Expected(kTestCount / 9U));
+}
+#endif
+
+TEST(GeometryPredicates2D, InCirclePermutations) {
+  // Near-cocircular points far from origin, so differences round too
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const Point2D kCenter(1.0e+6 + MakeRandomValue(),
+                          -1.0e+6 - MakeRandomValue());
+    Point2D points[4];
+    for (auto& point : points) {
+      const auto kAngle = 6.283185307179586 * MakeRandomValue();
+      point = Point2D(kCenter.GetX() + (0.001 * std::cos(kAngle)),
+                      kCenter.GetY() + (0.001 * std::sin(kAngle)));
+    }
+    const auto kSign = SignOf(
+        Predicates2D::InCircle(points[0], points[1], points[2], points[3]));
+    // The lifted determinant changes sign with every transposition
+    EXPECT_EQ(SignOf(Predicates2D::InCircle(points[1], points[2], points[0],
+                                            points[3])),
+              kSign);
+    EXPECT_EQ(SignOf(Predicates2D::InCircle(points[0], points[1], points[3],
+                                            points[2])),
+              -kSign);
+    EXPECT_EQ(SignOf(Predicates2D::InCircle(points[3], points[1], points[2],
+                                            points[0])),
+              -kSign);
+    EXPECT_EQ(SignOf(Predicates2D::Orient2D(points[0], points[1], points[2])),
+              -SignOf(Predicates2D::Orient2D(points[1], points[0], points[2])));
+  }
+}
+
+TEST(GeometryPredicates2D, Batch) {
+  const Point2D kA(0.1, 0.2);
+  const Point2D kB(0.7, 1.4);
+  const Point2D kC(-0.5, 0.9);
+  std::vector<Point2D> points;
+  PointCloud2D cloud;
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    // Every third point lies on the line through kA and kB up to rounding
+    const auto kT = MakeRandomValue();
+    const auto kPoint =
+        (i % 3U == 0U)
+            ? Point2D(0.1 + (0.6 * kT), 0.2 + (1.2 * kT))
+            : Point2D(MakeRandomValue() - 0.5, MakeRandomValue() * 2.0);
+    points.push_back(kPoint);
+    cloud.PushBack(kPoint);
+  }
+
+  for (const std::size_t kThreads : {1U, 4U}) {
+    std::vector<int8_t> orientations(kTestCount);
+    Predicates2D::Orient2D(kA, kB, points.data(), points.size(),
+                           orientations.data(), kThreads);
+    const auto kCloudOrientations =
+        Predicates2D::Orient2D(kA, kB, cloud, kThreads);
+    std::vector<int8_t> circles(kTestCount);
+    Predicates2D::InCircle(kA, kB, kC, points.data(), points.size(),
+                           circles.data(), kThreads);
+    const auto kCloudCircles =
+        Predicates2D::InCircle(kA, kB, kC, cloud, kThreads);
+    for (uint32_t i = 0; i < kTestCount; ++i) {
+      EXPECT_EQ(orientations[i],
+                SignOf(Predicates2D::Orient2D(kA, kB, points[i])));
+      EXPECT_EQ(circles[i],
+                SignOf(Predicates2D::InCircle(kA, kB, kC, points[i])));
+    }
+    EXPECT_EQ(kCloudOrientations, orientations);
+    EXPECT_EQ(kCloudCircles, circles);
+  }
+}
+}  // namespace Jeong0806::geometry
@@ -0,0 +1,115 @@
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/quantity.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <type_traits>
+#include <utility>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 1000U;
+
+template <typename Lhs, typename Rhs, typename = void>
+struct IsAddable : std::false_type {};
+
+template <typename Lhs, typename Rhs>
+struct IsAddable<Lhs, Rhs,
+                 std::void_t<decltype(std::declval<Lhs>() +
+                                      std::declval<Rhs>())>>
+    : std::true_type {};
+}  // namespace
+
+namespace Jeong0806::geometry {
+TEST(GeometryQuantity, ValueType) {
+  static_assert(std::is_trivially_copyable_v<Kilometers>);
+  static_assert(sizeof(Nanometers) == sizeof(double));
+  static_assert(Meters().GetValue() == 0.0);
+  static_assert(Meters(2.5).GetValue() == 2.5);
+  static_assert(Meters::kType == Distance::DistanceType::kMeter);
+}
+
+TEST(GeometryQuantity, UnitMixing) {
+  static_assert(!std::is_convertible_v<Kilometers, Meters>);
+  static_assert(!std::is_convertible_v<double, Meters>);
+  static_assert(!std::is_convertible_v<Distance, Meters>);
+  static_assert(std::is_constructible_v<Meters, Kilometers>);
+  static_assert(std::is_constructible_v<Meters, Distance>);
+  static_assert(IsAddable<Meters, Meters>::value);
+  static_assert(!IsAddable<Meters, Kilometers>::value);
+  static_assert(!IsAddable<Meters, double>::value);
+}
+
+TEST(GeometryQuantity, Conversion) {
+  static_assert(Meters(Kilometers(1.5)) == Meters(1500.0));
+  static_assert(Millimeters(Centimeters(3.0)) == Millimeters(30.0));
+  static_assert(Nanometers(Micrometers(2.0)) == Nanometers(2000.0));
+
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const auto kValue = static_cast<double>(std::rand()) / 3.0;
+
+    EXPECT_DOUBLE_EQ(Kilometers(Meters(kValue)).GetValue(), kValue / 1.0e+3);
+    EXPECT_DOUBLE_EQ(Meters(Kilometers(kValue)).GetValue(), kValue * 1.0e+3);
+    EXPECT_DOUBLE_EQ(Meters(Centimeters(Meters(kValue))).GetValue(), kValue);
+  }
+}
+
+TEST(GeometryQuantity, Distance) {
+  static_assert(Kilometers(1.0).ToDistance() == Distance(1000.0));
+  static_assert(Nanometers(Distance(2.0, Distance::DistanceType::kKilometer)) ==
+                Nanometers(2.0e+12));
+
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const auto kValue = static_cast<double>(std::rand()) / 3.0;
+    const Distance kDistance(kValue, Distance::DistanceType::kMillimeter);
+
+    EXPECT_EQ(Millimeters(kValue).ToDistance(), kDistance);
+    EXPECT_EQ(Nanometers(kValue).ToDistance(),
+              Distance(kValue, Distance::DistanceType::kNanometer));
+    EXPECT_EQ(Millimeters(kDistance).GetValue(),
+              kDistance.GetValue(Distance::DistanceType::kMillimeter));
+    EXPECT_EQ(Kilometers(kDistance).GetValue(),
+              kDistance.GetValue(Distance::DistanceType::kKilometer));
+  }
+}
+
+TEST(GeometryQuantity, Operator) {
+  constexpr Meters kLhs(3.0);
+  constexpr Meters kRhs(1.5);
+
+  static_assert(kLhs + kRhs == Meters(4.5));
+  static_assert(kLhs - kRhs == Meters(1.5));
+  static_assert(-kLhs == Meters(-3.0));
+  static_assert(kLhs * 2.0 == Meters(6.0));
+  static_assert(2.0 * kLhs == Meters(6.0));
+  static_assert(kLhs / 2.0 == Meters(1.5));
+  static_assert(kLhs / kRhs == 2.0);
+  static_assert(kRhs < kLhs && kRhs <= kLhs && kLhs > kRhs && kLhs >= kRhs);
+  static_assert(kLhs != kRhs);
+
+  auto value = kLhs;
+  value += kRhs;
+  EXPECT_EQ(value, Meters(4.5));
+  value -= kLhs;
+  EXPECT_EQ(value, kRhs);
+  value *= 4.0;
+  EXPECT_EQ(value, Meters(6.0));
+  value /= 3.0;
+  EXPECT_EQ(value, Meters(2.0));
+}
+
+TEST(GeometryQuantity, Literal) {
+  using namespace literals;  // NOLINT(build/namespaces)
+
+  static_assert(1.5_km == Kilometers(1.5));
+  static_assert(2.0_m == Meters(2.0));
+  static_assert(3.0_cm == Centimeters(3.0));
+  static_assert(4.0_mm == Millimeters(4.0));
+  static_assert(5.0_um == Micrometers(5.0));
+  static_assert(6.0_nm == Nanometers(6.0));
+  static_assert(Meters(1.5_km) + 2.0_m == 1502.0_m);
+}
+}  // namespace Jeong0806::geometry
@@ -0,0 +1,64 @@
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#ifndef Jeong0806_GEOMETRY_TEST_UNIT_RANDOM_POINTS_HPP_
+#define Jeong0806_GEOMETRY_TEST_UNIT_RANDOM_POINTS_HPP_
+
+#include <cstddef>
+#include <cstdlib>
+#include <vector>
+
+#include "geometry/point2d.hpp"
+#include "geometry/point_cloud2d.hpp"
+
+namespace Jeong0806::geometry::test_helper {
+/**
+ * @brief Make uniformly distributed random points from std::rand
+ * @param count The number of points
+ * @param range The width of the coordinates
+ * @param min The lowest coordinate
+ * @return std::vector<Point2D> The points
+ */
+inline auto MakeRandomPoints(std::size_t count, double range, double min = 0.0)
+    -> std::vector<Point2D> {
+  std::vector<Point2D> points;
+  points.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    points.emplace_back(min + (range * std::rand() / RAND_MAX),
+                        min + (range * std::rand() / RAND_MAX));
+  }
+  return points;
+}
+
+/**
+ * @brief Make uniformly distributed random points in a point cloud
+ * @param count The number of points
+ * @param range The width of the coordinates
+ * @param min The lowest coordinate
+ * @return PointCloud2D The points
+ */
+inline auto MakeRandomPointCloud(std::size_t count, double range,
+                                 double min = 0.0) -> PointCloud2D {
+  return PointCloud2D(MakeRandomPoints(count, range, min));
+}
+
+/**
+ * @brief Make random points with integer coordinates, which have exact
+ * distances and many ties
+ * @param count The number of points
+ * @param range One past the highest coordinate, the lowest being zero
+ * @return std::vector<Point2D> The points
+ */
+inline auto MakeRandomGridPoints(std::size_t count, int range)
+    -> std::vector<Point2D> {
+  std::vector<Point2D> points;
+  points.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    points.emplace_back(static_cast<double>(std::rand() % range),
+                        static_cast<double>(std::rand() % range));
+  }
+  return points;
+}
+}  // namespace Jeong0806::geometry::test_helper
+
+#endif  // Jeong0806_GEOMETRY_TEST_UNIT_RANDOM_POINTS_HPP_
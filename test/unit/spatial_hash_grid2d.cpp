@@ -0,0 +1,150 @@
+// Copyright (c) 2023 Jeong0806, All Rights Reserved.
+// Author Jeong Seong In (0806jsi@gmail.com)
+
+#include "geometry/spatial_hash_grid2d.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "random_points.hpp"
+
+namespace {
+constexpr uint32_t kPointCount = 2000U;
+constexpr uint32_t kQueryCount = 200U;
+constexpr double kRange = 1000.0;
+
+using Jeong0806::geometry::test_helper::MakeRandomPoints;
+
+auto BruteForceRadius(const std::vector<Jeong0806::geometry::Point2D>& points,
+                      const Jeong0806::geometry::Point2D& query, double radius)
+    -> std::vector<Jeong0806::geometry::Neighbor> {
+  std::vector<Jeong0806::geometry::Neighbor> neighbors;
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    const auto kDistance =
+        Jeong0806::geometry::Point2D::CalculateDistance(points[i], query);
+    if (kDistance <= radius) {
+      neighbors.push_back(Jeong0806::geometry::Neighbor{i, kDistance});
+    }
+  }
+  std::sort(neighbors.begin(), neighbors.end());
+  return neighbors;
+}
+
+auto BruteForcePairs(const std::vector<Jeong0806::geometry::Point2D>& points,
+                     double radius)
+    -> std::vector<Jeong0806::geometry::NeighborPair> {
+  std::vector<Jeong0806::geometry::NeighborPair> pairs;
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    for (auto j = i + 1U; j < points.size(); ++j) {
+      const auto kDistance =
+          Jeong0806::geometry::Point2D::CalculateDistance(points[i], points[j]);
+      if (kDistance <= radius) {
+        pairs.push_back(Jeong0806::geometry::NeighborPair{i, j, kDistance});
+      }
+    }
+  }
+  return pairs;
+}
+
+auto ExpectSameIndices(const std::vector<Jeong0806::geometry::Neighbor>& lhs,
+                       const std::vector<Jeong0806::geometry::Neighbor>& rhs)
+    -> void {
+  ASSERT_EQ(lhs.size(), rhs.size());
+  for (std::size_t i = 0; i < lhs.size(); ++i) {
+    EXPECT_EQ(lhs[i].index, rhs[i].index);
+    EXPECT_DOUBLE_EQ(lhs[i].distance, rhs[i].distance);
+  }
+}
+}  // namespace
+
+namespace Jeong0806::geometry {
+TEST(GeometrySpatialHashGrid2D, Constructor) {
+  SpatialHashGrid2D grid1;
+  EXPECT_TRUE(grid1.Empty());
+  EXPECT_TRUE(grid1.Radius(Point2D(), 1.0).empty());
+
+  const auto kPoints = MakeRandomPoints(kPointCount, kRange);
+  SpatialHashGrid2D grid2(kPoints, Distance(10.0));
+  EXPECT_EQ(grid2.Size(), kPoints.size());
+  EXPECT_EQ(grid2.GetCellSize(), Distance(10.0));
+
+  EXPECT_THROW(SpatialHashGrid2D(kPoints, Distance(0.0)),
+               std::invalid_argument);
+  EXPECT_THROW(SpatialHashGrid2D(kPoints, Distance(-1.0)),
+               std::invalid_argument);
+}
+
+TEST(GeometrySpatialHashGrid2D, CellSizeUnit) {
+  const std::vector<Point2D> kPoints = {Point2D(0.0, 0.0), Point2D(0.4, 0.0)};
+  SpatialHashGrid2D grid(kPoints, Distance(500.0),
+                         Distance::DistanceType::kKilometer);
+
+  EXPECT_EQ(grid.Radius(Point2D(), Distance(450.0)).size(), 2U);
+  EXPECT_EQ(grid.Radius(Point2D(), Distance(350.0)).size(), 1U);
+}
+
+TEST(GeometrySpatialHashGrid2D, RadiusDense) {
+  const auto kPoints = MakeRandomPoints(kPointCount, kRange);
+  SpatialHashGrid2D grid(kPoints, Distance(25.0));
+
+  for (uint32_t i = 0; i < kQueryCount; ++i) {
+    const Point2D kQuery(kRange * std::rand() / RAND_MAX,
+                         kRange * std::rand() / RAND_MAX);
+    const auto kRadius = 5.0 * (i % 20U);
+    ExpectSameIndices(grid.Radius(kQuery, kRadius),
+                      BruteForceRadius(kPoints, kQuery, kRadius));
+  }
+}
+
+TEST(GeometrySpatialHashGrid2D, RadiusHashed) {
+  // A tiny cell over a wide extent forces the hashed bucket layout
+  auto points = MakeRandomPoints(kPointCount, kRange);
+  points.emplace_back(1.0e+9, -1.0e+9);
+  SpatialHashGrid2D grid(points, Distance(10.0));
+  EXPECT_LE(grid.GetBucketCount(), 4U * points.size());
+
+  for (uint32_t i = 0; i < kQueryCount; ++i) {
+    const Point2D kQuery(kRange * std::rand() / RAND_MAX,
+                         kRange * std::rand() / RAND_MAX);
+    const auto kRadius = 5.0 * (i % 20U);
+    ExpectSameIndices(grid.Radius(kQuery, kRadius),
+                      BruteForceRadius(points, kQuery, kRadius));
+  }
+  EXPECT_EQ(grid.Radius(Point2D(), 1.0e+10).size(), points.size());
+}
+
+TEST(GeometrySpatialHashGrid2D, PairsWithin) {
+  const auto kPoints = MakeRandomPoints(kPointCount, kRange);
+  SpatialHashGrid2D grid(kPoints, Distance(20.0));
+
+  for (const auto kRadius : {0.0, 5.0, 20.0, 45.0}) {
+    const auto kExpected = BruteForcePairs(kPoints, kRadius);
+    const auto kPairs = grid.PairsWithin(kRadius, 4U);
+    ASSERT_EQ(kPairs.size(), kExpected.size());
+    for (std::size_t i = 0; i < kPairs.size(); ++i) {
+      EXPECT_EQ(kPairs[i].first, kExpected[i].first);
+      EXPECT_EQ(kPairs[i].second, kExpected[i].second);
+      EXPECT_DOUBLE_EQ(kPairs[i].distance, kExpected[i].distance);
+    }
+  }
+  EXPECT_EQ(grid.PairsWithin(Distance(20.0)), grid.PairsWithin(20.0));
+}
+
+TEST(GeometrySpatialHashGrid2D, ParallelConstruction) {
+  const auto kPoints = MakeRandomPoints(1U << 16U, kRange);
+  SpatialHashGrid2D serial(kPoints, Distance(5.0), Distance::DistanceType::kMeter,
+                           1U);
+  SpatialHashGrid2D parallel(kPoints, Distance(5.0),
+                             Distance::DistanceType::kMeter, 4U);
+
+  for (uint32_t i = 0; i < kQueryCount; ++i) {
+    const Point2D kQuery(kRange * std::rand() / RAND_MAX,
+                         kRange * std::rand() / RAND_MAX);
+    EXPECT_EQ(serial.Radius(kQuery, 5.0), parallel.Radius(kQuery, 5.0));
+  }
+}
+}  // namespace Jeong0806::geometry
@@ -0,0 +1,21 @@
+project(
+  benchmark
+  LANGUAGES CXX
+  VERSION 1.7.1
+  DESCRIPTION "Google Benchmark"
+  HOMEPAGE_URL "https://github.com/google/benchmark.git"
+)
+
+set(${PROJECT_NAME}_GIT_TAG v1.7.1 CACHE STRING "benchmark git tag")
+set(${PROJECT_NAME}_PREFIX ${CMAKE_BINARY_DIR}/${PROJECT_NAME}-prefix CACHE STRING "benchmark install prefix")
+set(${PROJECT_NAME}_INSTALL_PATH ${CMAKE_SOURCE_DIR}/thirdparty/install/${CMAKE_BUILD_TYPE}/${PROJECT_NAME} CACHE STRING "benchmark install path")
+set(${PROJECT_NAME}_CMAKE_PATH ${${PROJECT_NAME}_INSTALL_PATH}/lib/cmake/benchmark CACHE STRING "benchmark cmake path")
+set(
+  ${PROJECT_NAME}_CMAKE_ARGS
+  -DCMAKE_INSTALL_PREFIX=${${PROJECT_NAME}_INSTALL_PATH}
+  -DCMAKE_BUILD_TYPE=${CMAKE_BUILD_TYPE}
+  -DBENCHMARK_ENABLE_TESTING=OFF
+  -DBENCHMARK_ENABLE_GTEST_TESTS=OFF)
+
+set(${PROJECT_NAME}_INCLUDE_PATH ${${PROJECT_NAME}_INSTALL_PATH}/include CACHE STRING "benchmark include path")
+set(${PROJECT_NAME}_LIBRARIES benchmark::benchmark CACHE STRING "benchmark library path")